@@ -118,7 +118,7 @@ int libuna_base32_character_copy_to_quintet(
 			else if( ( base32_character >= (uint8_t) 'S' )
 			      && ( base32_character <= (uint8_t) 'V' ) )
 			{
-				*base32_quintet = base32_character - (uint8_t) 'J' + 27;
+				*base32_quintet = base32_character - (uint8_t) 'S' + 28;
 			}
 			else
 			{
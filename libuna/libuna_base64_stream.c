@@ -21,11 +21,13 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libuna_base64_stream.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_simd.h"
 #include "libuna_types.h"
 
 static uint8_t *libuna_base64_sixtet_to_character_table = \
@@ -34,6 +36,48 @@ static uint8_t *libuna_base64_sixtet_to_character_table = \
 static uint8_t *libuna_base64url_sixtet_to_character_table = \
 	(uint8_t *) "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
 
+/* Base64 character to sixtet lookup table used to decode blocks of characters
+ * Characters that are not part of the alphabet are filled with 0xff
+ */
+static const uint8_t libuna_base64_character_to_sixtet_table[ 256 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+/* Base64 URL character to sixtet lookup table used to decode blocks of characters
+ * Characters that are not part of the alphabet are filled with 0xff
+ */
+static const uint8_t libuna_base64url_character_to_sixtet_table[ 256 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0x3f,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
 /* Copies a base64 character to a base64 sixtet
  * Returns 1 if successful or -1 on error
  */
@@ -1183,6 +1227,588 @@ int libuna_base64_triplet_copy_to_byte_stream(
 	return( 1 );
 }
 
+/* Copies the base64 characters at the start of a base64 stream to a byte stream
+ * The characters are decoded in blocks of 4 characters, decoding stops at the first
+ * block that contains a character that is not part of the alphabet, such as padding
+ * or whitespace, or that does not fit in the byte stream, the remainder is left to the caller
+ * Returns the number of base64 characters decoded
+ */
+static size_t libuna_base64_stream_copy_blocks_to_byte_stream(
+               const uint8_t *base64_stream,
+               size_t base64_stream_size,
+               uint8_t *byte_stream,
+               size_t byte_stream_size,
+               uint32_t base64_variant )
+{
+	const uint8_t *character_to_sixtet_table = NULL;
+	size_t base64_stream_index               = 0;
+	size_t byte_stream_index                 = 0;
+	uint32_t base64_triplet                  = 0;
+	uint8_t sixtet1                          = 0;
+	uint8_t sixtet2                          = 0;
+	uint8_t sixtet3                          = 0;
+	uint8_t sixtet4                          = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	uint8_t base64_character_62              = 0;
+	uint8_t base64_character_63              = 0;
+#endif
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit                     = _mm256_setzero_si256();
+	__m256i shift_256bit                     = _mm256_setzero_si256();
+	__m256i valid_256bit                     = _mm256_setzero_si256();
+	__m256i range_256bit                     = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit                     = _mm_setzero_si128();
+	__m128i shift_128bit                     = _mm_setzero_si128();
+	__m128i valid_128bit                     = _mm_setzero_si128();
+	__m128i range_128bit                     = _mm_setzero_si128();
+#endif
+#if defined( LIBUNA_HAVE_SSSE3 )
+	uint32_t value_32bit                     = 0;
+
+#elif defined( LIBUNA_HAVE_SSE2 )
+	uint32_t base64_triplets[ 4 ];
+
+	int triplet_index                        = 0;
+#endif
+
+	switch( base64_variant & 0x000f0000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL:
+			character_to_sixtet_table = libuna_base64_character_to_sixtet_table;
+#if defined( LIBUNA_HAVE_SSE2 )
+			base64_character_62       = (uint8_t) '+';
+			base64_character_63       = (uint8_t) '/';
+#endif
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ALPHABET_URL:
+			character_to_sixtet_table = libuna_base64url_character_to_sixtet_table;
+#if defined( LIBUNA_HAVE_SSE2 )
+			base64_character_62       = (uint8_t) '-';
+			base64_character_63       = (uint8_t) '_';
+#endif
+			break;
+
+		default:
+			return( 0 );
+	}
+	/* The characters are classified by range, characters of 0x80 and above
+	 * are negative as signed bytes and fall outside every range
+	 */
+#if defined( LIBUNA_HAVE_AVX2 )
+	while( ( ( base64_stream_size - base64_stream_index ) >= 32 )
+	    && ( ( byte_stream_size - byte_stream_index ) >= 24 ) )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( base64_stream[ base64_stream_index ] ) );
+
+		range_256bit = _mm256_and_si256(
+		                _mm256_cmpgt_epi8(
+		                 block_256bit,
+		                 _mm256_set1_epi8( (char) ( 'A' - 1 ) ) ),
+		                _mm256_cmpgt_epi8(
+		                 _mm256_set1_epi8( (char) ( 'Z' + 1 ) ),
+		                 block_256bit ) );
+
+		valid_256bit = range_256bit;
+		shift_256bit = _mm256_and_si256(
+		                range_256bit,
+		                _mm256_set1_epi8( (char) ( 0 - 'A' ) ) );
+
+		range_256bit = _mm256_and_si256(
+		                _mm256_cmpgt_epi8(
+		                 block_256bit,
+		                 _mm256_set1_epi8( (char) ( 'a' - 1 ) ) ),
+		                _mm256_cmpgt_epi8(
+		                 _mm256_set1_epi8( (char) ( 'z' + 1 ) ),
+		                 block_256bit ) );
+
+		valid_256bit = _mm256_or_si256(
+		                valid_256bit,
+		                range_256bit );
+		shift_256bit = _mm256_or_si256(
+		                shift_256bit,
+		                _mm256_and_si256(
+		                 range_256bit,
+		                 _mm256_set1_epi8( (char) ( 26 - 'a' ) ) ) );
+
+		range_256bit = _mm256_and_si256(
+		                _mm256_cmpgt_epi8(
+		                 block_256bit,
+		                 _mm256_set1_epi8( (char) ( '0' - 1 ) ) ),
+		                _mm256_cmpgt_epi8(
+		                 _mm256_set1_epi8( (char) ( '9' + 1 ) ),
+		                 block_256bit ) );
+
+		valid_256bit = _mm256_or_si256(
+		                valid_256bit,
+		                range_256bit );
+		shift_256bit = _mm256_or_si256(
+		                shift_256bit,
+		                _mm256_and_si256(
+		                 range_256bit,
+		                 _mm256_set1_epi8( (char) ( 52 - '0' ) ) ) );
+
+		range_256bit = _mm256_cmpeq_epi8(
+		                block_256bit,
+		                _mm256_set1_epi8( (char) base64_character_62 ) );
+
+		valid_256bit = _mm256_or_si256(
+		                valid_256bit,
+		                range_256bit );
+		shift_256bit = _mm256_or_si256(
+		                shift_256bit,
+		                _mm256_and_si256(
+		                 range_256bit,
+		                 _mm256_set1_epi8( (char) ( 62 - base64_character_62 ) ) ) );
+
+		range_256bit = _mm256_cmpeq_epi8(
+		                block_256bit,
+		                _mm256_set1_epi8( (char) base64_character_63 ) );
+
+		valid_256bit = _mm256_or_si256(
+		                valid_256bit,
+		                range_256bit );
+		shift_256bit = _mm256_or_si256(
+		                shift_256bit,
+		                _mm256_and_si256(
+		                 range_256bit,
+		                 _mm256_set1_epi8( (char) ( 63 - base64_character_63 ) ) ) );
+
+		if( _mm256_movemask_epi8( valid_256bit ) != -1 )
+		{
+			break;
+		}
+		block_256bit = _mm256_add_epi8(
+		                block_256bit,
+		                shift_256bit );
+
+		/* Combine the 4 sixtets of every 32-bit value into a 24-bit value
+		 */
+		block_256bit = _mm256_maddubs_epi16(
+		                block_256bit,
+		                _mm256_set1_epi32( 0x01400140L ) );
+
+		block_256bit = _mm256_madd_epi16(
+		                block_256bit,
+		                _mm256_set1_epi32( 0x00011000L ) );
+
+		/* Store the 24-bit values as 3 big-endian bytes
+		 */
+		block_256bit = _mm256_shuffle_epi8(
+		                block_256bit,
+		                _mm256_setr_epi8(
+		                 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		                 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 ) );
+
+		block_256bit = _mm256_permutevar8x32_epi32(
+		                block_256bit,
+		                _mm256_setr_epi32( 0, 1, 2, 4, 5, 6, 3, 7 ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( byte_stream[ byte_stream_index ] ),
+		 _mm256_castsi256_si128(
+		  block_256bit ) );
+
+		_mm_storel_epi64(
+		 (__m128i *) &( byte_stream[ byte_stream_index + 16 ] ),
+		 _mm256_extracti128_si256(
+		  block_256bit,
+		  1 ) );
+
+		base64_stream_index += 32;
+		byte_stream_index   += 24;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( ( base64_stream_size - base64_stream_index ) >= 16 )
+	    && ( ( byte_stream_size - byte_stream_index ) >= 12 ) )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( base64_stream[ base64_stream_index ] ) );
+
+		range_128bit = _mm_and_si128(
+		                _mm_cmpgt_epi8(
+		                 block_128bit,
+		                 _mm_set1_epi8( (char) ( 'A' - 1 ) ) ),
+		                _mm_cmplt_epi8(
+		                 block_128bit,
+		                 _mm_set1_epi8( (char) ( 'Z' + 1 ) ) ) );
+
+		valid_128bit = range_128bit;
+		shift_128bit = _mm_and_si128(
+		                range_128bit,
+		                _mm_set1_epi8( (char) ( 0 - 'A' ) ) );
+
+		range_128bit = _mm_and_si128(
+		                _mm_cmpgt_epi8(
+		                 block_128bit,
+		                 _mm_set1_epi8( (char) ( 'a' - 1 ) ) ),
+		                _mm_cmplt_epi8(
+		                 block_128bit,
+		                 _mm_set1_epi8( (char) ( 'z' + 1 ) ) ) );
+
+		valid_128bit = _mm_or_si128(
+		                valid_128bit,
+		                range_128bit );
+		shift_128bit = _mm_or_si128(
+		                shift_128bit,
+		                _mm_and_si128(
+		                 range_128bit,
+		                 _mm_set1_epi8( (char) ( 26 - 'a' ) ) ) );
+
+		range_128bit = _mm_and_si128(
+		                _mm_cmpgt_epi8(
+		                 block_128bit,
+		                 _mm_set1_epi8( (char) ( '0' - 1 ) ) ),
+		                _mm_cmplt_epi8(
+		                 block_128bit,
+		                 _mm_set1_epi8( (char) ( '9' + 1 ) ) ) );
+
+		valid_128bit = _mm_or_si128(
+		                valid_128bit,
+		                range_128bit );
+		shift_128bit = _mm_or_si128(
+		                shift_128bit,
+		                _mm_and_si128(
+		                 range_128bit,
+		                 _mm_set1_epi8( (char) ( 52 - '0' ) ) ) );
+
+		range_128bit = _mm_cmpeq_epi8(
+		                block_128bit,
+		                _mm_set1_epi8( (char) base64_character_62 ) );
+
+		valid_128bit = _mm_or_si128(
+		                valid_128bit,
+		                range_128bit );
+		shift_128bit = _mm_or_si128(
+		                shift_128bit,
+		                _mm_and_si128(
+		                 range_128bit,
+		                 _mm_set1_epi8( (char) ( 62 - base64_character_62 ) ) ) );
+
+		range_128bit = _mm_cmpeq_epi8(
+		                block_128bit,
+		                _mm_set1_epi8( (char) base64_character_63 ) );
+
+		valid_128bit = _mm_or_si128(
+		                valid_128bit,
+		                range_128bit );
+		shift_128bit = _mm_or_si128(
+		                shift_128bit,
+		                _mm_and_si128(
+		                 range_128bit,
+		                 _mm_set1_epi8( (char) ( 63 - base64_character_63 ) ) ) );
+
+		if( _mm_movemask_epi8( valid_128bit ) != 0xffff )
+		{
+			break;
+		}
+		block_128bit = _mm_add_epi8(
+		                block_128bit,
+		                shift_128bit );
+
+		/* Combine the 4 sixtets of every 32-bit value into a 24-bit value
+		 */
+#if defined( LIBUNA_HAVE_SSSE3 )
+		block_128bit = _mm_maddubs_epi16(
+		                block_128bit,
+		                _mm_set1_epi32( 0x01400140L ) );
+#else
+		block_128bit = _mm_or_si128(
+		                _mm_slli_epi16(
+		                 _mm_and_si128(
+		                  block_128bit,
+		                  _mm_set1_epi16( 0x00ff ) ),
+		                 6 ),
+		                _mm_srli_epi16(
+		                 block_128bit,
+		                 8 ) );
+#endif
+		block_128bit = _mm_madd_epi16(
+		                block_128bit,
+		                _mm_set1_epi32( 0x00011000L ) );
+
+		/* Store the 24-bit values as 3 big-endian bytes
+		 */
+#if defined( LIBUNA_HAVE_SSSE3 )
+		block_128bit = _mm_shuffle_epi8(
+		                block_128bit,
+		                _mm_setr_epi8(
+		                 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 ) );
+
+		_mm_storel_epi64(
+		 (__m128i *) &( byte_stream[ byte_stream_index ] ),
+		 block_128bit );
+
+		value_32bit = (uint32_t) _mm_cvtsi128_si32(
+		                          _mm_srli_si128(
+		                           block_128bit,
+		                           8 ) );
+
+		memory_copy(
+		 &( byte_stream[ byte_stream_index + 8 ] ),
+		 &value_32bit,
+		 4 );
+
+		byte_stream_index += 12;
+#else
+		_mm_storeu_si128(
+		 (__m128i *) base64_triplets,
+		 block_128bit );
+
+		for( triplet_index = 0;
+		     triplet_index < 4;
+		     triplet_index++ )
+		{
+			base64_triplet = base64_triplets[ triplet_index ];
+
+			byte_stream[ byte_stream_index++ ] = (uint8_t) ( base64_triplet >> 16 );
+			byte_stream[ byte_stream_index++ ] = (uint8_t) ( base64_triplet >> 8 );
+			byte_stream[ byte_stream_index++ ] = (uint8_t) base64_triplet;
+		}
+#endif
+		base64_stream_index += 16;
+	}
+#endif
+	while( ( ( base64_stream_size - base64_stream_index ) >= 4 )
+	    && ( ( byte_stream_size - byte_stream_index ) >= 3 ) )
+	{
+		sixtet1 = character_to_sixtet_table[ base64_stream[ base64_stream_index ] ];
+		sixtet2 = character_to_sixtet_table[ base64_stream[ base64_stream_index + 1 ] ];
+		sixtet3 = character_to_sixtet_table[ base64_stream[ base64_stream_index + 2 ] ];
+		sixtet4 = character_to_sixtet_table[ base64_stream[ base64_stream_index + 3 ] ];
+
+		if( ( ( sixtet1 | sixtet2 | sixtet3 | sixtet4 ) & 0x80 ) != 0 )
+		{
+			break;
+		}
+		base64_triplet = ( (uint32_t) sixtet1 << 18 )
+		               | ( (uint32_t) sixtet2 << 12 )
+		               | ( (uint32_t) sixtet3 << 6 )
+		               | sixtet4;
+
+		byte_stream[ byte_stream_index     ] = (uint8_t) ( base64_triplet >> 16 );
+		byte_stream[ byte_stream_index + 1 ] = (uint8_t) ( base64_triplet >> 8 );
+		byte_stream[ byte_stream_index + 2 ] = (uint8_t) base64_triplet;
+
+		base64_stream_index += 4;
+		byte_stream_index   += 3;
+	}
+	return( base64_stream_index );
+}
+
+/* Copies the bytes at the start of a byte stream to a base64 stream
+ * The bytes are encoded in blocks of 3 bytes without padding or end of line
+ * characters, the remainder is left to the caller
+ * Returns the number of bytes encoded
+ */
+static size_t libuna_base64_stream_copy_blocks_from_byte_stream(
+               uint8_t *base64_stream,
+               size_t base64_stream_size,
+               const uint8_t *byte_stream,
+               size_t byte_stream_size,
+               uint32_t base64_variant )
+{
+	uint8_t *sixtet_to_character_table = NULL;
+	size_t base64_stream_index         = 0;
+	size_t byte_stream_index           = 0;
+	uint32_t base64_triplet            = 0;
+
+#if defined( LIBUNA_HAVE_SSSE3 )
+	uint8_t base64_character_62        = 0;
+	uint8_t base64_character_63        = 0;
+#endif
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit               = _mm256_setzero_si256();
+	__m256i offset_256bit              = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSSE3 )
+	__m128i block_128bit               = _mm_setzero_si128();
+	__m128i offset_128bit              = _mm_setzero_si128();
+#endif
+
+	switch( base64_variant & 0x000f0000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL:
+			sixtet_to_character_table = libuna_base64_sixtet_to_character_table;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ALPHABET_URL:
+			sixtet_to_character_table = libuna_base64url_sixtet_to_character_table;
+			break;
+
+		default:
+			return( 0 );
+	}
+#if defined( LIBUNA_HAVE_SSSE3 )
+	base64_character_62 = sixtet_to_character_table[ 62 ];
+	base64_character_63 = sixtet_to_character_table[ 63 ];
+#endif
+
+	/* The 3 bytes of every 32-bit value are spread over 4 sixtets with
+	 * a shuffle and multiplications, then the sixtets are mapped to characters
+	 * by adding the offset of their range
+	 */
+#if defined( LIBUNA_HAVE_AVX2 )
+	while( ( ( byte_stream_size - byte_stream_index ) >= 28 )
+	    && ( ( base64_stream_size - base64_stream_index ) >= 32 ) )
+	{
+		block_256bit = _mm256_inserti128_si256(
+		                _mm256_castsi128_si256(
+		                 _mm_loadu_si128(
+		                  (const __m128i *) &( byte_stream[ byte_stream_index ] ) ) ),
+		                _mm_loadu_si128(
+		                 (const __m128i *) &( byte_stream[ byte_stream_index + 12 ] ) ),
+		                1 );
+
+		block_256bit = _mm256_shuffle_epi8(
+		                block_256bit,
+		                _mm256_setr_epi8(
+		                 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+		                 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 ) );
+
+		block_256bit = _mm256_or_si256(
+		                _mm256_mulhi_epu16(
+		                 _mm256_and_si256(
+		                  block_256bit,
+		                  _mm256_set1_epi32( 0x0fc0fc00L ) ),
+		                 _mm256_set1_epi32( 0x04000040L ) ),
+		                _mm256_mullo_epi16(
+		                 _mm256_and_si256(
+		                  block_256bit,
+		                  _mm256_set1_epi32( 0x003f03f0L ) ),
+		                 _mm256_set1_epi32( 0x01000010L ) ) );
+
+		offset_256bit = _mm256_add_epi8(
+		                 _mm256_set1_epi8( (char) 'A' ),
+		                 _mm256_and_si256(
+		                  _mm256_cmpgt_epi8(
+		                   block_256bit,
+		                   _mm256_set1_epi8( 25 ) ),
+		                  _mm256_set1_epi8( (char) ( ( 'a' - 26 ) - 'A' ) ) ) );
+
+		offset_256bit = _mm256_add_epi8(
+		                 offset_256bit,
+		                 _mm256_and_si256(
+		                  _mm256_cmpgt_epi8(
+		                   block_256bit,
+		                   _mm256_set1_epi8( 51 ) ),
+		                  _mm256_set1_epi8( (char) ( ( '0' - 52 ) - ( 'a' - 26 ) ) ) ) );
+
+		offset_256bit = _mm256_add_epi8(
+		                 offset_256bit,
+		                 _mm256_and_si256(
+		                  _mm256_cmpeq_epi8(
+		                   block_256bit,
+		                   _mm256_set1_epi8( 62 ) ),
+		                  _mm256_set1_epi8( (char) ( ( base64_character_62 - 62 ) - ( '0' - 52 ) ) ) ) );
+
+		offset_256bit = _mm256_add_epi8(
+		                 offset_256bit,
+		                 _mm256_and_si256(
+		                  _mm256_cmpeq_epi8(
+		                   block_256bit,
+		                   _mm256_set1_epi8( 63 ) ),
+		                  _mm256_set1_epi8( (char) ( ( base64_character_63 - 63 ) - ( '0' - 52 ) ) ) ) );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( base64_stream[ base64_stream_index ] ),
+		 _mm256_add_epi8(
+		  block_256bit,
+		  offset_256bit ) );
+
+		byte_stream_index   += 24;
+		base64_stream_index += 32;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSSE3 )
+	while( ( ( byte_stream_size - byte_stream_index ) >= 16 )
+	    && ( ( base64_stream_size - base64_stream_index ) >= 16 ) )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( byte_stream[ byte_stream_index ] ) );
+
+		block_128bit = _mm_shuffle_epi8(
+		                block_128bit,
+		                _mm_setr_epi8(
+		                 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 ) );
+
+		block_128bit = _mm_or_si128(
+		                _mm_mulhi_epu16(
+		                 _mm_and_si128(
+		                  block_128bit,
+		                  _mm_set1_epi32( 0x0fc0fc00L ) ),
+		                 _mm_set1_epi32( 0x04000040L ) ),
+		                _mm_mullo_epi16(
+		                 _mm_and_si128(
+		                  block_128bit,
+		                  _mm_set1_epi32( 0x003f03f0L ) ),
+		                 _mm_set1_epi32( 0x01000010L ) ) );
+
+		offset_128bit = _mm_add_epi8(
+		                 _mm_set1_epi8( (char) 'A' ),
+		                 _mm_and_si128(
+		                  _mm_cmpgt_epi8(
+		                   block_128bit,
+		                   _mm_set1_epi8( 25 ) ),
+		                  _mm_set1_epi8( (char) ( ( 'a' - 26 ) - 'A' ) ) ) );
+
+		offset_128bit = _mm_add_epi8(
+		                 offset_128bit,
+		                 _mm_and_si128(
+		                  _mm_cmpgt_epi8(
+		                   block_128bit,
+		                   _mm_set1_epi8( 51 ) ),
+		                  _mm_set1_epi8( (char) ( ( '0' - 52 ) - ( 'a' - 26 ) ) ) ) );
+
+		offset_128bit = _mm_add_epi8(
+		                 offset_128bit,
+		                 _mm_and_si128(
+		                  _mm_cmpeq_epi8(
+		                   block_128bit,
+		                   _mm_set1_epi8( 62 ) ),
+		                  _mm_set1_epi8( (char) ( ( base64_character_62 - 62 ) - ( '0' - 52 ) ) ) ) );
+
+		offset_128bit = _mm_add_epi8(
+		                 offset_128bit,
+		                 _mm_and_si128(
+		                  _mm_cmpeq_epi8(
+		                   block_128bit,
+		                   _mm_set1_epi8( 63 ) ),
+		                  _mm_set1_epi8( (char) ( ( base64_character_63 - 63 ) - ( '0' - 52 ) ) ) ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( base64_stream[ base64_stream_index ] ),
+		 _mm_add_epi8(
+		  block_128bit,
+		  offset_128bit ) );
+
+		byte_stream_index   += 12;
+		base64_stream_index += 16;
+	}
+#endif
+	while( ( ( byte_stream_size - byte_stream_index ) >= 3 )
+	    && ( ( base64_stream_size - base64_stream_index ) >= 4 ) )
+	{
+		base64_triplet = ( (uint32_t) byte_stream[ byte_stream_index ] << 16 )
+		               | ( (uint32_t) byte_stream[ byte_stream_index + 1 ] << 8 )
+		               | byte_stream[ byte_stream_index + 2 ];
+
+		base64_stream[ base64_stream_index     ] = sixtet_to_character_table[ ( base64_triplet >> 18 ) & 0x3f ];
+		base64_stream[ base64_stream_index + 1 ] = sixtet_to_character_table[ ( base64_triplet >> 12 ) & 0x3f ];
+		base64_stream[ base64_stream_index + 2 ] = sixtet_to_character_table[ ( base64_triplet >> 6 ) & 0x3f ];
+		base64_stream[ base64_stream_index + 3 ] = sixtet_to_character_table[ base64_triplet & 0x3f ];
+
+		byte_stream_index   += 3;
+		base64_stream_index += 4;
+	}
+	return( byte_stream_index );
+}
+
 /* Determines the size of a byte stream from a base64 stream
  *
  * LIBUNA_BASE64_FLAG_STRIP_WHITESPACE removes leading space and tab characters,
@@ -1776,6 +2402,82 @@ int libuna_base64_stream_size_to_byte_stream(
 	return( 1 );
 }
 
+/* Determines the maximum size of a byte stream from a base64 stream
+ * The maximum size is an upper bound that is determined without decoding the base64 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base64_stream_maximum_size_to_byte_stream(
+     size_t base64_stream_size,
+     size_t *byte_stream_size,
+     uint32_t base64_variant,
+     libcerror_error_t **error )
+{
+	static char *function        = "libuna_base64_stream_maximum_size_to_byte_stream";
+	size_t base64_character_size = 0;
+	size_t number_of_characters  = 0;
+
+	if( base64_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base64 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( base64_variant & 0xf0000000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ENCODING_BYTE_STREAM:
+			base64_character_size = 1;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN:
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN:
+			base64_character_size = 2;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN:
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN:
+			base64_character_size = 4;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported base64 variant.",
+			 function );
+
+			return( -1 );
+	}
+	/* Every 4 base64 characters, including whitespace and padding,
+	 * are decoded into at most 3 bytes
+	 */
+	number_of_characters = base64_stream_size / base64_character_size;
+
+	*byte_stream_size = ( number_of_characters / 4 ) * 3;
+
+	if( ( number_of_characters % 4 ) != 0 )
+	{
+		*byte_stream_size += 3;
+	}
+	return( 1 );
+}
+
 /* Copies a byte stream from a base64 stream
  *
  * LIBUNA_BASE64_FLAG_STRIP_WHITESPACE removes leading space and tab characters,
@@ -1792,11 +2494,57 @@ int libuna_base64_stream_copy_to_byte_stream(
      uint8_t flags,
      libcerror_error_t **error )
 {
-	static char *function        = "libuna_base64_stream_copy_to_byte_stream";
+	static char *function    = "libuna_base64_stream_copy_to_byte_stream";
+	size_t byte_stream_index = 0;
+
+	if( libuna_base64_stream_with_index_copy_to_byte_stream(
+	     base64_stream,
+	     base64_stream_size,
+	     byte_stream,
+	     byte_stream_size,
+	     &byte_stream_index,
+	     base64_variant,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream from base64 stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a byte stream from a base64 stream
+ *
+ * LIBUNA_BASE64_FLAG_STRIP_WHITESPACE removes leading space and tab characters,
+ * and trailing space, tab and end of line characters
+ *
+ * The byte stream index is set to the end of the decoded bytes, which allows
+ * to decode into a byte stream of the maximum size in a single pass
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base64_stream_with_index_copy_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     uint32_t base64_variant,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function        = "libuna_base64_stream_with_index_copy_to_byte_stream";
 	size_t base64_character_size = 0;
 	size_t base64_stream_index   = 0;
-	size_t byte_stream_index     = 0;
+	size_t characters_size       = 0;
 	size_t number_of_characters  = 0;
+	size_t stream_index          = 0;
 	size_t whitespace_size       = 0;
 	uint32_t base64_character1   = 0;
 	uint32_t base64_character2   = 0;
@@ -1849,6 +2597,28 @@ int libuna_base64_stream_copy_to_byte_stream(
 
 		return( -1 );
 	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_stream_index > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	switch( base64_variant & 0x000000ffUL )
 	{
 		case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE:
@@ -1983,6 +2753,7 @@ int libuna_base64_stream_copy_to_byte_stream(
 	}
 	base64_stream_size -= whitespace_size;
 	base64_stream_index = 0;
+	stream_index        = *byte_stream_index;
 
 	if( ( flags & LIBUNA_BASE64_FLAG_STRIP_WHITESPACE ) == 0 )
 	{
@@ -1990,6 +2761,34 @@ int libuna_base64_stream_copy_to_byte_stream(
 	}
 	while( base64_stream_index < base64_stream_size )
 	{
+		/* Decode the blocks of 4 base64 characters within a line in bulk,
+		 * padding, whitespace and invalid characters are left to the code below
+		 */
+		if( ( base64_character_size == 1 )
+		 && ( padding_size == 0 )
+		 && ( ( strip_mode == LIBUNA_STRIP_MODE_LEADING_WHITESPACE )
+		  || ( strip_mode == LIBUNA_STRIP_MODE_NON_WHITESPACE ) ) )
+		{
+			characters_size = libuna_base64_stream_copy_blocks_to_byte_stream(
+			                   &( base64_stream[ base64_stream_index ] ),
+			                   base64_stream_size - base64_stream_index,
+			                   &( byte_stream[ stream_index ] ),
+			                   byte_stream_size - stream_index,
+			                   base64_variant );
+
+			if( characters_size > 0 )
+			{
+				base64_stream_index  += characters_size;
+				stream_index    += ( characters_size / 4 ) * 3;
+				number_of_characters += characters_size;
+				strip_mode            = LIBUNA_STRIP_MODE_NON_WHITESPACE;
+
+				if( base64_stream_index >= base64_stream_size )
+				{
+					break;
+				}
+			}
+		}
 		switch( base64_variant & 0xf0000000UL )
 		{
 			case LIBUNA_BASE64_VARIANT_ENCODING_BYTE_STREAM:
@@ -2159,8 +2958,9 @@ int libuna_base64_stream_copy_to_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-				 "%s: unable to copy base64 triplet from base64 stream.",
-				 function );
+				 "%s: unable to copy base64 triplet from base64 stream at index: %" PRIzd ".",
+				 function,
+				 base64_stream_index );
 
 				return( -1 );
 			}
@@ -2170,7 +2970,7 @@ int libuna_base64_stream_copy_to_byte_stream(
 			     base64_triplet,
 			     byte_stream,
 			     byte_stream_size,
-			     &byte_stream_index,
+			     &stream_index,
 			     padding_size,
 			     error ) != 1 )
 			{
@@ -2200,6 +3000,8 @@ int libuna_base64_stream_copy_to_byte_stream(
 			return( -1 );
 		}
 	}
+	*byte_stream_index = stream_index;
+
 	return( 1 );
 }
 
@@ -2418,6 +3220,8 @@ int libuna_base64_stream_with_index_copy_from_byte_stream(
 	size_t base64_character_size         = 0;
 	size_t calculated_base64_stream_size = 0;
 	size_t byte_stream_index             = 0;
+	size_t bytes_size                    = 0;
+	size_t line_size                     = 0;
 	size_t number_of_characters          = 0;
 	size_t remaining_size                = 0;
 	size_t stream_index                  = 0;
@@ -2622,6 +3426,44 @@ int libuna_base64_stream_with_index_copy_from_byte_stream(
 	}
 	while( byte_stream_index < byte_stream_size )
 	{
+		/* Encode the complete triplets in bulk, the last triplet of a line
+		 * is left to the code below so that it adds the end of line character
+		 */
+		if( base64_character_size == 1 )
+		{
+			bytes_size = byte_stream_size - byte_stream_index;
+
+			if( character_limit != 0 )
+			{
+				line_size = ( ( ( character_limit - number_of_characters ) / 4 ) - 1 ) * 3;
+
+				if( bytes_size > line_size )
+				{
+					bytes_size = line_size;
+				}
+			}
+			bytes_size = libuna_base64_stream_copy_blocks_from_byte_stream(
+			              &( base64_stream[ stream_index ] ),
+			              base64_stream_size - stream_index,
+			              &( byte_stream[ byte_stream_index ] ),
+			              bytes_size,
+			              base64_variant );
+
+			if( bytes_size > 0 )
+			{
+				byte_stream_index += bytes_size;
+				stream_index      += ( bytes_size / 3 ) * 4;
+
+				if( character_limit != 0 )
+				{
+					number_of_characters += ( bytes_size / 3 ) * 4;
+				}
+				if( byte_stream_index >= byte_stream_size )
+				{
+					break;
+				}
+			}
+		}
 		/* Convert the byte stream into a base64 triplet
 		 */
 		if( libuna_base64_triplet_copy_from_byte_stream(
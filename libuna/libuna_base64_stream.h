@@ -86,6 +86,13 @@ int libuna_base64_stream_size_to_byte_stream(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_base64_stream_maximum_size_to_byte_stream(
+     size_t base64_stream_size,
+     size_t *byte_stream_size,
+     uint32_t base64_variant,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_base64_stream_copy_to_byte_stream(
      const uint8_t *base64_stream,
@@ -96,6 +103,17 @@ int libuna_base64_stream_copy_to_byte_stream(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_base64_stream_with_index_copy_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     uint32_t base64_variant,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_base64_stream_size_from_byte_stream(
      const uint8_t *byte_stream,
@@ -0,0 +1,1293 @@
+/*
+ * Base16, base32 and base64 stream decoder functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libuna_base16_stream.h"
+#include "libuna_base32_stream.h"
+#include "libuna_base64_stream.h"
+#include "libuna_base_stream_decoder.h"
+#include "libuna_definitions.h"
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+/* Creates a base stream decoder
+ * Make sure the value base_stream_decoder is referencing, is set to NULL
+ * The base variant is a base16, base32 or base64 variant that matches the base format
+ * The flags are the strip whitespace flag of the base format
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_decoder_initialize(
+     libuna_base_stream_decoder_t **base_stream_decoder,
+     int base_format,
+     uint32_t base_variant,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_decoder_t *internal_base_stream_decoder = NULL;
+	static char *function                                               = "libuna_base_stream_decoder_initialize";
+	size_t block_number_of_characters                                   = 0;
+	size_t block_size                                                   = 0;
+	size_t character_limit                                              = 0;
+	size_t character_size                                               = 0;
+	int result                                                          = 0;
+
+	if( base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid base stream decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBUNA_BASE64_FLAG_STRIP_WHITESPACE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	switch( base_format )
+	{
+		case LIBUNA_BASE_FORMAT_BASE16:
+			block_size                 = 1;
+			block_number_of_characters = 2;
+
+			switch( base_variant & 0x000000ffUL )
+			{
+				case LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE:
+				case LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_64:
+				case LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_76:
+					result = 1;
+					break;
+			}
+			switch( base_variant & 0x000f0000UL )
+			{
+				case LIBUNA_BASE16_VARIANT_CASE_LOWER:
+				case LIBUNA_BASE16_VARIANT_CASE_MIXED:
+				case LIBUNA_BASE16_VARIANT_CASE_UPPER:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE32:
+			block_size                 = 5;
+			block_number_of_characters = 8;
+
+			switch( base_variant & 0x000000ffUL )
+			{
+				case LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE:
+				case LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64:
+					result = 1;
+					break;
+			}
+			switch( base_variant & 0x000f0000UL )
+			{
+				case LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL:
+				case LIBUNA_BASE32_VARIANT_ALPHABET_HEX:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			switch( base_variant & 0x0f000000UL )
+			{
+				case LIBUNA_BASE32_VARIANT_PADDING_NONE:
+				case LIBUNA_BASE32_VARIANT_PADDING_OPTIONAL:
+				case LIBUNA_BASE32_VARIANT_PADDING_REQUIRED:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE64:
+			block_size                 = 3;
+			block_number_of_characters = 4;
+
+			switch( base_variant & 0x000000ffUL )
+			{
+				case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE:
+				case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_64:
+				case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_76:
+					result = 1;
+					break;
+			}
+			switch( base_variant & 0x000f0000UL )
+			{
+				case LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL:
+				case LIBUNA_BASE64_VARIANT_ALPHABET_URL:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			switch( base_variant & 0x0f000000UL )
+			{
+				case LIBUNA_BASE64_VARIANT_PADDING_NONE:
+				case LIBUNA_BASE64_VARIANT_PADDING_OPTIONAL:
+				case LIBUNA_BASE64_VARIANT_PADDING_REQUIRED:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported base format: %d.",
+			 function,
+			 base_format );
+
+			return( -1 );
+	}
+	/* The string encoding values are the same for every base format
+	 */
+	switch( base_variant & 0xf0000000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ENCODING_BYTE_STREAM:
+			character_size = 1;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN:
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN:
+			character_size = 2;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN:
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN:
+			character_size = 4;
+			break;
+
+		default:
+			result = 0;
+			break;
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base variant.",
+		 function );
+
+		return( -1 );
+	}
+	/* The character limits are a multiple of the number of characters in a block
+	 */
+	character_limit = (size_t) ( base_variant & 0x000000ffUL );
+
+	internal_base_stream_decoder = memory_allocate_structure(
+	                                libuna_internal_base_stream_decoder_t );
+
+	if( internal_base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create base stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_base_stream_decoder,
+	     0,
+	     sizeof( libuna_internal_base_stream_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear base stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	internal_base_stream_decoder->base_format                = base_format;
+	internal_base_stream_decoder->base_variant               = base_variant;
+	internal_base_stream_decoder->flags                      = flags;
+	internal_base_stream_decoder->block_size                 = block_size;
+	internal_base_stream_decoder->block_number_of_characters = block_number_of_characters;
+	internal_base_stream_decoder->character_size             = character_size;
+	internal_base_stream_decoder->character_limit            = character_limit;
+
+	if( ( flags & LIBUNA_BASE64_FLAG_STRIP_WHITESPACE ) != 0 )
+	{
+		internal_base_stream_decoder->strip_mode = LIBUNA_STRIP_MODE_LEADING_WHITESPACE;
+	}
+	else
+	{
+		internal_base_stream_decoder->strip_mode = LIBUNA_STRIP_MODE_NON_WHITESPACE;
+	}
+	*base_stream_decoder = (libuna_base_stream_decoder_t *) internal_base_stream_decoder;
+
+	return( 1 );
+
+on_error:
+	if( internal_base_stream_decoder != NULL )
+	{
+		memory_free(
+		 internal_base_stream_decoder );
+	}
+	return( -1 );
+}
+
+/* Frees a base stream decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_decoder_free(
+     libuna_base_stream_decoder_t **base_stream_decoder,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_decoder_t *internal_base_stream_decoder = NULL;
+	static char *function                                               = "libuna_base_stream_decoder_free";
+
+	if( base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_decoder != NULL )
+	{
+		internal_base_stream_decoder = (libuna_internal_base_stream_decoder_t *) *base_stream_decoder;
+		*base_stream_decoder         = NULL;
+
+		memory_free(
+		 internal_base_stream_decoder );
+	}
+	return( 1 );
+}
+
+/* Decodes a base stream that is part of a larger base stream into a byte stream
+ * The characters of a block that is split by the end of the base stream are kept
+ * by the base stream decoder and decoded together with the characters of the next base stream
+ * The whitespace and line length checks are the same as when the larger base stream
+ * is decoded at once, whitespace that is only valid at the end of the larger base stream
+ * results in an error when it is followed by another block
+ * Decoding stops at the end of the base stream or when the byte stream is full
+ * The base stream index and byte stream index are set to the end of
+ * the consumed characters and the decoded bytes respectively
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_decoder_decode(
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     const uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t *base_stream_index,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_decoder_t *internal_base_stream_decoder = NULL;
+	const uint8_t *character_data                                       = NULL;
+	static char *function                                               = "libuna_base_stream_decoder_decode";
+	size_t copy_size                                                    = 0;
+	size_t maximum_number_of_characters                                 = 0;
+	size_t number_of_characters                                         = 0;
+	size_t safe_base_stream_index                                       = 0;
+	size_t safe_byte_stream_index                                       = 0;
+	size_t scan_index                                                   = 0;
+	uint32_t base_character                                             = 0;
+	int result                                                          = 0;
+
+	if( base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_base_stream_decoder = (libuna_internal_base_stream_decoder_t *) base_stream_decoder;
+
+	if( base_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_index > base_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: base stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_stream_index > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_base_stream_index = *base_stream_index;
+	safe_byte_stream_index = *byte_stream_index;
+
+	while( safe_base_stream_index < base_stream_size )
+	{
+		if( ( internal_base_stream_decoder->character_buffer_size > 0 )
+		 || ( ( base_stream_size - safe_base_stream_index ) < internal_base_stream_decoder->character_size ) )
+		{
+			/* Complete the character that is split by the end of the base stream
+			 */
+			copy_size = internal_base_stream_decoder->character_size - internal_base_stream_decoder->character_buffer_size;
+
+			if( copy_size > ( base_stream_size - safe_base_stream_index ) )
+			{
+				copy_size = base_stream_size - safe_base_stream_index;
+			}
+			if( copy_size > 0 )
+			{
+				if( memory_copy(
+				     &( internal_base_stream_decoder->character_buffer[ internal_base_stream_decoder->character_buffer_size ] ),
+				     &( base_stream[ safe_base_stream_index ] ),
+				     copy_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy base stream to character buffer.",
+					 function );
+
+					return( -1 );
+				}
+				internal_base_stream_decoder->character_buffer_size += copy_size;
+				safe_base_stream_index                              += copy_size;
+			}
+			if( internal_base_stream_decoder->character_buffer_size < internal_base_stream_decoder->character_size )
+			{
+				break;
+			}
+			character_data = internal_base_stream_decoder->character_buffer;
+		}
+		else
+		{
+			/* Decode the blocks of a sequence of non-whitespace characters in bulk
+			 */
+			if( ( internal_base_stream_decoder->block_buffer_size == 0 )
+			 && ( internal_base_stream_decoder->padding_size == 0 )
+			 && ( internal_base_stream_decoder->invalid_whitespace == 0 )
+			 && ( internal_base_stream_decoder->strip_mode != LIBUNA_STRIP_MODE_TRAILING_WHITESPACE ) )
+			{
+				maximum_number_of_characters = ( base_stream_size - safe_base_stream_index )
+				                             / internal_base_stream_decoder->character_size;
+
+				number_of_characters = ( ( byte_stream_size - safe_byte_stream_index )
+				                     / internal_base_stream_decoder->block_size )
+				                     * internal_base_stream_decoder->block_number_of_characters;
+
+				if( maximum_number_of_characters > number_of_characters )
+				{
+					maximum_number_of_characters = number_of_characters;
+				}
+				scan_index = safe_base_stream_index;
+
+				if( internal_base_stream_decoder->character_size == 1 )
+				{
+					for( number_of_characters = 0;
+					     number_of_characters < maximum_number_of_characters;
+					     number_of_characters++ )
+					{
+						base_character = base_stream[ scan_index ];
+
+						if( ( base_character == (uint32_t) '\n' )
+						 || ( base_character == (uint32_t) '\r' )
+						 || ( base_character == (uint32_t) ' ' )
+						 || ( base_character == (uint32_t) '\t' )
+						 || ( base_character == (uint32_t) '\v' ) )
+						{
+							break;
+						}
+						scan_index++;
+					}
+				}
+				else
+				{
+					for( number_of_characters = 0;
+					     number_of_characters < maximum_number_of_characters;
+					     number_of_characters++ )
+					{
+						base_character = libuna_internal_base_stream_decoder_get_character(
+						                  internal_base_stream_decoder,
+						                  &( base_stream[ scan_index ] ) );
+
+						if( ( base_character == (uint32_t) '\n' )
+						 || ( base_character == (uint32_t) '\r' )
+						 || ( base_character == (uint32_t) ' ' )
+						 || ( base_character == (uint32_t) '\t' )
+						 || ( base_character == (uint32_t) '\v' ) )
+						{
+							break;
+						}
+						scan_index += internal_base_stream_decoder->character_size;
+					}
+				}
+				number_of_characters -= number_of_characters % internal_base_stream_decoder->block_number_of_characters;
+
+				if( number_of_characters > 0 )
+				{
+					if( internal_base_stream_decoder->end_of_line_pending != 0 )
+					{
+						internal_base_stream_decoder->number_of_characters = 0;
+						internal_base_stream_decoder->end_of_line_pending  = 0;
+					}
+					internal_base_stream_decoder->strip_mode  = LIBUNA_STRIP_MODE_NON_WHITESPACE;
+					internal_base_stream_decoder->end_of_line = 0;
+
+					copy_size = number_of_characters * internal_base_stream_decoder->character_size;
+
+					if( libuna_internal_base_stream_decoder_copy_blocks(
+					     internal_base_stream_decoder,
+					     &( base_stream[ safe_base_stream_index ] ),
+					     copy_size,
+					     byte_stream,
+					     byte_stream_size,
+					     &safe_byte_stream_index,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+						 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+						 "%s: unable to copy base stream at index: %" PRIzd " to byte stream.",
+						 function,
+						 safe_base_stream_index );
+
+						return( -1 );
+					}
+					safe_base_stream_index += copy_size;
+
+					continue;
+				}
+			}
+			character_data = &( base_stream[ safe_base_stream_index ] );
+		}
+		result = libuna_internal_base_stream_decoder_copy_character(
+		          internal_base_stream_decoder,
+		          character_data,
+		          byte_stream,
+		          byte_stream_size,
+		          &safe_byte_stream_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy base character at index: %" PRIzd ".",
+			 function,
+			 safe_base_stream_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* The byte stream is too small for the block of the character
+			 * hence the bytes of a split character are left in the base stream
+			 */
+			if( internal_base_stream_decoder->character_buffer_size > 0 )
+			{
+				internal_base_stream_decoder->character_buffer_size -= copy_size;
+				safe_base_stream_index                              -= copy_size;
+			}
+			break;
+		}
+		if( internal_base_stream_decoder->character_buffer_size > 0 )
+		{
+			internal_base_stream_decoder->character_buffer_size = 0;
+		}
+		else
+		{
+			safe_base_stream_index += internal_base_stream_decoder->character_size;
+		}
+	}
+	*base_stream_index = safe_base_stream_index;
+	*byte_stream_index = safe_byte_stream_index;
+
+	return( 1 );
+}
+
+/* Decodes the characters kept by the base stream decoder
+ * This function should be called after the last base stream has been decoded
+ * Whitespace at the end of the base stream is ignored
+ * An error is returned if the characters do not form a valid last block
+ * Afterwards the base stream decoder can be used to decode a new base stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_decoder_finalize(
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_decoder_t *internal_base_stream_decoder = NULL;
+	static char *function                                               = "libuna_base_stream_decoder_finalize";
+	size_t safe_byte_stream_index                                       = 0;
+
+	if( base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_base_stream_decoder = (libuna_internal_base_stream_decoder_t *) base_stream_decoder;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_stream_index > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_base_stream_decoder->character_buffer_size > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing base stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	safe_byte_stream_index = *byte_stream_index;
+
+	if( internal_base_stream_decoder->block_buffer_size > 0 )
+	{
+		if( internal_base_stream_decoder->base_format == LIBUNA_BASE_FORMAT_BASE16 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: missing base16 character.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_base_stream_decoder->block_size > ( byte_stream_size - safe_byte_stream_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: byte stream too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_internal_base_stream_decoder_copy_blocks(
+		     internal_base_stream_decoder,
+		     internal_base_stream_decoder->block_buffer,
+		     internal_base_stream_decoder->block_buffer_size,
+		     byte_stream,
+		     byte_stream_size,
+		     &safe_byte_stream_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy last block to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_base_stream_decoder->character_limit != 0 )
+	{
+		if( internal_base_stream_decoder->number_of_characters > internal_base_stream_decoder->character_limit )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: number of characters in last line exceed maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_base_stream_decoder->flags & LIBUNA_BASE64_FLAG_STRIP_WHITESPACE ) != 0 )
+	{
+		internal_base_stream_decoder->strip_mode = LIBUNA_STRIP_MODE_LEADING_WHITESPACE;
+	}
+	else
+	{
+		internal_base_stream_decoder->strip_mode = LIBUNA_STRIP_MODE_NON_WHITESPACE;
+	}
+	internal_base_stream_decoder->number_of_characters = 0;
+	internal_base_stream_decoder->padding_size         = 0;
+	internal_base_stream_decoder->end_of_line          = 0;
+	internal_base_stream_decoder->end_of_line_pending  = 0;
+	internal_base_stream_decoder->invalid_whitespace   = 0;
+	internal_base_stream_decoder->block_buffer_size    = 0;
+
+	*byte_stream_index = safe_byte_stream_index;
+
+	return( 1 );
+}
+
+/* Retrieves a character from the base stream in the string encoding
+ * of the base stream decoder
+ * Returns the character value
+ */
+uint32_t libuna_internal_base_stream_decoder_get_character(
+          libuna_internal_base_stream_decoder_t *internal_base_stream_decoder,
+          const uint8_t *base_stream )
+{
+	uint32_t base_character = 0;
+
+	switch( internal_base_stream_decoder->base_variant & 0xf0000000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ENCODING_BYTE_STREAM:
+			base_character = base_stream[ 0 ];
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN:
+			byte_stream_copy_to_uint16_big_endian(
+			 base_stream,
+			 base_character );
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN:
+			byte_stream_copy_to_uint16_little_endian(
+			 base_stream,
+			 base_character );
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN:
+			byte_stream_copy_to_uint32_big_endian(
+			 base_stream,
+			 base_character );
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN:
+			byte_stream_copy_to_uint32_little_endian(
+			 base_stream,
+			 base_character );
+			break;
+	}
+	return( base_character );
+}
+
+/* Copies a single base character to the base stream decoder
+ * The block is decoded into the byte stream when the character completes it
+ * Returns 1 if successful, 0 if the byte stream is too small for the block or -1 on error
+ */
+int libuna_internal_base_stream_decoder_copy_character(
+     libuna_internal_base_stream_decoder_t *internal_base_stream_decoder,
+     const uint8_t *base_stream,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_internal_base_stream_decoder_copy_character";
+	uint32_t base_character = 0;
+
+	if( internal_base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	base_character = libuna_internal_base_stream_decoder_get_character(
+	                  internal_base_stream_decoder,
+	                  base_stream );
+
+	if( ( base_character == (uint32_t) '\n' )
+	 || ( base_character == (uint32_t) '\r' ) )
+	{
+		/* A pair of end of line characters is handled as a single end of line
+		 */
+		if( internal_base_stream_decoder->end_of_line != 0 )
+		{
+			internal_base_stream_decoder->end_of_line = 0;
+
+			return( 1 );
+		}
+		if( ( internal_base_stream_decoder->strip_mode != LIBUNA_STRIP_MODE_NON_WHITESPACE )
+		 && ( internal_base_stream_decoder->strip_mode != LIBUNA_STRIP_MODE_TRAILING_WHITESPACE ) )
+		{
+			internal_base_stream_decoder->invalid_whitespace = 1;
+		}
+		else
+		{
+			internal_base_stream_decoder->strip_mode  = LIBUNA_STRIP_MODE_LEADING_WHITESPACE;
+			internal_base_stream_decoder->end_of_line = 1;
+		}
+		if( ( internal_base_stream_decoder->character_limit != 0 )
+		 && ( internal_base_stream_decoder->number_of_characters != internal_base_stream_decoder->character_limit ) )
+		{
+			internal_base_stream_decoder->invalid_whitespace = 1;
+		}
+		internal_base_stream_decoder->end_of_line_pending = 1;
+
+		return( 1 );
+	}
+	internal_base_stream_decoder->end_of_line = 0;
+
+	if( ( base_character == (uint32_t) ' ' )
+	 || ( base_character == (uint32_t) '\t' )
+	 || ( base_character == (uint32_t) '\v' ) )
+	{
+		if( ( internal_base_stream_decoder->flags & LIBUNA_BASE64_FLAG_STRIP_WHITESPACE ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: invalid whitespace character in base stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_base_stream_decoder->strip_mode == LIBUNA_STRIP_MODE_NON_WHITESPACE )
+		{
+			internal_base_stream_decoder->strip_mode = LIBUNA_STRIP_MODE_TRAILING_WHITESPACE;
+		}
+		if( internal_base_stream_decoder->block_buffer_size > 0 )
+		{
+			internal_base_stream_decoder->invalid_whitespace = 1;
+		}
+		return( 1 );
+	}
+	/* Whitespace is only valid at the end of the base stream
+	 * when it is not followed by other characters
+	 */
+	if( ( internal_base_stream_decoder->invalid_whitespace != 0 )
+	 || ( internal_base_stream_decoder->strip_mode == LIBUNA_STRIP_MODE_TRAILING_WHITESPACE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: invalid whitespace or line length in base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_base_stream_decoder->padding_size > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: invalid character after padding in base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_base_stream_decoder->block_buffer_size / internal_base_stream_decoder->character_size ) + 1 ) >= internal_base_stream_decoder->block_number_of_characters )
+	{
+		if( ( *byte_stream_index > byte_stream_size )
+		 || ( internal_base_stream_decoder->block_size > ( byte_stream_size - *byte_stream_index ) ) )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_base_stream_decoder->end_of_line_pending != 0 )
+	{
+		internal_base_stream_decoder->number_of_characters = 0;
+		internal_base_stream_decoder->end_of_line_pending  = 0;
+	}
+	internal_base_stream_decoder->strip_mode = LIBUNA_STRIP_MODE_NON_WHITESPACE;
+
+	if( memory_copy(
+	     &( internal_base_stream_decoder->block_buffer[ internal_base_stream_decoder->block_buffer_size ] ),
+	     base_stream,
+	     internal_base_stream_decoder->character_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy base character to block buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_base_stream_decoder->block_buffer_size += internal_base_stream_decoder->character_size;
+
+	if( ( internal_base_stream_decoder->block_buffer_size / internal_base_stream_decoder->character_size ) >= internal_base_stream_decoder->block_number_of_characters )
+	{
+		if( libuna_internal_base_stream_decoder_copy_blocks(
+		     internal_base_stream_decoder,
+		     internal_base_stream_decoder->block_buffer,
+		     internal_base_stream_decoder->block_buffer_size,
+		     byte_stream,
+		     byte_stream_size,
+		     byte_stream_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy block to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		internal_base_stream_decoder->block_buffer_size = 0;
+	}
+	return( 1 );
+}
+
+/* Copies blocks of base characters without whitespace to the byte stream
+ * in the base format of the base stream decoder
+ * Only the last block can be incomplete or contain padding
+ * The number of characters in the line and the padding size are updated
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_internal_base_stream_decoder_copy_blocks(
+     libuna_internal_base_stream_decoder_t *internal_base_stream_decoder,
+     const uint8_t *base_stream,
+     size_t base_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libuna_internal_base_stream_decoder_copy_blocks";
+	size_t base_stream_index    = 0;
+	size_t number_of_characters = 0;
+	size_t stream_index         = 0;
+	uint64_t base32_quintuplet  = 0;
+	uint32_t base_character     = 0;
+	uint32_t base_variant       = 0;
+	uint8_t base_value          = 0;
+	uint8_t padding_size        = 0;
+	int result                  = 0;
+
+	if( internal_base_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_stream_index > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The base stream decoder checks the line length itself
+	 */
+	base_variant = internal_base_stream_decoder->base_variant & ~( 0x000000ffUL );
+	stream_index = *byte_stream_index;
+
+	/* Optional padding allows the last block to be incomplete
+	 */
+	if( ( ( base_variant & 0x0f000000UL ) == LIBUNA_BASE64_VARIANT_PADDING_OPTIONAL )
+	 && ( ( base_stream_size % ( internal_base_stream_decoder->block_number_of_characters * internal_base_stream_decoder->character_size ) ) != 0 ) )
+	{
+		base_variant &= ~( 0x0f000000UL );
+		base_variant |= LIBUNA_BASE64_VARIANT_PADDING_NONE;
+	}
+	/* Without padding the base32 and base64 block functions stop at the first
+	 * character that is not part of the alphabet hence the characters are checked
+	 */
+	if( ( internal_base_stream_decoder->base_format != LIBUNA_BASE_FORMAT_BASE16 )
+	 && ( ( base_variant & 0x0f000000UL ) == LIBUNA_BASE64_VARIANT_PADDING_NONE ) )
+	{
+		for( base_stream_index = 0;
+		     base_stream_index < base_stream_size;
+		     base_stream_index += internal_base_stream_decoder->character_size )
+		{
+			base_character = libuna_internal_base_stream_decoder_get_character(
+			                  internal_base_stream_decoder,
+			                  &( base_stream[ base_stream_index ] ) );
+
+			if( ( base_character & 0xffffff00UL ) != 0 )
+			{
+				result = -1;
+			}
+			else if( internal_base_stream_decoder->base_format == LIBUNA_BASE_FORMAT_BASE32 )
+			{
+				result = libuna_base32_character_copy_to_quintet(
+				          (uint8_t) base_character,
+				          &base_value,
+				          base_variant,
+				          error );
+			}
+			else
+			{
+				result = libuna_base64_character_copy_to_sixtet(
+				          (uint8_t) base_character,
+				          &base_value,
+				          base_variant,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: invalid character in base stream at index: %" PRIzd ".",
+				 function,
+				 base_stream_index );
+
+				return( -1 );
+			}
+		}
+		base_stream_index = 0;
+	}
+
+	switch( internal_base_stream_decoder->base_format )
+	{
+		case LIBUNA_BASE_FORMAT_BASE16:
+			result = libuna_base16_stream_copy_to_byte_stream(
+			          base_stream,
+			          base_stream_size,
+			          &( byte_stream[ stream_index ] ),
+			          byte_stream_size - stream_index,
+			          base_variant,
+			          0,
+			          error );
+
+			stream_index += base_stream_size / ( internal_base_stream_decoder->character_size * 2 );
+
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE32:
+			result = 1;
+
+			while( base_stream_index < base_stream_size )
+			{
+				if( padding_size > 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+					 "%s: invalid character after padding in base32 stream.",
+					 function );
+
+					return( -1 );
+				}
+				if( libuna_base32_quintuplet_copy_from_base32_stream(
+				     &base32_quintuplet,
+				     base_stream,
+				     base_stream_size,
+				     &base_stream_index,
+				     &padding_size,
+				     base_variant,
+				     error ) != 1 )
+				{
+					result = -1;
+
+					break;
+				}
+				if( libuna_base32_quintuplet_copy_to_byte_stream(
+				     base32_quintuplet,
+				     byte_stream,
+				     byte_stream_size,
+				     &stream_index,
+				     padding_size,
+				     error ) != 1 )
+				{
+					result = -1;
+
+					break;
+				}
+			}
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE64:
+			result = libuna_base64_stream_with_index_copy_to_byte_stream(
+			          base_stream,
+			          base_stream_size,
+			          byte_stream,
+			          byte_stream_size,
+			          &stream_index,
+			          base_variant,
+			          0,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid base stream decoder - unsupported base format.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to copy base stream to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_characters = base_stream_size / internal_base_stream_decoder->character_size;
+
+	/* Padding characters are not counted as characters of the line
+	 * and signal the end of the encoded data
+	 */
+	if( ( internal_base_stream_decoder->base_format != LIBUNA_BASE_FORMAT_BASE16 )
+	 && ( ( base_variant & 0x0f000000UL ) != LIBUNA_BASE64_VARIANT_PADDING_NONE ) )
+	{
+		base_stream_index = base_stream_size;
+
+		while( base_stream_index > 0 )
+		{
+			base_stream_index -= internal_base_stream_decoder->character_size;
+
+			base_character = libuna_internal_base_stream_decoder_get_character(
+			                  internal_base_stream_decoder,
+			                  &( base_stream[ base_stream_index ] ) );
+
+			if( base_character != (uint32_t) '=' )
+			{
+				break;
+			}
+			internal_base_stream_decoder->padding_size += 1;
+
+			number_of_characters--;
+		}
+	}
+	internal_base_stream_decoder->number_of_characters += number_of_characters;
+
+	*byte_stream_index = stream_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,167 @@
+/*
+ * Base16, base32 and base64 stream decoder functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_BASE_STREAM_DECODER_H )
+#define _LIBUNA_BASE_STREAM_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_extern.h"
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libuna_internal_base_stream_decoder libuna_internal_base_stream_decoder_t;
+
+struct libuna_internal_base_stream_decoder
+{
+	/* The base format
+	 */
+	int base_format;
+
+	/* The base variant
+	 */
+	uint32_t base_variant;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The number of bytes in a block
+	 */
+	size_t block_size;
+
+	/* The number of characters in a block
+	 */
+	size_t block_number_of_characters;
+
+	/* The size of a character
+	 */
+	size_t character_size;
+
+	/* The maximum number of characters in a line or 0 if not set
+	 */
+	size_t character_limit;
+
+	/* The number of characters in the current line
+	 */
+	size_t number_of_characters;
+
+	/* The whitespace strip mode
+	 */
+	uint8_t strip_mode;
+
+	/* The padding size of the last block
+	 */
+	uint8_t padding_size;
+
+	/* Value to indicate the previous character was an end of line character
+	 */
+	uint8_t end_of_line;
+
+	/* Value to indicate an end of line character was found after the last block
+	 */
+	uint8_t end_of_line_pending;
+
+	/* Value to indicate whitespace was found that is only valid at the end of the stream
+	 */
+	uint8_t invalid_whitespace;
+
+	/* The buffer that holds the bytes of an incomplete character
+	 */
+	uint8_t character_buffer[ 4 ];
+
+	/* The number of bytes in the character buffer
+	 */
+	size_t character_buffer_size;
+
+	/* The buffer that holds the characters of an incomplete block
+	 */
+	uint8_t block_buffer[ 32 ];
+
+	/* The number of bytes in the block buffer
+	 */
+	size_t block_buffer_size;
+};
+
+LIBUNA_EXTERN \
+int libuna_base_stream_decoder_initialize(
+     libuna_base_stream_decoder_t **base_stream_decoder,
+     int base_format,
+     uint32_t base_variant,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_base_stream_decoder_free(
+     libuna_base_stream_decoder_t **base_stream_decoder,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_base_stream_decoder_decode(
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     const uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t *base_stream_index,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_base_stream_decoder_finalize(
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error );
+
+uint32_t libuna_internal_base_stream_decoder_get_character(
+          libuna_internal_base_stream_decoder_t *internal_base_stream_decoder,
+          const uint8_t *base_stream );
+
+int libuna_internal_base_stream_decoder_copy_character(
+     libuna_internal_base_stream_decoder_t *internal_base_stream_decoder,
+     const uint8_t *base_stream,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error );
+
+int libuna_internal_base_stream_decoder_copy_blocks(
+     libuna_internal_base_stream_decoder_t *internal_base_stream_decoder,
+     const uint8_t *base_stream,
+     size_t base_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_BASE_STREAM_DECODER_H ) */
+
@@ -0,0 +1,1010 @@
+/*
+ * Base16, base32 and base64 stream encoder functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libuna_base16_stream.h"
+#include "libuna_base32_stream.h"
+#include "libuna_base64_stream.h"
+#include "libuna_base_stream_encoder.h"
+#include "libuna_definitions.h"
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+/* Creates a base stream encoder
+ * Make sure the value base_stream_encoder is referencing, is set to NULL
+ * The base variant is a base16, base32 or base64 variant that matches the base format
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_encoder_initialize(
+     libuna_base_stream_encoder_t **base_stream_encoder,
+     int base_format,
+     uint32_t base_variant,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_encoder_t *internal_base_stream_encoder = NULL;
+	static char *function                                               = "libuna_base_stream_encoder_initialize";
+	size_t block_number_of_characters                                   = 0;
+	size_t block_size                                                   = 0;
+	size_t character_limit                                              = 0;
+	size_t character_size                                               = 0;
+	int result                                                          = 0;
+
+	if( base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_encoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid base stream encoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	switch( base_format )
+	{
+		case LIBUNA_BASE_FORMAT_BASE16:
+			block_size                 = 1;
+			block_number_of_characters = 2;
+
+			switch( base_variant & 0x000000ffUL )
+			{
+				case LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE:
+				case LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_64:
+				case LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_76:
+					result = 1;
+					break;
+			}
+			switch( base_variant & 0x000f0000UL )
+			{
+				case LIBUNA_BASE16_VARIANT_CASE_LOWER:
+				case LIBUNA_BASE16_VARIANT_CASE_MIXED:
+				case LIBUNA_BASE16_VARIANT_CASE_UPPER:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE32:
+			block_size                 = 5;
+			block_number_of_characters = 8;
+
+			switch( base_variant & 0x000000ffUL )
+			{
+				case LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE:
+				case LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64:
+					result = 1;
+					break;
+			}
+			switch( base_variant & 0x000f0000UL )
+			{
+				case LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL:
+				case LIBUNA_BASE32_VARIANT_ALPHABET_HEX:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			switch( base_variant & 0x0f000000UL )
+			{
+				case LIBUNA_BASE32_VARIANT_PADDING_NONE:
+				case LIBUNA_BASE32_VARIANT_PADDING_OPTIONAL:
+				case LIBUNA_BASE32_VARIANT_PADDING_REQUIRED:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE64:
+			block_size                 = 3;
+			block_number_of_characters = 4;
+
+			switch( base_variant & 0x000000ffUL )
+			{
+				case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE:
+				case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_64:
+				case LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_76:
+					result = 1;
+					break;
+			}
+			switch( base_variant & 0x000f0000UL )
+			{
+				case LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL:
+				case LIBUNA_BASE64_VARIANT_ALPHABET_URL:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			switch( base_variant & 0x0f000000UL )
+			{
+				case LIBUNA_BASE64_VARIANT_PADDING_NONE:
+				case LIBUNA_BASE64_VARIANT_PADDING_OPTIONAL:
+				case LIBUNA_BASE64_VARIANT_PADDING_REQUIRED:
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported base format: %d.",
+			 function,
+			 base_format );
+
+			return( -1 );
+	}
+	/* The string encoding values are the same for every base format
+	 */
+	switch( base_variant & 0xf0000000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ENCODING_BYTE_STREAM:
+			character_size = 1;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN:
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN:
+			character_size = 2;
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN:
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN:
+			character_size = 4;
+			break;
+
+		default:
+			result = 0;
+			break;
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base variant.",
+		 function );
+
+		return( -1 );
+	}
+	/* The character limits are a multiple of the number of characters in a block
+	 */
+	character_limit = (size_t) ( base_variant & 0x000000ffUL );
+
+	internal_base_stream_encoder = memory_allocate_structure(
+	                                libuna_internal_base_stream_encoder_t );
+
+	if( internal_base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create base stream encoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_base_stream_encoder,
+	     0,
+	     sizeof( libuna_internal_base_stream_encoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear base stream encoder.",
+		 function );
+
+		goto on_error;
+	}
+	internal_base_stream_encoder->base_format                = base_format;
+	internal_base_stream_encoder->base_variant               = base_variant;
+	internal_base_stream_encoder->block_size                 = block_size;
+	internal_base_stream_encoder->block_number_of_characters = block_number_of_characters;
+	internal_base_stream_encoder->character_size             = character_size;
+	internal_base_stream_encoder->character_limit            = character_limit;
+
+	*base_stream_encoder = (libuna_base_stream_encoder_t *) internal_base_stream_encoder;
+
+	return( 1 );
+
+on_error:
+	if( internal_base_stream_encoder != NULL )
+	{
+		memory_free(
+		 internal_base_stream_encoder );
+	}
+	return( -1 );
+}
+
+/* Frees a base stream encoder
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_encoder_free(
+     libuna_base_stream_encoder_t **base_stream_encoder,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_encoder_t *internal_base_stream_encoder = NULL;
+	static char *function                                               = "libuna_base_stream_encoder_free";
+
+	if( base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_encoder != NULL )
+	{
+		internal_base_stream_encoder = (libuna_internal_base_stream_encoder_t *) *base_stream_encoder;
+		*base_stream_encoder         = NULL;
+
+		memory_free(
+		 internal_base_stream_encoder );
+	}
+	return( 1 );
+}
+
+/* Encodes a byte stream that is part of a larger byte stream into a base stream
+ * The bytes of a block that is split by the end of the byte stream are kept
+ * by the base stream encoder and encoded together with the bytes of the next byte stream
+ * The position in the line is kept so that the end of line characters are
+ * at the same positions as when the larger byte stream is encoded at once
+ * Encoding stops at the end of the byte stream or when the base stream is full
+ * The byte stream index and base stream index are set to the end of
+ * the consumed bytes and the encoded characters respectively
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_encoder_encode(
+     libuna_base_stream_encoder_t *base_stream_encoder,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t *base_stream_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_encoder_t *internal_base_stream_encoder = NULL;
+	static char *function                                               = "libuna_base_stream_encoder_encode";
+	size_t block_stream_size                                            = 0;
+	size_t copy_size                                                    = 0;
+	size_t end_of_line_size                                             = 0;
+	size_t line_number_of_blocks                                        = 0;
+	size_t number_of_blocks                                             = 0;
+	size_t remaining_size                                               = 0;
+	size_t safe_base_stream_index                                       = 0;
+	size_t safe_byte_stream_index                                       = 0;
+
+	if( base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream encoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_base_stream_encoder = (libuna_internal_base_stream_encoder_t *) base_stream_encoder;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_stream_index > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: byte stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_index > base_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: base stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_byte_stream_index = *byte_stream_index;
+	safe_base_stream_index = *base_stream_index;
+
+	block_stream_size = internal_base_stream_encoder->block_number_of_characters
+	                  * internal_base_stream_encoder->character_size;
+
+	if( internal_base_stream_encoder->character_limit != 0 )
+	{
+		end_of_line_size = internal_base_stream_encoder->character_size;
+	}
+	while( 1 )
+	{
+		if( internal_base_stream_encoder->buffer_size > 0 )
+		{
+			/* Complete the block that was split by the end of the previous byte stream
+			 */
+			copy_size = internal_base_stream_encoder->block_size - internal_base_stream_encoder->buffer_size;
+
+			if( copy_size > ( byte_stream_size - safe_byte_stream_index ) )
+			{
+				copy_size = byte_stream_size - safe_byte_stream_index;
+			}
+			if( copy_size > 0 )
+			{
+				if( memory_copy(
+				     &( internal_base_stream_encoder->buffer[ internal_base_stream_encoder->buffer_size ] ),
+				     &( byte_stream[ safe_byte_stream_index ] ),
+				     copy_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy byte stream to buffer.",
+					 function );
+
+					return( -1 );
+				}
+				internal_base_stream_encoder->buffer_size += copy_size;
+				safe_byte_stream_index                    += copy_size;
+			}
+			if( internal_base_stream_encoder->buffer_size < internal_base_stream_encoder->block_size )
+			{
+				break;
+			}
+			number_of_blocks = 1;
+		}
+		else
+		{
+			remaining_size = byte_stream_size - safe_byte_stream_index;
+
+			if( remaining_size < internal_base_stream_encoder->block_size )
+			{
+				/* Keep the bytes of the block that is split by the end of the byte stream
+				 */
+				if( remaining_size > 0 )
+				{
+					if( memory_copy(
+					     internal_base_stream_encoder->buffer,
+					     &( byte_stream[ safe_byte_stream_index ] ),
+					     remaining_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy byte stream to buffer.",
+						 function );
+
+						return( -1 );
+					}
+					internal_base_stream_encoder->buffer_size = remaining_size;
+					safe_byte_stream_index                    = byte_stream_size;
+				}
+				break;
+			}
+			number_of_blocks = remaining_size / internal_base_stream_encoder->block_size;
+		}
+		/* Encode at most the blocks up to the end of the line
+		 */
+		if( internal_base_stream_encoder->character_limit != 0 )
+		{
+			line_number_of_blocks = ( internal_base_stream_encoder->character_limit - internal_base_stream_encoder->number_of_characters )
+			                      / internal_base_stream_encoder->block_number_of_characters;
+
+			if( number_of_blocks > line_number_of_blocks )
+			{
+				number_of_blocks = line_number_of_blocks;
+			}
+		}
+		/* The base stream requires space for the end of line character
+		 * and for 1 additional character used by the base64 conversion
+		 */
+		remaining_size = base_stream_size - safe_base_stream_index;
+
+		if( remaining_size < ( end_of_line_size + internal_base_stream_encoder->character_size ) )
+		{
+			break;
+		}
+		remaining_size -= end_of_line_size + internal_base_stream_encoder->character_size;
+
+		if( number_of_blocks > ( remaining_size / block_stream_size ) )
+		{
+			number_of_blocks = remaining_size / block_stream_size;
+		}
+		if( number_of_blocks == 0 )
+		{
+			break;
+		}
+		if( internal_base_stream_encoder->buffer_size > 0 )
+		{
+			if( libuna_internal_base_stream_encoder_copy_blocks(
+			     internal_base_stream_encoder,
+			     internal_base_stream_encoder->buffer,
+			     internal_base_stream_encoder->block_size,
+			     base_stream,
+			     base_stream_size,
+			     &safe_base_stream_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy buffer to base stream.",
+				 function );
+
+				return( -1 );
+			}
+			internal_base_stream_encoder->buffer_size = 0;
+		}
+		else
+		{
+			if( libuna_internal_base_stream_encoder_copy_blocks(
+			     internal_base_stream_encoder,
+			     &( byte_stream[ safe_byte_stream_index ] ),
+			     number_of_blocks * internal_base_stream_encoder->block_size,
+			     base_stream,
+			     base_stream_size,
+			     &safe_base_stream_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy byte stream at index: %" PRIzd " to base stream.",
+				 function,
+				 safe_byte_stream_index );
+
+				return( -1 );
+			}
+			safe_byte_stream_index += number_of_blocks * internal_base_stream_encoder->block_size;
+		}
+		if( internal_base_stream_encoder->character_limit != 0 )
+		{
+			internal_base_stream_encoder->number_of_characters += number_of_blocks
+			                                                    * internal_base_stream_encoder->block_number_of_characters;
+
+			if( internal_base_stream_encoder->number_of_characters >= internal_base_stream_encoder->character_limit )
+			{
+				if( libuna_internal_base_stream_encoder_copy_end_of_line(
+				     internal_base_stream_encoder,
+				     base_stream,
+				     base_stream_size,
+				     &safe_base_stream_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+					 "%s: unable to copy end of line to base stream.",
+					 function );
+
+					return( -1 );
+				}
+				internal_base_stream_encoder->number_of_characters = 0;
+			}
+		}
+	}
+	*byte_stream_index = safe_byte_stream_index;
+	*base_stream_index = safe_base_stream_index;
+
+	return( 1 );
+}
+
+/* Encodes the bytes kept by the base stream encoder including the padding
+ * and the end of line of the last line
+ * This function should be called after the last byte stream has been encoded
+ * Afterwards the base stream encoder can be used to encode a new byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_base_stream_encoder_finalize(
+     libuna_base_stream_encoder_t *base_stream_encoder,
+     uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t *base_stream_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_base_stream_encoder_t *internal_base_stream_encoder = NULL;
+	static char *function                                               = "libuna_base_stream_encoder_finalize";
+	size_t safe_base_stream_index                                       = 0;
+	size_t start_base_stream_index                                      = 0;
+
+	if( base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream encoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_base_stream_encoder = (libuna_internal_base_stream_encoder_t *) base_stream_encoder;
+
+	if( base_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_index > base_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: base stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_base_stream_index = *base_stream_index;
+
+	if( internal_base_stream_encoder->buffer_size > 0 )
+	{
+		start_base_stream_index = safe_base_stream_index;
+
+		if( libuna_internal_base_stream_encoder_copy_blocks(
+		     internal_base_stream_encoder,
+		     internal_base_stream_encoder->buffer,
+		     internal_base_stream_encoder->buffer_size,
+		     base_stream,
+		     base_stream_size,
+		     &safe_base_stream_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy buffer to base stream.",
+			 function );
+
+			return( -1 );
+		}
+		internal_base_stream_encoder->number_of_characters += ( safe_base_stream_index - start_base_stream_index )
+		                                                    / internal_base_stream_encoder->character_size;
+	}
+	if( ( internal_base_stream_encoder->character_limit != 0 )
+	 && ( internal_base_stream_encoder->number_of_characters != 0 ) )
+	{
+		if( libuna_internal_base_stream_encoder_copy_end_of_line(
+		     internal_base_stream_encoder,
+		     base_stream,
+		     base_stream_size,
+		     &safe_base_stream_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy end of line to base stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_base_stream_encoder->buffer_size          = 0;
+	internal_base_stream_encoder->number_of_characters = 0;
+
+	*base_stream_index = safe_base_stream_index;
+
+	return( 1 );
+}
+
+/* Copies bytes to the base stream in the base format of the base stream encoder
+ * The bytes are encoded without end of line characters and are padded if
+ * they do not form a complete block
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_internal_base_stream_encoder_copy_blocks(
+     libuna_internal_base_stream_encoder_t *internal_base_stream_encoder,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t *base_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "libuna_internal_base_stream_encoder_copy_blocks";
+	size_t blocks_stream_index = 0;
+	size_t character_index     = 0;
+	size_t stream_index        = 0;
+	uint32_t base_variant      = 0;
+	uint8_t base_character     = 0;
+	int result                 = 0;
+
+	if( internal_base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *base_stream_index >= base_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: base stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The base stream encoder adds the end of line characters itself
+	 */
+	base_variant = internal_base_stream_encoder->base_variant & ~( 0x000000ffUL );
+
+	switch( internal_base_stream_encoder->base_format )
+	{
+		case LIBUNA_BASE_FORMAT_BASE16:
+			result = libuna_base16_stream_with_index_copy_from_byte_stream(
+			          &( base_stream[ *base_stream_index ] ),
+			          base_stream_size - *base_stream_index,
+			          &blocks_stream_index,
+			          byte_stream,
+			          byte_stream_size,
+			          base_variant,
+			          error );
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE32:
+			/* The base32 quintuplet functions only write byte stream characters
+			 */
+			result = libuna_base32_stream_with_index_copy_from_byte_stream(
+			          &( base_stream[ *base_stream_index ] ),
+			          base_stream_size - *base_stream_index,
+			          &blocks_stream_index,
+			          byte_stream,
+			          byte_stream_size,
+			          base_variant & 0x0fffffffUL,
+			          error );
+			break;
+
+		case LIBUNA_BASE_FORMAT_BASE64:
+			result = libuna_base64_stream_with_index_copy_from_byte_stream(
+			          &( base_stream[ *base_stream_index ] ),
+			          base_stream_size - *base_stream_index,
+			          &blocks_stream_index,
+			          byte_stream,
+			          byte_stream_size,
+			          base_variant,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid base stream encoder - unsupported base format.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+		 "%s: unable to copy byte stream to base stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_base_stream_encoder->base_format == LIBUNA_BASE_FORMAT_BASE32 )
+	 && ( internal_base_stream_encoder->character_size > 1 ) )
+	{
+		if( blocks_stream_index > ( ( base_stream_size - *base_stream_index ) / internal_base_stream_encoder->character_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: base stream too small.",
+			 function );
+
+			return( -1 );
+		}
+		/* Widen the characters in place to the string encoding, starting
+		 * with the last character so no character is overwritten before it is read
+		 */
+		character_index = blocks_stream_index;
+
+		while( character_index > 0 )
+		{
+			character_index--;
+
+			base_character = base_stream[ *base_stream_index + character_index ];
+			stream_index   = *base_stream_index + ( character_index * internal_base_stream_encoder->character_size );
+
+			switch( base_variant & 0xf0000000UL )
+			{
+				case LIBUNA_BASE32_VARIANT_ENCODING_UTF16_BIG_ENDIAN:
+					byte_stream_copy_from_uint16_big_endian(
+					 &( base_stream[ stream_index ] ),
+					 (uint16_t) base_character );
+					break;
+
+				case LIBUNA_BASE32_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN:
+					byte_stream_copy_from_uint16_little_endian(
+					 &( base_stream[ stream_index ] ),
+					 (uint16_t) base_character );
+					break;
+
+				case LIBUNA_BASE32_VARIANT_ENCODING_UTF32_BIG_ENDIAN:
+					byte_stream_copy_from_uint32_big_endian(
+					 &( base_stream[ stream_index ] ),
+					 (uint32_t) base_character );
+					break;
+
+				case LIBUNA_BASE32_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN:
+					byte_stream_copy_from_uint32_little_endian(
+					 &( base_stream[ stream_index ] ),
+					 (uint32_t) base_character );
+					break;
+			}
+		}
+		blocks_stream_index *= internal_base_stream_encoder->character_size;
+	}
+	*base_stream_index += blocks_stream_index;
+
+	return( 1 );
+}
+
+/* Copies an end of line character to the base stream in the string encoding
+ * of the base stream encoder
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_internal_base_stream_encoder_copy_end_of_line(
+     libuna_internal_base_stream_encoder_t *internal_base_stream_encoder,
+     uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t *base_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_internal_base_stream_encoder_copy_end_of_line";
+	size_t stream_index   = 0;
+
+	if( internal_base_stream_encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base stream index.",
+		 function );
+
+		return( -1 );
+	}
+	stream_index = *base_stream_index;
+
+	if( ( internal_base_stream_encoder->character_size > base_stream_size )
+	 || ( stream_index > ( base_stream_size - internal_base_stream_encoder->character_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: base stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_base_stream_encoder->base_variant & 0xf0000000UL )
+	{
+		case LIBUNA_BASE64_VARIANT_ENCODING_BYTE_STREAM:
+			base_stream[ stream_index ] = (uint8_t) '\n';
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN:
+			byte_stream_copy_from_uint16_big_endian(
+			 &( base_stream[ stream_index ] ),
+			 (uint16_t) '\n' );
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN:
+			byte_stream_copy_from_uint16_little_endian(
+			 &( base_stream[ stream_index ] ),
+			 (uint16_t) '\n' );
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN:
+			byte_stream_copy_from_uint32_big_endian(
+			 &( base_stream[ stream_index ] ),
+			 (uint32_t) '\n' );
+			break;
+
+		case LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN:
+			byte_stream_copy_from_uint32_little_endian(
+			 &( base_stream[ stream_index ] ),
+			 (uint32_t) '\n' );
+			break;
+	}
+	*base_stream_index = stream_index + internal_base_stream_encoder->character_size;
+
+	return( 1 );
+}
+
@@ -23,8 +23,10 @@
 #include <types.h>
 
 #include "libuna_byte_stream.h"
+#include "libuna_codepage.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_transcode.h"
 #include "libuna_types.h"
 #include "libuna_unicode_character.h"
 
@@ -38,9 +40,13 @@ int libuna_byte_stream_size_from_utf8(
      size_t *byte_stream_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_byte_stream_size_from_utf8";
-	size_t utf8_string_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                               = "libuna_byte_stream_size_from_utf8";
+	size_t utf8_string_index                            = 0;
+	libuna_unicode_character_t unicode_character        = 0;
+	const uint8_t *unicode_to_byte_stream_page_index    = NULL;
+	const uint8_t *unicode_to_byte_stream_pages         = NULL;
+	const uint16_t *unicode_to_double_byte_stream_pages = NULL;
+	int result                                          = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -75,10 +81,55 @@ int libuna_byte_stream_size_from_utf8(
 
 		return( -1 );
 	}
+	/* Retrieve the lookup table of the codepage once, the characters are then
+	 * converted in bulk without determining the codepage for every character
+	 */
+	result = libuna_codepage_get_unicode_to_byte_stream_table(
+	          codepage,
+	          &unicode_to_byte_stream_page_index,
+	          &unicode_to_byte_stream_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libuna_codepage_get_unicode_to_double_byte_stream_table(
+		          codepage,
+		          &unicode_to_byte_stream_page_index,
+		          &unicode_to_double_byte_stream_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Unicode to byte stream lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	*byte_stream_size = 0;
 
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_to_byte_stream_page_index != NULL )
+		{
+			/* Determine the size of the characters in bulk with the lookup table of the codepage
+			 */
+			libuna_transcode_byte_stream_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 unicode_to_byte_stream_page_index,
+			 unicode_to_double_byte_stream_pages,
+			 byte_stream_size );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -129,10 +180,14 @@ int libuna_byte_stream_copy_from_utf8(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_byte_stream_copy_from_utf8";
-	size_t byte_stream_index                     = 0;
-	size_t utf8_string_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                               = "libuna_byte_stream_copy_from_utf8";
+	size_t byte_stream_index                            = 0;
+	size_t utf8_string_index                            = 0;
+	libuna_unicode_character_t unicode_character        = 0;
+	const uint8_t *unicode_to_byte_stream_page_index    = NULL;
+	const uint8_t *unicode_to_byte_stream_pages         = NULL;
+	const uint16_t *unicode_to_double_byte_stream_pages = NULL;
+	int result                                          = 0;
 
 	if( byte_stream == NULL )
 	{
@@ -178,8 +233,56 @@ int libuna_byte_stream_copy_from_utf8(
 
 		return( -1 );
 	}
+	/* Retrieve the lookup table of the codepage once, the characters are then
+	 * converted in bulk without determining the codepage for every character
+	 */
+	result = libuna_codepage_get_unicode_to_byte_stream_table(
+	          codepage,
+	          &unicode_to_byte_stream_page_index,
+	          &unicode_to_byte_stream_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libuna_codepage_get_unicode_to_double_byte_stream_table(
+		          codepage,
+		          &unicode_to_byte_stream_page_index,
+		          &unicode_to_double_byte_stream_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Unicode to byte stream lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_to_byte_stream_page_index != NULL )
+		{
+			/* Convert the characters in bulk with the lookup table of the codepage
+			 */
+			libuna_transcode_byte_stream_copy_from_utf8(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 unicode_to_byte_stream_page_index,
+			 unicode_to_byte_stream_pages,
+			 unicode_to_double_byte_stream_pages );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -231,9 +334,13 @@ int libuna_byte_stream_size_from_utf16(
      size_t *byte_stream_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_byte_stream_size_from_utf16";
-	size_t utf16_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                               = "libuna_byte_stream_size_from_utf16";
+	size_t utf16_string_index                           = 0;
+	libuna_unicode_character_t unicode_character        = 0;
+	const uint8_t *unicode_to_byte_stream_page_index    = NULL;
+	const uint8_t *unicode_to_byte_stream_pages         = NULL;
+	const uint16_t *unicode_to_double_byte_stream_pages = NULL;
+	int result                                          = 0;
 
 	if( utf16_string == NULL )
 	{
@@ -268,10 +375,55 @@ int libuna_byte_stream_size_from_utf16(
 
 		return( -1 );
 	}
+	/* Retrieve the lookup table of the codepage once, the characters are then
+	 * converted in bulk without determining the codepage for every character
+	 */
+	result = libuna_codepage_get_unicode_to_byte_stream_table(
+	          codepage,
+	          &unicode_to_byte_stream_page_index,
+	          &unicode_to_byte_stream_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libuna_codepage_get_unicode_to_double_byte_stream_table(
+		          codepage,
+		          &unicode_to_byte_stream_page_index,
+		          &unicode_to_double_byte_stream_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Unicode to byte stream lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	*byte_stream_size = 0;
 
 	while( utf16_string_index < utf16_string_size )
 	{
+		if( unicode_to_byte_stream_page_index != NULL )
+		{
+			/* Determine the size of the characters in bulk with the lookup table of the codepage
+			 */
+			libuna_transcode_byte_stream_size_from_utf16(
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index,
+			 unicode_to_byte_stream_page_index,
+			 unicode_to_double_byte_stream_pages,
+			 byte_stream_size );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16(
@@ -322,10 +474,14 @@ int libuna_byte_stream_copy_from_utf16(
      size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_byte_stream_copy_from_utf16";
-	size_t byte_stream_index                     = 0;
-	size_t utf16_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                               = "libuna_byte_stream_copy_from_utf16";
+	size_t byte_stream_index                            = 0;
+	size_t utf16_string_index                           = 0;
+	libuna_unicode_character_t unicode_character        = 0;
+	const uint8_t *unicode_to_byte_stream_page_index    = NULL;
+	const uint8_t *unicode_to_byte_stream_pages         = NULL;
+	const uint16_t *unicode_to_double_byte_stream_pages = NULL;
+	int result                                          = 0;
 
 	if( byte_stream == NULL )
 	{
@@ -371,8 +527,56 @@ int libuna_byte_stream_copy_from_utf16(
 
 		return( -1 );
 	}
+	/* Retrieve the lookup table of the codepage once, the characters are then
+	 * converted in bulk without determining the codepage for every character
+	 */
+	result = libuna_codepage_get_unicode_to_byte_stream_table(
+	          codepage,
+	          &unicode_to_byte_stream_page_index,
+	          &unicode_to_byte_stream_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libuna_codepage_get_unicode_to_double_byte_stream_table(
+		          codepage,
+		          &unicode_to_byte_stream_page_index,
+		          &unicode_to_double_byte_stream_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Unicode to byte stream lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	while( utf16_string_index < utf16_string_size )
 	{
+		if( unicode_to_byte_stream_page_index != NULL )
+		{
+			/* Convert the characters in bulk with the lookup table of the codepage
+			 */
+			libuna_transcode_byte_stream_copy_from_utf16(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index,
+			 unicode_to_byte_stream_page_index,
+			 unicode_to_byte_stream_pages,
+			 unicode_to_double_byte_stream_pages );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16(
@@ -424,9 +628,13 @@ int libuna_byte_stream_size_from_utf32(
      size_t *byte_stream_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_byte_stream_size_from_utf32";
-	size_t utf32_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                               = "libuna_byte_stream_size_from_utf32";
+	size_t utf32_string_index                           = 0;
+	libuna_unicode_character_t unicode_character        = 0;
+	const uint8_t *unicode_to_byte_stream_page_index    = NULL;
+	const uint8_t *unicode_to_byte_stream_pages         = NULL;
+	const uint16_t *unicode_to_double_byte_stream_pages = NULL;
+	int result                                          = 0;
 
 	if( utf32_string == NULL )
 	{
@@ -461,10 +669,55 @@ int libuna_byte_stream_size_from_utf32(
 
 		return( -1 );
 	}
+	/* Retrieve the lookup table of the codepage once, the characters are then
+	 * converted in bulk without determining the codepage for every character
+	 */
+	result = libuna_codepage_get_unicode_to_byte_stream_table(
+	          codepage,
+	          &unicode_to_byte_stream_page_index,
+	          &unicode_to_byte_stream_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libuna_codepage_get_unicode_to_double_byte_stream_table(
+		          codepage,
+		          &unicode_to_byte_stream_page_index,
+		          &unicode_to_double_byte_stream_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Unicode to byte stream lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	*byte_stream_size = 0;
 
 	while( utf32_string_index < utf32_string_size )
 	{
+		if( unicode_to_byte_stream_page_index != NULL )
+		{
+			/* Determine the size of the characters in bulk with the lookup table of the codepage
+			 */
+			libuna_transcode_byte_stream_size_from_utf32(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 unicode_to_byte_stream_page_index,
+			 unicode_to_double_byte_stream_pages,
+			 byte_stream_size );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -515,10 +768,14 @@ int libuna_byte_stream_copy_from_utf32(
      size_t utf32_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_byte_stream_copy_from_utf32";
-	size_t byte_stream_index                     = 0;
-	size_t utf32_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                               = "libuna_byte_stream_copy_from_utf32";
+	size_t byte_stream_index                            = 0;
+	size_t utf32_string_index                           = 0;
+	libuna_unicode_character_t unicode_character        = 0;
+	const uint8_t *unicode_to_byte_stream_page_index    = NULL;
+	const uint8_t *unicode_to_byte_stream_pages         = NULL;
+	const uint16_t *unicode_to_double_byte_stream_pages = NULL;
+	int result                                          = 0;
 
 	if( byte_stream == NULL )
 	{
@@ -564,8 +821,56 @@ int libuna_byte_stream_copy_from_utf32(
 
 		return( -1 );
 	}
+	/* Retrieve the lookup table of the codepage once, the characters are then
+	 * converted in bulk without determining the codepage for every character
+	 */
+	result = libuna_codepage_get_unicode_to_byte_stream_table(
+	          codepage,
+	          &unicode_to_byte_stream_page_index,
+	          &unicode_to_byte_stream_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libuna_codepage_get_unicode_to_double_byte_stream_table(
+		          codepage,
+		          &unicode_to_byte_stream_page_index,
+		          &unicode_to_double_byte_stream_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Unicode to byte stream lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	while( utf32_string_index < utf32_string_size )
 	{
+		if( unicode_to_byte_stream_page_index != NULL )
+		{
+			/* Convert the characters in bulk with the lookup table of the codepage
+			 */
+			libuna_transcode_byte_stream_copy_from_utf32(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 unicode_to_byte_stream_page_index,
+			 unicode_to_byte_stream_pages,
+			 unicode_to_double_byte_stream_pages );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -0,0 +1,52 @@
+/*
+ * Unicode simple case folding functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_CASE_FOLDING_H )
+#define _LIBUNA_CASE_FOLDING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The Unicode characters from this value onwards have no case folded form
+ */
+#define LIBUNA_CASE_FOLDING_MAXIMUM_CHARACTER		0x1e980UL
+
+extern const uint8_t libuna_case_folding_page_index[ 979 ];
+
+extern const uint8_t libuna_case_folding_delta_index[ 38 * 128 ];
+
+extern const int32_t libuna_case_folding_deltas[ 99 ];
+
+libuna_unicode_character_t libuna_case_folding_get_character(
+                            libuna_unicode_character_t unicode_character );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_CASE_FOLDING_H ) */
+
@@ -0,0 +1,464 @@
+/*
+ * Codepage functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_codepage.h"
+#include "libuna_codepage_ascii.h"
+#include "libuna_codepage_iso_8859_1.h"
+#include "libuna_codepage_iso_8859_2.h"
+#include "libuna_codepage_iso_8859_3.h"
+#include "libuna_codepage_iso_8859_4.h"
+#include "libuna_codepage_iso_8859_5.h"
+#include "libuna_codepage_iso_8859_6.h"
+#include "libuna_codepage_iso_8859_7.h"
+#include "libuna_codepage_iso_8859_8.h"
+#include "libuna_codepage_iso_8859_9.h"
+#include "libuna_codepage_iso_8859_10.h"
+#include "libuna_codepage_iso_8859_11.h"
+#include "libuna_codepage_iso_8859_13.h"
+#include "libuna_codepage_iso_8859_14.h"
+#include "libuna_codepage_iso_8859_15.h"
+#include "libuna_codepage_iso_8859_16.h"
+#include "libuna_codepage_koi8_r.h"
+#include "libuna_codepage_koi8_u.h"
+#include "libuna_codepage_windows_874.h"
+#include "libuna_codepage_windows_1250.h"
+#include "libuna_codepage_windows_1251.h"
+#include "libuna_codepage_windows_1252.h"
+#include "libuna_codepage_windows_1253.h"
+#include "libuna_codepage_windows_1254.h"
+#include "libuna_codepage_windows_1255.h"
+#include "libuna_codepage_windows_1256.h"
+#include "libuna_codepage_windows_1257.h"
+#include "libuna_codepage_windows_1258.h"
+#include "libuna_codepage_windows_932.h"
+#include "libuna_codepage_windows_936.h"
+#include "libuna_codepage_windows_949.h"
+#include "libuna_codepage_windows_950.h"
+#include "libuna_definitions.h"
+#include "libuna_libcerror.h"
+
+/* Determines if a codepage is supported
+ * Every supported codepage maps the 7-bit ASCII characters onto the same byte values
+ * Returns 1 if the codepage is supported or 0 if not
+ */
+int libuna_codepage_is_supported(
+     int codepage )
+{
+	switch( codepage )
+	{
+		case LIBUNA_CODEPAGE_WINDOWS_932:
+		case LIBUNA_CODEPAGE_WINDOWS_936:
+		case LIBUNA_CODEPAGE_WINDOWS_949:
+		case LIBUNA_CODEPAGE_WINDOWS_950:
+			return( 1 );
+
+		default:
+			break;
+	}
+	if( libuna_codepage_get_byte_stream_to_unicode_table(
+	     codepage ) != NULL )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the byte stream to Unicode character lookup table of a single-byte codepage
+ * The lookup table contains 256 entries, one for every byte stream byte value
+ * Returns the lookup table or NULL if the codepage is not a supported single-byte codepage
+ */
+const uint16_t *libuna_codepage_get_byte_stream_to_unicode_table(
+                 int codepage )
+{
+	switch( codepage )
+	{
+		case LIBUNA_CODEPAGE_ASCII:
+			return( libuna_codepage_ascii_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_1:
+			return( libuna_codepage_iso_8859_1_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_2:
+			return( libuna_codepage_iso_8859_2_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_3:
+			return( libuna_codepage_iso_8859_3_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_4:
+			return( libuna_codepage_iso_8859_4_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_5:
+			return( libuna_codepage_iso_8859_5_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_6:
+			return( libuna_codepage_iso_8859_6_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_7:
+			return( libuna_codepage_iso_8859_7_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_8:
+			return( libuna_codepage_iso_8859_8_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_9:
+			return( libuna_codepage_iso_8859_9_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_10:
+			return( libuna_codepage_iso_8859_10_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_11:
+			return( libuna_codepage_iso_8859_11_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_13:
+			return( libuna_codepage_iso_8859_13_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_14:
+			return( libuna_codepage_iso_8859_14_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_15:
+			return( libuna_codepage_iso_8859_15_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_ISO_8859_16:
+			return( libuna_codepage_iso_8859_16_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_KOI8_R:
+			return( libuna_codepage_koi8_r_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_KOI8_U:
+			return( libuna_codepage_koi8_u_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_874:
+			return( libuna_codepage_windows_874_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1250:
+			return( libuna_codepage_windows_1250_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1251:
+			return( libuna_codepage_windows_1251_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1252:
+			return( libuna_codepage_windows_1252_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1253:
+			return( libuna_codepage_windows_1253_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1254:
+			return( libuna_codepage_windows_1254_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1255:
+			return( libuna_codepage_windows_1255_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1256:
+			return( libuna_codepage_windows_1256_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1257:
+			return( libuna_codepage_windows_1257_byte_stream_to_unicode );
+
+		case LIBUNA_CODEPAGE_WINDOWS_1258:
+			return( libuna_codepage_windows_1258_byte_stream_to_unicode );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Retrieves the Unicode character to byte stream lookup table of a single-byte codepage
+ * The lookup table consists of a page index of 256 entries, indexed by the upper byte
+ * of a Unicode character in the basic multilingual plane, which contains the number of
+ * the page of 256 entries, indexed by the lower byte, that contains the byte stream byte value
+ * Returns 1 if successful, 0 if the codepage is not a supported single-byte codepage or -1 on error
+ */
+int libuna_codepage_get_unicode_to_byte_stream_table(
+     int codepage,
+     const uint8_t **page_index,
+     const uint8_t **pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_codepage_get_unicode_to_byte_stream_table";
+
+	if( page_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page index.",
+		 function );
+
+		return( -1 );
+	}
+	if( pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pages.",
+		 function );
+
+		return( -1 );
+	}
+	switch( codepage )
+	{
+		case LIBUNA_CODEPAGE_ASCII:
+			*page_index = libuna_codepage_ascii_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_ascii_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_1:
+			*page_index = libuna_codepage_iso_8859_1_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_1_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_2:
+			*page_index = libuna_codepage_iso_8859_2_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_2_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_3:
+			*page_index = libuna_codepage_iso_8859_3_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_3_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_4:
+			*page_index = libuna_codepage_iso_8859_4_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_4_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_5:
+			*page_index = libuna_codepage_iso_8859_5_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_5_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_6:
+			*page_index = libuna_codepage_iso_8859_6_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_6_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_7:
+			*page_index = libuna_codepage_iso_8859_7_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_7_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_8:
+			*page_index = libuna_codepage_iso_8859_8_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_8_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_9:
+			*page_index = libuna_codepage_iso_8859_9_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_9_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_10:
+			*page_index = libuna_codepage_iso_8859_10_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_10_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_11:
+			*page_index = libuna_codepage_iso_8859_11_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_11_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_13:
+			*page_index = libuna_codepage_iso_8859_13_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_13_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_14:
+			*page_index = libuna_codepage_iso_8859_14_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_14_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_15:
+			*page_index = libuna_codepage_iso_8859_15_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_15_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_ISO_8859_16:
+			*page_index = libuna_codepage_iso_8859_16_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_iso_8859_16_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_KOI8_R:
+			*page_index = libuna_codepage_koi8_r_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_koi8_r_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_KOI8_U:
+			*page_index = libuna_codepage_koi8_u_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_koi8_u_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_874:
+			*page_index = libuna_codepage_windows_874_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_874_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1250:
+			*page_index = libuna_codepage_windows_1250_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1250_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1251:
+			*page_index = libuna_codepage_windows_1251_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1251_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1252:
+			*page_index = libuna_codepage_windows_1252_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1252_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1253:
+			*page_index = libuna_codepage_windows_1253_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1253_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1254:
+			*page_index = libuna_codepage_windows_1254_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1254_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1255:
+			*page_index = libuna_codepage_windows_1255_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1255_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1256:
+			*page_index = libuna_codepage_windows_1256_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1256_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1257:
+			*page_index = libuna_codepage_windows_1257_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1257_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_1258:
+			*page_index = libuna_codepage_windows_1258_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_1258_unicode_to_byte_stream;
+
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the Unicode character to byte stream lookup table of a double-byte codepage
+ * The lookup table has the same layout as that of a single-byte codepage, but the entries
+ * contain the 1st byte stream byte in the lower 8 bits and the 2nd byte, if any, in the upper 8 bits
+ * Returns 1 if successful, 0 if the codepage is not a supported double-byte codepage or -1 on error
+ */
+int libuna_codepage_get_unicode_to_double_byte_stream_table(
+     int codepage,
+     const uint8_t **page_index,
+     const uint16_t **pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_codepage_get_unicode_to_double_byte_stream_table";
+
+	if( page_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page index.",
+		 function );
+
+		return( -1 );
+	}
+	if( pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pages.",
+		 function );
+
+		return( -1 );
+	}
+	switch( codepage )
+	{
+		case LIBUNA_CODEPAGE_WINDOWS_932:
+			*page_index = libuna_codepage_windows_932_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_932_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_936:
+			*page_index = libuna_codepage_windows_936_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_936_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_949:
+			*page_index = libuna_codepage_windows_949_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_949_unicode_to_byte_stream;
+
+			break;
+
+		case LIBUNA_CODEPAGE_WINDOWS_950:
+			*page_index = libuna_codepage_windows_950_unicode_to_byte_stream_page_index;
+			*pages      = libuna_codepage_windows_950_unicode_to_byte_stream;
+
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
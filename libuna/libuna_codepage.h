@@ -0,0 +1,57 @@
+/*
+ * Codepage functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_CODEPAGE_H )
+#define _LIBUNA_CODEPAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libuna_codepage_is_supported(
+     int codepage );
+
+const uint16_t *libuna_codepage_get_byte_stream_to_unicode_table(
+                 int codepage );
+
+int libuna_codepage_get_unicode_to_byte_stream_table(
+     int codepage,
+     const uint8_t **page_index,
+     const uint8_t **pages,
+     libcerror_error_t **error );
+
+int libuna_codepage_get_unicode_to_double_byte_stream_table(
+     int codepage,
+     const uint8_t **page_index,
+     const uint16_t **pages,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_CODEPAGE_H ) */
+
@@ -29,9 +29,12 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_iso_8859_10_byte_stream_to_unicode_base_0xa0[ 96 ];
+extern const uint16_t libuna_codepage_iso_8859_10_byte_stream_to_unicode[ 256 ];
+
+extern const uint8_t libuna_codepage_iso_8859_10_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_iso_8859_10_unicode_to_byte_stream[ 4 * 256 ];
 
-extern const uint8_t libuna_codepage_iso_8859_10_unicode_to_byte_stream_base_0x00c0[ 144 ];
 extern const uint8_t libuna_codepage_iso_8859_10_unicode_to_byte_stream_base_0x0160[ 16 ];
 
 #if defined( __cplusplus )
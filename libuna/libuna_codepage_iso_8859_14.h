@@ -29,11 +29,13 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_iso_8859_14_byte_stream_to_unicode_base_0xa0[ 96 ];
+extern const uint16_t libuna_codepage_iso_8859_14_byte_stream_to_unicode[ 256 ];
+
+extern const uint8_t libuna_codepage_iso_8859_14_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_iso_8859_14_unicode_to_byte_stream[ 4 * 256 ];
 
-extern const uint8_t libuna_codepage_iso_8859_14_unicode_to_byte_stream_base_0x00c0[ 64 ];
 extern const uint8_t libuna_codepage_iso_8859_14_unicode_to_byte_stream_base_0x0170[ 8 ];
-extern const uint8_t libuna_codepage_iso_8859_14_unicode_to_byte_stream_base_0x1e80[ 8 ];
 
 #if defined( __cplusplus )
 }
@@ -29,9 +29,11 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_iso_8859_15_byte_stream_to_unicode_base_0xa0[ 32 ];
+extern const uint16_t libuna_codepage_iso_8859_15_byte_stream_to_unicode[ 256 ];
 
-extern const uint8_t libuna_codepage_iso_8859_15_unicode_to_byte_stream_base_0x00a0[ 32 ];
+extern const uint8_t libuna_codepage_iso_8859_15_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_iso_8859_15_unicode_to_byte_stream[ 4 * 256 ];
 
 #if defined( __cplusplus )
 }
@@ -29,9 +29,12 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_koi8_u_byte_stream_to_unicode_base_0x80[ 128 ];
+extern const uint16_t libuna_codepage_koi8_u_byte_stream_to_unicode[ 256 ];
+
+extern const uint8_t libuna_codepage_koi8_u_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_koi8_u_unicode_to_byte_stream[ 6 * 256 ];
 
-extern const uint8_t libuna_codepage_koi8_u_unicode_to_byte_stream_base_0x0410[ 64 ];
 extern const uint8_t libuna_codepage_koi8_u_unicode_to_byte_stream_base_0x2550[ 32 ];
 
 #if defined( __cplusplus )
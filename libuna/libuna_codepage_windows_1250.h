@@ -29,13 +29,14 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_windows_1250_byte_stream_to_unicode_base_0x80[ 128 ];
+extern const uint16_t libuna_codepage_windows_1250_byte_stream_to_unicode[ 256 ];
+
+extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream[ 6 * 256 ];
 
-extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x00a0[ 128 ];
 extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x0138[ 72 ];
-extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x02d8[ 8 ];
 extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x2010[ 24 ];
-extern const uint8_t libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x2030[ 16 ];
 
 #if defined( __cplusplus )
 }
@@ -29,9 +29,11 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_windows_1252_byte_stream_to_unicode_base_0x80[ 32 ];
+extern const uint16_t libuna_codepage_windows_1252_byte_stream_to_unicode[ 256 ];
 
-extern const uint8_t libuna_codepage_windows_1252_unicode_to_byte_stream_base_0x2010[ 24 ];
+extern const uint8_t libuna_codepage_windows_1252_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_windows_1252_unicode_to_byte_stream[ 6 * 256 ];
 
 #if defined( __cplusplus )
 }
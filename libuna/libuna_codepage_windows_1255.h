@@ -29,11 +29,13 @@
 extern "C" {
 #endif
 
-extern const uint16_t libuna_codepage_windows_1255_byte_stream_to_unicode_base_0x80[ 128 ];
+extern const uint16_t libuna_codepage_windows_1255_byte_stream_to_unicode[ 256 ];
+
+extern const uint8_t libuna_codepage_windows_1255_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint8_t libuna_codepage_windows_1255_unicode_to_byte_stream[ 7 * 256 ];
 
-extern const uint8_t libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x00a0[ 32 ];
 extern const uint8_t libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x05b0[ 24 ];
-extern const uint8_t libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x05d0[ 40 ];
 extern const uint8_t libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x2010[ 24 ];
 
 #if defined( __cplusplus )
@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+extern const uint8_t libuna_codepage_windows_949_unicode_to_byte_stream_page_index[ 256 ];
+
+extern const uint16_t libuna_codepage_windows_949_unicode_to_byte_stream[ 146 * 256 ];
+
 LIBUNA_EXTERN \
 int libuna_codepage_windows_949_unicode_character_size_to_byte_stream(
      libuna_unicode_character_t unicode_character,
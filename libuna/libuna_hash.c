@@ -0,0 +1,1462 @@
+/*
+ * Unicode string hash functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libuna_codepage.h"
+#include "libuna_definitions.h"
+#include "libuna_hash.h"
+#include "libuna_libcerror.h"
+#include "libuna_transcode.h"
+#include "libuna_types.h"
+#include "libuna_unicode_character.h"
+
+#define libuna_hash_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+/* Mixes an input value into an accumulator
+ * Returns the accumulator
+ */
+static uint64_t libuna_hash_round(
+                 uint64_t accumulator,
+                 uint64_t input )
+{
+	accumulator += input * LIBUNA_HASH_PRIME64_2;
+	accumulator  = libuna_hash_rotate_left( accumulator, 31 );
+	accumulator *= LIBUNA_HASH_PRIME64_1;
+
+	return( accumulator );
+}
+
+/* Merges an accumulator into the hash
+ * Returns the hash
+ */
+static uint64_t libuna_hash_merge_round(
+                 uint64_t hash,
+                 uint64_t accumulator )
+{
+	hash ^= libuna_hash_round(
+	         0,
+	         accumulator );
+
+	hash = ( hash * LIBUNA_HASH_PRIME64_1 ) + LIBUNA_HASH_PRIME64_4;
+
+	return( hash );
+}
+
+/* Mixes a stripe of 32 bytes into the accumulators
+ */
+static void libuna_hash_context_update_stripe(
+             libuna_hash_context_t *context,
+             const uint8_t *stripe )
+{
+	uint64_t value_64bit = 0;
+	int accumulator_index = 0;
+
+	for( accumulator_index = 0;
+	     accumulator_index < 4;
+	     accumulator_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( stripe[ accumulator_index * 8 ] ),
+		 value_64bit );
+
+		context->accumulators[ accumulator_index ] = libuna_hash_round(
+		                                              context->accumulators[ accumulator_index ],
+		                                              value_64bit );
+	}
+}
+
+/* Initializes a hash context
+ */
+void libuna_hash_context_initialize(
+      libuna_hash_context_t *context )
+{
+	context->accumulators[ 0 ] = LIBUNA_HASH_PRIME64_1 + LIBUNA_HASH_PRIME64_2;
+	context->accumulators[ 1 ] = LIBUNA_HASH_PRIME64_2;
+	context->accumulators[ 2 ] = 0;
+	context->accumulators[ 3 ] = (uint64_t) 0 - LIBUNA_HASH_PRIME64_1;
+	context->number_of_bytes   = 0;
+	context->block_size        = 0;
+}
+
+/* Updates a hash context with data
+ */
+void libuna_hash_context_update(
+      libuna_hash_context_t *context,
+      const uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	size_t read_size   = 0;
+
+	context->number_of_bytes += data_size;
+
+	if( context->block_size > 0 )
+	{
+		read_size = 32 - context->block_size;
+
+		if( read_size > data_size )
+		{
+			read_size = data_size;
+		}
+		memory_copy(
+		 &( context->block[ context->block_size ] ),
+		 data,
+		 read_size );
+
+		context->block_size += read_size;
+		data_offset         += read_size;
+
+		if( context->block_size < 32 )
+		{
+			return;
+		}
+		libuna_hash_context_update_stripe(
+		 context,
+		 context->block );
+
+		context->block_size = 0;
+	}
+	while( ( data_size - data_offset ) >= 32 )
+	{
+		libuna_hash_context_update_stripe(
+		 context,
+		 &( data[ data_offset ] ) );
+
+		data_offset += 32;
+	}
+	if( data_offset < data_size )
+	{
+		memory_copy(
+		 context->block,
+		 &( data[ data_offset ] ),
+		 data_size - data_offset );
+
+		context->block_size = data_size - data_offset;
+	}
+}
+
+/* Updates a hash context with the UTF-8 character bytes of an Unicode character
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_context_update_with_unicode_character(
+     libuna_hash_context_t *context,
+     libuna_unicode_character_t unicode_character,
+     libcerror_error_t **error )
+{
+	libuna_utf8_character_t utf8_string[ 4 ];
+
+	static char *function    = "libuna_hash_context_update_with_unicode_character";
+	size_t utf8_string_index = 0;
+
+	if( libuna_unicode_character_copy_to_utf8(
+	     unicode_character,
+	     utf8_string,
+	     4,
+	     &utf8_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+		 "%s: unable to copy Unicode character to UTF-8.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_hash_context_update(
+	 context,
+	 utf8_string,
+	 utf8_string_index );
+
+	return( 1 );
+}
+
+/* Finalizes a hash context
+ */
+void libuna_hash_context_finalize(
+      libuna_hash_context_t *context,
+      uint64_t *hash )
+{
+	uint64_t value_64bit = 0;
+	uint32_t value_32bit = 0;
+	size_t block_offset  = 0;
+
+	if( context->number_of_bytes >= 32 )
+	{
+		value_64bit = libuna_hash_rotate_left( context->accumulators[ 0 ], 1 )
+		            + libuna_hash_rotate_left( context->accumulators[ 1 ], 7 )
+		            + libuna_hash_rotate_left( context->accumulators[ 2 ], 12 )
+		            + libuna_hash_rotate_left( context->accumulators[ 3 ], 18 );
+
+		value_64bit = libuna_hash_merge_round(
+		               value_64bit,
+		               context->accumulators[ 0 ] );
+
+		value_64bit = libuna_hash_merge_round(
+		               value_64bit,
+		               context->accumulators[ 1 ] );
+
+		value_64bit = libuna_hash_merge_round(
+		               value_64bit,
+		               context->accumulators[ 2 ] );
+
+		value_64bit = libuna_hash_merge_round(
+		               value_64bit,
+		               context->accumulators[ 3 ] );
+	}
+	else
+	{
+		value_64bit = LIBUNA_HASH_PRIME64_5;
+	}
+	*hash = value_64bit + context->number_of_bytes;
+
+	while( ( block_offset + 8 ) <= context->block_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( context->block[ block_offset ] ),
+		 value_64bit );
+
+		*hash ^= libuna_hash_round(
+		          0,
+		          value_64bit );
+
+		*hash = ( libuna_hash_rotate_left( *hash, 27 ) * LIBUNA_HASH_PRIME64_1 ) + LIBUNA_HASH_PRIME64_4;
+
+		block_offset += 8;
+	}
+	if( ( block_offset + 4 ) <= context->block_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( context->block[ block_offset ] ),
+		 value_32bit );
+
+		*hash ^= (uint64_t) value_32bit * LIBUNA_HASH_PRIME64_1;
+		*hash  = ( libuna_hash_rotate_left( *hash, 23 ) * LIBUNA_HASH_PRIME64_2 ) + LIBUNA_HASH_PRIME64_3;
+
+		block_offset += 4;
+	}
+	while( block_offset < context->block_size )
+	{
+		*hash ^= (uint64_t) context->block[ block_offset ] * LIBUNA_HASH_PRIME64_5;
+		*hash  = libuna_hash_rotate_left( *hash, 11 ) * LIBUNA_HASH_PRIME64_1;
+
+		block_offset += 1;
+	}
+	*hash ^= *hash >> 33;
+	*hash *= LIBUNA_HASH_PRIME64_2;
+	*hash ^= *hash >> 29;
+	*hash *= LIBUNA_HASH_PRIME64_3;
+	*hash ^= *hash >> 32;
+}
+
+/* Calculates the hash of a byte stream
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * An end-of-string character is not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+	libuna_utf8_character_t utf8_string[ LIBUNA_HASH_BUFFER_SIZE ];
+
+	static char *function                        = "libuna_hash_calculate_from_byte_stream";
+	const uint16_t *byte_stream_to_unicode_table = NULL;
+	libuna_unicode_character_t unicode_character = 0;
+	size_t ascii_string_size                     = 0;
+	size_t byte_stream_index                     = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the byte stream is terminated with a zero byte
+	 */
+	if( ( byte_stream_size >= 1 )
+	 && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
+	{
+		byte_stream_size -= 1;
+	}
+	byte_stream_to_unicode_table = libuna_codepage_get_byte_stream_to_unicode_table(
+	                                codepage );
+
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( byte_stream_to_unicode_table != NULL )
+		{
+			/* Convert the single-byte codepage characters in bulk
+			 */
+			utf8_string_index = 0;
+
+			libuna_transcode_utf8_copy_from_byte_stream(
+			 utf8_string,
+			 LIBUNA_HASH_BUFFER_SIZE,
+			 &utf8_string_index,
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 byte_stream_to_unicode_table );
+
+			libuna_hash_context_update(
+			 &context,
+			 utf8_string,
+			 utf8_string_index );
+
+			if( ( byte_stream_index >= byte_stream_size )
+			 || ( utf8_string_index > ( LIBUNA_HASH_BUFFER_SIZE - 4 ) ) )
+			{
+				continue;
+			}
+		}
+		else if( ( unicode_character < 0x80 )
+		      && ( libuna_codepage_is_supported(
+		            codepage ) != 0 ) )
+		{
+			/* Hash the 7-bit ASCII characters directly, since these are likely
+			 * to follow a 7-bit ASCII character and are the same in UTF-8
+			 */
+			ascii_string_size = 0;
+
+			libuna_transcode_ascii_size_from_byte_stream(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 &ascii_string_size );
+
+			libuna_hash_context_update(
+			 &context,
+			 &( byte_stream[ byte_stream_index - ascii_string_size ] ),
+			 ascii_string_size );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
+		/* Convert the byte stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-7 stream
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * An end-of-string character is not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf7_stream(
+     const uint8_t *utf7_stream,
+     size_t utf7_stream_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+
+	static char *function                        = "libuna_hash_calculate_from_utf7_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t ascii_string_size                     = 0;
+	size_t utf7_stream_index                     = 0;
+	uint32_t utf7_stream_base64_data             = 0;
+	uint8_t zero_byte                            = 0;
+
+	if( utf7_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-7 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf7_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-7 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-7 stream is terminated with a zero byte
+	 * The zero byte is decoded, since it can end a base64 encoded sequence,
+	 * but it is not included in the hash
+	 */
+	if( ( utf7_stream_size >= 1 )
+	 && ( utf7_stream[ utf7_stream_size - 1 ] == 0 ) )
+	{
+		zero_byte = 1;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( utf7_stream_index < utf7_stream_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Hash the 7-bit ASCII characters directly, since these are likely
+			 * to follow a 7-bit ASCII character and are the same in UTF-8
+			 */
+			ascii_string_size = 0;
+
+			libuna_transcode_ascii_size_from_utf7_stream(
+			 utf7_stream,
+			 utf7_stream_size - zero_byte,
+			 &utf7_stream_index,
+			 utf7_stream_base64_data,
+			 &ascii_string_size );
+
+			libuna_hash_context_update(
+			 &context,
+			 &( utf7_stream[ utf7_stream_index - ascii_string_size ] ),
+			 ascii_string_size );
+
+			if( utf7_stream_index >= utf7_stream_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-7 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf7_stream(
+		     &unicode_character,
+		     utf7_stream,
+		     utf7_stream_size,
+		     &utf7_stream_index,
+		     &utf7_stream_base64_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-7 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( zero_byte != 0 )
+		 && ( unicode_character == 0 )
+		 && ( utf7_stream_index >= utf7_stream_size ) )
+		{
+			break;
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 string
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * An end-of-string character is not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf8(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+
+	static char *function                        = "libuna_hash_calculate_from_utf8";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t ascii_string_size                     = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-8 string is terminated with an end-of-string character
+	 */
+	if( ( utf8_string_size >= 1 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( utf8_string_index < utf8_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Hash the 7-bit ASCII characters directly, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			ascii_string_size = 0;
+
+			libuna_transcode_ascii_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 &ascii_string_size );
+
+			libuna_hash_context_update(
+			 &context,
+			 &( utf8_string[ utf8_string_index - ascii_string_size ] ),
+			 ascii_string_size );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 stream
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * A byte order mark (BOM) and an end-of-string character are not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf8_stream(
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+
+	static char *function                        = "libuna_hash_calculate_from_utf8_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t ascii_string_size                     = 0;
+	size_t utf8_stream_index                     = 0;
+
+	if( utf8_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-8 stream starts with a byte order mark (BOM)
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0x0ef )
+		 && ( utf8_stream[ 1 ] == 0x0bb )
+		 && ( utf8_stream[ 2 ] == 0x0bf ) )
+		{
+			utf8_stream_index = 3;
+		}
+	}
+	/* Check if the UTF-8 stream is terminated with a zero byte
+	 */
+	if( ( utf8_stream_size > utf8_stream_index )
+	 && ( utf8_stream[ utf8_stream_size - 1 ] == 0 ) )
+	{
+		utf8_stream_size -= 1;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( utf8_stream_index < utf8_stream_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Hash the 7-bit ASCII characters directly, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			ascii_string_size = 0;
+
+			libuna_transcode_ascii_size_from_utf8_stream(
+			 utf8_stream,
+			 utf8_stream_size,
+			 &utf8_stream_index,
+			 &ascii_string_size );
+
+			libuna_hash_context_update(
+			 &context,
+			 &( utf8_stream[ utf8_stream_index - ascii_string_size ] ),
+			 ascii_string_size );
+
+			if( utf8_stream_index >= utf8_stream_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 stream bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_stream,
+		     utf8_stream_size,
+		     &utf8_stream_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-16 string
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * An end-of-string character is not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf16(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+	libuna_utf8_character_t utf8_string[ LIBUNA_HASH_BUFFER_SIZE ];
+
+	static char *function                        = "libuna_hash_calculate_from_utf16";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-16 string is terminated with an end-of-string character
+	 */
+	if( ( utf16_string_size >= 1 )
+	 && ( utf16_string[ utf16_string_size - 1 ] == 0 ) )
+	{
+		utf16_string_size -= 1;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( utf16_string_index < utf16_string_size )
+	{
+		/* Convert the non-surrogate UTF-16 characters in bulk
+		 */
+		utf8_string_index = 0;
+
+		libuna_transcode_utf8_copy_from_utf16(
+		 utf8_string,
+		 LIBUNA_HASH_BUFFER_SIZE,
+		 &utf8_string_index,
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index );
+
+		libuna_hash_context_update(
+		 &context,
+		 utf8_string,
+		 utf8_string_index );
+
+		if( ( utf16_string_index >= utf16_string_size )
+		 || ( utf8_string_index > ( LIBUNA_HASH_BUFFER_SIZE - 4 ) ) )
+		{
+			continue;
+		}
+		/* Convert the UTF-16 character bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_size,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-16 stream
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * A byte order mark (BOM) and an end-of-string character are not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+	libuna_utf8_character_t utf8_string[ LIBUNA_HASH_BUFFER_SIZE ];
+
+	static char *function                        = "libuna_hash_calculate_from_utf16_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	int read_byte_order                          = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( utf16_stream_size >= 2 )
+	{
+		if( ( utf16_stream[ 0 ] == 0xfe )
+		 && ( utf16_stream[ 1 ] == 0xff ) )
+		{
+			read_byte_order    = LIBUNA_ENDIAN_BIG;
+			utf16_stream_index = 2;
+		}
+		else if( ( utf16_stream[ 0 ] == 0xff )
+		      && ( utf16_stream[ 1 ] == 0xfe ) )
+		{
+			read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+			utf16_stream_index = 2;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-16 stream is terminated with zero bytes
+	 */
+	if( ( ( utf16_stream_size - utf16_stream_index ) >= 2 )
+	 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	{
+		utf16_stream_size -= 2;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		/* Convert the non-surrogate UTF-16 characters in bulk
+		 */
+		utf8_string_index = 0;
+
+		libuna_transcode_utf8_copy_from_utf16_stream(
+		 utf8_string,
+		 LIBUNA_HASH_BUFFER_SIZE,
+		 &utf8_string_index,
+		 utf16_stream,
+		 utf16_stream_size,
+		 &utf16_stream_index,
+		 byte_order );
+
+		libuna_hash_context_update(
+		 &context,
+		 utf8_string,
+		 utf8_string_index );
+
+		if( ( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+		 || ( utf8_string_index > ( LIBUNA_HASH_BUFFER_SIZE - 4 ) ) )
+		{
+			continue;
+		}
+		/* Convert the UTF-16 stream bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-32 string
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * An end-of-string character is not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf32(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+	libuna_utf8_character_t utf8_string[ LIBUNA_HASH_BUFFER_SIZE ];
+
+	static char *function                        = "libuna_hash_calculate_from_utf32";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf32_string_index                    = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-32 string is terminated with an end-of-string character
+	 */
+	if( ( utf32_string_size >= 1 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( utf32_string_index < utf32_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Convert the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			utf8_string_index = 0;
+
+			libuna_transcode_utf8_copy_ascii_from_utf32(
+			 utf8_string,
+			 LIBUNA_HASH_BUFFER_SIZE,
+			 &utf8_string_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index );
+
+			libuna_hash_context_update(
+			 &context,
+			 utf8_string,
+			 utf8_string_index );
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf8_string_index >= LIBUNA_HASH_BUFFER_SIZE ) )
+			{
+				continue;
+			}
+		}
+		/* Convert the UTF-32 character into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32(
+		     &unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-32 stream
+ * The hash is calculated over the UTF-8 representation of the Unicode characters
+ * hence equivalent strings in different encodings have the same hash
+ * A byte order mark (BOM) and an end-of-string character are not included in the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_hash_calculate_from_utf32_stream(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_hash_context_t context;
+	libuna_utf8_character_t utf8_string[ LIBUNA_HASH_BUFFER_SIZE ];
+
+	static char *function                        = "libuna_hash_calculate_from_utf32_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf32_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	int read_byte_order                          = 0;
+
+	if( utf32_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf32_stream_size % 4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: missing UTF-32 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( utf32_stream_size >= 4 )
+	{
+		if( ( utf32_stream[ 0 ] == 0x00 )
+		 && ( utf32_stream[ 1 ] == 0x00 )
+		 && ( utf32_stream[ 2 ] == 0xfe )
+		 && ( utf32_stream[ 3 ] == 0xff ) )
+		{
+			read_byte_order    = LIBUNA_ENDIAN_BIG;
+			utf32_stream_index = 4;
+		}
+		else if( ( utf32_stream[ 0 ] == 0xff )
+		      && ( utf32_stream[ 1 ] == 0xfe )
+		      && ( utf32_stream[ 2 ] == 0x00 )
+		      && ( utf32_stream[ 3 ] == 0x00 ) )
+		{
+			read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+			utf32_stream_index = 4;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-32 stream is terminated with zero bytes
+	 */
+	if( ( ( utf32_stream_size - utf32_stream_index ) >= 4 )
+	 && ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 3 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 2 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 1 ] == 0 ) )
+	{
+		utf32_stream_size -= 4;
+	}
+	libuna_hash_context_initialize(
+	 &context );
+
+	while( ( utf32_stream_index + 3 ) < utf32_stream_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Convert the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			utf8_string_index = 0;
+
+			libuna_transcode_utf8_copy_ascii_from_utf32_stream(
+			 utf8_string,
+			 LIBUNA_HASH_BUFFER_SIZE,
+			 &utf8_string_index,
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 byte_order );
+
+			libuna_hash_context_update(
+			 &context,
+			 utf8_string,
+			 utf8_string_index );
+
+			if( ( ( utf32_stream_index + 3 ) >= utf32_stream_size )
+			 || ( utf8_string_index >= LIBUNA_HASH_BUFFER_SIZE ) )
+			{
+				continue;
+			}
+		}
+		/* Convert the UTF-32 stream bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32_stream(
+		     &unicode_character,
+		     utf32_stream,
+		     utf32_stream_size,
+		     &utf32_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_hash_context_update_with_unicode_character(
+		     &context,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	libuna_hash_context_finalize(
+	 &context,
+	 hash );
+
+	return( 1 );
+}
+
@@ -0,0 +1,150 @@
+/*
+ * Unicode string hash functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_HASH_H )
+#define _LIBUNA_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_extern.h"
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer that holds the UTF-8 character bytes that are hashed
+ */
+#define LIBUNA_HASH_BUFFER_SIZE			256
+
+/* The primes of the 64-bit hash, which is XXH64 with a seed of 0
+ */
+#define LIBUNA_HASH_PRIME64_1			0x9e3779b185ebca87ULL
+#define LIBUNA_HASH_PRIME64_2			0xc2b2ae3d27d4eb4fULL
+#define LIBUNA_HASH_PRIME64_3			0x165667b19e3779f9ULL
+#define LIBUNA_HASH_PRIME64_4			0x85ebca77c2b2ae63ULL
+#define LIBUNA_HASH_PRIME64_5			0x27d4eb2f165667c5ULL
+
+typedef struct libuna_hash_context libuna_hash_context_t;
+
+struct libuna_hash_context
+{
+	/* The accumulators
+	 */
+	uint64_t accumulators[ 4 ];
+
+	/* The number of bytes that were hashed
+	 */
+	uint64_t number_of_bytes;
+
+	/* The block that holds the bytes that do not fill a stripe of 32 bytes
+	 */
+	uint8_t block[ 32 ];
+
+	/* The block size
+	 */
+	size_t block_size;
+};
+
+void libuna_hash_context_initialize(
+      libuna_hash_context_t *context );
+
+void libuna_hash_context_update(
+      libuna_hash_context_t *context,
+      const uint8_t *data,
+      size_t data_size );
+
+int libuna_hash_context_update_with_unicode_character(
+     libuna_hash_context_t *context,
+     libuna_unicode_character_t unicode_character,
+     libcerror_error_t **error );
+
+void libuna_hash_context_finalize(
+      libuna_hash_context_t *context,
+      uint64_t *hash );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf7_stream(
+     const uint8_t *utf7_stream,
+     size_t utf7_stream_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf8(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf8_stream(
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf16(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf32(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_hash_calculate_from_utf32_stream(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_HASH_H ) */
+
@@ -0,0 +1,103 @@
+/*
+ * Unicode normalization functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_NORMALIZATION_H )
+#define _LIBUNA_NORMALIZATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The Unicode characters from this value onwards have no normalization properties
+ */
+#define LIBUNA_NORMALIZATION_MAXIMUM_CHARACTER			0x2fa1eUL
+
+/* The maximum number of Unicode characters of a full canonical decomposition
+ */
+#define LIBUNA_NORMALIZATION_MAXIMUM_DECOMPOSITION_SIZE		4
+
+/* The normalization properties
+ */
+#define LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS		0x00ffU
+#define LIBUNA_NORMALIZATION_PROPERTY_NFC_QUICK_CHECK_NO	0x0100U
+#define LIBUNA_NORMALIZATION_PROPERTY_NFC_QUICK_CHECK_MAYBE	0x0200U
+#define LIBUNA_NORMALIZATION_PROPERTY_NFD_QUICK_CHECK_NO	0x0400U
+
+/* The Hangul syllable and jamo definitions
+ */
+#define LIBUNA_NORMALIZATION_HANGUL_SYLLABLE_BASE		0xac00UL
+#define LIBUNA_NORMALIZATION_HANGUL_LEADING_JAMO_BASE		0x1100UL
+#define LIBUNA_NORMALIZATION_HANGUL_VOWEL_JAMO_BASE		0x1161UL
+#define LIBUNA_NORMALIZATION_HANGUL_TRAILING_JAMO_BASE		0x11a7UL
+
+#define LIBUNA_NORMALIZATION_NUMBER_OF_HANGUL_LEADING_JAMO	19
+#define LIBUNA_NORMALIZATION_NUMBER_OF_HANGUL_VOWEL_JAMO	21
+#define LIBUNA_NORMALIZATION_NUMBER_OF_HANGUL_TRAILING_JAMO	28
+#define LIBUNA_NORMALIZATION_NUMBER_OF_HANGUL_SYLLABLES		11172
+
+extern const uint8_t libuna_normalization_page_index[ 3049 ];
+
+extern const uint16_t libuna_normalization_properties[ 163 * 64 ];
+
+extern const libuna_unicode_character_t libuna_normalization_decomposition_characters[ 2061 ];
+
+extern const uint16_t libuna_normalization_decomposition_offsets[ 2062 ];
+
+extern const libuna_unicode_character_t libuna_normalization_decomposition_sequences[ 3406 ];
+
+extern const libuna_unicode_character_t libuna_normalization_composition_pairs[ 941 * 2 ];
+
+extern const libuna_unicode_character_t libuna_normalization_composition_characters[ 941 ];
+
+uint16_t libuna_normalization_get_properties(
+          libuna_unicode_character_t unicode_character );
+
+size_t libuna_normalization_copy_decomposition(
+        libuna_unicode_character_t unicode_character,
+        libuna_unicode_character_t *decomposition );
+
+libuna_unicode_character_t libuna_normalization_get_composition(
+                            libuna_unicode_character_t first_unicode_character,
+                            libuna_unicode_character_t second_unicode_character );
+
+int libuna_normalization_get_quick_check_mask(
+     int normalization_form,
+     uint16_t *quick_check_mask,
+     libcerror_error_t **error );
+
+int libuna_normalization_quick_check_utf16(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t quick_check_mask,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_NORMALIZATION_H ) */
+
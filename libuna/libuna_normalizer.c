@@ -0,0 +1,612 @@
+/*
+ * Unicode normalizer functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libuna_definitions.h"
+#include "libuna_libcerror.h"
+#include "libuna_normalization.h"
+#include "libuna_normalizer.h"
+#include "libuna_types.h"
+
+/* Creates a normalizer
+ * Make sure the value normalizer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_normalizer_initialize(
+     libuna_normalizer_t **normalizer,
+     int normalization_form,
+     libcerror_error_t **error )
+{
+	libuna_internal_normalizer_t *internal_normalizer = NULL;
+	static char *function                             = "libuna_normalizer_initialize";
+	uint16_t quick_check_mask                         = 0;
+
+	if( normalizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalizer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *normalizer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid normalizer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_normalization_get_quick_check_mask(
+	     normalization_form,
+	     &quick_check_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to retrieve quick check mask.",
+		 function );
+
+		return( -1 );
+	}
+	internal_normalizer = memory_allocate_structure(
+	                       libuna_internal_normalizer_t );
+
+	if( internal_normalizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create normalizer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_normalizer,
+	     0,
+	     sizeof( libuna_internal_normalizer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear normalizer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_normalizer->normalization_form    = normalization_form;
+	internal_normalizer->quick_check_mask      = quick_check_mask;
+	internal_normalizer->segment_is_normalized = 1;
+
+	*normalizer = (libuna_normalizer_t *) internal_normalizer;
+
+	return( 1 );
+
+on_error:
+	if( internal_normalizer != NULL )
+	{
+		memory_free(
+		 internal_normalizer );
+	}
+	return( -1 );
+}
+
+/* Frees a normalizer
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_normalizer_free(
+     libuna_normalizer_t **normalizer,
+     libcerror_error_t **error )
+{
+	libuna_internal_normalizer_t *internal_normalizer = NULL;
+	static char *function                             = "libuna_normalizer_free";
+
+	if( normalizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalizer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *normalizer != NULL )
+	{
+		internal_normalizer = (libuna_internal_normalizer_t *) *normalizer;
+		*normalizer         = NULL;
+
+		memory_free(
+		 internal_normalizer );
+	}
+	return( 1 );
+}
+
+/* Normalizes Unicode characters that are part of a larger sequence of Unicode characters
+ * The normalizer is intended as a stage between a decoder and an encoder, e.g.
+ * libuna_stream_decoder_decode and libuna_unicode_character_copy_to_utf8
+ * The Unicode characters that can still be affected by the Unicode characters that follow
+ * are kept by the normalizer and normalized together with the next Unicode characters
+ * Normalization stops at the end of the Unicode characters or when the normalized Unicode characters are full
+ * The Unicode characters index and normalized Unicode characters index are set to the end of
+ * the consumed and normalized Unicode characters respectively
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_normalizer_normalize(
+     libuna_normalizer_t *normalizer,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t *unicode_characters_index,
+     libuna_unicode_character_t *normalized_unicode_characters,
+     size_t normalized_unicode_characters_size,
+     size_t *normalized_unicode_characters_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_normalizer_t *internal_normalizer = NULL;
+	static char *function                             = "libuna_normalizer_normalize";
+	libuna_unicode_character_t unicode_character      = 0;
+	size_t safe_normalized_unicode_characters_index   = 0;
+	size_t safe_unicode_characters_index              = 0;
+	size_t segment_index                              = 0;
+	uint16_t boundary_mask                            = 0;
+	uint16_t properties                               = 0;
+	uint8_t combining_class                           = 0;
+
+	if( normalizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalizer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_normalizer = (libuna_internal_normalizer_t *) normalizer;
+
+	if( unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid Unicode characters size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unicode_characters_index > unicode_characters_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: Unicode characters index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_unicode_characters_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid normalized Unicode characters size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_unicode_characters_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized Unicode characters index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *normalized_unicode_characters_index > normalized_unicode_characters_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: normalized Unicode characters index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_unicode_characters_index            = *unicode_characters_index;
+	safe_normalized_unicode_characters_index = *normalized_unicode_characters_index;
+
+	/* A character with a combining class of 0 that passes the quick check
+	 * is not affected by the characters that precede it, hence ends the segment
+	 */
+	boundary_mask = LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS
+	              | internal_normalizer->quick_check_mask;
+
+	for( ;; )
+	{
+		/* Copy the normalized characters of the previous segment
+		 */
+		while( ( internal_normalizer->buffer_index < internal_normalizer->buffer_size )
+		    && ( safe_normalized_unicode_characters_index < normalized_unicode_characters_size ) )
+		{
+			normalized_unicode_characters[ safe_normalized_unicode_characters_index++ ] = internal_normalizer->buffer[ internal_normalizer->buffer_index++ ];
+		}
+		if( ( internal_normalizer->buffer_index < internal_normalizer->buffer_size )
+		 || ( safe_unicode_characters_index >= unicode_characters_size ) )
+		{
+			break;
+		}
+		unicode_character = unicode_characters[ safe_unicode_characters_index ];
+
+		/* The 7-bit ASCII characters are starters that pass the quick check
+		 */
+		properties = 0;
+
+		if( unicode_character >= 0x80 )
+		{
+			properties = libuna_normalization_get_properties(
+			              unicode_character );
+		}
+		if( ( properties & boundary_mask ) == 0 )
+		{
+			if( ( internal_normalizer->segment_is_normalized != 0 )
+			 && ( internal_normalizer->segment_size <= ( normalized_unicode_characters_size - safe_normalized_unicode_characters_index ) ) )
+			{
+				/* The segment passes the quick check hence it is copied untouched
+				 */
+				for( segment_index = 0;
+				     segment_index < internal_normalizer->segment_size;
+				     segment_index++ )
+				{
+					normalized_unicode_characters[ safe_normalized_unicode_characters_index++ ] = internal_normalizer->segment[ segment_index ];
+				}
+				/* Copy successive characters that pass the quick check in bulk,
+				 * the last character is kept since it can compose with the characters that follow
+				 */
+				while( ( ( safe_unicode_characters_index + 1 ) < unicode_characters_size )
+				    && ( safe_normalized_unicode_characters_index < normalized_unicode_characters_size ) )
+				{
+					unicode_character = unicode_characters[ safe_unicode_characters_index + 1 ];
+
+					if( ( unicode_character >= 0x80 )
+					 && ( ( libuna_normalization_get_properties(
+					         unicode_character ) & boundary_mask ) != 0 ) )
+					{
+						break;
+					}
+					normalized_unicode_characters[ safe_normalized_unicode_characters_index++ ] = unicode_characters[ safe_unicode_characters_index++ ];
+				}
+				internal_normalizer->segment[ 0 ]         = unicode_characters[ safe_unicode_characters_index++ ];
+				internal_normalizer->segment_size         = 1;
+				internal_normalizer->last_combining_class = 0;
+
+				continue;
+			}
+			if( internal_normalizer->segment_size > 0 )
+			{
+				libuna_internal_normalizer_normalize_segment(
+				 internal_normalizer );
+
+				continue;
+			}
+		}
+		else if( internal_normalizer->segment_size >= LIBUNA_NORMALIZER_MAXIMUM_SEGMENT_SIZE )
+		{
+			libuna_internal_normalizer_normalize_segment(
+			 internal_normalizer );
+
+			continue;
+		}
+		combining_class = (uint8_t) ( properties & LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS );
+
+		if( ( ( properties & internal_normalizer->quick_check_mask ) != 0 )
+		 || ( ( combining_class != 0 )
+		  &&  ( combining_class < internal_normalizer->last_combining_class ) ) )
+		{
+			internal_normalizer->segment_is_normalized = 0;
+		}
+		internal_normalizer->last_combining_class = combining_class;
+
+		internal_normalizer->segment[ internal_normalizer->segment_size++ ] = unicode_characters[ safe_unicode_characters_index++ ];
+	}
+	*unicode_characters_index            = safe_unicode_characters_index;
+	*normalized_unicode_characters_index = safe_normalized_unicode_characters_index;
+
+	return( 1 );
+}
+
+/* Normalizes the Unicode characters kept by the normalizer
+ * This function should be called after the last Unicode characters have been normalized
+ * and until it returns 1
+ * Afterwards the normalizer can be used to normalize a new sequence of Unicode characters
+ * Returns 1 if successful, 0 if the normalized Unicode characters are full or -1 on error
+ */
+int libuna_normalizer_finalize(
+     libuna_normalizer_t *normalizer,
+     libuna_unicode_character_t *normalized_unicode_characters,
+     size_t normalized_unicode_characters_size,
+     size_t *normalized_unicode_characters_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_normalizer_t *internal_normalizer = NULL;
+	static char *function                             = "libuna_normalizer_finalize";
+	size_t safe_normalized_unicode_characters_index   = 0;
+
+	if( normalizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalizer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_normalizer = (libuna_internal_normalizer_t *) normalizer;
+
+	if( normalized_unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_unicode_characters_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid normalized Unicode characters size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_unicode_characters_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized Unicode characters index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *normalized_unicode_characters_index > normalized_unicode_characters_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: normalized Unicode characters index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_normalized_unicode_characters_index = *normalized_unicode_characters_index;
+
+	for( ;; )
+	{
+		while( ( internal_normalizer->buffer_index < internal_normalizer->buffer_size )
+		    && ( safe_normalized_unicode_characters_index < normalized_unicode_characters_size ) )
+		{
+			normalized_unicode_characters[ safe_normalized_unicode_characters_index++ ] = internal_normalizer->buffer[ internal_normalizer->buffer_index++ ];
+		}
+		if( internal_normalizer->buffer_index < internal_normalizer->buffer_size )
+		{
+			*normalized_unicode_characters_index = safe_normalized_unicode_characters_index;
+
+			return( 0 );
+		}
+		if( internal_normalizer->segment_size == 0 )
+		{
+			break;
+		}
+		libuna_internal_normalizer_normalize_segment(
+		 internal_normalizer );
+	}
+	*normalized_unicode_characters_index = safe_normalized_unicode_characters_index;
+
+	return( 1 );
+}
+
+/* Normalizes the segment of a normalizer into its buffer
+ * The buffer is expected to be empty
+ */
+void libuna_internal_normalizer_normalize_segment(
+      libuna_internal_normalizer_t *internal_normalizer )
+{
+	libuna_unicode_character_t composed_unicode_character = 0;
+	libuna_unicode_character_t unicode_character          = 0;
+	size_t buffer_index                                   = 0;
+	size_t composed_index                                 = 0;
+	size_t insert_index                                   = 0;
+	size_t segment_index                                  = 0;
+	size_t starter_index                                  = 0;
+	uint16_t combining_class                              = 0;
+	uint16_t last_combining_class                         = 0;
+
+	internal_normalizer->buffer_index = 0;
+	internal_normalizer->buffer_size  = 0;
+
+	if( internal_normalizer->segment_is_normalized != 0 )
+	{
+		for( segment_index = 0;
+		     segment_index < internal_normalizer->segment_size;
+		     segment_index++ )
+		{
+			internal_normalizer->buffer[ segment_index ] = internal_normalizer->segment[ segment_index ];
+		}
+		internal_normalizer->buffer_size = internal_normalizer->segment_size;
+	}
+	else
+	{
+		for( segment_index = 0;
+		     segment_index < internal_normalizer->segment_size;
+		     segment_index++ )
+		{
+			internal_normalizer->buffer_size += libuna_normalization_copy_decomposition(
+			                                     internal_normalizer->segment[ segment_index ],
+			                                     &( internal_normalizer->buffer[ internal_normalizer->buffer_size ] ) );
+		}
+		/* Put the combining marks in canonical order, which is a stable sort
+		 * of the successive characters with a non-zero combining class
+		 */
+		for( buffer_index = 1;
+		     buffer_index < internal_normalizer->buffer_size;
+		     buffer_index++ )
+		{
+			unicode_character = internal_normalizer->buffer[ buffer_index ];
+			combining_class   = libuna_normalization_get_properties(
+			                     unicode_character ) & LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS;
+
+			if( combining_class == 0 )
+			{
+				continue;
+			}
+			for( insert_index = buffer_index;
+			     insert_index > 0;
+			     insert_index-- )
+			{
+				if( ( libuna_normalization_get_properties(
+				       internal_normalizer->buffer[ insert_index - 1 ] ) & LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS ) <= combining_class )
+				{
+					break;
+				}
+				internal_normalizer->buffer[ insert_index ] = internal_normalizer->buffer[ insert_index - 1 ];
+			}
+			internal_normalizer->buffer[ insert_index ] = unicode_character;
+		}
+		if( ( internal_normalizer->normalization_form == LIBUNA_NORMALIZATION_FORM_NFC )
+		 && ( internal_normalizer->buffer_size > 0 ) )
+		{
+			/* Compose the characters that are not blocked from the last starter,
+			 * a combining class of 256 indicates there is no starter
+			 */
+			last_combining_class = libuna_normalization_get_properties(
+			                        internal_normalizer->buffer[ 0 ] ) & LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS;
+
+			if( last_combining_class != 0 )
+			{
+				last_combining_class = 256;
+			}
+			composed_index = 1;
+
+			for( buffer_index = 1;
+			     buffer_index < internal_normalizer->buffer_size;
+			     buffer_index++ )
+			{
+				unicode_character = internal_normalizer->buffer[ buffer_index ];
+				combining_class   = libuna_normalization_get_properties(
+				                     unicode_character ) & LIBUNA_NORMALIZATION_PROPERTY_COMBINING_CLASS;
+
+				if( ( last_combining_class == 0 )
+				 || ( ( last_combining_class < combining_class )
+				  &&  ( last_combining_class != 256 ) ) )
+				{
+					composed_unicode_character = libuna_normalization_get_composition(
+					                              internal_normalizer->buffer[ starter_index ],
+					                              unicode_character );
+
+					if( composed_unicode_character != 0 )
+					{
+						internal_normalizer->buffer[ starter_index ] = composed_unicode_character;
+
+						continue;
+					}
+				}
+				if( combining_class == 0 )
+				{
+					starter_index = composed_index;
+				}
+				last_combining_class = combining_class;
+
+				internal_normalizer->buffer[ composed_index++ ] = unicode_character;
+			}
+			internal_normalizer->buffer_size = composed_index;
+		}
+	}
+	internal_normalizer->segment_size          = 0;
+	internal_normalizer->segment_is_normalized = 1;
+	internal_normalizer->last_combining_class  = 0;
+}
+
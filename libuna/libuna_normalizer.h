@@ -0,0 +1,124 @@
+/*
+ * Unicode normalizer functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_NORMALIZER_H )
+#define _LIBUNA_NORMALIZER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_extern.h"
+#include "libuna_libcerror.h"
+#include "libuna_normalization.h"
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of Unicode characters in a segment
+ * A segment that exceeds this size is normalized in parts, this only
+ * affects text with more than 30 successive combining marks, which is
+ * not stream-safe according to Unicode Standard Annex #15
+ */
+#define LIBUNA_NORMALIZER_MAXIMUM_SEGMENT_SIZE		32
+
+typedef struct libuna_internal_normalizer libuna_internal_normalizer_t;
+
+struct libuna_internal_normalizer
+{
+	/* The normalization form
+	 */
+	int normalization_form;
+
+	/* The normalization properties that fail the quick check
+	 */
+	uint16_t quick_check_mask;
+
+	/* The segment, which contains the Unicode characters since the last
+	 * character that is not affected by the characters that precede it
+	 */
+	libuna_unicode_character_t segment[ LIBUNA_NORMALIZER_MAXIMUM_SEGMENT_SIZE ];
+
+	/* The number of Unicode characters in the segment
+	 */
+	size_t segment_size;
+
+	/* Value to indicate the segment passes the quick check
+	 */
+	uint8_t segment_is_normalized;
+
+	/* The combining class of the last Unicode character in the segment
+	 */
+	uint8_t last_combining_class;
+
+	/* The buffer that holds the normalized Unicode characters of a segment
+	 */
+	libuna_unicode_character_t buffer[ LIBUNA_NORMALIZER_MAXIMUM_SEGMENT_SIZE * LIBUNA_NORMALIZATION_MAXIMUM_DECOMPOSITION_SIZE ];
+
+	/* The index of the next Unicode character in the buffer
+	 */
+	size_t buffer_index;
+
+	/* The number of Unicode characters in the buffer
+	 */
+	size_t buffer_size;
+};
+
+LIBUNA_EXTERN \
+int libuna_normalizer_initialize(
+     libuna_normalizer_t **normalizer,
+     int normalization_form,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_normalizer_free(
+     libuna_normalizer_t **normalizer,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_normalizer_normalize(
+     libuna_normalizer_t *normalizer,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t *unicode_characters_index,
+     libuna_unicode_character_t *normalized_unicode_characters,
+     size_t normalized_unicode_characters_size,
+     size_t *normalized_unicode_characters_index,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_normalizer_finalize(
+     libuna_normalizer_t *normalizer,
+     libuna_unicode_character_t *normalized_unicode_characters,
+     size_t normalized_unicode_characters_size,
+     size_t *normalized_unicode_characters_index,
+     libcerror_error_t **error );
+
+void libuna_internal_normalizer_normalize_segment(
+      libuna_internal_normalizer_t *internal_normalizer );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_NORMALIZER_H ) */
+
@@ -0,0 +1,60 @@
+/*
+ * The internal SIMD definitions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_INTERNAL_SIMD_H )
+#define _LIBUNA_INTERNAL_SIMD_H
+
+#include <common.h>
+
+/* The SIMD code paths are selected at compile time based on the instruction
+ * sets the compiler targets, e.g. SSE2 is always available on x86-64,
+ * SSSE3 is available when building with -mssse3, -msse4.1 or /arch:AVX
+ * and AVX2 is available when building with -mavx2 or /arch:AVX2
+ * Define LIBUNA_DISABLE_SIMD to build only the scalar code paths
+ */
+#if !defined( LIBUNA_DISABLE_SIMD )
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define LIBUNA_HAVE_SSE2	1
+#endif
+
+#if defined( LIBUNA_HAVE_SSE2 ) && ( defined( __SSSE3__ ) || defined( __AVX__ ) )
+#define LIBUNA_HAVE_SSSE3	1
+#endif
+
+#if defined( LIBUNA_HAVE_SSSE3 ) && defined( __AVX2__ )
+#define LIBUNA_HAVE_AVX2	1
+#endif
+
+#endif /* !defined( LIBUNA_DISABLE_SIMD ) */
+
+#if defined( LIBUNA_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( LIBUNA_HAVE_SSSE3 )
+#include <tmmintrin.h>
+
+#elif defined( LIBUNA_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#endif /* !defined( _LIBUNA_INTERNAL_SIMD_H ) */
+
@@ -0,0 +1,824 @@
+/*
+ * Stream decoder functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libuna_codepage.h"
+#include "libuna_definitions.h"
+#include "libuna_libcerror.h"
+#include "libuna_stream_decoder.h"
+#include "libuna_transcode.h"
+#include "libuna_types.h"
+#include "libuna_unicode_character.h"
+
+/* Creates a stream decoder
+ * Make sure the value stream_decoder is referencing, is set to NULL
+ * The codepage is only used by the byte stream format
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_stream_decoder_initialize(
+     libuna_stream_decoder_t **stream_decoder,
+     int stream_format,
+     int codepage,
+     libcerror_error_t **error )
+{
+	libuna_internal_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                     = "libuna_stream_decoder_initialize";
+	size_t maximum_character_size                             = 0;
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The maximum character size is the number of bytes a single character
+	 * can read, including the bytes the UTF-7 decoder looks ahead at, so that
+	 * a character is only decoded when all the bytes it depends on are available
+	 */
+	switch( stream_format )
+	{
+		case LIBUNA_STREAM_FORMAT_BYTE_STREAM:
+			if( libuna_codepage_is_supported(
+			     codepage ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported codepage: %d.",
+				 function,
+				 codepage );
+
+				return( -1 );
+			}
+			if( libuna_codepage_get_byte_stream_to_unicode_table(
+			     codepage ) != NULL )
+			{
+				maximum_character_size = 1;
+			}
+			else
+			{
+				maximum_character_size = 2;
+			}
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF7:
+			maximum_character_size = 24;
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF8:
+			maximum_character_size = 6;
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN:
+		case LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN:
+		case LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN:
+		case LIBUNA_STREAM_FORMAT_UTF32_LITTLE_ENDIAN:
+			maximum_character_size = 4;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported stream format: %d.",
+			 function,
+			 stream_format );
+
+			return( -1 );
+	}
+	internal_stream_decoder = memory_allocate_structure(
+	                           libuna_internal_stream_decoder_t );
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream_decoder,
+	     0,
+	     sizeof( libuna_internal_stream_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream_decoder->stream_format          = stream_format;
+	internal_stream_decoder->codepage               = codepage;
+	internal_stream_decoder->maximum_character_size = maximum_character_size;
+
+	*stream_decoder = (libuna_stream_decoder_t *) internal_stream_decoder;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream_decoder != NULL )
+	{
+		memory_free(
+		 internal_stream_decoder );
+	}
+	return( -1 );
+}
+
+/* Frees a stream decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_stream_decoder_free(
+     libuna_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error )
+{
+	libuna_internal_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                     = "libuna_stream_decoder_free";
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_decoder != NULL )
+	{
+		internal_stream_decoder = (libuna_internal_stream_decoder_t *) *stream_decoder;
+		*stream_decoder         = NULL;
+
+		memory_free(
+		 internal_stream_decoder );
+	}
+	return( 1 );
+}
+
+/* Decodes Unicode characters from a stream that is part of a larger stream
+ * The bytes of a character that is split by the end of the stream are kept
+ * by the stream decoder and decoded together with the bytes of the next stream
+ * Decoding stops at the end of the stream or when the Unicode characters are full
+ * The stream index and Unicode characters index are set to the end of
+ * the consumed bytes and decoded characters respectively
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_stream_decoder_decode(
+     libuna_stream_decoder_t *stream_decoder,
+     const uint8_t *stream,
+     size_t stream_size,
+     size_t *stream_index,
+     libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t *unicode_characters_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                     = "libuna_stream_decoder_decode";
+	size_t buffer_index                                       = 0;
+	size_t copy_size                                          = 0;
+	size_t previous_buffer_size                               = 0;
+	size_t safe_stream_index                                  = 0;
+	size_t safe_unicode_characters_index                      = 0;
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = (libuna_internal_stream_decoder_t *) stream_decoder;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_index > stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid Unicode characters size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unicode_characters_index > unicode_characters_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: Unicode characters index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_stream_index             = *stream_index;
+	safe_unicode_characters_index = *unicode_characters_index;
+
+	if( internal_stream_decoder->buffer_size > 0 )
+	{
+		/* Append at most the maximum character size of the stream to the buffered bytes,
+		 * which is sufficient to decode every character that starts in the buffer
+		 */
+		previous_buffer_size = internal_stream_decoder->buffer_size;
+		copy_size            = stream_size - safe_stream_index;
+
+		if( copy_size > internal_stream_decoder->maximum_character_size )
+		{
+			copy_size = internal_stream_decoder->maximum_character_size;
+		}
+		if( memory_copy(
+		     &( internal_stream_decoder->buffer[ previous_buffer_size ] ),
+		     &( stream[ safe_stream_index ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy stream to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_stream_decoder->buffer_size += copy_size;
+
+		while( ( buffer_index < previous_buffer_size )
+		    && ( ( internal_stream_decoder->buffer_size - buffer_index ) >= internal_stream_decoder->maximum_character_size )
+		    && ( safe_unicode_characters_index < unicode_characters_size ) )
+		{
+			if( libuna_internal_stream_decoder_copy_unicode_character(
+			     internal_stream_decoder,
+			     &( unicode_characters[ safe_unicode_characters_index ] ),
+			     internal_stream_decoder->buffer,
+			     internal_stream_decoder->buffer_size,
+			     &buffer_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from buffer.",
+				 function );
+
+				internal_stream_decoder->buffer_size = previous_buffer_size;
+
+				return( -1 );
+			}
+			safe_unicode_characters_index++;
+		}
+		if( buffer_index >= previous_buffer_size )
+		{
+			/* The character that was split has been decoded
+			 */
+			safe_stream_index += buffer_index - previous_buffer_size;
+
+			internal_stream_decoder->buffer_size = 0;
+		}
+		else
+		{
+			if( safe_unicode_characters_index >= unicode_characters_size )
+			{
+				/* Leave the appended bytes in the stream
+				 */
+				internal_stream_decoder->buffer_size = previous_buffer_size;
+			}
+			else
+			{
+				/* The stream was too small to complete the character
+				 * and has been appended to the buffer completely
+				 */
+				safe_stream_index = stream_size;
+			}
+			/* Realign the remaining bytes to the start of the buffer
+			 */
+			internal_stream_decoder->buffer_size -= buffer_index;
+
+			for( copy_size = 0;
+			     copy_size < internal_stream_decoder->buffer_size;
+			     copy_size++ )
+			{
+				internal_stream_decoder->buffer[ copy_size ] = internal_stream_decoder->buffer[ buffer_index++ ];
+			}
+		}
+	}
+	if( internal_stream_decoder->buffer_size == 0 )
+	{
+		while( safe_unicode_characters_index < unicode_characters_size )
+		{
+			switch( internal_stream_decoder->stream_format )
+			{
+				case LIBUNA_STREAM_FORMAT_BYTE_STREAM:
+					libuna_transcode_utf32_copy_ascii_from_byte_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index );
+					break;
+
+				case LIBUNA_STREAM_FORMAT_UTF7:
+					libuna_transcode_utf32_copy_ascii_from_utf7_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index,
+					 internal_stream_decoder->utf7_stream_base64_data );
+					break;
+
+				case LIBUNA_STREAM_FORMAT_UTF8:
+					libuna_transcode_utf32_copy_ascii_from_utf8_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index );
+					break;
+
+				case LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN:
+					libuna_transcode_utf32_copy_ascii_from_utf16_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index,
+					 LIBUNA_ENDIAN_BIG );
+					break;
+
+				case LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN:
+					libuna_transcode_utf32_copy_ascii_from_utf16_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index,
+					 LIBUNA_ENDIAN_LITTLE );
+					break;
+
+				case LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN:
+					libuna_transcode_utf32_copy_ascii_from_utf32_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index,
+					 LIBUNA_ENDIAN_BIG );
+					break;
+
+				case LIBUNA_STREAM_FORMAT_UTF32_LITTLE_ENDIAN:
+					libuna_transcode_utf32_copy_ascii_from_utf32_stream(
+					 (libuna_utf32_character_t *) unicode_characters,
+					 unicode_characters_size,
+					 &safe_unicode_characters_index,
+					 stream,
+					 stream_size,
+					 &safe_stream_index,
+					 LIBUNA_ENDIAN_LITTLE );
+					break;
+			}
+			if( ( safe_unicode_characters_index >= unicode_characters_size )
+			 || ( ( stream_size - safe_stream_index ) < internal_stream_decoder->maximum_character_size ) )
+			{
+				break;
+			}
+			if( libuna_internal_stream_decoder_copy_unicode_character(
+			     internal_stream_decoder,
+			     &( unicode_characters[ safe_unicode_characters_index ] ),
+			     stream,
+			     stream_size,
+			     &safe_stream_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from stream at index: %" PRIzd ".",
+				 function,
+				 safe_stream_index );
+
+				return( -1 );
+			}
+			safe_unicode_characters_index++;
+		}
+		if( ( safe_unicode_characters_index < unicode_characters_size )
+		 && ( safe_stream_index < stream_size ) )
+		{
+			/* Keep the bytes of the character that is split by the end of the stream
+			 */
+			copy_size = stream_size - safe_stream_index;
+
+			if( memory_copy(
+			     internal_stream_decoder->buffer,
+			     &( stream[ safe_stream_index ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy stream to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			internal_stream_decoder->buffer_size = copy_size;
+
+			safe_stream_index = stream_size;
+		}
+	}
+	*stream_index             = safe_stream_index;
+	*unicode_characters_index = safe_unicode_characters_index;
+
+	return( 1 );
+}
+
+/* Decodes the Unicode characters of the bytes kept by the stream decoder
+ * This function should be called after the last stream has been decoded
+ * and until it returns 1
+ * An error is returned if the bytes do not form complete characters
+ * Afterwards the stream decoder can be used to decode a new stream
+ * Returns 1 if successful, 0 if the Unicode characters are full or -1 on error
+ */
+int libuna_stream_decoder_finalize(
+     libuna_stream_decoder_t *stream_decoder,
+     libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t *unicode_characters_index,
+     libcerror_error_t **error )
+{
+	libuna_internal_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                     = "libuna_stream_decoder_finalize";
+	size_t buffer_index                                       = 0;
+	size_t copy_size                                          = 0;
+	size_t safe_unicode_characters_index                      = 0;
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = (libuna_internal_stream_decoder_t *) stream_decoder;
+
+	if( unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid Unicode characters size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unicode_characters_index > unicode_characters_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: Unicode characters index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_stream_decoder->stream_format == LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN )
+	  ||  ( internal_stream_decoder->stream_format == LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN ) )
+	 && ( ( internal_stream_decoder->buffer_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_stream_decoder->stream_format == LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN )
+	  ||  ( internal_stream_decoder->stream_format == LIBUNA_STREAM_FORMAT_UTF32_LITTLE_ENDIAN ) )
+	 && ( ( internal_stream_decoder->buffer_size % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	safe_unicode_characters_index = *unicode_characters_index;
+
+	/* The UTF-7 decoder can look at the byte after the end of the stream
+	 */
+	internal_stream_decoder->buffer[ internal_stream_decoder->buffer_size ] = 0;
+
+	while( buffer_index < internal_stream_decoder->buffer_size )
+	{
+		if( safe_unicode_characters_index >= unicode_characters_size )
+		{
+			/* Realign the remaining bytes to the start of the buffer
+			 * so that the next call continues with them
+			 */
+			internal_stream_decoder->buffer_size -= buffer_index;
+
+			for( copy_size = 0;
+			     copy_size < internal_stream_decoder->buffer_size;
+			     copy_size++ )
+			{
+				internal_stream_decoder->buffer[ copy_size ] = internal_stream_decoder->buffer[ buffer_index++ ];
+			}
+			*unicode_characters_index = safe_unicode_characters_index;
+
+			return( 0 );
+		}
+		if( libuna_internal_stream_decoder_copy_unicode_character(
+		     internal_stream_decoder,
+		     &( unicode_characters[ safe_unicode_characters_index ] ),
+		     internal_stream_decoder->buffer,
+		     internal_stream_decoder->buffer_size,
+		     &buffer_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from buffer.",
+			 function );
+
+			return( -1 );
+		}
+		safe_unicode_characters_index++;
+	}
+	internal_stream_decoder->buffer_size             = 0;
+	internal_stream_decoder->utf7_stream_base64_data = 0;
+
+	*unicode_characters_index = safe_unicode_characters_index;
+
+	return( 1 );
+}
+
+/* Copies a Unicode character from a stream in the format of the stream decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_internal_stream_decoder_copy_unicode_character(
+     libuna_internal_stream_decoder_t *internal_stream_decoder,
+     libuna_unicode_character_t *unicode_character,
+     const uint8_t *stream,
+     size_t stream_size,
+     size_t *stream_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_internal_stream_decoder_copy_unicode_character";
+	int result            = 0;
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_stream_decoder->stream_format )
+	{
+		case LIBUNA_STREAM_FORMAT_BYTE_STREAM:
+			result = libuna_unicode_character_copy_from_byte_stream(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          internal_stream_decoder->codepage,
+			          error );
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF7:
+			result = libuna_unicode_character_copy_from_utf7_stream(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          &( internal_stream_decoder->utf7_stream_base64_data ),
+			          error );
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF8:
+			result = libuna_unicode_character_copy_from_utf8(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          error );
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN:
+			result = libuna_unicode_character_copy_from_utf16_stream(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          LIBUNA_ENDIAN_BIG,
+			          error );
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN:
+			result = libuna_unicode_character_copy_from_utf16_stream(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          LIBUNA_ENDIAN_LITTLE,
+			          error );
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN:
+			result = libuna_unicode_character_copy_from_utf32_stream(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          LIBUNA_ENDIAN_BIG,
+			          error );
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF32_LITTLE_ENDIAN:
+			result = libuna_unicode_character_copy_from_utf32_stream(
+			          unicode_character,
+			          stream,
+			          stream_size,
+			          stream_index,
+			          LIBUNA_ENDIAN_LITTLE,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid stream decoder - unsupported stream format.",
+			 function );
+
+			return( -1 );
+	}
+	return( result );
+}
+
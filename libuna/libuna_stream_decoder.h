@@ -0,0 +1,114 @@
+/*
+ * Stream decoder functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_STREAM_DECODER_H )
+#define _LIBUNA_STREAM_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_extern.h"
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer that holds the bytes of a character
+ * that is split between successive streams
+ */
+#define LIBUNA_STREAM_DECODER_BUFFER_SIZE	48
+
+typedef struct libuna_internal_stream_decoder libuna_internal_stream_decoder_t;
+
+struct libuna_internal_stream_decoder
+{
+	/* The stream format
+	 */
+	int stream_format;
+
+	/* The codepage
+	 */
+	int codepage;
+
+	/* The maximum number of bytes that are read to decode a single character
+	 */
+	size_t maximum_character_size;
+
+	/* The UTF-7 stream base64 data
+	 */
+	uint32_t utf7_stream_base64_data;
+
+	/* The buffer
+	 */
+	uint8_t buffer[ LIBUNA_STREAM_DECODER_BUFFER_SIZE ];
+
+	/* The number of bytes in the buffer
+	 */
+	size_t buffer_size;
+};
+
+LIBUNA_EXTERN \
+int libuna_stream_decoder_initialize(
+     libuna_stream_decoder_t **stream_decoder,
+     int stream_format,
+     int codepage,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_stream_decoder_free(
+     libuna_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_stream_decoder_decode(
+     libuna_stream_decoder_t *stream_decoder,
+     const uint8_t *stream,
+     size_t stream_size,
+     size_t *stream_index,
+     libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t *unicode_characters_index,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_stream_decoder_finalize(
+     libuna_stream_decoder_t *stream_decoder,
+     libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t *unicode_characters_index,
+     libcerror_error_t **error );
+
+int libuna_internal_stream_decoder_copy_unicode_character(
+     libuna_internal_stream_decoder_t *internal_stream_decoder,
+     libuna_unicode_character_t *unicode_character,
+     const uint8_t *stream,
+     size_t stream_size,
+     size_t *stream_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_STREAM_DECODER_H ) */
+
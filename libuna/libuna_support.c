@@ -37,3 +37,32 @@ const char *libuna_get_version(
 
 #endif /* !defined( HAVE_LOCAL_LIBUNA ) */
 
+/* Retrieves a description of a status code
+ * Returns the description as a string
+ */
+const char *libuna_get_status_code_string(
+             int status_code )
+{
+	switch( status_code )
+	{
+		case LIBUNA_STATUS_OK:
+			return( "Success" );
+
+		case LIBUNA_STATUS_INVALID_ARGUMENT:
+			return( "Invalid argument" );
+
+		case LIBUNA_STATUS_INVALID_INPUT:
+			return( "Invalid input" );
+
+		case LIBUNA_STATUS_TRUNCATED_INPUT:
+			return( "Truncated input" );
+
+		case LIBUNA_STATUS_OUTPUT_TOO_SMALL:
+			return( "Output too small" );
+
+		default:
+			break;
+	}
+	return( "Unknown status code" );
+}
+
@@ -41,6 +41,10 @@ const char *libuna_get_version(
 
 #endif /* !defined( HAVE_LOCAL_LIBUNA ) */
 
+LIBUNA_EXTERN \
+const char *libuna_get_status_code_string(
+             int status_code );
+
 #if defined( __cplusplus )
 }
 #endif
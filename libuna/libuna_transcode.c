@@ -0,0 +1,4457 @@
+/*
+ * Bulk transcoding functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libuna_definitions.h"
+#include "libuna_simd.h"
+#include "libuna_transcode.h"
+#include "libuna_types.h"
+
+/* Decodes a well-formed UTF-8 character
+ * Only the byte sequences that libuna_unicode_character_copy_from_utf8 converts
+ * into the same Unicode character are decoded, other sequences such as
+ * the overlong 0xc0 and 0xc1 forms are left to that function
+ * Returns the number of UTF-8 character bytes or 0 if not decoded
+ */
+static size_t libuna_transcode_utf8_character_decode(
+               const libuna_utf8_character_t *utf8_string,
+               size_t utf8_string_size,
+               libuna_unicode_character_t *unicode_character )
+{
+	libuna_utf8_character_t utf8_lower_bound = 0x80;
+	libuna_utf8_character_t utf8_upper_bound = 0xbf;
+
+	if( utf8_string[ 0 ] < 0x80 )
+	{
+		*unicode_character = utf8_string[ 0 ];
+
+		return( 1 );
+	}
+	if( ( utf8_string[ 0 ] < 0xc2 )
+	 || ( utf8_string[ 0 ] > 0xf4 )
+	 || ( utf8_string_size < 2 ) )
+	{
+		return( 0 );
+	}
+	if( utf8_string[ 0 ] < 0xe0 )
+	{
+		if( ( utf8_string[ 1 ] < 0x80 )
+		 || ( utf8_string[ 1 ] > 0xbf ) )
+		{
+			return( 0 );
+		}
+		*unicode_character = ( (libuna_unicode_character_t) ( utf8_string[ 0 ] & 0x1f ) << 6 )
+		                   | ( utf8_string[ 1 ] & 0x3f );
+
+		return( 2 );
+	}
+	if( utf8_string[ 0 ] == 0xe0 )
+	{
+		utf8_lower_bound = 0xa0;
+	}
+	else if( utf8_string[ 0 ] == 0xed )
+	{
+		utf8_upper_bound = 0x9f;
+	}
+	else if( utf8_string[ 0 ] == 0xf0 )
+	{
+		utf8_lower_bound = 0x90;
+	}
+	else if( utf8_string[ 0 ] == 0xf4 )
+	{
+		utf8_upper_bound = 0x8f;
+	}
+	if( ( utf8_string[ 1 ] < utf8_lower_bound )
+	 || ( utf8_string[ 1 ] > utf8_upper_bound )
+	 || ( utf8_string_size < 3 )
+	 || ( utf8_string[ 2 ] < 0x80 )
+	 || ( utf8_string[ 2 ] > 0xbf ) )
+	{
+		return( 0 );
+	}
+	if( utf8_string[ 0 ] < 0xf0 )
+	{
+		*unicode_character = ( (libuna_unicode_character_t) ( utf8_string[ 0 ] & 0x0f ) << 12 )
+		                   | ( (libuna_unicode_character_t) ( utf8_string[ 1 ] & 0x3f ) << 6 )
+		                   | ( utf8_string[ 2 ] & 0x3f );
+
+		return( 3 );
+	}
+	if( ( utf8_string_size < 4 )
+	 || ( utf8_string[ 3 ] < 0x80 )
+	 || ( utf8_string[ 3 ] > 0xbf ) )
+	{
+		return( 0 );
+	}
+	*unicode_character = ( (libuna_unicode_character_t) ( utf8_string[ 0 ] & 0x07 ) << 18 )
+	                   | ( (libuna_unicode_character_t) ( utf8_string[ 1 ] & 0x3f ) << 12 )
+	                   | ( (libuna_unicode_character_t) ( utf8_string[ 2 ] & 0x3f ) << 6 )
+	                   | ( utf8_string[ 3 ] & 0x3f );
+
+	return( 4 );
+}
+
+/* Determines the number of 7-bit ASCII bytes at the start of an UTF-8 string
+ * The bytes are scanned in blocks, the remainder is left to the caller
+ * Returns the number of bytes in the blocks that only contain 7-bit ASCII
+ */
+static size_t libuna_transcode_utf8_ascii_blocks_size(
+               const libuna_utf8_character_t *utf8_string,
+               size_t utf8_string_size )
+{
+	size_t utf8_string_index = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit     = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit     = _mm_setzero_si128();
+#else
+	uint64_t block_64bit     = 0;
+#endif
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	while( ( utf8_string_size - utf8_string_index ) >= 32 )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf8_string[ utf8_string_index ] ) );
+
+		if( _mm256_movemask_epi8( block_256bit ) != 0 )
+		{
+			break;
+		}
+		utf8_string_index += 32;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( utf8_string_size - utf8_string_index ) >= 16 )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf8_string[ utf8_string_index ] ) );
+
+		if( _mm_movemask_epi8( block_128bit ) != 0 )
+		{
+			break;
+		}
+		utf8_string_index += 16;
+	}
+#else
+	while( ( utf8_string_size - utf8_string_index ) >= 8 )
+	{
+		memory_copy(
+		 &block_64bit,
+		 &( utf8_string[ utf8_string_index ] ),
+		 8 );
+
+		if( ( block_64bit & 0x8080808080808080ULL ) != 0 )
+		{
+			break;
+		}
+		utf8_string_index += 8;
+	}
+#endif
+	return( utf8_string_index );
+}
+
+/* Copies the 7-bit ASCII bytes at the start of a byte string to an UTF-16 string
+ * The bytes are copied in blocks, the remainder is left to the caller
+ * Returns the number of bytes copied
+ */
+static size_t libuna_transcode_utf16_copy_from_ascii_blocks(
+               libuna_utf16_character_t *utf16_string,
+               size_t utf16_string_size,
+               const uint8_t *ascii_string,
+               size_t ascii_string_size )
+{
+	size_t ascii_string_index = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit      = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit      = _mm_setzero_si128();
+	__m128i zero_128bit       = _mm_setzero_si128();
+#endif
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	while( ( ( ascii_string_size - ascii_string_index ) >= 32 )
+	    && ( ( utf16_string_size - ascii_string_index ) >= 32 ) )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( ascii_string[ ascii_string_index ] ) );
+
+		if( _mm256_movemask_epi8( block_256bit ) != 0 )
+		{
+			break;
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) &( utf16_string[ ascii_string_index ] ),
+		 _mm256_cvtepu8_epi16(
+		  _mm256_castsi256_si128(
+		   block_256bit ) ) );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( utf16_string[ ascii_string_index + 16 ] ),
+		 _mm256_cvtepu8_epi16(
+		  _mm256_extracti128_si256(
+		   block_256bit,
+		   1 ) ) );
+
+		ascii_string_index += 32;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( ( ascii_string_size - ascii_string_index ) >= 16 )
+	    && ( ( utf16_string_size - ascii_string_index ) >= 16 ) )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( ascii_string[ ascii_string_index ] ) );
+
+		if( _mm_movemask_epi8( block_128bit ) != 0 )
+		{
+			break;
+		}
+		_mm_storeu_si128(
+		 (__m128i *) &( utf16_string[ ascii_string_index ] ),
+		 _mm_unpacklo_epi8(
+		  block_128bit,
+		  zero_128bit ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf16_string[ ascii_string_index + 8 ] ),
+		 _mm_unpackhi_epi8(
+		  block_128bit,
+		  zero_128bit ) );
+
+		ascii_string_index += 16;
+	}
+#else
+	ascii_string_size = libuna_transcode_utf8_ascii_blocks_size(
+	                     ascii_string,
+	                     ascii_string_size );
+
+	if( ascii_string_size > utf16_string_size )
+	{
+		ascii_string_size = utf16_string_size;
+	}
+	while( ascii_string_index < ascii_string_size )
+	{
+		utf16_string[ ascii_string_index ] = (libuna_utf16_character_t) ascii_string[ ascii_string_index ];
+
+		ascii_string_index++;
+	}
+#endif
+	return( ascii_string_index );
+}
+
+/* Copies the 7-bit ASCII bytes at the start of a byte string to an UTF-32 string
+ * The bytes are copied in blocks, the remainder is left to the caller
+ * Returns the number of bytes copied
+ */
+static size_t libuna_transcode_utf32_copy_from_ascii_blocks(
+               libuna_utf32_character_t *utf32_string,
+               size_t utf32_string_size,
+               const uint8_t *ascii_string,
+               size_t ascii_string_size )
+{
+	size_t ascii_string_index = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit      = _mm_setzero_si128();
+	__m128i half_128bit       = _mm_setzero_si128();
+	__m128i zero_128bit       = _mm_setzero_si128();
+#endif
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( ( ascii_string_size - ascii_string_index ) >= 16 )
+	    && ( ( utf32_string_size - ascii_string_index ) >= 16 ) )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( ascii_string[ ascii_string_index ] ) );
+
+		if( _mm_movemask_epi8( block_128bit ) != 0 )
+		{
+			break;
+		}
+		half_128bit = _mm_unpacklo_epi8(
+		               block_128bit,
+		               zero_128bit );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf32_string[ ascii_string_index ] ),
+		 _mm_unpacklo_epi16(
+		  half_128bit,
+		  zero_128bit ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf32_string[ ascii_string_index + 4 ] ),
+		 _mm_unpackhi_epi16(
+		  half_128bit,
+		  zero_128bit ) );
+
+		half_128bit = _mm_unpackhi_epi8(
+		               block_128bit,
+		               zero_128bit );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf32_string[ ascii_string_index + 8 ] ),
+		 _mm_unpacklo_epi16(
+		  half_128bit,
+		  zero_128bit ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf32_string[ ascii_string_index + 12 ] ),
+		 _mm_unpackhi_epi16(
+		  half_128bit,
+		  zero_128bit ) );
+
+		ascii_string_index += 16;
+	}
+#else
+	ascii_string_size = libuna_transcode_utf8_ascii_blocks_size(
+	                     ascii_string,
+	                     ascii_string_size );
+
+	if( ascii_string_size > utf32_string_size )
+	{
+		ascii_string_size = utf32_string_size;
+	}
+	while( ascii_string_index < ascii_string_size )
+	{
+		utf32_string[ ascii_string_index ] = (libuna_utf32_character_t) ascii_string[ ascii_string_index ];
+
+		ascii_string_index++;
+	}
+#endif
+	return( ascii_string_index );
+}
+
+/* Determines the size of an UTF-16 string from the well-formed characters of an UTF-8 string
+ * Adds the number of UTF-16 characters to the UTF-16 string size and
+ * advances the UTF-8 string index to the first character that was not handled
+ */
+void libuna_transcode_utf16_size_from_utf8(
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      size_t *utf16_string_size )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_size                        = 0;
+	size_t safe_utf16_string_size                = *utf16_string_size;
+	size_t safe_utf8_string_index                = *utf8_string_index;
+
+	while( safe_utf8_string_index < utf8_string_size )
+	{
+		if( utf8_string[ safe_utf8_string_index ] < 0x80 )
+		{
+			character_size = libuna_transcode_utf8_ascii_blocks_size(
+			                  &( utf8_string[ safe_utf8_string_index ] ),
+			                  utf8_string_size - safe_utf8_string_index );
+
+			safe_utf8_string_index += character_size;
+			safe_utf16_string_size += character_size;
+
+			if( safe_utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
+		character_size = libuna_transcode_utf8_character_decode(
+		                  &( utf8_string[ safe_utf8_string_index ] ),
+		                  utf8_string_size - safe_utf8_string_index,
+		                  &unicode_character );
+
+		if( character_size == 0 )
+		{
+			break;
+		}
+		if( unicode_character > LIBUNA_UNICODE_BASIC_MULTILINGUAL_PLANE_MAX )
+		{
+			safe_utf16_string_size += 2;
+		}
+		else
+		{
+			safe_utf16_string_size += 1;
+		}
+		safe_utf8_string_index += character_size;
+	}
+	*utf8_string_index = safe_utf8_string_index;
+	*utf16_string_size = safe_utf16_string_size;
+}
+
+/* Copies the well-formed characters of an UTF-8 string to an UTF-16 string
+ * Advances both indexes to the first character that was not handled
+ */
+void libuna_transcode_utf16_copy_from_utf8(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_size                        = 0;
+	size_t safe_utf16_string_index               = *utf16_string_index;
+	size_t safe_utf8_string_index                = *utf8_string_index;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit                         = _mm_setzero_si128();
+	__m128i in_range_128bit                      = _mm_setzero_si128();
+	__m128i lower_bound_128bit                   = _mm_set1_epi16( (short) 0x80c2 );
+	__m128i upper_bound_128bit                   = _mm_set1_epi16( (short) 0xbfdf );
+#endif
+
+	if( safe_utf16_string_index >= utf16_string_size )
+	{
+		return;
+	}
+	while( safe_utf8_string_index < utf8_string_size )
+	{
+		if( utf8_string[ safe_utf8_string_index ] < 0x80 )
+		{
+			character_size = libuna_transcode_utf16_copy_from_ascii_blocks(
+			                  &( utf16_string[ safe_utf16_string_index ] ),
+			                  utf16_string_size - safe_utf16_string_index,
+			                  &( utf8_string[ safe_utf8_string_index ] ),
+			                  utf8_string_size - safe_utf8_string_index );
+
+			safe_utf8_string_index  += character_size;
+			safe_utf16_string_index += character_size;
+		}
+#if defined( LIBUNA_HAVE_SSE2 )
+		else if( ( utf8_string[ safe_utf8_string_index ] >= 0xc2 )
+		      && ( utf8_string[ safe_utf8_string_index ] <= 0xdf ) )
+		{
+			/* Convert blocks of 8 consecutive 2-byte UTF-8 characters, where every
+			 * 16-bit lane contains the lead byte in the lower and the continuation
+			 * byte in the upper 8 bits
+			 */
+			while( ( ( utf8_string_size - safe_utf8_string_index ) >= 16 )
+			    && ( ( utf16_string_size - safe_utf16_string_index ) >= 8 ) )
+			{
+				block_128bit = _mm_loadu_si128(
+				                (const __m128i *) &( utf8_string[ safe_utf8_string_index ] ) );
+
+				in_range_128bit = _mm_and_si128(
+				                   _mm_cmpeq_epi8(
+				                    _mm_max_epu8(
+				                     block_128bit,
+				                     lower_bound_128bit ),
+				                    block_128bit ),
+				                   _mm_cmpeq_epi8(
+				                    _mm_min_epu8(
+				                     block_128bit,
+				                     upper_bound_128bit ),
+				                    block_128bit ) );
+
+				if( _mm_movemask_epi8( in_range_128bit ) != 0xffff )
+				{
+					break;
+				}
+				_mm_storeu_si128(
+				 (__m128i *) &( utf16_string[ safe_utf16_string_index ] ),
+				 _mm_or_si128(
+				  _mm_slli_epi16(
+				   _mm_and_si128(
+				    block_128bit,
+				    _mm_set1_epi16( 0x001f ) ),
+				   6 ),
+				  _mm_and_si128(
+				   _mm_srli_epi16(
+				    block_128bit,
+				    8 ),
+				   _mm_set1_epi16( 0x003f ) ) ) );
+
+				safe_utf8_string_index  += 16;
+				safe_utf16_string_index += 8;
+			}
+		}
+#endif
+		if( ( safe_utf8_string_index >= utf8_string_size )
+		 || ( safe_utf16_string_index >= utf16_string_size ) )
+		{
+			break;
+		}
+		character_size = libuna_transcode_utf8_character_decode(
+		                  &( utf8_string[ safe_utf8_string_index ] ),
+		                  utf8_string_size - safe_utf8_string_index,
+		                  &unicode_character );
+
+		if( character_size == 0 )
+		{
+			break;
+		}
+		if( unicode_character <= LIBUNA_UNICODE_BASIC_MULTILINGUAL_PLANE_MAX )
+		{
+			utf16_string[ safe_utf16_string_index++ ] = (libuna_utf16_character_t) unicode_character;
+		}
+		else
+		{
+			if( ( safe_utf16_string_index + 1 ) >= utf16_string_size )
+			{
+				break;
+			}
+			unicode_character                        -= 0x010000;
+			utf16_string[ safe_utf16_string_index     ] = (libuna_utf16_character_t) ( ( unicode_character >> 10 ) + LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START );
+			utf16_string[ safe_utf16_string_index + 1 ] = (libuna_utf16_character_t) ( ( unicode_character & 0x03ff ) + LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START );
+
+			safe_utf16_string_index += 2;
+		}
+		safe_utf8_string_index += character_size;
+	}
+	*utf8_string_index  = safe_utf8_string_index;
+	*utf16_string_index = safe_utf16_string_index;
+}
+
+/* Encodes a Unicode character, that is not a surrogate, from the basic multilingual plane into UTF-8
+ * Returns the number of UTF-8 character bytes
+ */
+static size_t libuna_transcode_utf8_character_encode(
+               uint16_t unicode_character,
+               libuna_utf8_character_t *utf8_string )
+{
+	if( unicode_character < 0x0080 )
+	{
+		utf8_string[ 0 ] = (libuna_utf8_character_t) unicode_character;
+
+		return( 1 );
+	}
+	if( unicode_character < 0x0800 )
+	{
+		utf8_string[ 0 ] = (libuna_utf8_character_t) ( 0xc0 | ( unicode_character >> 6 ) );
+		utf8_string[ 1 ] = (libuna_utf8_character_t) ( 0x80 | ( unicode_character & 0x3f ) );
+
+		return( 2 );
+	}
+	utf8_string[ 0 ] = (libuna_utf8_character_t) ( 0xe0 | ( unicode_character >> 12 ) );
+	utf8_string[ 1 ] = (libuna_utf8_character_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+	utf8_string[ 2 ] = (libuna_utf8_character_t) ( 0x80 | ( unicode_character & 0x3f ) );
+
+	return( 3 );
+}
+
+/* Determines the size of an UTF-8 string from the non-surrogate characters of an UTF-16 stream
+ * Adds the number of UTF-8 character bytes to the UTF-8 string size and
+ * advances the UTF-16 stream index to the first character that was not handled
+ */
+void libuna_transcode_utf8_size_from_utf16_stream(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order,
+      size_t *utf8_string_size )
+{
+	size_t safe_utf16_stream_index = *utf16_stream_index;
+	size_t safe_utf8_string_size   = *utf8_string_size;
+	uint16_t utf16_character       = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit           = _mm_setzero_si128();
+	__m128i count_128bit           = _mm_setzero_si128();
+	__m128i zero_128bit            = _mm_setzero_si128();
+#endif
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	/* Classify 8 UTF-16 characters at a time, every character is stored in 1 byte
+	 * if less than 0x0080, 2 bytes if less than 0x0800 and 3 bytes otherwise
+	 */
+	while( ( utf16_stream_size - safe_utf16_stream_index ) >= 16 )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+
+		if( byte_order == LIBUNA_ENDIAN_BIG )
+		{
+			block_128bit = _mm_or_si128(
+			                _mm_slli_epi16(
+			                 block_128bit,
+			                 8 ),
+			                _mm_srli_epi16(
+			                 block_128bit,
+			                 8 ) );
+		}
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi16(
+		      _mm_and_si128(
+		       block_128bit,
+		       _mm_set1_epi16( (short) 0xf800 ) ),
+		      _mm_set1_epi16( (short) 0xd800 ) ) ) != 0 )
+		{
+			break;
+		}
+		/* Every lane contains the number of UTF-8 bytes less than 3
+		 */
+		count_128bit = _mm_sub_epi16(
+		                zero_128bit,
+		                _mm_add_epi16(
+		                 _mm_cmpeq_epi16(
+		                  _mm_subs_epu16(
+		                   block_128bit,
+		                   _mm_set1_epi16( 0x007f ) ),
+		                  zero_128bit ),
+		                 _mm_cmpeq_epi16(
+		                  _mm_subs_epu16(
+		                   block_128bit,
+		                   _mm_set1_epi16( 0x07ff ) ),
+		                  zero_128bit ) ) );
+
+		count_128bit = _mm_sad_epu8(
+		                count_128bit,
+		                zero_128bit );
+
+		safe_utf8_string_size += 24
+		                       - (size_t) _mm_cvtsi128_si32( count_128bit )
+		                       - (size_t) _mm_extract_epi16( count_128bit, 4 );
+
+		safe_utf16_stream_index += 16;
+	}
+#endif
+	while( ( safe_utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		if( byte_order == LIBUNA_ENDIAN_BIG )
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 &( utf16_stream[ safe_utf16_stream_index ] ),
+			 utf16_character );
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ safe_utf16_stream_index ] ),
+			 utf16_character );
+		}
+		if( utf16_character < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( utf16_character < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else if( ( utf16_character & 0xf800 ) != 0xd800 )
+		{
+			safe_utf8_string_size += 3;
+		}
+		else
+		{
+			break;
+		}
+		safe_utf16_stream_index += 2;
+	}
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_size   = safe_utf8_string_size;
+}
+
+/* Copies the non-surrogate characters of an UTF-16 stream to an UTF-8 string
+ * Advances both indexes to the first character that was not handled
+ */
+void libuna_transcode_utf8_copy_from_utf16_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order )
+{
+	size_t character_size          = 0;
+	size_t safe_utf16_stream_index = *utf16_stream_index;
+	size_t safe_utf8_string_index  = *utf8_string_index;
+	uint16_t utf16_character       = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit           = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	uint16_t utf16_block[ 8 ];
+
+	__m128i block_128bit           = _mm_setzero_si128();
+	__m128i zero_128bit            = _mm_setzero_si128();
+	size_t character_iterator      = 0;
+	int ascii_mask                 = 0;
+	int two_byte_mask              = 0;
+#endif
+
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		return;
+	}
+#if defined( LIBUNA_HAVE_AVX2 )
+	/* Convert blocks of 16 7-bit ASCII characters
+	 */
+	while( ( ( utf16_stream_size - safe_utf16_stream_index ) >= 32 )
+	    && ( ( utf8_string_size - safe_utf8_string_index ) >= 16 ) )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+
+		if( byte_order == LIBUNA_ENDIAN_BIG )
+		{
+			block_256bit = _mm256_or_si256(
+			                _mm256_slli_epi16(
+			                 block_256bit,
+			                 8 ),
+			                _mm256_srli_epi16(
+			                 block_256bit,
+			                 8 ) );
+		}
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi16(
+		      _mm256_subs_epu16(
+		       block_256bit,
+		       _mm256_set1_epi16( 0x007f ) ),
+		      _mm256_setzero_si256() ) ) != -1 )
+		{
+			break;
+		}
+		_mm_storeu_si128(
+		 (__m128i *) &( utf8_string[ safe_utf8_string_index ] ),
+		 _mm_packus_epi16(
+		  _mm256_castsi256_si128(
+		   block_256bit ),
+		  _mm256_extracti128_si256(
+		   block_256bit,
+		   1 ) ) );
+
+		safe_utf16_stream_index += 32;
+		safe_utf8_string_index  += 16;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	/* Classify blocks of 8 UTF-16 characters as all 7-bit ASCII, all stored
+	 * in 2 UTF-8 bytes or mixed, blocks containing surrogates are handled
+	 * by the scalar loop
+	 */
+	while( ( ( utf16_stream_size - safe_utf16_stream_index ) >= 16 )
+	    && ( ( utf8_string_size - safe_utf8_string_index ) >= 24 ) )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+
+		if( byte_order == LIBUNA_ENDIAN_BIG )
+		{
+			block_128bit = _mm_or_si128(
+			                _mm_slli_epi16(
+			                 block_128bit,
+			                 8 ),
+			                _mm_srli_epi16(
+			                 block_128bit,
+			                 8 ) );
+		}
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi16(
+		      _mm_and_si128(
+		       block_128bit,
+		       _mm_set1_epi16( (short) 0xf800 ) ),
+		      _mm_set1_epi16( (short) 0xd800 ) ) ) != 0 )
+		{
+			break;
+		}
+		ascii_mask = _mm_movemask_epi8(
+		              _mm_cmpeq_epi16(
+		               _mm_subs_epu16(
+		                block_128bit,
+		                _mm_set1_epi16( 0x007f ) ),
+		               zero_128bit ) );
+
+		if( ascii_mask == 0xffff )
+		{
+			_mm_storel_epi64(
+			 (__m128i *) &( utf8_string[ safe_utf8_string_index ] ),
+			 _mm_packus_epi16(
+			  block_128bit,
+			  block_128bit ) );
+
+			safe_utf8_string_index += 8;
+		}
+		else
+		{
+			two_byte_mask = _mm_movemask_epi8(
+			                 _mm_cmpeq_epi16(
+			                  _mm_subs_epu16(
+			                   block_128bit,
+			                   _mm_set1_epi16( 0x07ff ) ),
+			                  zero_128bit ) );
+
+			if( ( ascii_mask == 0 )
+			 && ( two_byte_mask == 0xffff ) )
+			{
+				/* Every 16-bit lane contains the lead byte in the lower
+				 * and the continuation byte in the upper 8 bits
+				 */
+				_mm_storeu_si128(
+				 (__m128i *) &( utf8_string[ safe_utf8_string_index ] ),
+				 _mm_or_si128(
+				  _mm_or_si128(
+				   _mm_srli_epi16(
+				    block_128bit,
+				    6 ),
+				   _mm_set1_epi16( (short) 0x80c0 ) ),
+				  _mm_slli_epi16(
+				   _mm_and_si128(
+				    block_128bit,
+				    _mm_set1_epi16( 0x003f ) ),
+				   8 ) ) );
+
+				safe_utf8_string_index += 16;
+			}
+			else
+			{
+				_mm_storeu_si128(
+				 (__m128i *) utf16_block,
+				 block_128bit );
+
+				for( character_iterator = 0;
+				     character_iterator < 8;
+				     character_iterator++ )
+				{
+					safe_utf8_string_index += libuna_transcode_utf8_character_encode(
+					                           utf16_block[ character_iterator ],
+					                           &( utf8_string[ safe_utf8_string_index ] ) );
+				}
+			}
+		}
+		safe_utf16_stream_index += 16;
+	}
+#endif
+	while( ( safe_utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		if( byte_order == LIBUNA_ENDIAN_BIG )
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 &( utf16_stream[ safe_utf16_stream_index ] ),
+			 utf16_character );
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ safe_utf16_stream_index ] ),
+			 utf16_character );
+		}
+		if( utf16_character < 0x0080 )
+		{
+			character_size = 1;
+		}
+		else if( utf16_character < 0x0800 )
+		{
+			character_size = 2;
+		}
+		else if( ( utf16_character & 0xf800 ) != 0xd800 )
+		{
+			character_size = 3;
+		}
+		else
+		{
+			break;
+		}
+		if( character_size > ( utf8_string_size - safe_utf8_string_index ) )
+		{
+			break;
+		}
+		safe_utf8_string_index += libuna_transcode_utf8_character_encode(
+		                           utf16_character,
+		                           &( utf8_string[ safe_utf8_string_index ] ) );
+
+		safe_utf16_stream_index += 2;
+	}
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_index  = safe_utf8_string_index;
+}
+
+/* Determines the size of an UTF-8 string from the non-surrogate characters of an UTF-16 string
+ * Adds the number of UTF-8 character bytes to the UTF-8 string size and
+ * advances the UTF-16 string index to the first character that was not handled
+ */
+void libuna_transcode_utf8_size_from_utf16(
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      size_t *utf8_string_size )
+{
+	size_t utf16_stream_index = *utf16_string_index * 2;
+	int byte_order            = LIBUNA_ENDIAN_LITTLE;
+
+	if( _BYTE_STREAM_HOST_IS_ENDIAN_BIG )
+	{
+		byte_order = LIBUNA_ENDIAN_BIG;
+	}
+	/* An UTF-16 string is an UTF-16 stream in host byte order
+	 */
+	libuna_transcode_utf8_size_from_utf16_stream(
+	 (const uint8_t *) utf16_string,
+	 utf16_string_size * 2,
+	 &utf16_stream_index,
+	 byte_order,
+	 utf8_string_size );
+
+	*utf16_string_index = utf16_stream_index / 2;
+}
+
+/* Copies the non-surrogate characters of an UTF-16 string to an UTF-8 string
+ * Advances both indexes to the first character that was not handled
+ */
+void libuna_transcode_utf8_copy_from_utf16(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index )
+{
+	size_t utf16_stream_index = *utf16_string_index * 2;
+	int byte_order            = LIBUNA_ENDIAN_LITTLE;
+
+	if( _BYTE_STREAM_HOST_IS_ENDIAN_BIG )
+	{
+		byte_order = LIBUNA_ENDIAN_BIG;
+	}
+	/* An UTF-16 string is an UTF-16 stream in host byte order
+	 */
+	libuna_transcode_utf8_copy_from_utf16_stream(
+	 utf8_string,
+	 utf8_string_size,
+	 utf8_string_index,
+	 (const uint8_t *) utf16_string,
+	 utf16_string_size * 2,
+	 &utf16_stream_index,
+	 byte_order );
+
+	*utf16_string_index = utf16_stream_index / 2;
+}
+
+
+/* Determines the size of an UTF-8 string from a byte stream in a single-byte codepage
+ * The single-byte codepages map the 7-bit ASCII byte values onto the same Unicode characters
+ * Adds the number of UTF-8 character bytes to the UTF-8 string size and
+ * advances the byte stream index to the end of the byte stream
+ */
+void libuna_transcode_utf8_size_from_byte_stream(
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table,
+      size_t *utf8_string_size )
+{
+	size_t ascii_size             = 0;
+	size_t safe_byte_stream_index = *byte_stream_index;
+	size_t safe_utf8_string_size  = *utf8_string_size;
+	uint16_t unicode_character    = 0;
+
+	while( safe_byte_stream_index < byte_stream_size )
+	{
+		if( byte_stream[ safe_byte_stream_index ] < 0x80 )
+		{
+			ascii_size = libuna_transcode_utf8_ascii_blocks_size(
+			              &( byte_stream[ safe_byte_stream_index ] ),
+			              byte_stream_size - safe_byte_stream_index );
+
+			safe_byte_stream_index += ascii_size;
+			safe_utf8_string_size  += ascii_size;
+
+			if( safe_byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
+		unicode_character = byte_stream_to_unicode_table[ byte_stream[ safe_byte_stream_index++ ] ];
+
+		if( unicode_character < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( unicode_character < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+	}
+	*byte_stream_index = safe_byte_stream_index;
+	*utf8_string_size  = safe_utf8_string_size;
+}
+
+/* Copies a byte stream in a single-byte codepage to an UTF-8 string
+ * Advances both indexes to the first byte that did not fit in the UTF-8 string
+ */
+void libuna_transcode_utf8_copy_from_byte_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table )
+{
+	size_t character_size         = 0;
+	size_t safe_byte_stream_index = *byte_stream_index;
+	size_t safe_utf8_string_index = *utf8_string_index;
+	uint16_t unicode_character    = 0;
+
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		return;
+	}
+	while( safe_byte_stream_index < byte_stream_size )
+	{
+		if( byte_stream[ safe_byte_stream_index ] < 0x80 )
+		{
+			character_size = libuna_transcode_utf8_ascii_blocks_size(
+			                  &( byte_stream[ safe_byte_stream_index ] ),
+			                  byte_stream_size - safe_byte_stream_index );
+
+			if( character_size > ( utf8_string_size - safe_utf8_string_index ) )
+			{
+				character_size = utf8_string_size - safe_utf8_string_index;
+			}
+			if( character_size > 0 )
+			{
+				memory_copy(
+				 &( utf8_string[ safe_utf8_string_index ] ),
+				 &( byte_stream[ safe_byte_stream_index ] ),
+				 character_size );
+
+				safe_byte_stream_index += character_size;
+				safe_utf8_string_index += character_size;
+
+				if( safe_byte_stream_index >= byte_stream_size )
+				{
+					break;
+				}
+			}
+		}
+		unicode_character = byte_stream_to_unicode_table[ byte_stream[ safe_byte_stream_index ] ];
+
+		if( unicode_character < 0x0080 )
+		{
+			character_size = 1;
+		}
+		else if( unicode_character < 0x0800 )
+		{
+			character_size = 2;
+		}
+		else
+		{
+			character_size = 3;
+		}
+		if( character_size > ( utf8_string_size - safe_utf8_string_index ) )
+		{
+			break;
+		}
+		safe_utf8_string_index += libuna_transcode_utf8_character_encode(
+		                           unicode_character,
+		                           &( utf8_string[ safe_utf8_string_index ] ) );
+
+		safe_byte_stream_index += 1;
+	}
+	*byte_stream_index = safe_byte_stream_index;
+	*utf8_string_index = safe_utf8_string_index;
+}
+
+/* Copies a byte stream in a single-byte codepage to an UTF-16 string
+ * Advances both indexes to the first byte that did not fit in the UTF-16 string
+ */
+void libuna_transcode_utf16_copy_from_byte_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table )
+{
+	size_t block_size              = 0;
+	size_t character_size          = 0;
+	size_t safe_byte_stream_index  = *byte_stream_index;
+	size_t safe_utf16_string_index = *utf16_string_index;
+
+	while( ( safe_byte_stream_index < byte_stream_size )
+	    && ( safe_utf16_string_index < utf16_string_size ) )
+	{
+		character_size = libuna_transcode_utf16_copy_from_ascii_blocks(
+		                  &( utf16_string[ safe_utf16_string_index ] ),
+		                  utf16_string_size - safe_utf16_string_index,
+		                  &( byte_stream[ safe_byte_stream_index ] ),
+		                  byte_stream_size - safe_byte_stream_index );
+
+		safe_byte_stream_index  += character_size;
+		safe_utf16_string_index += character_size;
+
+		/* Convert the next block of bytes with the lookup table
+		 */
+		block_size = byte_stream_size - safe_byte_stream_index;
+
+		if( block_size > ( utf16_string_size - safe_utf16_string_index ) )
+		{
+			block_size = utf16_string_size - safe_utf16_string_index;
+		}
+		if( block_size > 16 )
+		{
+			block_size = 16;
+		}
+		while( block_size > 0 )
+		{
+			utf16_string[ safe_utf16_string_index++ ] = (libuna_utf16_character_t) byte_stream_to_unicode_table[ byte_stream[ safe_byte_stream_index++ ] ];
+
+			block_size--;
+		}
+	}
+	*byte_stream_index  = safe_byte_stream_index;
+	*utf16_string_index = safe_utf16_string_index;
+}
+
+/* Copies a byte stream in a single-byte codepage to an UTF-32 string
+ * Advances both indexes to the first byte that did not fit in the UTF-32 string
+ */
+void libuna_transcode_utf32_copy_from_byte_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table )
+{
+	size_t block_size              = 0;
+	size_t character_size          = 0;
+	size_t safe_byte_stream_index  = *byte_stream_index;
+	size_t safe_utf32_string_index = *utf32_string_index;
+
+	while( ( safe_byte_stream_index < byte_stream_size )
+	    && ( safe_utf32_string_index < utf32_string_size ) )
+	{
+		character_size = libuna_transcode_utf32_copy_from_ascii_blocks(
+		                  &( utf32_string[ safe_utf32_string_index ] ),
+		                  utf32_string_size - safe_utf32_string_index,
+		                  &( byte_stream[ safe_byte_stream_index ] ),
+		                  byte_stream_size - safe_byte_stream_index );
+
+		safe_byte_stream_index  += character_size;
+		safe_utf32_string_index += character_size;
+
+		/* Convert the next block of bytes with the lookup table
+		 */
+		block_size = byte_stream_size - safe_byte_stream_index;
+
+		if( block_size > ( utf32_string_size - safe_utf32_string_index ) )
+		{
+			block_size = utf32_string_size - safe_utf32_string_index;
+		}
+		if( block_size > 16 )
+		{
+			block_size = 16;
+		}
+		while( block_size > 0 )
+		{
+			utf32_string[ safe_utf32_string_index++ ] = (libuna_utf32_character_t) byte_stream_to_unicode_table[ byte_stream[ safe_byte_stream_index++ ] ];
+
+			block_size--;
+		}
+	}
+	*byte_stream_index  = safe_byte_stream_index;
+	*utf32_string_index = safe_utf32_string_index;
+}
+
+/* Decodes an UTF-16 character
+ * Only the characters that libuna_unicode_character_copy_from_utf16 converts without
+ * replacement are decoded, unpaired surrogates are left to that function
+ * Returns the number of UTF-16 code units or 0 if not decoded
+ */
+static size_t libuna_transcode_utf16_character_decode(
+               const libuna_utf16_character_t *utf16_string,
+               size_t utf16_string_size,
+               libuna_unicode_character_t *unicode_character )
+{
+	if( ( utf16_string[ 0 ] < 0xd800 )
+	 || ( utf16_string[ 0 ] > 0xdfff ) )
+	{
+		*unicode_character = utf16_string[ 0 ];
+
+		return( 1 );
+	}
+	if( ( utf16_string[ 0 ] > 0xdbff )
+	 || ( utf16_string_size < 2 )
+	 || ( utf16_string[ 1 ] < 0xdc00 )
+	 || ( utf16_string[ 1 ] > 0xdfff ) )
+	{
+		return( 0 );
+	}
+	*unicode_character = ( ( (libuna_unicode_character_t) utf16_string[ 0 ] - 0xd800 ) << 10 )
+	                   + ( utf16_string[ 1 ] - 0xdc00 )
+	                   + 0x010000;
+
+	return( 2 );
+}
+
+/* Determines the size of a byte stream character from an Unicode character
+ * A single-byte codepage is indicated by the absence of the double-byte pages
+ * Returns the number of byte stream character bytes
+ */
+static size_t libuna_transcode_byte_stream_character_size(
+               libuna_unicode_character_t unicode_character,
+               const uint8_t *unicode_to_byte_stream_page_index,
+               const uint16_t *unicode_to_double_byte_stream_pages )
+{
+	size_t page_number = 0;
+
+	if( ( unicode_to_double_byte_stream_pages == NULL )
+	 || ( unicode_character >= 0x00010000UL ) )
+	{
+		return( 1 );
+	}
+	page_number = unicode_to_byte_stream_page_index[ unicode_character >> 8 ];
+
+	if( unicode_to_double_byte_stream_pages[ ( page_number << 8 ) | ( unicode_character & 0x000000ffUL ) ] > 0x00ff )
+	{
+		return( 2 );
+	}
+	return( 1 );
+}
+
+/* Copies an Unicode character to a byte stream with the Unicode to byte stream lookup table of a codepage
+ * The entries of the double-byte pages contain the 1st byte in the lower 8 bits and the 2nd byte,
+ * if any, in the upper 8 bits. Characters outside the basic multilingual plane are copied as 0x1a
+ * The byte stream must contain space for at least 1 byte
+ * Returns the number of byte stream character bytes or 0 if the byte stream is too small
+ */
+static size_t libuna_transcode_byte_stream_character_copy(
+               libuna_unicode_character_t unicode_character,
+               uint8_t *byte_stream,
+               size_t byte_stream_size,
+               const uint8_t *unicode_to_byte_stream_page_index,
+               const uint8_t *unicode_to_byte_stream_pages,
+               const uint16_t *unicode_to_double_byte_stream_pages )
+{
+	size_t table_index         = 0;
+	uint16_t byte_stream_value = 0;
+
+	if( unicode_character >= 0x00010000UL )
+	{
+		byte_stream[ 0 ] = 0x1a;
+
+		return( 1 );
+	}
+	table_index = ( (size_t) unicode_to_byte_stream_page_index[ unicode_character >> 8 ] << 8 )
+	            | ( unicode_character & 0x000000ffUL );
+
+	if( unicode_to_byte_stream_pages != NULL )
+	{
+		byte_stream[ 0 ] = unicode_to_byte_stream_pages[ table_index ];
+
+		return( 1 );
+	}
+	byte_stream_value = unicode_to_double_byte_stream_pages[ table_index ];
+
+	if( byte_stream_value <= 0x00ff )
+	{
+		byte_stream[ 0 ] = (uint8_t) byte_stream_value;
+
+		return( 1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		return( 0 );
+	}
+	byte_stream[ 0 ] = (uint8_t) ( byte_stream_value & 0x00ff );
+	byte_stream[ 1 ] = (uint8_t) ( byte_stream_value >> 8 );
+
+	return( 2 );
+}
+
+/* Determines the size of a byte stream from an UTF-8 string
+ * The lookup table of the codepage is retrieved once by the caller, of which only
+ * the double-byte pages are needed, these are NULL for a single-byte codepage
+ * Adds the number of byte stream bytes to the byte stream size and advances
+ * the UTF-8 string index to the first character that was not converted
+ */
+void libuna_transcode_byte_stream_size_from_utf8(
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint16_t *unicode_to_double_byte_stream_pages,
+      size_t *byte_stream_size )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_size                        = 0;
+	size_t safe_byte_stream_size                 = *byte_stream_size;
+	size_t safe_utf8_string_index                = *utf8_string_index;
+
+	while( safe_utf8_string_index < utf8_string_size )
+	{
+		/* Determine the size of runs of 7-bit ASCII characters in bulk,
+		 * that of a single 7-bit ASCII character with the lookup table
+		 */
+		if( ( utf8_string[ safe_utf8_string_index ] < 0x80 )
+		 && ( ( safe_utf8_string_index + 1 ) < utf8_string_size )
+		 && ( utf8_string[ safe_utf8_string_index + 1 ] < 0x80 ) )
+		{
+			libuna_transcode_ascii_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &safe_utf8_string_index,
+			 &safe_byte_stream_size );
+
+			continue;
+		}
+		character_size = libuna_transcode_utf8_character_decode(
+		                  &( utf8_string[ safe_utf8_string_index ] ),
+		                  utf8_string_size - safe_utf8_string_index,
+		                  &unicode_character );
+
+		if( character_size == 0 )
+		{
+			break;
+		}
+		safe_byte_stream_size += libuna_transcode_byte_stream_character_size(
+		                          unicode_character,
+		                          unicode_to_byte_stream_page_index,
+		                          unicode_to_double_byte_stream_pages );
+
+		safe_utf8_string_index += character_size;
+	}
+	*byte_stream_size  = safe_byte_stream_size;
+	*utf8_string_index = safe_utf8_string_index;
+}
+
+/* Copies a byte stream from an UTF-8 string
+ * The lookup table of the codepage is retrieved once by the caller, either
+ * the single-byte or the double-byte pages are NULL
+ * Advances both indexes to the first character that was not converted
+ */
+void libuna_transcode_byte_stream_copy_from_utf8(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint8_t *unicode_to_byte_stream_pages,
+      const uint16_t *unicode_to_double_byte_stream_pages )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_character_size            = 0;
+	size_t character_size                        = 0;
+	size_t safe_byte_stream_index                = *byte_stream_index;
+	size_t safe_utf8_string_index                = *utf8_string_index;
+
+	while( ( safe_utf8_string_index < utf8_string_size )
+	    && ( safe_byte_stream_index < byte_stream_size ) )
+	{
+		/* Convert runs of 7-bit ASCII characters in bulk, a single 7-bit ASCII
+		 * character is converted with the lookup table
+		 */
+		if( ( utf8_string[ safe_utf8_string_index ] < 0x80 )
+		 && ( ( safe_utf8_string_index + 1 ) < utf8_string_size )
+		 && ( utf8_string[ safe_utf8_string_index + 1 ] < 0x80 ) )
+		{
+			libuna_transcode_byte_stream_copy_ascii_from_utf8(
+			 byte_stream,
+			 byte_stream_size,
+			 &safe_byte_stream_index,
+			 utf8_string,
+			 utf8_string_size,
+			 &safe_utf8_string_index );
+
+			continue;
+		}
+		character_size = libuna_transcode_utf8_character_decode(
+		                  &( utf8_string[ safe_utf8_string_index ] ),
+		                  utf8_string_size - safe_utf8_string_index,
+		                  &unicode_character );
+
+		if( character_size == 0 )
+		{
+			break;
+		}
+		byte_stream_character_size = libuna_transcode_byte_stream_character_copy(
+		                              unicode_character,
+		                              &( byte_stream[ safe_byte_stream_index ] ),
+		                              byte_stream_size - safe_byte_stream_index,
+		                              unicode_to_byte_stream_page_index,
+		                              unicode_to_byte_stream_pages,
+		                              unicode_to_double_byte_stream_pages );
+
+		if( byte_stream_character_size == 0 )
+		{
+			break;
+		}
+		safe_byte_stream_index += byte_stream_character_size;
+		safe_utf8_string_index += character_size;
+	}
+	*byte_stream_index = safe_byte_stream_index;
+	*utf8_string_index = safe_utf8_string_index;
+}
+
+/* Determines the size of a byte stream from an UTF-16 string
+ * The lookup table of the codepage is retrieved once by the caller, of which only
+ * the double-byte pages are needed, these are NULL for a single-byte codepage
+ * Adds the number of byte stream bytes to the byte stream size and advances
+ * the UTF-16 string index to the first character that was not converted
+ */
+void libuna_transcode_byte_stream_size_from_utf16(
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint16_t *unicode_to_double_byte_stream_pages,
+      size_t *byte_stream_size )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_size                        = 0;
+	size_t safe_byte_stream_size                 = *byte_stream_size;
+	size_t safe_utf16_string_index               = *utf16_string_index;
+
+	while( safe_utf16_string_index < utf16_string_size )
+	{
+		/* Determine the size of runs of 7-bit ASCII characters in bulk,
+		 * that of a single 7-bit ASCII character with the lookup table
+		 */
+		if( ( utf16_string[ safe_utf16_string_index ] < 0x80 )
+		 && ( ( safe_utf16_string_index + 1 ) < utf16_string_size )
+		 && ( utf16_string[ safe_utf16_string_index + 1 ] < 0x80 ) )
+		{
+			libuna_transcode_ascii_size_from_utf16(
+			 utf16_string,
+			 utf16_string_size,
+			 &safe_utf16_string_index,
+			 &safe_byte_stream_size );
+
+			continue;
+		}
+		character_size = libuna_transcode_utf16_character_decode(
+		                  &( utf16_string[ safe_utf16_string_index ] ),
+		                  utf16_string_size - safe_utf16_string_index,
+		                  &unicode_character );
+
+		if( character_size == 0 )
+		{
+			break;
+		}
+		safe_byte_stream_size += libuna_transcode_byte_stream_character_size(
+		                          unicode_character,
+		                          unicode_to_byte_stream_page_index,
+		                          unicode_to_double_byte_stream_pages );
+
+		safe_utf16_string_index += character_size;
+	}
+	*byte_stream_size   = safe_byte_stream_size;
+	*utf16_string_index = safe_utf16_string_index;
+}
+
+/* Copies a byte stream from an UTF-16 string
+ * The lookup table of the codepage is retrieved once by the caller, either
+ * the single-byte or the double-byte pages are NULL
+ * Advances both indexes to the first character that was not converted
+ */
+void libuna_transcode_byte_stream_copy_from_utf16(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint8_t *unicode_to_byte_stream_pages,
+      const uint16_t *unicode_to_double_byte_stream_pages )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_character_size            = 0;
+	size_t character_size                        = 0;
+	size_t safe_byte_stream_index                = *byte_stream_index;
+	size_t safe_utf16_string_index               = *utf16_string_index;
+
+	while( ( safe_utf16_string_index < utf16_string_size )
+	    && ( safe_byte_stream_index < byte_stream_size ) )
+	{
+		/* Convert runs of 7-bit ASCII characters in bulk, a single 7-bit ASCII
+		 * character is converted with the lookup table
+		 */
+		if( ( utf16_string[ safe_utf16_string_index ] < 0x80 )
+		 && ( ( safe_utf16_string_index + 1 ) < utf16_string_size )
+		 && ( utf16_string[ safe_utf16_string_index + 1 ] < 0x80 ) )
+		{
+			libuna_transcode_byte_stream_copy_ascii_from_utf16(
+			 byte_stream,
+			 byte_stream_size,
+			 &safe_byte_stream_index,
+			 utf16_string,
+			 utf16_string_size,
+			 &safe_utf16_string_index );
+
+			continue;
+		}
+		character_size = libuna_transcode_utf16_character_decode(
+		                  &( utf16_string[ safe_utf16_string_index ] ),
+		                  utf16_string_size - safe_utf16_string_index,
+		                  &unicode_character );
+
+		if( character_size == 0 )
+		{
+			break;
+		}
+		byte_stream_character_size = libuna_transcode_byte_stream_character_copy(
+		                              unicode_character,
+		                              &( byte_stream[ safe_byte_stream_index ] ),
+		                              byte_stream_size - safe_byte_stream_index,
+		                              unicode_to_byte_stream_page_index,
+		                              unicode_to_byte_stream_pages,
+		                              unicode_to_double_byte_stream_pages );
+
+		if( byte_stream_character_size == 0 )
+		{
+			break;
+		}
+		safe_byte_stream_index  += byte_stream_character_size;
+		safe_utf16_string_index += character_size;
+	}
+	*byte_stream_index  = safe_byte_stream_index;
+	*utf16_string_index = safe_utf16_string_index;
+}
+
+/* Determines the size of a byte stream from an UTF-32 string
+ * The lookup table of the codepage is retrieved once by the caller, of which only
+ * the double-byte pages are needed, these are NULL for a single-byte codepage
+ * Adds the number of byte stream bytes to the byte stream size and advances
+ * the UTF-32 string index to the first character that was not converted
+ */
+void libuna_transcode_byte_stream_size_from_utf32(
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint16_t *unicode_to_double_byte_stream_pages,
+      size_t *byte_stream_size )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_size                        = 0;
+	size_t safe_byte_stream_size                 = *byte_stream_size;
+	size_t safe_utf32_string_index               = *utf32_string_index;
+
+	while( safe_utf32_string_index < utf32_string_size )
+	{
+		/* Determine the size of runs of 7-bit ASCII characters in bulk,
+		 * that of a single 7-bit ASCII character with the lookup table
+		 */
+		if( ( utf32_string[ safe_utf32_string_index ] < 0x80 )
+		 && ( ( safe_utf32_string_index + 1 ) < utf32_string_size )
+		 && ( utf32_string[ safe_utf32_string_index + 1 ] < 0x80 ) )
+		{
+			libuna_transcode_ascii_size_from_utf32(
+			 utf32_string,
+			 utf32_string_size,
+			 &safe_utf32_string_index,
+			 &safe_byte_stream_size );
+
+			continue;
+		}
+		/* The low surrogates are replaced by libuna_unicode_character_copy_from_utf32
+		 */
+		if( ( utf32_string[ safe_utf32_string_index ] >= 0xdc00 )
+		 && ( utf32_string[ safe_utf32_string_index ] <= 0xdfff ) )
+		{
+			break;
+		}
+		unicode_character = utf32_string[ safe_utf32_string_index ];
+		character_size    = 1;
+
+		safe_byte_stream_size += libuna_transcode_byte_stream_character_size(
+		                          unicode_character,
+		                          unicode_to_byte_stream_page_index,
+		                          unicode_to_double_byte_stream_pages );
+
+		safe_utf32_string_index += character_size;
+	}
+	*byte_stream_size   = safe_byte_stream_size;
+	*utf32_string_index = safe_utf32_string_index;
+}
+
+/* Copies a byte stream from an UTF-32 string
+ * The lookup table of the codepage is retrieved once by the caller, either
+ * the single-byte or the double-byte pages are NULL
+ * Advances both indexes to the first character that was not converted
+ */
+void libuna_transcode_byte_stream_copy_from_utf32(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint8_t *unicode_to_byte_stream_pages,
+      const uint16_t *unicode_to_double_byte_stream_pages )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_character_size            = 0;
+	size_t character_size                        = 0;
+	size_t safe_byte_stream_index                = *byte_stream_index;
+	size_t safe_utf32_string_index               = *utf32_string_index;
+
+	while( ( safe_utf32_string_index < utf32_string_size )
+	    && ( safe_byte_stream_index < byte_stream_size ) )
+	{
+		/* Convert runs of 7-bit ASCII characters in bulk, a single 7-bit ASCII
+		 * character is converted with the lookup table
+		 */
+		if( ( utf32_string[ safe_utf32_string_index ] < 0x80 )
+		 && ( ( safe_utf32_string_index + 1 ) < utf32_string_size )
+		 && ( utf32_string[ safe_utf32_string_index + 1 ] < 0x80 ) )
+		{
+			libuna_transcode_byte_stream_copy_ascii_from_utf32(
+			 byte_stream,
+			 byte_stream_size,
+			 &safe_byte_stream_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &safe_utf32_string_index );
+
+			continue;
+		}
+		/* The low surrogates are replaced by libuna_unicode_character_copy_from_utf32
+		 */
+		if( ( utf32_string[ safe_utf32_string_index ] >= 0xdc00 )
+		 && ( utf32_string[ safe_utf32_string_index ] <= 0xdfff ) )
+		{
+			break;
+		}
+		unicode_character = utf32_string[ safe_utf32_string_index ];
+		character_size    = 1;
+
+		byte_stream_character_size = libuna_transcode_byte_stream_character_copy(
+		                              unicode_character,
+		                              &( byte_stream[ safe_byte_stream_index ] ),
+		                              byte_stream_size - safe_byte_stream_index,
+		                              unicode_to_byte_stream_page_index,
+		                              unicode_to_byte_stream_pages,
+		                              unicode_to_double_byte_stream_pages );
+
+		if( byte_stream_character_size == 0 )
+		{
+			break;
+		}
+		safe_byte_stream_index  += byte_stream_character_size;
+		safe_utf32_string_index += character_size;
+	}
+	*byte_stream_index  = safe_byte_stream_index;
+	*utf32_string_index = safe_utf32_string_index;
+}
+
+/* The 7-bit ASCII characters that can be directly encoded in UTF-7
+ * The characters are stored as a bitmap of 128 bits
+ */
+static const uint32_t libuna_transcode_utf7_directly_encoded_characters[ 4 ] = {
+	0x00002601UL, 0xfffff7ffUL, 0xefffffffUL, 0x3fffffffUL };
+
+/* Determines the offset of the least significant byte in a code unit
+ * A byte order of 0 represents the byte order of the host
+ * Returns the offset of the least significant byte
+ */
+static uint8_t libuna_transcode_ascii_byte_offset(
+                uint8_t unit_size,
+                int byte_order )
+{
+	uint16_t host_value = 0x0001;
+
+	if( ( unit_size == 1 )
+	 || ( byte_order == LIBUNA_ENDIAN_LITTLE ) )
+	{
+		return( 0 );
+	}
+	if( byte_order == LIBUNA_ENDIAN_BIG )
+	{
+		return( unit_size - 1 );
+	}
+	if( *( (uint8_t *) &host_value ) == 0x01 )
+	{
+		return( 0 );
+	}
+	return( unit_size - 1 );
+}
+
+/* Determines the number of 7-bit ASCII characters at the start of a string
+ * The string consists of code units of 1, 2 or 4 bytes in the specified byte order
+ * The code units are scanned in blocks with a mask that is set for every bit
+ * that cannot be set in a 7-bit ASCII character, the remainder is scanned per code unit
+ * Returns the number of 7-bit ASCII characters
+ */
+static size_t libuna_transcode_ascii_characters_size(
+               const uint8_t *string,
+               size_t number_of_characters,
+               uint8_t unit_size,
+               int byte_order )
+{
+	uint8_t block_mask[ 8 ];
+
+	size_t string_index  = 0;
+	size_t string_size   = 0;
+	uint8_t byte_index   = 0;
+	uint8_t byte_offset  = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit = _mm256_setzero_si256();
+	__m256i mask_256bit  = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit = _mm_setzero_si128();
+	__m128i mask_128bit  = _mm_setzero_si128();
+	__m128i zero_128bit  = _mm_setzero_si128();
+#else
+	uint64_t block_64bit = 0;
+	uint64_t mask_64bit  = 0;
+#endif
+
+	if( number_of_characters == 0 )
+	{
+		return( 0 );
+	}
+	byte_offset = libuna_transcode_ascii_byte_offset(
+	               unit_size,
+	               byte_order );
+
+	/* Check the first character before setting up the block scan
+	 */
+	for( byte_index = 0;
+	     byte_index < unit_size;
+	     byte_index++ )
+	{
+		if( byte_index == byte_offset )
+		{
+			if( string[ byte_index ] >= 0x80 )
+			{
+				return( 0 );
+			}
+		}
+		else if( string[ byte_index ] != 0 )
+		{
+			return( 0 );
+		}
+	}
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index += unit_size )
+	{
+		memory_set(
+		 &( block_mask[ byte_index ] ),
+		 0xff,
+		 unit_size );
+
+		block_mask[ byte_index + byte_offset ] = 0x80;
+	}
+	string_size = number_of_characters * unit_size;
+
+	if( unit_size == 1 )
+	{
+		string_index = libuna_transcode_utf8_ascii_blocks_size(
+		                string,
+		                string_size );
+	}
+	else
+	{
+#if defined( LIBUNA_HAVE_SSE2 )
+		mask_128bit = _mm_loadl_epi64(
+		               (const __m128i *) block_mask );
+
+		mask_128bit = _mm_unpacklo_epi64(
+		               mask_128bit,
+		               mask_128bit );
+#endif
+#if defined( LIBUNA_HAVE_AVX2 )
+		mask_256bit = _mm256_broadcastq_epi64(
+		               mask_128bit );
+
+		while( ( string_size - string_index ) >= 32 )
+		{
+			block_256bit = _mm256_loadu_si256(
+			                (const __m256i *) &( string[ string_index ] ) );
+
+			if( _mm256_testz_si256(
+			     block_256bit,
+			     mask_256bit ) == 0 )
+			{
+				break;
+			}
+			string_index += 32;
+		}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+		while( ( string_size - string_index ) >= 16 )
+		{
+			block_128bit = _mm_loadu_si128(
+			                (const __m128i *) &( string[ string_index ] ) );
+
+			block_128bit = _mm_cmpeq_epi8(
+			                _mm_and_si128(
+			                 block_128bit,
+			                 mask_128bit ),
+			                zero_128bit );
+
+			if( _mm_movemask_epi8( block_128bit ) != 0xffff )
+			{
+				break;
+			}
+			string_index += 16;
+		}
+#else
+		memory_copy(
+		 &mask_64bit,
+		 block_mask,
+		 8 );
+
+		while( ( string_size - string_index ) >= 8 )
+		{
+			memory_copy(
+			 &block_64bit,
+			 &( string[ string_index ] ),
+			 8 );
+
+			if( ( block_64bit & mask_64bit ) != 0 )
+			{
+				break;
+			}
+			string_index += 8;
+		}
+#endif
+	}
+	/* The blocks are a multiple of the code unit size
+	 * so the remainder starts at a code unit boundary
+	 */
+	while( string_index < string_size )
+	{
+		for( byte_index = 0;
+		     byte_index < unit_size;
+		     byte_index++ )
+		{
+			if( ( string[ string_index + byte_index ] & block_mask[ byte_index ] ) != 0 )
+			{
+				break;
+			}
+		}
+		if( byte_index < unit_size )
+		{
+			break;
+		}
+		string_index += unit_size;
+	}
+	return( string_index / unit_size );
+}
+
+/* Determines the number of directly encoded 7-bit ASCII characters at the start of an UTF-7 stream
+ * The + character is not included since it starts a base64 encoded sequence
+ * Returns the number of directly encoded characters
+ */
+static size_t libuna_transcode_utf7_direct_characters_size(
+               const uint8_t *utf7_stream,
+               size_t utf7_stream_size )
+{
+	size_t utf7_stream_index = 0;
+	uint8_t byte_value       = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit     = _mm256_setzero_si256();
+	__m256i lower_256bit     = _mm256_set1_epi8( 0x1f );
+	__m256i upper_256bit     = _mm256_set1_epi8( 0x7e );
+	__m256i plus_256bit      = _mm256_set1_epi8( '+' );
+	__m256i backslash_256bit = _mm256_set1_epi8( '\\' );
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit     = _mm_setzero_si128();
+	__m128i lower_128bit     = _mm_set1_epi8( 0x1f );
+	__m128i upper_128bit     = _mm_set1_epi8( 0x7e );
+	__m128i plus_128bit      = _mm_set1_epi8( '+' );
+	__m128i backslash_128bit = _mm_set1_epi8( '\\' );
+#endif
+
+	/* The blocks only contain the printable characters, other
+	 * directly encoded characters such as white space are handled per byte
+	 */
+#if defined( LIBUNA_HAVE_AVX2 )
+	while( ( utf7_stream_size - utf7_stream_index ) >= 32 )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf7_stream[ utf7_stream_index ] ) );
+
+		block_256bit = _mm256_andnot_si256(
+		                _mm256_or_si256(
+		                 _mm256_cmpeq_epi8(
+		                  block_256bit,
+		                  plus_256bit ),
+		                 _mm256_cmpeq_epi8(
+		                  block_256bit,
+		                  backslash_256bit ) ),
+		                _mm256_and_si256(
+		                 _mm256_cmpgt_epi8(
+		                  block_256bit,
+		                  lower_256bit ),
+		                 _mm256_cmpgt_epi8(
+		                  upper_256bit,
+		                  block_256bit ) ) );
+
+		if( _mm256_movemask_epi8( block_256bit ) != -1 )
+		{
+			break;
+		}
+		utf7_stream_index += 32;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( utf7_stream_size - utf7_stream_index ) >= 16 )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf7_stream[ utf7_stream_index ] ) );
+
+		block_128bit = _mm_andnot_si128(
+		                _mm_or_si128(
+		                 _mm_cmpeq_epi8(
+		                  block_128bit,
+		                  plus_128bit ),
+		                 _mm_cmpeq_epi8(
+		                  block_128bit,
+		                  backslash_128bit ) ),
+		                _mm_and_si128(
+		                 _mm_cmpgt_epi8(
+		                  block_128bit,
+		                  lower_128bit ),
+		                 _mm_cmplt_epi8(
+		                  block_128bit,
+		                  upper_128bit ) ) );
+
+		if( _mm_movemask_epi8( block_128bit ) != 0xffff )
+		{
+			break;
+		}
+		utf7_stream_index += 16;
+	}
+#endif
+	while( utf7_stream_index < utf7_stream_size )
+	{
+		byte_value = utf7_stream[ utf7_stream_index ];
+
+		if( ( byte_value >= 0x80 )
+		 || ( ( libuna_transcode_utf7_directly_encoded_characters[ byte_value >> 5 ] & ( 1UL << ( byte_value & 0x1f ) ) ) == 0 ) )
+		{
+			break;
+		}
+		utf7_stream_index++;
+	}
+	return( utf7_stream_index );
+}
+
+/* Copies 7-bit ASCII characters from a string of code units to another
+ * The strings consist of code units of 1, 2 or 4 bytes in the specified byte order
+ * The source string must contain at least the number of characters in 7-bit ASCII
+ */
+static void libuna_transcode_ascii_characters_copy(
+             uint8_t *destination,
+             uint8_t destination_unit_size,
+             int destination_byte_order,
+             const uint8_t *source,
+             uint8_t source_unit_size,
+             int source_byte_order,
+             size_t number_of_characters )
+{
+	size_t character_index      = 0;
+	uint8_t destination_offset  = 0;
+	uint8_t source_offset       = 0;
+
+	if( number_of_characters == 0 )
+	{
+		return;
+	}
+	destination_offset = libuna_transcode_ascii_byte_offset(
+	                      destination_unit_size,
+	                      destination_byte_order );
+
+	source_offset = libuna_transcode_ascii_byte_offset(
+	                 source_unit_size,
+	                 source_byte_order );
+
+	if( ( destination_unit_size == source_unit_size )
+	 && ( destination_offset == source_offset ) )
+	{
+		memory_copy(
+		 destination,
+		 source,
+		 number_of_characters * source_unit_size );
+
+		return;
+	}
+	/* Widen the bytes in bulk for strings in the byte order of the host
+	 */
+	if( ( source_unit_size == 1 )
+	 && ( destination_byte_order == 0 ) )
+	{
+		if( destination_unit_size == 2 )
+		{
+			character_index = libuna_transcode_utf16_copy_from_ascii_blocks(
+			                   (libuna_utf16_character_t *) destination,
+			                   number_of_characters,
+			                   source,
+			                   number_of_characters );
+		}
+		else if( destination_unit_size == 4 )
+		{
+			character_index = libuna_transcode_utf32_copy_from_ascii_blocks(
+			                   (libuna_utf32_character_t *) destination,
+			                   number_of_characters,
+			                   source,
+			                   number_of_characters );
+		}
+	}
+	if( destination_unit_size == 1 )
+	{
+		while( character_index < number_of_characters )
+		{
+			destination[ character_index ] = source[ ( character_index * source_unit_size ) + source_offset ];
+
+			character_index++;
+		}
+		return;
+	}
+	memory_set(
+	 &( destination[ character_index * destination_unit_size ] ),
+	 0,
+	 ( number_of_characters - character_index ) * destination_unit_size );
+
+	while( character_index < number_of_characters )
+	{
+		destination[ ( character_index * destination_unit_size ) + destination_offset ] = source[ ( character_index * source_unit_size ) + source_offset ];
+
+		character_index++;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of a string of code units to another
+ * The sizes are in number of code units
+ * Returns the number of characters copied
+ */
+static size_t libuna_transcode_ascii_copy(
+               uint8_t *destination,
+               size_t destination_size,
+               uint8_t destination_unit_size,
+               int destination_byte_order,
+               const uint8_t *source,
+               size_t source_size,
+               uint8_t source_unit_size,
+               int source_byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( source_size > destination_size )
+	{
+		source_size = destination_size;
+	}
+	number_of_characters = libuna_transcode_ascii_characters_size(
+	                        source,
+	                        source_size,
+	                        source_unit_size,
+	                        source_byte_order );
+
+	libuna_transcode_ascii_characters_copy(
+	 destination,
+	 destination_unit_size,
+	 destination_byte_order,
+	 source,
+	 source_unit_size,
+	 source_byte_order,
+	 number_of_characters );
+
+	return( number_of_characters );
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-7 stream
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-7 stream index
+ */
+void libuna_transcode_ascii_size_from_utf7_stream(
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( ( utf7_stream_base64_data == 0 )
+	 && ( *utf7_stream_index < utf7_stream_size ) )
+	{
+		number_of_characters = libuna_transcode_utf7_direct_characters_size(
+		                        &( utf7_stream[ *utf7_stream_index ] ),
+		                        utf7_stream_size - *utf7_stream_index );
+
+		*utf7_stream_index += number_of_characters;
+		*string_size       += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-8 string
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-8 string index
+ */
+void libuna_transcode_ascii_size_from_utf8(
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf8_string_index < utf8_string_size )
+	 && ( utf8_string[ *utf8_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0 );
+
+		*utf8_string_index += number_of_characters;
+		*string_size       += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-8 stream
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-8 stream index
+ */
+void libuna_transcode_ascii_size_from_utf8_stream(
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf8_stream_index < utf8_stream_size )
+	 && ( utf8_stream[ *utf8_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        &( utf8_stream[ *utf8_stream_index ] ),
+		                        utf8_stream_size - *utf8_stream_index,
+		                        1,
+		                        0 );
+
+		*utf8_stream_index += number_of_characters;
+		*string_size       += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-16 string
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-16 string index
+ */
+void libuna_transcode_ascii_size_from_utf16(
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_string_index < utf16_string_size )
+	 && ( utf16_string[ *utf16_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        (const uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0 );
+
+		*utf16_string_index += number_of_characters;
+		*string_size        += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-16 stream
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-16 stream index
+ */
+void libuna_transcode_ascii_size_from_utf16_stream(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( *utf16_stream_index < utf16_stream_size )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        &( utf16_stream[ *utf16_stream_index ] ),
+		                        ( utf16_stream_size - *utf16_stream_index ) / 2,
+		                        2,
+		                        byte_order );
+
+		*utf16_stream_index += number_of_characters * 2;
+		*string_size        += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-32 string
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-32 string index
+ */
+void libuna_transcode_ascii_size_from_utf32(
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( utf32_string[ *utf32_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        (const uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0 );
+
+		*utf32_string_index += number_of_characters;
+		*string_size        += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of an UTF-32 stream
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the UTF-32 stream index
+ */
+void libuna_transcode_ascii_size_from_utf32_stream(
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( *utf32_stream_index < utf32_stream_size )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        &( utf32_stream[ *utf32_stream_index ] ),
+		                        ( utf32_stream_size - *utf32_stream_index ) / 4,
+		                        4,
+		                        byte_order );
+
+		*utf32_stream_index += number_of_characters * 4;
+		*string_size        += number_of_characters;
+	}
+}
+
+/* Determines the size of the 7-bit ASCII characters at the start of a byte stream
+ * Every 7-bit ASCII character is converted into a single character or byte, hence
+ * adds the number of characters to the string size and advances the byte stream index
+ */
+void libuna_transcode_ascii_size_from_byte_stream(
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      size_t *string_size )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *byte_stream_index < byte_stream_size )
+	 && ( byte_stream[ *byte_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_characters_size(
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0 );
+
+		*byte_stream_index += number_of_characters;
+		*string_size       += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-7 stream to an UTF-8 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf8_copy_ascii_from_utf7_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data )
+{
+	size_t number_of_characters = 0;
+
+	if( ( utf7_stream_base64_data == 0 )
+	 && ( *utf8_string_index < utf8_string_size )
+	 && ( *utf7_stream_index < utf7_stream_size ) )
+	{
+		number_of_characters = utf7_stream_size - *utf7_stream_index;
+
+		if( number_of_characters > ( utf8_string_size - *utf8_string_index ) )
+		{
+			number_of_characters = utf8_string_size - *utf8_string_index;
+		}
+		number_of_characters = libuna_transcode_utf7_direct_characters_size(
+		                        &( utf7_stream[ *utf7_stream_index ] ),
+		                        number_of_characters );
+
+		libuna_transcode_ascii_characters_copy(
+		 &( utf8_string[ *utf8_string_index ] ),
+		 1,
+		 0,
+		 &( utf7_stream[ *utf7_stream_index ] ),
+		 1,
+		 0,
+		 number_of_characters );
+
+		*utf8_string_index += number_of_characters;
+		*utf7_stream_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-8 stream to an UTF-8 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf8_copy_ascii_from_utf8_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf8_string_index < utf8_string_size )
+	 && ( *utf8_stream_index < utf8_stream_size )
+	 && ( utf8_stream[ *utf8_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0,
+		                        &( utf8_stream[ *utf8_stream_index ] ),
+		                        utf8_stream_size - *utf8_stream_index,
+		                        1,
+		                        0 );
+
+		*utf8_string_index += number_of_characters;
+		*utf8_stream_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 string to an UTF-8 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf8_copy_ascii_from_utf32(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf8_string_index < utf8_string_size )
+	 && ( *utf32_string_index < utf32_string_size )
+	 && ( utf32_string[ *utf32_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0,
+		                        (const uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0 );
+
+		*utf8_string_index  += number_of_characters;
+		*utf32_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 stream to an UTF-8 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf8_copy_ascii_from_utf32_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf8_string_index < utf8_string_size )
+	 && ( *utf32_stream_index < utf32_stream_size ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0,
+		                        &( utf32_stream[ *utf32_stream_index ] ),
+		                        ( utf32_stream_size - *utf32_stream_index ) / 4,
+		                        4,
+		                        byte_order );
+
+		*utf8_string_index  += number_of_characters;
+		*utf32_stream_index += number_of_characters * 4;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of a byte stream to an UTF-8 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf8_copy_ascii_from_byte_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf8_string_index < utf8_string_size )
+	 && ( *byte_stream_index < byte_stream_size )
+	 && ( byte_stream[ *byte_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0,
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0 );
+
+		*utf8_string_index += number_of_characters;
+		*byte_stream_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-7 stream to an UTF-16 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_copy_ascii_from_utf7_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data )
+{
+	size_t number_of_characters = 0;
+
+	if( ( utf7_stream_base64_data == 0 )
+	 && ( *utf16_string_index < utf16_string_size )
+	 && ( *utf7_stream_index < utf7_stream_size ) )
+	{
+		number_of_characters = utf7_stream_size - *utf7_stream_index;
+
+		if( number_of_characters > ( utf16_string_size - *utf16_string_index ) )
+		{
+			number_of_characters = utf16_string_size - *utf16_string_index;
+		}
+		number_of_characters = libuna_transcode_utf7_direct_characters_size(
+		                        &( utf7_stream[ *utf7_stream_index ] ),
+		                        number_of_characters );
+
+		libuna_transcode_ascii_characters_copy(
+		 (uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		 2,
+		 0,
+		 &( utf7_stream[ *utf7_stream_index ] ),
+		 1,
+		 0,
+		 number_of_characters );
+
+		*utf16_string_index += number_of_characters;
+		*utf7_stream_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-16 stream to an UTF-16 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_copy_ascii_from_utf16_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_string_index < utf16_string_size )
+	 && ( *utf16_stream_index < utf16_stream_size ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0,
+		                        &( utf16_stream[ *utf16_stream_index ] ),
+		                        ( utf16_stream_size - *utf16_stream_index ) / 2,
+		                        2,
+		                        byte_order );
+
+		*utf16_string_index += number_of_characters;
+		*utf16_stream_index += number_of_characters * 2;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 string to an UTF-16 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_copy_ascii_from_utf32(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_string_index < utf16_string_size )
+	 && ( *utf32_string_index < utf32_string_size )
+	 && ( utf32_string[ *utf32_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0,
+		                        (const uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0 );
+
+		*utf16_string_index += number_of_characters;
+		*utf32_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 stream to an UTF-16 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_copy_ascii_from_utf32_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_string_index < utf16_string_size )
+	 && ( *utf32_stream_index < utf32_stream_size ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0,
+		                        &( utf32_stream[ *utf32_stream_index ] ),
+		                        ( utf32_stream_size - *utf32_stream_index ) / 4,
+		                        4,
+		                        byte_order );
+
+		*utf16_string_index += number_of_characters;
+		*utf32_stream_index += number_of_characters * 4;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of a byte stream to an UTF-16 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_copy_ascii_from_byte_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_string_index < utf16_string_size )
+	 && ( *byte_stream_index < byte_stream_size )
+	 && ( byte_stream[ *byte_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0,
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0 );
+
+		*utf16_string_index += number_of_characters;
+		*byte_stream_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-7 stream to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_utf7_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data )
+{
+	size_t number_of_characters = 0;
+
+	if( ( utf7_stream_base64_data == 0 )
+	 && ( *utf32_string_index < utf32_string_size )
+	 && ( *utf7_stream_index < utf7_stream_size ) )
+	{
+		number_of_characters = utf7_stream_size - *utf7_stream_index;
+
+		if( number_of_characters > ( utf32_string_size - *utf32_string_index ) )
+		{
+			number_of_characters = utf32_string_size - *utf32_string_index;
+		}
+		number_of_characters = libuna_transcode_utf7_direct_characters_size(
+		                        &( utf7_stream[ *utf7_stream_index ] ),
+		                        number_of_characters );
+
+		libuna_transcode_ascii_characters_copy(
+		 (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		 4,
+		 0,
+		 &( utf7_stream[ *utf7_stream_index ] ),
+		 1,
+		 0,
+		 number_of_characters );
+
+		*utf32_string_index += number_of_characters;
+		*utf7_stream_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-8 string to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_utf8(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( *utf8_string_index < utf8_string_size )
+	 && ( utf8_string[ *utf8_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0,
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0 );
+
+		*utf32_string_index += number_of_characters;
+		*utf8_string_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-8 stream to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_utf8_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( *utf8_stream_index < utf8_stream_size )
+	 && ( utf8_stream[ *utf8_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0,
+		                        &( utf8_stream[ *utf8_stream_index ] ),
+		                        utf8_stream_size - *utf8_stream_index,
+		                        1,
+		                        0 );
+
+		*utf32_string_index += number_of_characters;
+		*utf8_stream_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-16 string to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_utf16(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( *utf16_string_index < utf16_string_size )
+	 && ( utf16_string[ *utf16_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0,
+		                        (const uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0 );
+
+		*utf32_string_index += number_of_characters;
+		*utf16_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-16 stream to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_utf16_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( *utf16_stream_index < utf16_stream_size ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0,
+		                        &( utf16_stream[ *utf16_stream_index ] ),
+		                        ( utf16_stream_size - *utf16_stream_index ) / 2,
+		                        2,
+		                        byte_order );
+
+		*utf32_string_index += number_of_characters;
+		*utf16_stream_index += number_of_characters * 2;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 stream to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_utf32_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( *utf32_stream_index < utf32_stream_size ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0,
+		                        &( utf32_stream[ *utf32_stream_index ] ),
+		                        ( utf32_stream_size - *utf32_stream_index ) / 4,
+		                        4,
+		                        byte_order );
+
+		*utf32_string_index += number_of_characters;
+		*utf32_stream_index += number_of_characters * 4;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of a byte stream to an UTF-32 string
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_copy_ascii_from_byte_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_string_index < utf32_string_size )
+	 && ( *byte_stream_index < byte_stream_size )
+	 && ( byte_stream[ *byte_stream_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        (uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0,
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0 );
+
+		*utf32_string_index += number_of_characters;
+		*byte_stream_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-8 string to an UTF-16 stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_stream_copy_ascii_from_utf8(
+      uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_stream_index < utf16_stream_size )
+	 && ( *utf8_string_index < utf8_string_size )
+	 && ( utf8_string[ *utf8_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf16_stream[ *utf16_stream_index ] ),
+		                        ( utf16_stream_size - *utf16_stream_index ) / 2,
+		                        2,
+		                        byte_order,
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0 );
+
+		*utf16_stream_index += number_of_characters * 2;
+		*utf8_string_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 string to an UTF-16 stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf16_stream_copy_ascii_from_utf32(
+      uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf16_stream_index < utf16_stream_size )
+	 && ( *utf32_string_index < utf32_string_size )
+	 && ( utf32_string[ *utf32_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf16_stream[ *utf16_stream_index ] ),
+		                        ( utf16_stream_size - *utf16_stream_index ) / 2,
+		                        2,
+		                        byte_order,
+		                        (const uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0 );
+
+		*utf16_stream_index += number_of_characters * 2;
+		*utf32_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-8 string to an UTF-32 stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_stream_copy_ascii_from_utf8(
+      uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_stream_index < utf32_stream_size )
+	 && ( *utf8_string_index < utf8_string_size )
+	 && ( utf8_string[ *utf8_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf32_stream[ *utf32_stream_index ] ),
+		                        ( utf32_stream_size - *utf32_stream_index ) / 4,
+		                        4,
+		                        byte_order,
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0 );
+
+		*utf32_stream_index += number_of_characters * 4;
+		*utf8_string_index  += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-16 string to an UTF-32 stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_utf32_stream_copy_ascii_from_utf16(
+      uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      int byte_order )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *utf32_stream_index < utf32_stream_size )
+	 && ( *utf16_string_index < utf16_string_size )
+	 && ( utf16_string[ *utf16_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( utf32_stream[ *utf32_stream_index ] ),
+		                        ( utf32_stream_size - *utf32_stream_index ) / 4,
+		                        4,
+		                        byte_order,
+		                        (const uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0 );
+
+		*utf32_stream_index += number_of_characters * 4;
+		*utf16_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-8 string to a byte stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_byte_stream_copy_ascii_from_utf8(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *byte_stream_index < byte_stream_size )
+	 && ( *utf8_string_index < utf8_string_size )
+	 && ( utf8_string[ *utf8_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0,
+		                        &( utf8_string[ *utf8_string_index ] ),
+		                        utf8_string_size - *utf8_string_index,
+		                        1,
+		                        0 );
+
+		*byte_stream_index += number_of_characters;
+		*utf8_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-16 string to a byte stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_byte_stream_copy_ascii_from_utf16(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *byte_stream_index < byte_stream_size )
+	 && ( *utf16_string_index < utf16_string_size )
+	 && ( utf16_string[ *utf16_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0,
+		                        (const uint8_t *) &( utf16_string[ *utf16_string_index ] ),
+		                        utf16_string_size - *utf16_string_index,
+		                        2,
+		                        0 );
+
+		*byte_stream_index  += number_of_characters;
+		*utf16_string_index += number_of_characters;
+	}
+}
+
+/* Copies the 7-bit ASCII characters at the start of an UTF-32 string to a byte stream
+ * Advances both indexes to the first character that was not copied
+ */
+void libuna_transcode_byte_stream_copy_ascii_from_utf32(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index )
+{
+	size_t number_of_characters = 0;
+
+	if( ( *byte_stream_index < byte_stream_size )
+	 && ( *utf32_string_index < utf32_string_size )
+	 && ( utf32_string[ *utf32_string_index ] < 0x80 ) )
+	{
+		number_of_characters = libuna_transcode_ascii_copy(
+		                        &( byte_stream[ *byte_stream_index ] ),
+		                        byte_stream_size - *byte_stream_index,
+		                        1,
+		                        0,
+		                        (const uint8_t *) &( utf32_string[ *utf32_string_index ] ),
+		                        utf32_string_size - *utf32_string_index,
+		                        4,
+		                        0 );
+
+		*byte_stream_index  += number_of_characters;
+		*utf32_string_index += number_of_characters;
+	}
+}
+
+
+/* The byte classes of the UTF-8 validation state machine
+ * The classes distinguish the byte ranges that libuna_unicode_character_copy_from_utf8
+ * accepts at the different positions of an UTF-8 character, which includes
+ * the overlong 2-byte forms with a 1st byte of 0xc0 or 0xc1
+ */
+static const uint8_t libuna_transcode_utf8_byte_classes[ 256 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6,
+	8, 9, 9, 9, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11 };
+
+/* The state transitions of the UTF-8 validation state machine indexed by state + byte class
+ * The states are multiples of 12, where 0 represents the end of a valid UTF-8 character
+ * and 12 represents an invalid UTF-8 character, which the state machine does not leave
+ */
+static const uint8_t libuna_transcode_utf8_state_transitions[ 108 ] = {
+	0, 12, 12, 12, 24, 48, 36, 60, 72, 84, 96, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 24, 24, 24, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 24, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 24, 24, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 36, 36, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 36, 36, 36, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12 };
+
+#if defined( LIBUNA_HAVE_SSSE3 )
+
+/* The UTF-8 block validation tables, for more information see:
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" by John Keiser and Daniel Lemire
+ * The error bits are:
+ * 0x01 too short, 0x02 too long, 0x04 overlong 3-byte form, 0x08 too large,
+ * 0x10 surrogate, 0x40 too large or overlong 4-byte form, 0x80 two continuation bytes
+ * The overlong 2-byte form bit (0x20) is not set to accept the same UTF-8 characters
+ * as libuna_unicode_character_copy_from_utf8
+ */
+#define LIBUNA_TRANSCODE_UTF8_BYTE_1_HIGH_TABLE \
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, \
+	0x80, 0x80, 0x80, 0x80, 0x01, 0x01, 0x15, 0x49
+
+#define LIBUNA_TRANSCODE_UTF8_BYTE_1_LOW_TABLE \
+	(char) 0xc7, (char) 0x83, (char) 0x83, (char) 0x83, (char) 0x8b, (char) 0xcb, (char) 0xcb, (char) 0xcb, \
+	(char) 0xcb, (char) 0xcb, (char) 0xcb, (char) 0xcb, (char) 0xcb, (char) 0xdb, (char) 0xcb, (char) 0xcb
+
+#define LIBUNA_TRANSCODE_UTF8_BYTE_2_HIGH_TABLE \
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, \
+	(char) 0xc6, (char) 0x8e, (char) 0x9a, (char) 0x9a, 0x01, 0x01, 0x01, 0x01
+
+#endif /* defined( LIBUNA_HAVE_SSSE3 ) */
+
+/* Determines the number of bytes at the start of an UTF-8 stream that are in blocks
+ * of valid UTF-8 characters, where the UTF-8 stream starts with an UTF-8 character
+ * The last UTF-8 character in the blocks can continue after the blocks, the block
+ * that contains an invalid UTF-8 character and the remainder are left to the caller
+ * Returns the number of bytes in the valid blocks
+ */
+static size_t libuna_transcode_utf8_valid_blocks_size(
+               const uint8_t *utf8_stream,
+               size_t utf8_stream_size )
+{
+	size_t utf8_stream_index          = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit              = _mm256_setzero_si256();
+	__m256i byte_1_high_256bit        = _mm256_setzero_si256();
+	__m256i byte_1_low_256bit         = _mm256_setzero_si256();
+	__m256i byte_2_high_256bit        = _mm256_setzero_si256();
+	__m256i error_256bit              = _mm256_setzero_si256();
+	__m256i incomplete_256bit         = _mm256_setzero_si256();
+	__m256i previous_1_256bit         = _mm256_setzero_si256();
+	__m256i previous_2_256bit         = _mm256_setzero_si256();
+	__m256i previous_3_256bit         = _mm256_setzero_si256();
+	__m256i previous_block_256bit     = _mm256_setzero_si256();
+	__m256i previous_lanes_256bit     = _mm256_setzero_si256();
+
+#elif defined( LIBUNA_HAVE_SSSE3 )
+	__m128i block_128bit              = _mm_setzero_si128();
+	__m128i byte_1_high_128bit        = _mm_setzero_si128();
+	__m128i byte_1_low_128bit         = _mm_setzero_si128();
+	__m128i byte_2_high_128bit        = _mm_setzero_si128();
+	__m128i error_128bit              = _mm_setzero_si128();
+	__m128i incomplete_128bit         = _mm_setzero_si128();
+	__m128i previous_1_128bit         = _mm_setzero_si128();
+	__m128i previous_2_128bit         = _mm_setzero_si128();
+	__m128i previous_3_128bit         = _mm_setzero_si128();
+	__m128i previous_block_128bit     = _mm_setzero_si128();
+#endif
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	const __m256i byte_1_high_table   = _mm256_setr_epi8(
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_1_HIGH_TABLE,
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_1_HIGH_TABLE );
+	const __m256i byte_1_low_table    = _mm256_setr_epi8(
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_1_LOW_TABLE,
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_1_LOW_TABLE );
+	const __m256i byte_2_high_table   = _mm256_setr_epi8(
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_2_HIGH_TABLE,
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_2_HIGH_TABLE );
+	const __m256i incomplete_maximum  = _mm256_setr_epi8(
+	                                     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	                                     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	                                     (char) 0xef, (char) 0xdf, (char) 0xbf );
+	const __m256i nibble_mask         = _mm256_set1_epi8( 0x0f );
+
+	while( ( utf8_stream_size - utf8_stream_index ) >= 32 )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf8_stream[ utf8_stream_index ] ) );
+
+		if( _mm256_movemask_epi8( block_256bit ) == 0 )
+		{
+			/* A block of 7-bit ASCII characters cannot complete the last UTF-8 character of the previous block
+			 */
+			if( _mm256_testz_si256( incomplete_256bit, incomplete_256bit ) == 0 )
+			{
+				break;
+			}
+			utf8_stream_index += libuna_transcode_utf8_ascii_blocks_size(
+			                      &( utf8_stream[ utf8_stream_index ] ),
+			                      utf8_stream_size - utf8_stream_index );
+
+			incomplete_256bit     = _mm256_setzero_si256();
+			previous_block_256bit = _mm256_setzero_si256();
+
+			continue;
+		}
+		previous_lanes_256bit = _mm256_permute2x128_si256(
+		                         previous_block_256bit,
+		                         block_256bit,
+		                         0x21 );
+		previous_1_256bit = _mm256_alignr_epi8(
+		                     block_256bit,
+		                     previous_lanes_256bit,
+		                     15 );
+		previous_2_256bit = _mm256_alignr_epi8(
+		                     block_256bit,
+		                     previous_lanes_256bit,
+		                     14 );
+		previous_3_256bit = _mm256_alignr_epi8(
+		                     block_256bit,
+		                     previous_lanes_256bit,
+		                     13 );
+
+		byte_1_high_256bit = _mm256_shuffle_epi8(
+		                      byte_1_high_table,
+		                      _mm256_and_si256(
+		                       _mm256_srli_epi16(
+		                        previous_1_256bit,
+		                        4 ),
+		                       nibble_mask ) );
+		byte_1_low_256bit = _mm256_shuffle_epi8(
+		                     byte_1_low_table,
+		                     _mm256_and_si256(
+		                      previous_1_256bit,
+		                      nibble_mask ) );
+		byte_2_high_256bit = _mm256_shuffle_epi8(
+		                      byte_2_high_table,
+		                      _mm256_and_si256(
+		                       _mm256_srli_epi16(
+		                        block_256bit,
+		                        4 ),
+		                       nibble_mask ) );
+
+		/* The 3rd and 4th byte of a 3-byte and 4-byte UTF-8 character are the only
+		 * continuation bytes that are allowed to follow another continuation byte
+		 */
+		error_256bit = _mm256_xor_si256(
+		                _mm256_and_si256(
+		                 byte_1_high_256bit,
+		                 _mm256_and_si256(
+		                  byte_1_low_256bit,
+		                  byte_2_high_256bit ) ),
+		                _mm256_and_si256(
+		                 _mm256_or_si256(
+		                  _mm256_subs_epu8(
+		                   previous_2_256bit,
+		                   _mm256_set1_epi8( (char) ( 0xe0 - 0x80 ) ) ),
+		                  _mm256_subs_epu8(
+		                   previous_3_256bit,
+		                   _mm256_set1_epi8( (char) ( 0xf0 - 0x80 ) ) ) ),
+		                 _mm256_set1_epi8( (char) 0x80 ) ) );
+
+		if( _mm256_testz_si256( error_256bit, error_256bit ) == 0 )
+		{
+			break;
+		}
+		incomplete_256bit = _mm256_subs_epu8(
+		                     block_256bit,
+		                     incomplete_maximum );
+
+		previous_block_256bit = block_256bit;
+		utf8_stream_index    += 32;
+	}
+#elif defined( LIBUNA_HAVE_SSSE3 )
+	const __m128i byte_1_high_table   = _mm_setr_epi8(
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_1_HIGH_TABLE );
+	const __m128i byte_1_low_table    = _mm_setr_epi8(
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_1_LOW_TABLE );
+	const __m128i byte_2_high_table   = _mm_setr_epi8(
+	                                     LIBUNA_TRANSCODE_UTF8_BYTE_2_HIGH_TABLE );
+	const __m128i incomplete_maximum  = _mm_setr_epi8(
+	                                     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	                                     (char) 0xef, (char) 0xdf, (char) 0xbf );
+	const __m128i nibble_mask         = _mm_set1_epi8( 0x0f );
+
+	while( ( utf8_stream_size - utf8_stream_index ) >= 16 )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf8_stream[ utf8_stream_index ] ) );
+
+		if( _mm_movemask_epi8( block_128bit ) == 0 )
+		{
+			/* A block of 7-bit ASCII characters cannot complete the last UTF-8 character of the previous block
+			 */
+			if( _mm_movemask_epi8(
+			     _mm_cmpeq_epi8(
+			      incomplete_128bit,
+			      _mm_setzero_si128() ) ) != 0xffff )
+			{
+				break;
+			}
+			utf8_stream_index += libuna_transcode_utf8_ascii_blocks_size(
+			                      &( utf8_stream[ utf8_stream_index ] ),
+			                      utf8_stream_size - utf8_stream_index );
+
+			incomplete_128bit     = _mm_setzero_si128();
+			previous_block_128bit = _mm_setzero_si128();
+
+			continue;
+		}
+		previous_1_128bit = _mm_alignr_epi8(
+		                     block_128bit,
+		                     previous_block_128bit,
+		                     15 );
+		previous_2_128bit = _mm_alignr_epi8(
+		                     block_128bit,
+		                     previous_block_128bit,
+		                     14 );
+		previous_3_128bit = _mm_alignr_epi8(
+		                     block_128bit,
+		                     previous_block_128bit,
+		                     13 );
+
+		byte_1_high_128bit = _mm_shuffle_epi8(
+		                      byte_1_high_table,
+		                      _mm_and_si128(
+		                       _mm_srli_epi16(
+		                        previous_1_128bit,
+		                        4 ),
+		                       nibble_mask ) );
+		byte_1_low_128bit = _mm_shuffle_epi8(
+		                     byte_1_low_table,
+		                     _mm_and_si128(
+		                      previous_1_128bit,
+		                      nibble_mask ) );
+		byte_2_high_128bit = _mm_shuffle_epi8(
+		                      byte_2_high_table,
+		                      _mm_and_si128(
+		                       _mm_srli_epi16(
+		                        block_128bit,
+		                        4 ),
+		                       nibble_mask ) );
+
+		/* The 3rd and 4th byte of a 3-byte and 4-byte UTF-8 character are the only
+		 * continuation bytes that are allowed to follow another continuation byte
+		 */
+		error_128bit = _mm_xor_si128(
+		                _mm_and_si128(
+		                 byte_1_high_128bit,
+		                 _mm_and_si128(
+		                  byte_1_low_128bit,
+		                  byte_2_high_128bit ) ),
+		                _mm_and_si128(
+		                 _mm_or_si128(
+		                  _mm_subs_epu8(
+		                   previous_2_128bit,
+		                   _mm_set1_epi8( (char) ( 0xe0 - 0x80 ) ) ),
+		                  _mm_subs_epu8(
+		                   previous_3_128bit,
+		                   _mm_set1_epi8( (char) ( 0xf0 - 0x80 ) ) ) ),
+		                 _mm_set1_epi8( (char) 0x80 ) ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      error_128bit,
+		      _mm_setzero_si128() ) ) != 0xffff )
+		{
+			break;
+		}
+		incomplete_128bit = _mm_subs_epu8(
+		                     block_128bit,
+		                     incomplete_maximum );
+
+		previous_block_128bit = block_128bit;
+		utf8_stream_index    += 16;
+	}
+#else
+	utf8_stream_index = libuna_transcode_utf8_ascii_blocks_size(
+	                     utf8_stream,
+	                     utf8_stream_size );
+#endif
+	return( utf8_stream_index );
+}
+
+/* Validates the UTF-8 characters at the start of an UTF-8 stream
+ * The UTF-8 characters are validated in blocks and the blocks that contain
+ * an invalid UTF-8 character are validated with the UTF-8 validation state machine
+ * Advances the UTF-8 stream index to the first UTF-8 character that is invalid
+ * or incomplete or to the end of the UTF-8 stream
+ */
+void libuna_transcode_utf8_stream_validate(
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index )
+{
+	size_t block_stream_size   = 0;
+	size_t character_index     = 0;
+	size_t stream_index        = 0;
+	size_t validate_index      = 0;
+	uint8_t back_index         = 0;
+	uint8_t state              = 0;
+
+	stream_index = *utf8_stream_index;
+
+	while( stream_index < utf8_stream_size )
+	{
+		block_stream_size = libuna_transcode_utf8_valid_blocks_size(
+		                     &( utf8_stream[ stream_index ] ),
+		                     utf8_stream_size - stream_index );
+
+		stream_index += block_stream_size;
+
+		/* The last UTF-8 character of the blocks can be incomplete hence
+		 * the state machine continues at the start of the character
+		 */
+		for( back_index = 1;
+		     ( back_index <= 3 ) && ( back_index <= block_stream_size );
+		     back_index++ )
+		{
+			if( utf8_stream[ stream_index - back_index ] < 0x80 )
+			{
+				stream_index -= back_index - 1;
+
+				break;
+			}
+			else if( utf8_stream[ stream_index - back_index ] >= 0xc0 )
+			{
+				stream_index -= back_index;
+
+				break;
+			}
+		}
+		/* Validate at least the size of a block with the state machine before
+		 * continuing with the blocks, since the state machine does not leave
+		 * the invalid state it is only tested after the block
+		 */
+		character_index = stream_index;
+		state           = 0;
+
+		do
+		{
+			validate_index = utf8_stream_size - stream_index;
+
+			if( validate_index > 32 )
+			{
+				validate_index = 32;
+			}
+			validate_index += stream_index;
+
+			while( stream_index < validate_index )
+			{
+				state = libuna_transcode_utf8_state_transitions[ state + libuna_transcode_utf8_byte_classes[ utf8_stream[ stream_index ] ] ];
+
+				stream_index++;
+
+				character_index = ( state == 0 ) ? stream_index : character_index;
+			}
+		}
+		while( ( state != 0 )
+		    && ( state != 12 )
+		    && ( stream_index < utf8_stream_size ) );
+
+		if( state != 0 )
+		{
+			stream_index = character_index;
+
+			break;
+		}
+	}
+	*utf8_stream_index = stream_index;
+}
+
+/* Validates the UTF-16 characters at the start of an UTF-16 stream
+ * The UTF-16 stream is validated in blocks that do not contain unpaired surrogates
+ * Advances the UTF-16 stream index to the first UTF-16 character that is invalid
+ * or incomplete or to the end of the UTF-16 stream
+ */
+void libuna_transcode_utf16_stream_validate(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order )
+{
+	size_t stream_index                      = 0;
+	size_t validate_index                    = 0;
+	libuna_utf16_character_t utf16_character = 0;
+	libuna_utf16_character_t utf16_surrogate = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit                     = _mm_setzero_si128();
+	int high_surrogate_mask                  = 0;
+	int low_surrogate_mask                   = 0;
+	int pending_high_surrogate_mask          = 0;
+#endif
+
+	stream_index = *utf16_stream_index;
+
+	while( ( stream_index + 1 ) < utf16_stream_size )
+	{
+#if defined( LIBUNA_HAVE_SSE2 )
+		pending_high_surrogate_mask = 0;
+
+		while( ( utf16_stream_size - stream_index ) >= 16 )
+		{
+			block_128bit = _mm_loadu_si128(
+			                (const __m128i *) &( utf16_stream[ stream_index ] ) );
+
+			/* Determine the upper 8 bits of the UTF-16 characters
+			 */
+			if( byte_order == LIBUNA_ENDIAN_BIG )
+			{
+				block_128bit = _mm_and_si128(
+				                block_128bit,
+				                _mm_set1_epi16( 0x00ff ) );
+			}
+			else
+			{
+				block_128bit = _mm_srli_epi16(
+				                block_128bit,
+				                8 );
+			}
+			block_128bit = _mm_and_si128(
+			                block_128bit,
+			                _mm_set1_epi16( 0x00fc ) );
+
+			high_surrogate_mask = _mm_movemask_epi8(
+			                       _mm_cmpeq_epi16(
+			                        block_128bit,
+			                        _mm_set1_epi16( 0x00d8 ) ) );
+
+			low_surrogate_mask = _mm_movemask_epi8(
+			                      _mm_cmpeq_epi16(
+			                       block_128bit,
+			                       _mm_set1_epi16( 0x00dc ) ) );
+
+			/* Every low surrogate must directly follow a high surrogate
+			 */
+			if( low_surrogate_mask != ( ( ( high_surrogate_mask << 2 ) | pending_high_surrogate_mask ) & 0xffff ) )
+			{
+				break;
+			}
+			pending_high_surrogate_mask = high_surrogate_mask >> 14;
+
+			stream_index += 16;
+		}
+		if( pending_high_surrogate_mask != 0 )
+		{
+			stream_index -= 2;
+		}
+#endif
+		/* Validate at least the size of a block before continuing with the blocks
+		 */
+		validate_index = stream_index + 16;
+
+		while( ( stream_index + 1 ) < utf16_stream_size )
+		{
+			if( byte_order == LIBUNA_ENDIAN_BIG )
+			{
+				utf16_character = ( (libuna_utf16_character_t) utf16_stream[ stream_index ] << 8 )
+				                | utf16_stream[ stream_index + 1 ];
+			}
+			else
+			{
+				utf16_character = ( (libuna_utf16_character_t) utf16_stream[ stream_index + 1 ] << 8 )
+				                | utf16_stream[ stream_index ];
+			}
+			if( ( utf16_character >= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START )
+			 && ( utf16_character <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+			{
+				*utf16_stream_index = stream_index;
+
+				return;
+			}
+			else if( ( utf16_character >= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START )
+			      && ( utf16_character <= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_END ) )
+			{
+				if( ( stream_index + 3 ) >= utf16_stream_size )
+				{
+					*utf16_stream_index = stream_index;
+
+					return;
+				}
+				if( byte_order == LIBUNA_ENDIAN_BIG )
+				{
+					utf16_surrogate = ( (libuna_utf16_character_t) utf16_stream[ stream_index + 2 ] << 8 )
+					                | utf16_stream[ stream_index + 3 ];
+				}
+				else
+				{
+					utf16_surrogate = ( (libuna_utf16_character_t) utf16_stream[ stream_index + 3 ] << 8 )
+					                | utf16_stream[ stream_index + 2 ];
+				}
+				if( ( utf16_surrogate < LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START )
+				 || ( utf16_surrogate > LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+				{
+					*utf16_stream_index = stream_index;
+
+					return;
+				}
+				stream_index += 2;
+			}
+			stream_index += 2;
+
+			if( stream_index >= validate_index )
+			{
+				break;
+			}
+		}
+	}
+	*utf16_stream_index = stream_index;
+}
+
+/* Validates the UTF-32 characters at the start of an UTF-32 stream
+ * The UTF-32 stream is validated in blocks that do not contain surrogates
+ * or values that exceed the maximum Unicode character
+ * Advances the UTF-32 stream index to the first UTF-32 character that is invalid
+ * or incomplete or to the end of the UTF-32 stream
+ */
+void libuna_transcode_utf32_stream_validate(
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order )
+{
+	size_t stream_index                      = 0;
+	size_t validate_index                    = 0;
+	libuna_utf32_character_t utf32_character = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit                     = _mm_setzero_si128();
+	__m128i invalid_128bit                   = _mm_setzero_si128();
+#endif
+
+	stream_index = *utf32_stream_index;
+
+	while( ( stream_index + 3 ) < utf32_stream_size )
+	{
+#if defined( LIBUNA_HAVE_SSE2 )
+		while( ( utf32_stream_size - stream_index ) >= 16 )
+		{
+			block_128bit = _mm_loadu_si128(
+			                (const __m128i *) &( utf32_stream[ stream_index ] ) );
+
+			if( byte_order == LIBUNA_ENDIAN_BIG )
+			{
+				block_128bit = _mm_or_si128(
+				                _mm_or_si128(
+				                 _mm_slli_epi32(
+				                  block_128bit,
+				                  24 ),
+				                 _mm_srli_epi32(
+				                  block_128bit,
+				                  24 ) ),
+				                _mm_or_si128(
+				                 _mm_and_si128(
+				                  _mm_slli_epi32(
+				                   block_128bit,
+				                   8 ),
+				                  _mm_set1_epi32( 0x00ff0000L ) ),
+				                 _mm_and_si128(
+				                  _mm_srli_epi32(
+				                   block_128bit,
+				                   8 ),
+				                  _mm_set1_epi32( 0x0000ff00L ) ) ) );
+			}
+			/* The comparison is signed hence the values are biased
+			 * to compare them as unsigned values
+			 */
+			invalid_128bit = _mm_or_si128(
+			                  _mm_cmpgt_epi32(
+			                   _mm_xor_si128(
+			                    block_128bit,
+			                    _mm_set1_epi32( (int) 0x80000000UL ) ),
+			                   _mm_set1_epi32( (int) ( 0x80000000UL | LIBUNA_UNICODE_CHARACTER_MAX ) ) ),
+			                  _mm_cmpeq_epi32(
+			                   _mm_and_si128(
+			                    block_128bit,
+			                    _mm_set1_epi32( (int) 0xfffff800UL ) ),
+			                   _mm_set1_epi32( 0x0000d800L ) ) );
+
+			if( _mm_movemask_epi8( invalid_128bit ) != 0 )
+			{
+				break;
+			}
+			stream_index += 16;
+		}
+#endif
+		/* Validate at least the size of a block before continuing with the blocks
+		 */
+		validate_index = stream_index + 16;
+
+		while( ( stream_index + 3 ) < utf32_stream_size )
+		{
+			if( byte_order == LIBUNA_ENDIAN_BIG )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 &( utf32_stream[ stream_index ] ),
+				 utf32_character );
+			}
+			else
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( utf32_stream[ stream_index ] ),
+				 utf32_character );
+			}
+			if( ( utf32_character > LIBUNA_UNICODE_CHARACTER_MAX )
+			 || ( ( utf32_character >= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START )
+			  && ( utf32_character <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) ) )
+			{
+				*utf32_stream_index = stream_index;
+
+				return;
+			}
+			stream_index += 4;
+
+			if( stream_index >= validate_index )
+			{
+				break;
+			}
+		}
+	}
+	*utf32_stream_index = stream_index;
+}
+
+#if defined( LIBUNA_HAVE_SSE2 )
+
+/* Determines the number of bits that are set in a 32-bit value
+ * Returns the number of bits that are set
+ */
+static uint8_t libuna_transcode_population_count(
+                uint32_t value )
+{
+	value = value - ( ( value >> 1 ) & 0x55555555UL );
+	value = ( value & 0x33333333UL ) + ( ( value >> 2 ) & 0x33333333UL );
+	value = ( value + ( value >> 4 ) ) & 0x0f0f0f0fUL;
+
+	return( (uint8_t) ( ( value * 0x01010101UL ) >> 24 ) );
+}
+
+#endif /* defined( LIBUNA_HAVE_SSE2 ) */
+
+/* Counts the UTF-8 characters at the start of an UTF-8 string
+ * Every byte that is not a continuation byte (0x80 - 0xbf) starts an UTF-8 character,
+ * which is how libuna_unicode_character_copy_from_utf8 divides a valid UTF-8 string
+ * The bytes are counted in blocks until the block that contains the start of
+ * the character after the maximum number of characters
+ * Advances the UTF-8 string index to the start of the character after the maximum
+ * number of characters or to the end of the UTF-8 string
+ */
+void libuna_transcode_utf8_count_characters(
+      const uint8_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      size_t maximum_number_of_characters,
+      size_t *number_of_characters )
+{
+	size_t character_count     = 0;
+	size_t string_index        = 0;
+	uint8_t block_count        = 0;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	__m256i block_256bit       = _mm256_setzero_si256();
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit       = _mm_setzero_si128();
+#else
+	uint64_t block_64bit       = 0;
+#endif
+
+	string_index = *utf8_string_index;
+
+#if defined( LIBUNA_HAVE_AVX2 )
+	while( ( utf8_string_size - string_index ) >= 32 )
+	{
+		block_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf8_string[ string_index ] ) );
+
+		/* The continuation bytes are the only bytes that are less than -64 as signed values
+		 */
+		block_count = libuna_transcode_population_count(
+		               (uint32_t) _mm256_movemask_epi8(
+		                           _mm256_cmpgt_epi8(
+		                            block_256bit,
+		                            _mm256_set1_epi8( -65 ) ) ) );
+
+		if( ( maximum_number_of_characters - character_count ) <= block_count )
+		{
+			break;
+		}
+		character_count += block_count;
+		string_index    += 32;
+	}
+#endif
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( utf8_string_size - string_index ) >= 16 )
+	{
+		block_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf8_string[ string_index ] ) );
+
+		block_count = libuna_transcode_population_count(
+		               (uint32_t) _mm_movemask_epi8(
+		                           _mm_cmpgt_epi8(
+		                            block_128bit,
+		                            _mm_set1_epi8( -65 ) ) ) );
+
+		if( ( maximum_number_of_characters - character_count ) <= block_count )
+		{
+			break;
+		}
+		character_count += block_count;
+		string_index    += 16;
+	}
+#else
+	while( ( utf8_string_size - string_index ) >= 8 )
+	{
+		memory_copy(
+		 &block_64bit,
+		 &( utf8_string[ string_index ] ),
+		 8 );
+
+		/* Mark the continuation bytes, which have bit 7 set and bit 6 not set,
+		 * and add up the marks
+		 */
+		block_64bit = ( block_64bit >> 7 ) & ~( block_64bit >> 6 ) & 0x0101010101010101ULL;
+		block_count = 8 - (uint8_t) ( ( block_64bit * 0x0101010101010101ULL ) >> 56 );
+
+		if( ( maximum_number_of_characters - character_count ) <= block_count )
+		{
+			break;
+		}
+		character_count += block_count;
+		string_index    += 8;
+	}
+#endif
+	while( string_index < utf8_string_size )
+	{
+		if( ( utf8_string[ string_index ] & 0xc0 ) != 0x80 )
+		{
+			if( character_count >= maximum_number_of_characters )
+			{
+				break;
+			}
+			character_count++;
+		}
+		string_index++;
+	}
+	*utf8_string_index    = string_index;
+	*number_of_characters = character_count;
+}
+
+/* Counts the UTF-16 characters at the start of an UTF-16 stream
+ * A byte order of 0 represents the byte order of the host
+ * A high surrogate starts an UTF-16 character of 2 code units and any other code unit
+ * an UTF-16 character of 1 code unit, which is how libuna_unicode_character_copy_from_utf16
+ * divides an UTF-16 string, where a high surrogate that is followed by another high surrogate
+ * is counted per code unit
+ * Advances the UTF-16 stream index to the start of the character after the maximum
+ * number of characters or to the end of the UTF-16 stream
+ */
+void libuna_transcode_utf16_count_characters(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order,
+      size_t maximum_number_of_characters,
+      size_t *number_of_characters )
+{
+	size_t character_count     = 0;
+	size_t stream_index        = 0;
+	size_t validate_index      = 0;
+	uint8_t byte_offset        = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i block_128bit       = _mm_setzero_si128();
+	uint32_t high_mask         = 0;
+	uint8_t block_count        = 0;
+	uint8_t pending_low        = 0;
+#endif
+
+	/* The byte offset of the most significant byte
+	 */
+	byte_offset  = 1 - libuna_transcode_ascii_byte_offset(
+	                    2,
+	                    byte_order );
+	stream_index = *utf16_stream_index;
+
+	while( ( ( stream_index + 1 ) < utf16_stream_size )
+	    && ( character_count < maximum_number_of_characters ) )
+	{
+#if defined( LIBUNA_HAVE_SSE2 )
+		pending_low = 0;
+
+		while( ( utf16_stream_size - stream_index ) >= 16 )
+		{
+			block_128bit = _mm_loadu_si128(
+			                (const __m128i *) &( utf16_stream[ stream_index ] ) );
+
+			/* Determine the upper 8 bits of the UTF-16 characters
+			 */
+			if( byte_offset == 0 )
+			{
+				block_128bit = _mm_and_si128(
+				                block_128bit,
+				                _mm_set1_epi16( 0x00ff ) );
+			}
+			else
+			{
+				block_128bit = _mm_srli_epi16(
+				                block_128bit,
+				                8 );
+			}
+			high_mask = (uint32_t) _mm_movemask_epi8(
+			                        _mm_cmpeq_epi16(
+			                         _mm_and_si128(
+			                          block_128bit,
+			                          _mm_set1_epi16( 0x00fc ) ),
+			                         _mm_set1_epi16( 0x00d8 ) ) );
+
+			/* Consecutive high surrogates are left to be counted per code unit
+			 */
+			if( ( ( ( high_mask << 2 ) | ( pending_low * 3 ) ) & high_mask ) != 0 )
+			{
+				break;
+			}
+			/* Every high surrogate, except the last code unit of the block, and the pending
+			 * low surrogate are code units that do not start an UTF-16 character
+			 */
+			block_count = 8 - pending_low - ( libuna_transcode_population_count( high_mask & 0x3fff ) / 2 );
+
+			if( ( maximum_number_of_characters - character_count ) <= block_count )
+			{
+				break;
+			}
+			character_count += block_count;
+			stream_index    += 16;
+			pending_low      = (uint8_t) ( high_mask >> 15 );
+		}
+		if( pending_low != 0 )
+		{
+			character_count -= 1;
+			stream_index    -= 2;
+		}
+#endif
+		/* Count at least the size of a block per code unit before continuing with the blocks
+		 */
+		validate_index = stream_index + 16;
+
+		while( ( ( stream_index + 1 ) < utf16_stream_size )
+		    && ( character_count < maximum_number_of_characters ) )
+		{
+			if( ( utf16_stream[ stream_index + byte_offset ] & 0xfc ) == 0xd8 )
+			{
+				stream_index += 2;
+			}
+			stream_index    += 2;
+			character_count += 1;
+
+			if( stream_index >= validate_index )
+			{
+				break;
+			}
+		}
+	}
+	/* A high surrogate at the end of the UTF-16 stream is counted as a character
+	 */
+	if( stream_index > utf16_stream_size )
+	{
+		stream_index = utf16_stream_size - ( utf16_stream_size % 2 );
+	}
+	*utf16_stream_index   = stream_index;
+	*number_of_characters = character_count;
+}
+
+#if defined( LIBUNA_HAVE_SSE2 )
+
+/* Narrows the code units in a block of UTF-16 or UTF-32 code units to ASCII characters
+ * An ASCII character is stored as its 7-bit value and any other code unit with bit 7 set
+ * Returns the block of narrowed code units
+ */
+static __m128i libuna_transcode_narrow_ascii_block(
+                const uint8_t *string,
+                uint8_t unit_size,
+                __m128i non_ascii_mask_128bit,
+                __m128i shift_128bit )
+{
+	__m128i block_128bit = _mm_setzero_si128();
+
+	block_128bit = _mm_loadu_si128(
+	                (const __m128i *) string );
+
+	if( unit_size == 2 )
+	{
+		return( _mm_or_si128(
+		         _mm_and_si128(
+		          _mm_srl_epi16(
+		           block_128bit,
+		           shift_128bit ),
+		          _mm_set1_epi16( 0x007f ) ),
+		         _mm_andnot_si128(
+		          _mm_cmpeq_epi16(
+		           _mm_and_si128(
+		            block_128bit,
+		            non_ascii_mask_128bit ),
+		           _mm_setzero_si128() ),
+		          _mm_set1_epi16( 0x0080 ) ) ) );
+	}
+	return( _mm_or_si128(
+	         _mm_and_si128(
+	          _mm_srl_epi32(
+	           block_128bit,
+	           shift_128bit ),
+	          _mm_set1_epi32( 0x0000007fL ) ),
+	         _mm_andnot_si128(
+	          _mm_cmpeq_epi32(
+	           _mm_and_si128(
+	            block_128bit,
+	            non_ascii_mask_128bit ),
+	           _mm_setzero_si128() ),
+	          _mm_set1_epi32( 0x00000080L ) ) ) );
+}
+
+/* Loads a block of 16 characters of an UTF-8, UTF-16 or UTF-32 string as bytes
+ * An ASCII character is stored as its 7-bit value and any other character as a byte with bit 7 set
+ * Returns the block of 16 bytes
+ */
+static __m128i libuna_transcode_load_ascii_block(
+                const uint8_t *string,
+                uint8_t unit_size,
+                uint8_t byte_offset )
+{
+	__m128i non_ascii_mask_128bit = _mm_setzero_si128();
+	__m128i shift_128bit          = _mm_setzero_si128();
+
+	if( unit_size == 1 )
+	{
+		return( _mm_loadu_si128(
+		         (const __m128i *) string ) );
+	}
+	/* The non-ASCII mask contains the bits of a code unit that are not set in an ASCII character
+	 */
+	shift_128bit = _mm_cvtsi32_si128(
+	                (int) byte_offset * 8 );
+
+	if( unit_size == 2 )
+	{
+		non_ascii_mask_128bit = _mm_set1_epi16(
+		                         ( byte_offset == 0 ) ? (short) 0xff80 : (short) 0x80ff );
+
+		return( _mm_packus_epi16(
+		         libuna_transcode_narrow_ascii_block(
+		          string,
+		          2,
+		          non_ascii_mask_128bit,
+		          shift_128bit ),
+		         libuna_transcode_narrow_ascii_block(
+		          &( string[ 16 ] ),
+		          2,
+		          non_ascii_mask_128bit,
+		          shift_128bit ) ) );
+	}
+	non_ascii_mask_128bit = _mm_set1_epi32(
+	                         ( byte_offset == 0 ) ? (int) 0xffffff80UL : (int) 0x80ffffffUL );
+
+	return( _mm_packus_epi16(
+	         _mm_packs_epi32(
+	          libuna_transcode_narrow_ascii_block(
+	           string,
+	           4,
+	           non_ascii_mask_128bit,
+	           shift_128bit ),
+	          libuna_transcode_narrow_ascii_block(
+	           &( string[ 16 ] ),
+	           4,
+	           non_ascii_mask_128bit,
+	           shift_128bit ) ),
+	         _mm_packs_epi32(
+	          libuna_transcode_narrow_ascii_block(
+	           &( string[ 32 ] ),
+	           4,
+	           non_ascii_mask_128bit,
+	           shift_128bit ),
+	          libuna_transcode_narrow_ascii_block(
+	           &( string[ 48 ] ),
+	           4,
+	           non_ascii_mask_128bit,
+	           shift_128bit ) ) ) );
+}
+
+#endif /* defined( LIBUNA_HAVE_SSE2 ) */
+
+/* Compares the ASCII characters at the start of 2 UTF-8, UTF-16 or UTF-32 strings
+ * The unit size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 and the size of a string
+ * is the number of code units. A byte order of 0 represents the byte order of the host
+ * An ASCII character is the same Unicode character in any of the strings, hence the
+ * Unicode characters before the first character that differs or is not an ASCII character
+ * are equal and do not need to be converted to be compared
+ * Returns the number of ASCII characters that are equal
+ */
+size_t libuna_transcode_compare_ascii_characters(
+        const uint8_t *first_string,
+        size_t first_string_size,
+        uint8_t first_unit_size,
+        int first_byte_order,
+        const uint8_t *second_string,
+        size_t second_string_size,
+        uint8_t second_unit_size,
+        int second_byte_order )
+{
+	size_t number_of_characters = 0;
+	size_t string_size          = 0;
+	uint8_t first_byte_offset   = 0;
+	uint8_t first_character     = 0;
+	uint8_t second_byte_offset  = 0;
+	uint8_t second_character    = 0;
+	uint8_t unit_index          = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i first_block_128bit  = _mm_setzero_si128();
+	__m128i second_block_128bit = _mm_setzero_si128();
+	uint32_t equal_mask         = 0;
+#else
+	uint64_t first_block_64bit  = 0;
+	uint64_t second_block_64bit = 0;
+#endif
+
+	first_byte_offset  = libuna_transcode_ascii_byte_offset(
+	                      first_unit_size,
+	                      first_byte_order );
+	second_byte_offset = libuna_transcode_ascii_byte_offset(
+	                      second_unit_size,
+	                      second_byte_order );
+
+	string_size = ( first_string_size < second_string_size ) ? first_string_size : second_string_size;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( string_size - number_of_characters ) >= 16 )
+	{
+		first_block_128bit  = libuna_transcode_load_ascii_block(
+		                       &( first_string[ number_of_characters * first_unit_size ] ),
+		                       first_unit_size,
+		                       first_byte_offset );
+		second_block_128bit = libuna_transcode_load_ascii_block(
+		                       &( second_string[ number_of_characters * second_unit_size ] ),
+		                       second_unit_size,
+		                       second_byte_offset );
+
+		/* The characters are equal ASCII characters if the bytes are equal and bit 7 is not set
+		 */
+		equal_mask = (uint32_t) _mm_movemask_epi8(
+		                         _mm_cmpeq_epi8(
+		                          first_block_128bit,
+		                          second_block_128bit ) );
+
+		equal_mask &= ~( (uint32_t) _mm_movemask_epi8(
+		                             first_block_128bit ) );
+
+		if( equal_mask != 0x0000ffffUL )
+		{
+			/* Count the characters that are equal before the first one that is not
+			 */
+			equal_mask = ~equal_mask & 0x0000ffffUL;
+
+			while( ( equal_mask & 1 ) == 0 )
+			{
+				equal_mask >>= 1;
+
+				number_of_characters++;
+			}
+			return( number_of_characters );
+		}
+		number_of_characters += 16;
+	}
+#else
+	if( ( first_unit_size == 1 )
+	 && ( second_unit_size == 1 ) )
+	{
+		while( ( string_size - number_of_characters ) >= 8 )
+		{
+			memory_copy(
+			 &first_block_64bit,
+			 &( first_string[ number_of_characters ] ),
+			 8 );
+
+			memory_copy(
+			 &second_block_64bit,
+			 &( second_string[ number_of_characters ] ),
+			 8 );
+
+			if( ( ( first_block_64bit ^ second_block_64bit ) | ( first_block_64bit & 0x8080808080808080ULL ) ) != 0 )
+			{
+				break;
+			}
+			number_of_characters += 8;
+		}
+	}
+#endif
+	while( number_of_characters < string_size )
+	{
+		first_character  = first_string[ ( number_of_characters * first_unit_size ) + first_byte_offset ];
+		second_character = second_string[ ( number_of_characters * second_unit_size ) + second_byte_offset ];
+
+		if( ( first_character != second_character )
+		 || ( first_character >= 0x80 ) )
+		{
+			break;
+		}
+		for( unit_index = 0;
+		     unit_index < first_unit_size;
+		     unit_index++ )
+		{
+			if( ( unit_index != first_byte_offset )
+			 && ( first_string[ ( number_of_characters * first_unit_size ) + unit_index ] != 0 ) )
+			{
+				return( number_of_characters );
+			}
+		}
+		for( unit_index = 0;
+		     unit_index < second_unit_size;
+		     unit_index++ )
+		{
+			if( ( unit_index != second_byte_offset )
+			 && ( second_string[ ( number_of_characters * second_unit_size ) + unit_index ] != 0 ) )
+			{
+				return( number_of_characters );
+			}
+		}
+		number_of_characters++;
+	}
+	return( number_of_characters );
+}
+
+/* Compares the ASCII characters at the start of 2 UTF-8, UTF-16 or UTF-32 strings
+ * without considering the case of the characters A to Z
+ * The unit size, string size and byte order are the same as for
+ * libuna_transcode_compare_ascii_characters
+ * The simple case folding of an ASCII character is the same as its lower case form,
+ * hence the ASCII characters are compared in their lower case form
+ * Returns the number of ASCII characters that are equal
+ */
+size_t libuna_transcode_compare_ascii_characters_case_insensitive(
+        const uint8_t *first_string,
+        size_t first_string_size,
+        uint8_t first_unit_size,
+        int first_byte_order,
+        const uint8_t *second_string,
+        size_t second_string_size,
+        uint8_t second_unit_size,
+        int second_byte_order )
+{
+	size_t number_of_characters = 0;
+	size_t string_size          = 0;
+	uint8_t first_byte_offset   = 0;
+	uint8_t first_character     = 0;
+	uint8_t second_byte_offset  = 0;
+	uint8_t second_character    = 0;
+	uint8_t unit_index          = 0;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	__m128i first_block_128bit  = _mm_setzero_si128();
+	__m128i second_block_128bit = _mm_setzero_si128();
+	__m128i lower_128bit        = _mm_set1_epi8( 'A' - 1 );
+	__m128i upper_128bit        = _mm_set1_epi8( 'Z' + 1 );
+	__m128i case_bit_128bit     = _mm_set1_epi8( 0x20 );
+	uint32_t equal_mask         = 0;
+#else
+	uint64_t first_block_64bit  = 0;
+	uint64_t second_block_64bit = 0;
+	uint64_t upper_case_64bit   = 0;
+#endif
+
+	first_byte_offset  = libuna_transcode_ascii_byte_offset(
+	                      first_unit_size,
+	                      first_byte_order );
+	second_byte_offset = libuna_transcode_ascii_byte_offset(
+	                      second_unit_size,
+	                      second_byte_order );
+
+	string_size = ( first_string_size < second_string_size ) ? first_string_size : second_string_size;
+
+#if defined( LIBUNA_HAVE_SSE2 )
+	while( ( string_size - number_of_characters ) >= 16 )
+	{
+		first_block_128bit  = libuna_transcode_load_ascii_block(
+		                       &( first_string[ number_of_characters * first_unit_size ] ),
+		                       first_unit_size,
+		                       first_byte_offset );
+		second_block_128bit = libuna_transcode_load_ascii_block(
+		                       &( second_string[ number_of_characters * second_unit_size ] ),
+		                       second_unit_size,
+		                       second_byte_offset );
+
+		/* Set bit 5 of the characters A to Z, bytes with bit 7 set are negative
+		 * and are never within the range
+		 */
+		first_block_128bit  = _mm_or_si128(
+		                       first_block_128bit,
+		                       _mm_and_si128(
+		                        _mm_and_si128(
+		                         _mm_cmpgt_epi8(
+		                          first_block_128bit,
+		                          lower_128bit ),
+		                         _mm_cmpgt_epi8(
+		                          upper_128bit,
+		                          first_block_128bit ) ),
+		                        case_bit_128bit ) );
+		second_block_128bit = _mm_or_si128(
+		                       second_block_128bit,
+		                       _mm_and_si128(
+		                        _mm_and_si128(
+		                         _mm_cmpgt_epi8(
+		                          second_block_128bit,
+		                          lower_128bit ),
+		                         _mm_cmpgt_epi8(
+		                          upper_128bit,
+		                          second_block_128bit ) ),
+		                        case_bit_128bit ) );
+
+		/* The characters are equal ASCII characters if the bytes are equal and bit 7 is not set
+		 */
+		equal_mask = (uint32_t) _mm_movemask_epi8(
+		                         _mm_cmpeq_epi8(
+		                          first_block_128bit,
+		                          second_block_128bit ) );
+
+		equal_mask &= ~( (uint32_t) _mm_movemask_epi8(
+		                             first_block_128bit ) );
+
+		if( equal_mask != 0x0000ffffUL )
+		{
+			/* Count the characters that are equal before the first one that is not
+			 */
+			equal_mask = ~equal_mask & 0x0000ffffUL;
+
+			while( ( equal_mask & 1 ) == 0 )
+			{
+				equal_mask >>= 1;
+
+				number_of_characters++;
+			}
+			return( number_of_characters );
+		}
+		number_of_characters += 16;
+	}
+#else
+	if( ( first_unit_size == 1 )
+	 && ( second_unit_size == 1 ) )
+	{
+		while( ( string_size - number_of_characters ) >= 8 )
+		{
+			memory_copy(
+			 &first_block_64bit,
+			 &( first_string[ number_of_characters ] ),
+			 8 );
+
+			memory_copy(
+			 &second_block_64bit,
+			 &( second_string[ number_of_characters ] ),
+			 8 );
+
+			if( ( ( first_block_64bit | second_block_64bit ) & 0x8080808080808080ULL ) != 0 )
+			{
+				break;
+			}
+			/* Bit 7 of a byte is set if the character is at least A and not more than Z,
+			 * the bytes are less than 0x80 hence the additions do not carry into the next byte
+			 */
+			upper_case_64bit   = ( first_block_64bit + 0x3f3f3f3f3f3f3f3fULL )
+			                   & ~( first_block_64bit + 0x2525252525252525ULL )
+			                   & 0x8080808080808080ULL;
+			first_block_64bit |= upper_case_64bit >> 2;
+
+			upper_case_64bit    = ( second_block_64bit + 0x3f3f3f3f3f3f3f3fULL )
+			                    & ~( second_block_64bit + 0x2525252525252525ULL )
+			                    & 0x8080808080808080ULL;
+			second_block_64bit |= upper_case_64bit >> 2;
+
+			if( first_block_64bit != second_block_64bit )
+			{
+				break;
+			}
+			number_of_characters += 8;
+		}
+	}
+#endif
+	while( number_of_characters < string_size )
+	{
+		first_character  = first_string[ ( number_of_characters * first_unit_size ) + first_byte_offset ];
+		second_character = second_string[ ( number_of_characters * second_unit_size ) + second_byte_offset ];
+
+		if( ( first_character >= (uint8_t) 'A' )
+		 && ( first_character <= (uint8_t) 'Z' ) )
+		{
+			first_character |= 0x20;
+		}
+		if( ( second_character >= (uint8_t) 'A' )
+		 && ( second_character <= (uint8_t) 'Z' ) )
+		{
+			second_character |= 0x20;
+		}
+		if( ( first_character != second_character )
+		 || ( first_character >= 0x80 ) )
+		{
+			break;
+		}
+		for( unit_index = 0;
+		     unit_index < first_unit_size;
+		     unit_index++ )
+		{
+			if( ( unit_index != first_byte_offset )
+			 && ( first_string[ ( number_of_characters * first_unit_size ) + unit_index ] != 0 ) )
+			{
+				return( number_of_characters );
+			}
+		}
+		for( unit_index = 0;
+		     unit_index < second_unit_size;
+		     unit_index++ )
+		{
+			if( ( unit_index != second_byte_offset )
+			 && ( second_string[ ( number_of_characters * second_unit_size ) + unit_index ] != 0 ) )
+			{
+				return( number_of_characters );
+			}
+		}
+		number_of_characters++;
+	}
+	return( number_of_characters );
+}
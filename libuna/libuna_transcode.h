@@ -0,0 +1,495 @@
+/*
+ * Bulk transcoding functions
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_TRANSCODE_H )
+#define _LIBUNA_TRANSCODE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The bulk transcoding functions convert runs of well-formed characters
+ * without argument checks or error construction. They stop at the first
+ * character they do not handle, e.g. malformed or truncated input or
+ * insufficient output space, and leave the indexes at that character so
+ * the caller can process it with the libuna_unicode_character functions,
+ * which provide the error reporting.
+ */
+
+void libuna_transcode_utf16_size_from_utf8(
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      size_t *utf16_string_size );
+
+void libuna_transcode_utf16_copy_from_utf8(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index );
+
+void libuna_transcode_utf8_size_from_utf16(
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      size_t *utf8_string_size );
+
+void libuna_transcode_utf8_copy_from_utf16(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index );
+
+void libuna_transcode_utf8_size_from_utf16_stream(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order,
+      size_t *utf8_string_size );
+
+void libuna_transcode_utf8_copy_from_utf16_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf8_size_from_byte_stream(
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table,
+      size_t *utf8_string_size );
+
+void libuna_transcode_utf8_copy_from_byte_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table );
+
+void libuna_transcode_utf16_copy_from_byte_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table );
+
+void libuna_transcode_utf32_copy_from_byte_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const uint16_t *byte_stream_to_unicode_table );
+
+void libuna_transcode_byte_stream_size_from_utf8(
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint16_t *unicode_to_double_byte_stream_pages,
+      size_t *byte_stream_size );
+
+void libuna_transcode_byte_stream_copy_from_utf8(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint8_t *unicode_to_byte_stream_pages,
+      const uint16_t *unicode_to_double_byte_stream_pages );
+
+void libuna_transcode_byte_stream_size_from_utf16(
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint16_t *unicode_to_double_byte_stream_pages,
+      size_t *byte_stream_size );
+
+void libuna_transcode_byte_stream_copy_from_utf16(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint8_t *unicode_to_byte_stream_pages,
+      const uint16_t *unicode_to_double_byte_stream_pages );
+
+void libuna_transcode_byte_stream_size_from_utf32(
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint16_t *unicode_to_double_byte_stream_pages,
+      size_t *byte_stream_size );
+
+void libuna_transcode_byte_stream_copy_from_utf32(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *unicode_to_byte_stream_page_index,
+      const uint8_t *unicode_to_byte_stream_pages,
+      const uint16_t *unicode_to_double_byte_stream_pages );
+
+/* The 7-bit ASCII functions convert runs of 7-bit ASCII characters, which are
+ * represented by a single code unit in every Unicode encoding and by the same
+ * byte in every supported codepage. The byte stream functions should only be
+ * used for a supported codepage, since the other codepages should be rejected.
+ */
+
+void libuna_transcode_ascii_size_from_utf7_stream(
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_utf8(
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_utf8_stream(
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_utf16(
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_utf16_stream(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_utf32(
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_utf32_stream(
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order,
+      size_t *string_size );
+
+void libuna_transcode_ascii_size_from_byte_stream(
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      size_t *string_size );
+
+void libuna_transcode_utf8_copy_ascii_from_utf7_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data );
+
+void libuna_transcode_utf8_copy_ascii_from_utf8_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index );
+
+void libuna_transcode_utf8_copy_ascii_from_utf32(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index );
+
+void libuna_transcode_utf8_copy_ascii_from_utf32_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf8_copy_ascii_from_byte_stream(
+      libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index );
+
+void libuna_transcode_utf16_copy_ascii_from_utf7_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data );
+
+void libuna_transcode_utf16_copy_ascii_from_utf16_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf16_copy_ascii_from_utf32(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index );
+
+void libuna_transcode_utf16_copy_ascii_from_utf32_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf16_copy_ascii_from_byte_stream(
+      libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index );
+
+void libuna_transcode_utf32_copy_ascii_from_utf7_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf7_stream,
+      size_t utf7_stream_size,
+      size_t *utf7_stream_index,
+      uint32_t utf7_stream_base64_data );
+
+void libuna_transcode_utf32_copy_ascii_from_utf8(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index );
+
+void libuna_transcode_utf32_copy_ascii_from_utf8_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index );
+
+void libuna_transcode_utf32_copy_ascii_from_utf16(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index );
+
+void libuna_transcode_utf32_copy_ascii_from_utf16_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf32_copy_ascii_from_utf32_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf32_copy_ascii_from_byte_stream(
+      libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      const uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index );
+
+void libuna_transcode_utf16_stream_copy_ascii_from_utf8(
+      uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      int byte_order );
+
+void libuna_transcode_utf16_stream_copy_ascii_from_utf32(
+      uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index,
+      int byte_order );
+
+void libuna_transcode_utf32_stream_copy_ascii_from_utf8(
+      uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      int byte_order );
+
+void libuna_transcode_utf32_stream_copy_ascii_from_utf16(
+      uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index,
+      int byte_order );
+
+void libuna_transcode_byte_stream_copy_ascii_from_utf8(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf8_character_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index );
+
+void libuna_transcode_byte_stream_copy_ascii_from_utf16(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf16_character_t *utf16_string,
+      size_t utf16_string_size,
+      size_t *utf16_string_index );
+
+void libuna_transcode_byte_stream_copy_ascii_from_utf32(
+      uint8_t *byte_stream,
+      size_t byte_stream_size,
+      size_t *byte_stream_index,
+      const libuna_utf32_character_t *utf32_string,
+      size_t utf32_string_size,
+      size_t *utf32_string_index );
+
+void libuna_transcode_utf8_stream_validate(
+      const uint8_t *utf8_stream,
+      size_t utf8_stream_size,
+      size_t *utf8_stream_index );
+
+void libuna_transcode_utf16_stream_validate(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf32_stream_validate(
+      const uint8_t *utf32_stream,
+      size_t utf32_stream_size,
+      size_t *utf32_stream_index,
+      int byte_order );
+
+void libuna_transcode_utf8_count_characters(
+      const uint8_t *utf8_string,
+      size_t utf8_string_size,
+      size_t *utf8_string_index,
+      size_t maximum_number_of_characters,
+      size_t *number_of_characters );
+
+void libuna_transcode_utf16_count_characters(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      size_t *utf16_stream_index,
+      int byte_order,
+      size_t maximum_number_of_characters,
+      size_t *number_of_characters );
+
+size_t libuna_transcode_compare_ascii_characters(
+        const uint8_t *first_string,
+        size_t first_string_size,
+        uint8_t first_unit_size,
+        int first_byte_order,
+        const uint8_t *second_string,
+        size_t second_string_size,
+        uint8_t second_unit_size,
+        int second_byte_order );
+
+size_t libuna_transcode_compare_ascii_characters_case_insensitive(
+        const uint8_t *first_string,
+        size_t first_string_size,
+        uint8_t first_unit_size,
+        int first_byte_order,
+        const uint8_t *second_string,
+        size_t second_string_size,
+        uint8_t second_unit_size,
+        int second_byte_order );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBUNA_TRANSCODE_H ) */
+
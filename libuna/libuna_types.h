@@ -31,6 +31,22 @@
  */
 #if defined( HAVE_LOCAL_LIBUNA )
 
+/* The following type definitions hide internal data structures
+ */
+#if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libuna_base_stream_decoder {}	libuna_base_stream_decoder_t;
+typedef struct libuna_base_stream_encoder {}	libuna_base_stream_encoder_t;
+typedef struct libuna_normalizer {}		libuna_normalizer_t;
+typedef struct libuna_stream_decoder {}		libuna_stream_decoder_t;
+
+#else
+typedef intptr_t libuna_base_stream_decoder_t;
+typedef intptr_t libuna_base_stream_encoder_t;
+typedef intptr_t libuna_normalizer_t;
+typedef intptr_t libuna_stream_decoder_t;
+
+#endif
+
 /* Unicode character definitions
  */
 typedef uint32_t libuna_unicode_character_t;
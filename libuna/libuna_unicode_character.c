@@ -23,35 +23,11 @@
 #include <types.h>
 
 #include "libuna_base64_stream.h"
-#include "libuna_codepage_iso_8859_2.h"
-#include "libuna_codepage_iso_8859_3.h"
-#include "libuna_codepage_iso_8859_4.h"
-#include "libuna_codepage_iso_8859_5.h"
-#include "libuna_codepage_iso_8859_6.h"
-#include "libuna_codepage_iso_8859_7.h"
-#include "libuna_codepage_iso_8859_8.h"
-#include "libuna_codepage_iso_8859_9.h"
-#include "libuna_codepage_iso_8859_10.h"
-#include "libuna_codepage_iso_8859_13.h"
-#include "libuna_codepage_iso_8859_14.h"
-#include "libuna_codepage_iso_8859_15.h"
-#include "libuna_codepage_iso_8859_16.h"
-#include "libuna_codepage_koi8_r.h"
-#include "libuna_codepage_koi8_u.h"
-#include "libuna_codepage_windows_874.h"
+#include "libuna_codepage.h"
 #include "libuna_codepage_windows_932.h"
 #include "libuna_codepage_windows_936.h"
 #include "libuna_codepage_windows_949.h"
 #include "libuna_codepage_windows_950.h"
-#include "libuna_codepage_windows_1250.h"
-#include "libuna_codepage_windows_1251.h"
-#include "libuna_codepage_windows_1252.h"
-#include "libuna_codepage_windows_1253.h"
-#include "libuna_codepage_windows_1254.h"
-#include "libuna_codepage_windows_1255.h"
-#include "libuna_codepage_windows_1256.h"
-#include "libuna_codepage_windows_1257.h"
-#include "libuna_codepage_windows_1258.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
 #include "libuna_types.h"
@@ -179,9 +155,10 @@ int libuna_unicode_character_copy_from_byte_stream(
      int codepage,
      libcerror_error_t **error )
 {
-	static char *function         = "libuna_unicode_character_copy_from_byte_stream";
-	uint8_t byte_stream_character = 0;
-	int result                    = 1;
+	static char *function                        = "libuna_unicode_character_copy_from_byte_stream";
+	const uint16_t *byte_stream_to_unicode_table = NULL;
+	uint8_t byte_stream_character                = 0;
+	int result                                   = 1;
 
 	if( unicode_character == NULL )
 	{
@@ -240,2675 +217,222 @@ int libuna_unicode_character_copy_from_byte_stream(
 	}
 	byte_stream_character = byte_stream[ *byte_stream_index ];
 
-	switch( codepage )
-	{
-		case LIBUNA_CODEPAGE_ASCII:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				*unicode_character = 0xfffd;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_1:
-			*unicode_character = byte_stream_character;
-
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_2:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_2_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_3:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_3_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_4:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_4_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_5:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_5_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_6:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_6_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_7:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_7_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_8:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_8_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_9:
-			if( byte_stream_character < 0xd0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xd0;
-
-				*unicode_character = libuna_codepage_iso_8859_9_byte_stream_to_unicode_base_0xd0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_10:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_10_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_11:
-			if( byte_stream_character < 0xa1 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else if( byte_stream_character < 0xdb )
-			{
-				*unicode_character = byte_stream_character + 0x0d60;
-			}
-			else if( byte_stream_character < 0xdf )
-			{
-				*unicode_character = 0xfffd;
-			}
-			else if( byte_stream_character < 0xfc )
-			{
-				*unicode_character = byte_stream_character + 0x0d60;
-			}
-			else
-			{
-				*unicode_character = 0xfffd;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_13:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_13_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_14:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_14_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_15:
-			if( ( byte_stream_character >= 0xa0 )
-			 && ( byte_stream_character < 0xc0 ) )
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_15_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			else
-			{
-				*unicode_character = byte_stream_character;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_16:
-			if( byte_stream_character < 0xa0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xa0;
-
-				*unicode_character = libuna_codepage_iso_8859_16_byte_stream_to_unicode_base_0xa0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_KOI8_R:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_koi8_r_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_KOI8_U:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_koi8_u_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_874:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_874_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_932:
-			result = libuna_codepage_windows_932_copy_from_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_936:
-			result = libuna_codepage_windows_936_copy_from_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_949:
-			result = libuna_codepage_windows_949_copy_from_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_950:
-			result = libuna_codepage_windows_950_copy_from_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1250:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1250_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1251:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1251_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1252:
-			if( ( byte_stream_character < 0x80 )
-			 || ( byte_stream_character >= 0xa0 ) )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1252_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1253:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1253_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1254:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else if( byte_stream_character < 0xa0 )
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1254_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			else if( byte_stream_character < 0xd0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else if( byte_stream_character < 0xe0 )
-			{
-				byte_stream_character -= 0xd0;
-
-				*unicode_character = libuna_codepage_windows_1254_byte_stream_to_unicode_base_0xd0[ byte_stream_character ];
-			}
-			else if( byte_stream_character < 0xf0 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0xf0;
-
-				*unicode_character = libuna_codepage_windows_1254_byte_stream_to_unicode_base_0xf0[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1255:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1255_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1256:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1256_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1257:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1257_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1258:
-			if( byte_stream_character < 0x80 )
-			{
-				*unicode_character = byte_stream_character;
-			}
-			else
-			{
-				byte_stream_character -= 0x80;
-
-				*unicode_character = libuna_codepage_windows_1258_byte_stream_to_unicode_base_0x80[ byte_stream_character ];
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		default:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			"%s: unsupported codepage: %d.",
-			 function,
-			 codepage );
-
-			return( -1 );
-	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy Unicode character from byte stream.",
-		 function );
-
-		return( -1 );
-	}
-	return( result );
-}
-
-/* Copies a Unicode character to a byte stream
- * Returns 1 if successful or -1 on error
- */
-int libuna_unicode_character_copy_to_byte_stream(
-     libuna_unicode_character_t unicode_character,
-     uint8_t *byte_stream,
-     size_t byte_stream_size,
-     size_t *byte_stream_index,
-     int codepage,
-     libcerror_error_t **error )
-{
-	static char *function  = "libuna_unicode_character_copy_to_byte_stream";
-	int result             = 1;
-
-	if( byte_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
-		 function );
-
-		return( -1 );
-	}
-	if( byte_stream_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid byte stream size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( byte_stream_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream index.",
-		 function );
-
-		return( -1 );
-	}
-	if( *byte_stream_index >= byte_stream_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: byte stream too small.",
-		 function );
-
-		return( -1 );
-	}
-	switch( codepage )
-	{
-		case LIBUNA_CODEPAGE_ASCII:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else
-			{
-				byte_stream[ *byte_stream_index ] = 0x1a;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_1:
-			if( unicode_character < 0x0100 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else
-			{
-				byte_stream[ *byte_stream_index ] = 0x1a;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_2:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0120 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_2_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0138 )
-			      && ( unicode_character < 0x0180 ) )
-			{
-				unicode_character -= 0x0138;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_2_unicode_to_byte_stream_base_0x0138[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x02d8 )
-			      && ( unicode_character < 0x02e0 ) )
-			{
-				unicode_character -= 0x02d8;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_2_unicode_to_byte_stream_base_0x02d8[ unicode_character ];
-			}
-			else if( unicode_character == 0x02c7 )
-			{
-				byte_stream[ *byte_stream_index ] = 0xb7;
-			}
-			else
-			{
-				byte_stream[ *byte_stream_index ] = 0x1a;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_3:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0100 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_3_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0108 )
-			      && ( unicode_character < 0x0110 ) )
-			{
-				unicode_character -= 0x0108;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_3_unicode_to_byte_stream_base_0x0108[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0118 )
-			      && ( unicode_character < 0x0128 ) )
-			{
-				unicode_character -= 0x0118;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_3_unicode_to_byte_stream_base_0x0118[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0130 )
-			      && ( unicode_character < 0x0138 ) )
-			{
-				unicode_character -= 0x0130;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_3_unicode_to_byte_stream_base_0x0130[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0158 )
-			      && ( unicode_character < 0x0160 ) )
-			{
-				unicode_character -= 0x0158;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_3_unicode_to_byte_stream_base_0x0158[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x016c:
-					byte_stream[ *byte_stream_index ] = 0xdd;
-					break;
-
-				case 0x016d:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x017b:
-					byte_stream[ *byte_stream_index ] = 0xaf;
-					break;
-
-				case 0x017c:
-					byte_stream[ *byte_stream_index ] = 0xbf;
-					break;
-
-				case 0x02d8:
-					byte_stream[ *byte_stream_index ] = 0xa2;
-					break;
-
-				case 0x02d9:
-					byte_stream[ *byte_stream_index ] = 0xff;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_4:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0158 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_4_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0160 )
-			      && ( unicode_character < 0x0180 ) )
-			{
-				unicode_character -= 0x0160;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_4_unicode_to_byte_stream_base_0x0160[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x02c7:
-					byte_stream[ *byte_stream_index ] = 0xb7;
-					break;
-
-				case 0x02d9:
-					byte_stream[ *byte_stream_index ] = 0xff;
-					break;
-
-				case 0x02db:
-					byte_stream[ *byte_stream_index ] = 0xb2;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_5:
-			if( unicode_character < 0x00a1 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x0400 )
-			      && ( unicode_character < 0x0460 ) )
-			{
-				unicode_character -= 0x0400;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_5_unicode_to_byte_stream_base_0x0400[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a7:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x00ad:
-					byte_stream[ *byte_stream_index ] = 0xad;
-					break;
-
-				case 0x2116:
-					byte_stream[ *byte_stream_index ] = 0xf0;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_6:
-			if( unicode_character < 0x00a1 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x0618 )
-			      && ( unicode_character < 0x658 ) )
-			{
-				unicode_character -= 0x0618;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_6_unicode_to_byte_stream_base_0x0618[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a4:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				case 0x00ad:
-					byte_stream[ *byte_stream_index ] = 0xad;
-					break;
-
-				case 0x060c:
-					byte_stream[ *byte_stream_index ] = 0xac;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_7:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00b8 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_7_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0380 )
-			      && ( unicode_character < 0x03d0 ) )
-			{
-				unicode_character -= 0x0380;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_7_unicode_to_byte_stream_base_0x0380[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00bb:
-					byte_stream[ *byte_stream_index ] = 0xbb;
-					break;
-
-				case 0x00bd:
-					byte_stream[ *byte_stream_index ] = 0xbd;
-					break;
-
-				case 0x037a:
-					byte_stream[ *byte_stream_index ] = 0xaa;
-					break;
-
-				case 0x2015:
-					byte_stream[ *byte_stream_index ] = 0xaf;
-					break;
-
-				case 0x2018:
-					byte_stream[ *byte_stream_index ] = 0xa1;
-					break;
-
-				case 0x2019:
-					byte_stream[ *byte_stream_index ] = 0xa2;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				case 0x20af:
-					byte_stream[ *byte_stream_index ] = 0xa5;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_8:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_8_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x05d0 )
-			      && ( unicode_character < 0x05f0 ) )
-			{
-				unicode_character -= 0x05d0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_8_unicode_to_byte_stream_base_0x05d0[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00d7:
-					byte_stream[ *byte_stream_index ] = 0xaa;
-					break;
-
-				case 0x00f7:
-					byte_stream[ *byte_stream_index ] = 0xba;
-					break;
-
-				case 0x200e:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x200f:
-					byte_stream[ *byte_stream_index ] = 0xfe;
-					break;
-
-				case 0x2017:
-					byte_stream[ *byte_stream_index ] = 0xdf;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_9:
-			if( unicode_character < 0x00d0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00d0 )
-			      && ( unicode_character < 0x0100 ) )
-			{
-				unicode_character -= 0x00d0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_9_unicode_to_byte_stream_base_0x00d0[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x011e:
-					byte_stream[ *byte_stream_index ] = 0xd0;
-					break;
-
-				case 0x011f:
-					byte_stream[ *byte_stream_index ] = 0xf0;
-					break;
-
-				case 0x0130:
-					byte_stream[ *byte_stream_index ] = 0xdd;
-					break;
-
-				case 0x0131:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x015e:
-					byte_stream[ *byte_stream_index ] = 0xde;
-					break;
-
-				case 0x015f:
-					byte_stream[ *byte_stream_index ] = 0xfe;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_10:
-			if( unicode_character < 0x00a1 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00c0 )
-			      && ( unicode_character < 0x0150 ) )
-			{
-				unicode_character -= 0x00c0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_10_unicode_to_byte_stream_base_0x00c0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0160 )
-			      && ( unicode_character < 0x0170 ) )
-			{
-				unicode_character -= 0x0160;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_10_unicode_to_byte_stream_base_0x0160[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a7:
-					byte_stream[ *byte_stream_index ] = 0xa7;
-					break;
-
-				case 0x00ad:
-					byte_stream[ *byte_stream_index ] = 0xad;
-					break;
-
-				case 0x00b0:
-					byte_stream[ *byte_stream_index ] = 0xb0;
-					break;
-
-				case 0x00b7:
-					byte_stream[ *byte_stream_index ] = 0xb7;
-					break;
-
-				case 0x0172:
-					byte_stream[ *byte_stream_index ] = 0xd9;
-					break;
-
-				case 0x0173:
-					byte_stream[ *byte_stream_index ] = 0xf9;
-					break;
-
-				case 0x017d:
-					byte_stream[ *byte_stream_index ] = 0xac;
-					break;
-
-				case 0x017e:
-					byte_stream[ *byte_stream_index ] = 0xbc;
-					break;
-
-				case 0x2015:
-					byte_stream[ *byte_stream_index ] = 0xbd;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_11:
-			if( unicode_character < 0x00a1 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x0e01 )
-			      && ( unicode_character < 0x0e3b ) )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) ( unicode_character - 0x0d60 );
-			}
-			else if( ( unicode_character >= 0x0e3f )
-			      && ( unicode_character < 0x0e5c ) )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) ( unicode_character - 0x0d60 );
-			}
-			else
-			{
-				byte_stream[ *byte_stream_index ] = 0x1a;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_13:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0180 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_13_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2018 )
-			       && ( unicode_character < 0x2020 ) )
-			{
-				unicode_character -= 0x2018;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_13_unicode_to_byte_stream_base_0x2018[ unicode_character ];
-			}
-			else
-			{
-				byte_stream[ *byte_stream_index ] = 0x1a;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_14:
-			if( unicode_character < 0x00a1 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00c0 )
-			      && ( unicode_character < 0x0100 ) )
-			{
-				unicode_character -= 0x00c0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_14_unicode_to_byte_stream_base_0x00c0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0170 )
-			      && ( unicode_character < 0x0178 ) )
-			{
-				unicode_character -= 0x0170;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_14_unicode_to_byte_stream_base_0x0170[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x1e80 )
-			      && ( unicode_character < 0x1e88 ) )
-			{
-				unicode_character -= 0x1e80;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_14_unicode_to_byte_stream_base_0x1e80[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a3:
-					byte_stream[ *byte_stream_index ] = 0xa3;
-					break;
-
-				case 0x00a7:
-					byte_stream[ *byte_stream_index ] = 0xa7;
-					break;
-
-				case 0x00a9:
-					byte_stream[ *byte_stream_index ] = 0xa9;
-					break;
-
-				case 0x00ad:
-					byte_stream[ *byte_stream_index ] = 0xad;
-					break;
-
-				case 0x00ae:
-					byte_stream[ *byte_stream_index ] = 0xae;
-					break;
-
-				case 0x00b6:
-					byte_stream[ *byte_stream_index ] = 0xb6;
-					break;
-
-				case 0x010a:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				case 0x010b:
-					byte_stream[ *byte_stream_index ] = 0xa5;
-					break;
-
-				case 0x0120:
-					byte_stream[ *byte_stream_index ] = 0xb2;
-					break;
-
-				case 0x0121:
-					byte_stream[ *byte_stream_index ] = 0xb3;
-					break;
-
-				case 0x0178:
-					byte_stream[ *byte_stream_index ] = 0xaf;
-					break;
-
-				case 0x1e02:
-					byte_stream[ *byte_stream_index ] = 0xa1;
-					break;
-
-				case 0x1e03:
-					byte_stream[ *byte_stream_index ] = 0xa2;
-					break;
-
-				case 0x1e0a:
-					byte_stream[ *byte_stream_index ] = 0xa6;
-					break;
-
-				case 0x1e0b:
-					byte_stream[ *byte_stream_index ] = 0xab;
-					break;
-
-				case 0x1e1e:
-					byte_stream[ *byte_stream_index ] = 0xb0;
-					break;
-
-				case 0x1e1f:
-					byte_stream[ *byte_stream_index ] = 0xb1;
-					break;
-
-				case 0x1e40:
-					byte_stream[ *byte_stream_index ] = 0xb4;
-					break;
-
-				case 0x1e41:
-					byte_stream[ *byte_stream_index ] = 0xb5;
-					break;
-
-				case 0x1e56:
-					byte_stream[ *byte_stream_index ] = 0xb7;
-					break;
-
-				case 0x1e57:
-					byte_stream[ *byte_stream_index ] = 0xb9;
-					break;
-
-				case 0x1e60:
-					byte_stream[ *byte_stream_index ] = 0xbb;
-					break;
-
-				case 0x1e61:
-					byte_stream[ *byte_stream_index ] = 0xbf;
-					break;
-
-				case 0x1e6a:
-					byte_stream[ *byte_stream_index ] = 0xd7;
-					break;
-
-				case 0x1e6b:
-					byte_stream[ *byte_stream_index ] = 0xf7;
-					break;
-
-				case 0x1ef2:
-					byte_stream[ *byte_stream_index ] = 0xac;
-					break;
-
-				case 0x1ef3:
-					byte_stream[ *byte_stream_index ] = 0xbc;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_15:
-			if( unicode_character < 0x00a0 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_15_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( unicode_character < 0x0100 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else switch( unicode_character )
-			{
-				case 0x0152:
-					byte_stream[ *byte_stream_index ] = 0xbc;
-					break;
-
-				case 0x0153:
-					byte_stream[ *byte_stream_index ] = 0xbd;
-					break;
-
-				case 0x0160:
-					byte_stream[ *byte_stream_index ] = 0xa6;
-					break;
-
-				case 0x0161:
-					byte_stream[ *byte_stream_index ] = 0xa8;
-					break;
-
-				case 0x0178:
-					byte_stream[ *byte_stream_index ] = 0xbe;
-					break;
-
-				case 0x017d:
-					byte_stream[ *byte_stream_index ] = 0xb4;
-					break;
-
-				case 0x017e:
-					byte_stream[ *byte_stream_index ] = 0xb8;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_ISO_8859_16:
-			if( unicode_character < 0x00a1 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a8 )
-			      && ( unicode_character < 0x0108 ) )
-			{
-				unicode_character -= 0x00a8;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_16_unicode_to_byte_stream_base_0x00a8[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0140 )
-			      && ( unicode_character < 0x0148 ) )
-			{
-				unicode_character -= 0x0140;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_16_unicode_to_byte_stream_base_0x0140[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0150 )
-			      && ( unicode_character < 0x0158 ) )
-			{
-				unicode_character -= 0x0150;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_16_unicode_to_byte_stream_base_0x0150[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0178 )
-			      && ( unicode_character < 0x0180 ) )
-			{
-				unicode_character -= 0x0178;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_16_unicode_to_byte_stream_base_0x0178[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0218 )
-			      && ( unicode_character < 0x0220 ) )
-			{
-				unicode_character -= 0x0218;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_iso_8859_16_unicode_to_byte_stream_base_0x0218[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a7:
-					byte_stream[ *byte_stream_index ] = 0xa7;
-					break;
-
-				case 0x010c:
-					byte_stream[ *byte_stream_index ] = 0xb2;
-					break;
-
-				case 0x010d:
-					byte_stream[ *byte_stream_index ] = 0xb9;
-					break;
-
-				case 0x0110:
-					byte_stream[ *byte_stream_index ] = 0xd0;
-					break;
-
-				case 0x0111:
-					byte_stream[ *byte_stream_index ] = 0xf0;
-					break;
-
-				case 0x0118:
-					byte_stream[ *byte_stream_index ] = 0xdd;
-					break;
-
-				case 0x0119:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x015a:
-					byte_stream[ *byte_stream_index ] = 0xd7;
-					break;
-
-				case 0x015b:
-					byte_stream[ *byte_stream_index ] = 0xf7;
-					break;
-
-				case 0x0160:
-					byte_stream[ *byte_stream_index ] = 0xa6;
-					break;
-
-				case 0x0161:
-					byte_stream[ *byte_stream_index ] = 0xa8;
-					break;
-
-				case 0x0170:
-					byte_stream[ *byte_stream_index ] = 0xd8;
-					break;
-
-				case 0x0171:
-					byte_stream[ *byte_stream_index ] = 0xf8;
-					break;
-
-				case 0x201d:
-					byte_stream[ *byte_stream_index ] = 0xb5;
-					break;
-
-				case 0x201e:
-					byte_stream[ *byte_stream_index ] = 0xa5;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_KOI8_R:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x0410 )
-			      && ( unicode_character < 0x0450 ) )
-			{
-				unicode_character -= 0x0410;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_koi8_r_unicode_to_byte_stream_base_0x0410[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2550 )
-			      && ( unicode_character < 0x2570 ) )
-			{
-				unicode_character -= 0x2550;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_koi8_r_unicode_to_byte_stream_base_0x2550[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a0:
-					byte_stream[ *byte_stream_index ] = 0x9a;
-					break;
-
-				case 0x00a9:
-					byte_stream[ *byte_stream_index ] = 0xbf;
-					break;
-
-				case 0x00b0:
-					byte_stream[ *byte_stream_index ] = 0x9c;
-					break;
-
-				case 0x00b2:
-					byte_stream[ *byte_stream_index ] = 0x9d;
-					break;
-
-				case 0x00b7:
-					byte_stream[ *byte_stream_index ] = 0x9e;
-					break;
-
-				case 0x00f7:
-					byte_stream[ *byte_stream_index ] = 0x9f;
-					break;
-
-				case 0x0401:
-					byte_stream[ *byte_stream_index ] = 0xb3;
-					break;
-
-				case 0x0451:
-					byte_stream[ *byte_stream_index ] = 0xa3;
-					break;
-
-				case 0x2219:
-					byte_stream[ *byte_stream_index ] = 0x95;
-					break;
-
-				case 0x221a:
-					byte_stream[ *byte_stream_index ] = 0x96;
-					break;
-
-				case 0x2248:
-					byte_stream[ *byte_stream_index ] = 0x97;
-					break;
-
-				case 0x2264:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
-
-				case 0x2265:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				case 0x2320:
-					byte_stream[ *byte_stream_index ] = 0x93;
-					break;
-
-				case 0x2321:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x2500:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2502:
-					byte_stream[ *byte_stream_index ] = 0x81;
-					break;
-
-				case 0x250c:
-					byte_stream[ *byte_stream_index ] = 0x82;
-					break;
-
-				case 0x2510:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x2514:
-					byte_stream[ *byte_stream_index ] = 0x84;
-					break;
-
-				case 0x2518:
-					byte_stream[ *byte_stream_index ] = 0x85;
-					break;
-
-				case 0x251c:
-					byte_stream[ *byte_stream_index ] = 0x86;
-					break;
-
-				case 0x2524:
-					byte_stream[ *byte_stream_index ] = 0x87;
-					break;
-
-				case 0x252c:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x2534:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x253c:
-					byte_stream[ *byte_stream_index ] = 0x8a;
-					break;
-
-				case 0x2580:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x2584:
-					byte_stream[ *byte_stream_index ] = 0x8c;
-					break;
-
-				case 0x2588:
-					byte_stream[ *byte_stream_index ] = 0x8d;
-					break;
-
-				case 0x258c:
-					byte_stream[ *byte_stream_index ] = 0x8e;
-					break;
-
-				case 0x2590:
-					byte_stream[ *byte_stream_index ] = 0x8f;
-					break;
-
-				case 0x2591:
-					byte_stream[ *byte_stream_index ] = 0x90;
-					break;
-
-				case 0x2592:
-					byte_stream[ *byte_stream_index ] = 0x91;
-					break;
-
-				case 0x2593:
-					byte_stream[ *byte_stream_index ] = 0x92;
-					break;
-
-				case 0x25a0:
-					byte_stream[ *byte_stream_index ] = 0x94;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_KOI8_U:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x0410 )
-			      && ( unicode_character < 0x0450 ) )
-			{
-				unicode_character -= 0x0410;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_koi8_u_unicode_to_byte_stream_base_0x0410[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2550 )
-			      && ( unicode_character < 0x2570 ) )
-			{
-				unicode_character -= 0x2550;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_koi8_u_unicode_to_byte_stream_base_0x2550[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00a0:
-					byte_stream[ *byte_stream_index ] = 0x9a;
-					break;
-
-				case 0x00a9:
-					byte_stream[ *byte_stream_index ] = 0xbf;
-					break;
-
-				case 0x00b0:
-					byte_stream[ *byte_stream_index ] = 0x9c;
-					break;
-
-				case 0x00b2:
-					byte_stream[ *byte_stream_index ] = 0x9d;
-					break;
-
-				case 0x00b7:
-					byte_stream[ *byte_stream_index ] = 0x9e;
-					break;
-
-				case 0x00f7:
-					byte_stream[ *byte_stream_index ] = 0x9f;
-					break;
-
-				case 0x0401:
-					byte_stream[ *byte_stream_index ] = 0xb3;
-					break;
-
-				case 0x0404:
-					byte_stream[ *byte_stream_index ] = 0xb4;
-					break;
-
-				case 0x0406:
-					byte_stream[ *byte_stream_index ] = 0xb6;
-					break;
-
-				case 0x0407:
-					byte_stream[ *byte_stream_index ] = 0xb7;
-					break;
-
-				case 0x0451:
-					byte_stream[ *byte_stream_index ] = 0xa3;
-					break;
-
-				case 0x0454:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				case 0x0456:
-					byte_stream[ *byte_stream_index ] = 0xa6;
-					break;
-
-				case 0x0457:
-					byte_stream[ *byte_stream_index ] = 0xa7;
-					break;
-
-				case 0x0490:
-					byte_stream[ *byte_stream_index ] = 0xbd;
-					break;
-
-				case 0x0491:
-					byte_stream[ *byte_stream_index ] = 0xad;
-					break;
-
-				case 0x2219:
-					byte_stream[ *byte_stream_index ] = 0x95;
-					break;
-
-				case 0x221a:
-					byte_stream[ *byte_stream_index ] = 0x96;
-					break;
-
-				case 0x2248:
-					byte_stream[ *byte_stream_index ] = 0x97;
-					break;
-
-				case 0x2264:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
-
-				case 0x2265:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				case 0x2320:
-					byte_stream[ *byte_stream_index ] = 0x93;
-					break;
-
-				case 0x2321:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x2500:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2502:
-					byte_stream[ *byte_stream_index ] = 0x81;
-					break;
-
-				case 0x250c:
-					byte_stream[ *byte_stream_index ] = 0x82;
-					break;
-
-				case 0x2510:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x2514:
-					byte_stream[ *byte_stream_index ] = 0x84;
-					break;
-
-				case 0x2518:
-					byte_stream[ *byte_stream_index ] = 0x85;
-					break;
-
-				case 0x251c:
-					byte_stream[ *byte_stream_index ] = 0x86;
-					break;
-
-				case 0x2524:
-					byte_stream[ *byte_stream_index ] = 0x87;
-					break;
-
-				case 0x252c:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x2534:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x253c:
-					byte_stream[ *byte_stream_index ] = 0x8a;
-					break;
-
-				case 0x2580:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x2584:
-					byte_stream[ *byte_stream_index ] = 0x8c;
-					break;
-
-				case 0x2588:
-					byte_stream[ *byte_stream_index ] = 0x8d;
-					break;
-
-				case 0x258c:
-					byte_stream[ *byte_stream_index ] = 0x8e;
-					break;
-
-				case 0x2590:
-					byte_stream[ *byte_stream_index ] = 0x8f;
-					break;
-
-				case 0x2591:
-					byte_stream[ *byte_stream_index ] = 0x90;
-					break;
-
-				case 0x2592:
-					byte_stream[ *byte_stream_index ] = 0x91;
-					break;
-
-				case 0x2593:
-					byte_stream[ *byte_stream_index ] = 0x92;
-					break;
-
-				case 0x25a0:
-					byte_stream[ *byte_stream_index ] = 0x94;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_874:
-			if( ( unicode_character < 0x0080 )
-			 || ( unicode_character == 0x00a0 ) )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x0e00 )
-			      && ( unicode_character < 0x0e60 ) )
-			{
-				unicode_character -= 0x0e00;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_874_unicode_to_byte_stream_base_0x0e00[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2018 )
-			      && ( unicode_character < 0x2020 ) )
-			{
-				unicode_character -= 0x2018;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_874_unicode_to_byte_stream_base_0x2018[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x2013:
-					byte_stream[ *byte_stream_index ] = 0x96;
-					break;
-
-				case 0x2014:
-					byte_stream[ *byte_stream_index ] = 0x97;
-					break;
-
-				case 0x2022:
-					byte_stream[ *byte_stream_index ] = 0x95;
-					break;
-
-				case 0x2026:
-					byte_stream[ *byte_stream_index ] = 0x85;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_932:
-			result = libuna_codepage_windows_932_copy_to_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_936:
-			result = libuna_codepage_windows_936_copy_to_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_949:
-			result = libuna_codepage_windows_949_copy_to_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_950:
-			result = libuna_codepage_windows_950_copy_to_byte_stream(
-			          unicode_character,
-			          byte_stream,
-			          byte_stream_size,
-			          byte_stream_index,
-			          error );
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1250:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0120 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0138 )
-			      && ( unicode_character < 0x0180 ) )
-			{
-				unicode_character -= 0x0138;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x0138[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x02d8 )
-			      && ( unicode_character < 0x02e0 ) )
-			{
-				unicode_character -= 0x02d8;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x02d8[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2030 )
-			      && ( unicode_character < 0x2040 ) )
-			{
-				unicode_character -= 0x2030;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1250_unicode_to_byte_stream_base_0x2030[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x02c7:
-					byte_stream[ *byte_stream_index ] = 0xa1;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1251:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1251_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0400 )
-			      && ( unicode_character < 0x0460 ) )
-			{
-				unicode_character -= 0x0400;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1251_unicode_to_byte_stream_base_0x0400[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1251_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x0490:
-					byte_stream[ *byte_stream_index ] = 0xa5;
-					break;
-
-				case 0x0491:
-					byte_stream[ *byte_stream_index ] = 0xb4;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x2116:
-					byte_stream[ *byte_stream_index ] = 0xb9;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1252:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0100 ) )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1252_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x0152:
-					byte_stream[ *byte_stream_index ] = 0x8c;
-					break;
-
-				case 0x0153:
-					byte_stream[ *byte_stream_index ] = 0x9c;
-					break;
-
-				case 0x0160:
-					byte_stream[ *byte_stream_index ] = 0x8a;
-					break;
-
-				case 0x0161:
-					byte_stream[ *byte_stream_index ] = 0x9a;
-					break;
-
-				case 0x0178:
-					byte_stream[ *byte_stream_index ] = 0x9f;
-					break;
-
-				case 0x017d:
-					byte_stream[ *byte_stream_index ] = 0x8e;
-					break;
-
-				case 0x017e:
-					byte_stream[ *byte_stream_index ] = 0x9e;
-					break;
-
-				case 0x0192:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x02c6:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x02dc:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1253:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1253_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0380 )
-			      && ( unicode_character < 0x03d0 ) )
-			{
-				unicode_character -= 0x0380;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1253_unicode_to_byte_stream_base_0x0380[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1253_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x0192:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1254:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00d0 ) )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00d0 )
-			      && ( unicode_character < 0x0100 ) )
-			{
-				unicode_character -= 0x00d0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1254_unicode_to_byte_stream_base_0x00d0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1254_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x011e:
-					byte_stream[ *byte_stream_index ] = 0xd0;
-					break;
-
-				case 0x011f:
-					byte_stream[ *byte_stream_index ] = 0xf0;
-					break;
-
-				case 0x0130:
-					byte_stream[ *byte_stream_index ] = 0xdd;
-					break;
-
-				case 0x0131:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x0152:
-					byte_stream[ *byte_stream_index ] = 0x8c;
-					break;
-
-				case 0x0153:
-					byte_stream[ *byte_stream_index ] = 0x9c;
-					break;
-
-				case 0x015e:
-					byte_stream[ *byte_stream_index ] = 0xde;
-					break;
-
-				case 0x015f:
-					byte_stream[ *byte_stream_index ] = 0xfe;
-					break;
-
-				case 0x0160:
-					byte_stream[ *byte_stream_index ] = 0x8a;
-					break;
-
-				case 0x0161:
-					byte_stream[ *byte_stream_index ] = 0x9a;
-					break;
-
-				case 0x0178:
-					byte_stream[ *byte_stream_index ] = 0x9f;
-					break;
-
-				case 0x0192:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x02c6:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x02dc:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
-
-		case LIBUNA_CODEPAGE_WINDOWS_1255:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x05b0 )
-			      && ( unicode_character < 0x05c8 ) )
-			{
-				unicode_character -= 0x05b0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x05b0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x05d0 )
-			      && ( unicode_character < 0x05f8 ) )
-			{
-				unicode_character -= 0x05d0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x05d0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1255_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00d7:
-					byte_stream[ *byte_stream_index ] = 0xaa;
-					break;
-
-				case 0x00f7:
-					byte_stream[ *byte_stream_index ] = 0xba;
-					break;
-
-				case 0x0192:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x02c6:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x02dc:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
-
-				case 0x200e:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x200f:
-					byte_stream[ *byte_stream_index ] = 0xfe;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
+	byte_stream_to_unicode_table = libuna_codepage_get_byte_stream_to_unicode_table(
+	                                codepage );
 
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20aa:
-					byte_stream[ *byte_stream_index ] = 0xa4;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
+	if( byte_stream_to_unicode_table != NULL )
+	{
+		*unicode_character = byte_stream_to_unicode_table[ byte_stream_character ];
 
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
+		*byte_stream_index += 1;
 
+		return( 1 );
+	}
+	switch( codepage )
+	{
+		case LIBUNA_CODEPAGE_WINDOWS_932:
+			result = libuna_codepage_windows_932_copy_from_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
 			break;
 
-		case LIBUNA_CODEPAGE_WINDOWS_1256:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				unicode_character -= 0x00a0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1256_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x00e0 )
-			      && ( unicode_character < 0x0100 ) )
-			{
-				unicode_character -= 0x00e0;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1256_unicode_to_byte_stream_base_0x00e0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x0618 )
-			      && ( unicode_character < 0x0658 ) )
-			{
-				unicode_character -= 0x0618;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1256_unicode_to_byte_stream_base_0x0618[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2008 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2008;
-
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1256_unicode_to_byte_stream_base_0x2008[ unicode_character ];
-			}
-			else switch( unicode_character )
-			{
-				case 0x00d7:
-					byte_stream[ *byte_stream_index ] = 0xd7;
-					break;
-
-				case 0x0152:
-					byte_stream[ *byte_stream_index ] = 0x8c;
-					break;
-
-				case 0x0153:
-					byte_stream[ *byte_stream_index ] = 0x9c;
-					break;
-
-				case 0x0192:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x02c6:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x060c:
-					byte_stream[ *byte_stream_index ] = 0xa1;
-					break;
-
-				case 0x0679:
-					byte_stream[ *byte_stream_index ] = 0x8a;
-					break;
-
-				case 0x067e:
-					byte_stream[ *byte_stream_index ] = 0x81;
-					break;
-
-				case 0x0686:
-					byte_stream[ *byte_stream_index ] = 0x8d;
-					break;
-
-				case 0x0688:
-					byte_stream[ *byte_stream_index ] = 0x8f;
-					break;
-
-				case 0x0691:
-					byte_stream[ *byte_stream_index ] = 0x9a;
-					break;
-
-				case 0x0698:
-					byte_stream[ *byte_stream_index ] = 0x8e;
-					break;
+		case LIBUNA_CODEPAGE_WINDOWS_936:
+			result = libuna_codepage_windows_936_copy_from_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
+			break;
 
-				case 0x06a9:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
+		case LIBUNA_CODEPAGE_WINDOWS_949:
+			result = libuna_codepage_windows_949_copy_from_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
+			break;
 
-				case 0x06af:
-					byte_stream[ *byte_stream_index ] = 0x90;
-					break;
+		case LIBUNA_CODEPAGE_WINDOWS_950:
+			result = libuna_codepage_windows_950_copy_from_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
+			break;
 
-				case 0x06ba:
-					byte_stream[ *byte_stream_index ] = 0x9f;
-					break;
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			"%s: unsupported codepage: %d.",
+			 function,
+			 codepage );
 
-				case 0x06be:
-					byte_stream[ *byte_stream_index ] = 0xaa;
-					break;
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy Unicode character from byte stream.",
+		 function );
 
-				case 0x06c1:
-					byte_stream[ *byte_stream_index ] = 0xc0;
-					break;
+		return( -1 );
+	}
+	return( result );
+}
 
-				case 0x06d2:
-					byte_stream[ *byte_stream_index ] = 0xff;
-					break;
+/* Copies a Unicode character to a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_unicode_character_copy_to_byte_stream(
+     libuna_unicode_character_t unicode_character,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function                            = "libuna_unicode_character_copy_to_byte_stream";
+	const uint8_t *unicode_to_byte_stream_page_index = NULL;
+	const uint8_t *unicode_to_byte_stream_pages      = NULL;
+	size_t page_number                               = 0;
+	int result                                       = 1;
 
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
 
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
 
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
 
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
+		return( -1 );
+	}
+	if( *byte_stream_index >= byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
 
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
+		return( -1 );
+	}
+	switch( codepage )
+	{
+		case LIBUNA_CODEPAGE_WINDOWS_932:
+			result = libuna_codepage_windows_932_copy_to_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
+			break;
 
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
+		case LIBUNA_CODEPAGE_WINDOWS_936:
+			result = libuna_codepage_windows_936_copy_to_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
+			break;
 
+		case LIBUNA_CODEPAGE_WINDOWS_949:
+			result = libuna_codepage_windows_949_copy_to_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
 			break;
 
-		case LIBUNA_CODEPAGE_WINDOWS_1257:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x0180 ) )
-			{
-				unicode_character -= 0x00a0;
+		case LIBUNA_CODEPAGE_WINDOWS_950:
+			result = libuna_codepage_windows_950_copy_to_byte_stream(
+			          unicode_character,
+			          byte_stream,
+			          byte_stream_size,
+			          byte_stream_index,
+			          error );
+			break;
 
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1257_unicode_to_byte_stream_base_0x00a0[ unicode_character ];
-			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
-			{
-				unicode_character -= 0x2010;
+		default:
+			result = libuna_codepage_get_unicode_to_byte_stream_table(
+			          codepage,
+			          &unicode_to_byte_stream_page_index,
+			          &unicode_to_byte_stream_pages,
+			          error );
 
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1257_unicode_to_byte_stream_base_0x2010[ unicode_character ];
-			}
-			else switch( unicode_character )
+			if( result == -1 )
 			{
-				case 0x02c7:
-					byte_stream[ *byte_stream_index ] = 0x8e;
-					break;
-
-				case 0x02d9:
-					byte_stream[ *byte_stream_index ] = 0xff;
-					break;
-
-				case 0x02db:
-					byte_stream[ *byte_stream_index ] = 0x9e;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
-			}
-			*byte_stream_index += 1;
-
-			break;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve Unicode to byte stream lookup table.",
+				 function );
 
-		case LIBUNA_CODEPAGE_WINDOWS_1258:
-			if( unicode_character < 0x0080 )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
-			}
-			else if( ( unicode_character >= 0x00a0 )
-			      && ( unicode_character < 0x00c0 ) )
-			{
-				byte_stream[ *byte_stream_index ] = (uint8_t) unicode_character;
+				return( -1 );
 			}
-			else if( ( unicode_character >= 0x00c0 )
-			      && ( unicode_character < 0x0108 ) )
+			else if( result == 0 )
 			{
-				unicode_character -= 0x00c0;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported codepage: %d.",
+				 function,
+				 codepage );
 
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1258_unicode_to_byte_stream_base_0x00c0[ unicode_character ];
+				return( -1 );
 			}
-			else if( ( unicode_character >= 0x2010 )
-			      && ( unicode_character < 0x2028 ) )
+			if( unicode_character < 0x00010000UL )
 			{
-				unicode_character -= 0x2010;
+				page_number = unicode_to_byte_stream_page_index[ unicode_character >> 8 ];
 
-				byte_stream[ *byte_stream_index ] = libuna_codepage_windows_1258_unicode_to_byte_stream_base_0x2010[ unicode_character ];
+				byte_stream[ *byte_stream_index ] = unicode_to_byte_stream_pages[ ( page_number << 8 ) | ( unicode_character & 0x000000ffUL ) ];
 			}
-			else switch( unicode_character )
+			else
 			{
-				case 0x0110:
-					byte_stream[ *byte_stream_index ] = 0xd0;
-					break;
-
-				case 0x0111:
-					byte_stream[ *byte_stream_index ] = 0xf0;
-					break;
-
-				case 0x0152:
-					byte_stream[ *byte_stream_index ] = 0x8c;
-					break;
-
-				case 0x0153:
-					byte_stream[ *byte_stream_index ] = 0x9c;
-					break;
-
-				case 0x0178:
-					byte_stream[ *byte_stream_index ] = 0x9f;
-					break;
-
-				case 0x0192:
-					byte_stream[ *byte_stream_index ] = 0x83;
-					break;
-
-				case 0x01a0:
-					byte_stream[ *byte_stream_index ] = 0xd5;
-					break;
-
-				case 0x01a1:
-					byte_stream[ *byte_stream_index ] = 0xf5;
-					break;
-
-				case 0x01af:
-					byte_stream[ *byte_stream_index ] = 0xdd;
-					break;
-
-				case 0x01b0:
-					byte_stream[ *byte_stream_index ] = 0xfd;
-					break;
-
-				case 0x02c6:
-					byte_stream[ *byte_stream_index ] = 0x88;
-					break;
-
-				case 0x02dc:
-					byte_stream[ *byte_stream_index ] = 0x98;
-					break;
-
-				case 0x0300:
-					byte_stream[ *byte_stream_index ] = 0xcc;
-					break;
-
-				case 0x0301:
-					byte_stream[ *byte_stream_index ] = 0xec;
-					break;
-
-				case 0x0303:
-					byte_stream[ *byte_stream_index ] = 0xde;
-					break;
-
-				case 0x0309:
-					byte_stream[ *byte_stream_index ] = 0xd2;
-					break;
-
-				case 0x0323:
-					byte_stream[ *byte_stream_index ] = 0xf2;
-					break;
-
-				case 0x2030:
-					byte_stream[ *byte_stream_index ] = 0x89;
-					break;
-
-				case 0x2039:
-					byte_stream[ *byte_stream_index ] = 0x8b;
-					break;
-
-				case 0x203a:
-					byte_stream[ *byte_stream_index ] = 0x9b;
-					break;
-
-				case 0x20ab:
-					byte_stream[ *byte_stream_index ] = 0xfe;
-					break;
-
-				case 0x20ac:
-					byte_stream[ *byte_stream_index ] = 0x80;
-					break;
-
-				case 0x2122:
-					byte_stream[ *byte_stream_index ] = 0x99;
-					break;
-
-				default:
-					byte_stream[ *byte_stream_index ] = 0x1a;
-					break;
+				byte_stream[ *byte_stream_index ] = 0x1a;
 			}
 			*byte_stream_index += 1;
 
 			break;
-
-		default:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			"%s: unsupported codepage: %d.",
-			 function,
-		         codepage );
-
-			return( -1 );
 	}
 	if( result != 1 )
 	{
@@ -3645,7 +1169,7 @@ int libuna_unicode_character_copy_from_utf7_stream(
 			{
 				*unicode_character  -= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START;
 				*unicode_character <<= 10;
-				*unicode_character  += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END;
+				*unicode_character  += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START;
 				*unicode_character  += 0x010000;
 			}
 			else
@@ -4766,7 +2290,7 @@ int libuna_unicode_character_copy_from_utf16(
 		{
 			*unicode_character  -= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START;
 			*unicode_character <<= 10;
-			*unicode_character  += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END;
+			*unicode_character  += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START;
 			*unicode_character  += 0x010000;
 		}
 		else
@@ -5008,7 +2532,7 @@ int libuna_unicode_character_copy_from_utf16_stream(
 		{
 			*unicode_character  -= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START;
 			*unicode_character <<= 10;
-			*unicode_character  += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END;
+			*unicode_character  += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START;
 			*unicode_character  += 0x010000;
 		}
 		else
@@ -5449,9 +2973,9 @@ int libuna_unicode_character_copy_from_utf32_stream(
 	{
 		*unicode_character   = utf32_stream[ *utf32_stream_index + 3 ];
 		*unicode_character <<= 8;
-		*unicode_character   = utf32_stream[ *utf32_stream_index + 2 ];
+		*unicode_character  += utf32_stream[ *utf32_stream_index + 2 ];
 		*unicode_character <<= 8;
-		*unicode_character   = utf32_stream[ *utf32_stream_index + 1 ];
+		*unicode_character  += utf32_stream[ *utf32_stream_index + 1 ];
 		*unicode_character <<= 8;
 		*unicode_character  += utf32_stream[ *utf32_stream_index ];
 	}
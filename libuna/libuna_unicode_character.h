@@ -30,6 +30,15 @@
 #include "libuna_libcerror.h"
 #include "libuna_types.h"
 
+/* The inline function specifier, Microsoft Visual Studio C compilers
+ * only support __inline
+ */
+#if defined( _MSC_VER )
+#define LIBUNA_INLINE __inline
+#else
+#define LIBUNA_INLINE inline
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
@@ -186,6 +195,366 @@ int libuna_unicode_character_copy_to_utf32_stream(
      int byte_order,
      libcerror_error_t **error );
 
+/* The unchecked functions do not validate their arguments and do not set
+ * an error, they are used by the per character loops of the string functions
+ * that already validated the strings and indexes. They are defined inline
+ * so that the compiler can expand them into these loops
+ */
+
+/* Determines the size of an UTF-8 character from an Unicode character without argument checks
+ * Returns the number of UTF-8 character bytes
+ */
+static LIBUNA_INLINE size_t libuna_unicode_character_size_to_utf8_unchecked(
+        libuna_unicode_character_t unicode_character )
+{
+	if( unicode_character < 0x080 )
+	{
+		return( 1 );
+	}
+	else if( unicode_character < 0x0800 )
+	{
+		return( 2 );
+	}
+	else if( ( unicode_character < 0x010000 )
+	      || ( unicode_character > LIBUNA_UNICODE_CHARACTER_MAX ) )
+	{
+		return( 3 );
+	}
+	return( 4 );
+}
+
+/* Copies a Unicode character from an UTF-8 string without argument checks
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+static LIBUNA_INLINE int libuna_unicode_character_copy_from_utf8_unchecked(
+     libuna_unicode_character_t *unicode_character,
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index )
+{
+	const libuna_utf8_character_t *utf8_character = NULL;
+	libuna_unicode_character_t safe_character     = 0;
+	uint8_t utf8_character_additional_bytes       = 0;
+
+	if( *utf8_string_index >= utf8_string_size )
+	{
+		return( LIBUNA_STATUS_TRUNCATED_INPUT );
+	}
+	utf8_character = &( utf8_string[ *utf8_string_index ] );
+
+	/* Determine the number of additional bytes of the UTF-8 character
+	 */
+	if( utf8_character[ 0 ] < 0xc0 )
+	{
+		utf8_character_additional_bytes = 0;
+	}
+	else if( utf8_character[ 0 ] < 0xe0 )
+	{
+		utf8_character_additional_bytes = 1;
+	}
+	else if( utf8_character[ 0 ] < 0xf0 )
+	{
+		utf8_character_additional_bytes = 2;
+	}
+	else if( utf8_character[ 0 ] < 0xf8 )
+	{
+		utf8_character_additional_bytes = 3;
+	}
+	else if( utf8_character[ 0 ] < 0xfc )
+	{
+		utf8_character_additional_bytes = 4;
+	}
+	else
+	{
+		utf8_character_additional_bytes = 5;
+	}
+	if( utf8_character_additional_bytes >= ( utf8_string_size - *utf8_string_index ) )
+	{
+		return( LIBUNA_STATUS_TRUNCATED_INPUT );
+	}
+	/* Unicode limits the UTF-8 character to consist of a maximum of 4 bytes
+	 */
+	if( ( utf8_character[ 0 ] > 0xf4 )
+	 || ( ( utf8_character[ 0 ] >= 0x80 )
+	  &&  ( utf8_character[ 0 ] < 0xc0 ) ) )
+	{
+		return( LIBUNA_STATUS_INVALID_INPUT );
+	}
+	safe_character = utf8_character[ 0 ];
+
+	if( utf8_character_additional_bytes >= 1 )
+	{
+		if( ( utf8_character[ 1 ] < 0x80 )
+		 || ( utf8_character[ 1 ] > 0xbf )
+		 || ( ( utf8_character[ 0 ] == 0xe0 )
+		  &&  ( utf8_character[ 1 ] < 0xa0 ) )
+		 || ( ( utf8_character[ 0 ] == 0xed )
+		  &&  ( utf8_character[ 1 ] > 0x9f ) )
+		 || ( ( utf8_character[ 0 ] == 0xf0 )
+		  &&  ( utf8_character[ 1 ] < 0x90 ) )
+		 || ( ( utf8_character[ 0 ] == 0xf4 )
+		  &&  ( utf8_character[ 1 ] > 0x8f ) ) )
+		{
+			return( LIBUNA_STATUS_INVALID_INPUT );
+		}
+		safe_character <<= 6;
+		safe_character  += utf8_character[ 1 ];
+
+		if( utf8_character_additional_bytes == 1 )
+		{
+			safe_character -= 0x03080;
+		}
+	}
+	if( utf8_character_additional_bytes >= 2 )
+	{
+		if( ( utf8_character[ 2 ] < 0x80 )
+		 || ( utf8_character[ 2 ] > 0xbf ) )
+		{
+			return( LIBUNA_STATUS_INVALID_INPUT );
+		}
+		safe_character <<= 6;
+		safe_character  += utf8_character[ 2 ];
+
+		if( utf8_character_additional_bytes == 2 )
+		{
+			safe_character -= 0x0e2080;
+		}
+	}
+	if( utf8_character_additional_bytes == 3 )
+	{
+		if( ( utf8_character[ 3 ] < 0x80 )
+		 || ( utf8_character[ 3 ] > 0xbf ) )
+		{
+			return( LIBUNA_STATUS_INVALID_INPUT );
+		}
+		safe_character <<= 6;
+		safe_character  += utf8_character[ 3 ];
+		safe_character  -= 0x03c82080;
+	}
+	if( safe_character > LIBUNA_UNICODE_CHARACTER_MAX )
+	{
+		safe_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+	}
+	*unicode_character  = safe_character;
+	*utf8_string_index += 1 + utf8_character_additional_bytes;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies a Unicode character into an UTF-8 string without argument checks
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+static LIBUNA_INLINE int libuna_unicode_character_copy_to_utf8_unchecked(
+     libuna_unicode_character_t unicode_character,
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index )
+{
+	libuna_utf8_character_t *utf8_character = NULL;
+	size_t utf8_character_size              = 0;
+
+	if( unicode_character > LIBUNA_UNICODE_CHARACTER_MAX )
+	{
+		unicode_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+	}
+	utf8_character_size = libuna_unicode_character_size_to_utf8_unchecked(
+	                       unicode_character );
+
+	if( ( *utf8_string_index >= utf8_string_size )
+	 || ( utf8_character_size > ( utf8_string_size - *utf8_string_index ) ) )
+	{
+		return( LIBUNA_STATUS_OUTPUT_TOO_SMALL );
+	}
+	utf8_character = &( utf8_string[ *utf8_string_index ] );
+
+	switch( utf8_character_size )
+	{
+		case 1:
+			utf8_character[ 0 ] = (libuna_utf8_character_t) unicode_character;
+			break;
+
+		case 2:
+			utf8_character[ 0 ] = (libuna_utf8_character_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			utf8_character[ 1 ] = (libuna_utf8_character_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			break;
+
+		case 3:
+			utf8_character[ 0 ] = (libuna_utf8_character_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			utf8_character[ 1 ] = (libuna_utf8_character_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_character[ 2 ] = (libuna_utf8_character_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			break;
+
+		default:
+			utf8_character[ 0 ] = (libuna_utf8_character_t) ( 0xf0 | ( unicode_character >> 18 ) );
+			utf8_character[ 1 ] = (libuna_utf8_character_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+			utf8_character[ 2 ] = (libuna_utf8_character_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_character[ 3 ] = (libuna_utf8_character_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			break;
+	}
+	*utf8_string_index += utf8_character_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Determines the size of an UTF-16 character from an Unicode character without argument checks
+ * Returns the number of UTF-16 characters
+ */
+static LIBUNA_INLINE size_t libuna_unicode_character_size_to_utf16_unchecked(
+        libuna_unicode_character_t unicode_character )
+{
+	if( ( unicode_character > LIBUNA_UNICODE_BASIC_MULTILINGUAL_PLANE_MAX )
+	 && ( unicode_character <= LIBUNA_UTF16_CHARACTER_MAX ) )
+	{
+		return( 2 );
+	}
+	return( 1 );
+}
+
+/* Copies a Unicode character from an UTF-16 string without argument checks
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+static LIBUNA_INLINE int libuna_unicode_character_copy_from_utf16_unchecked(
+     libuna_unicode_character_t *unicode_character,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index )
+{
+	libuna_unicode_character_t safe_character = 0;
+	libuna_utf16_character_t utf16_surrogate  = 0;
+
+	if( *utf16_string_index >= utf16_string_size )
+	{
+		return( LIBUNA_STATUS_TRUNCATED_INPUT );
+	}
+	safe_character = utf16_string[ *utf16_string_index ];
+
+	if( ( safe_character >= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START )
+	 && ( safe_character <= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_END ) )
+	{
+		if( ( *utf16_string_index + 1 ) >= utf16_string_size )
+		{
+			return( LIBUNA_STATUS_TRUNCATED_INPUT );
+		}
+		utf16_surrogate = utf16_string[ *utf16_string_index + 1 ];
+
+		if( ( utf16_surrogate >= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START )
+		 && ( utf16_surrogate <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+		{
+			safe_character -= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START;
+			safe_character <<= 10;
+			safe_character += utf16_surrogate - LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START;
+			safe_character += 0x010000;
+		}
+		else
+		{
+			safe_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+		}
+		*utf16_string_index += 1;
+	}
+	else if( ( safe_character >= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START )
+	      && ( safe_character <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+	{
+		safe_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+	}
+	*unicode_character   = safe_character;
+	*utf16_string_index += 1;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies a Unicode character into an UTF-16 string without argument checks
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+static LIBUNA_INLINE int libuna_unicode_character_copy_to_utf16_unchecked(
+     libuna_unicode_character_t unicode_character,
+     libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index )
+{
+	if( *utf16_string_index >= utf16_string_size )
+	{
+		return( LIBUNA_STATUS_OUTPUT_TOO_SMALL );
+	}
+	if( ( ( unicode_character >= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START )
+	  && ( unicode_character <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+	 || ( unicode_character > LIBUNA_UTF16_CHARACTER_MAX ) )
+	{
+		unicode_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+	}
+	if( unicode_character <= LIBUNA_UNICODE_BASIC_MULTILINGUAL_PLANE_MAX )
+	{
+		utf16_string[ *utf16_string_index ] = (libuna_utf16_character_t) unicode_character;
+
+		*utf16_string_index += 1;
+	}
+	else
+	{
+		if( ( *utf16_string_index + 1 ) >= utf16_string_size )
+		{
+			return( LIBUNA_STATUS_OUTPUT_TOO_SMALL );
+		}
+		unicode_character                      -= 0x010000;
+		utf16_string[ *utf16_string_index     ] = (libuna_utf16_character_t) ( ( unicode_character >> 10 ) + LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START );
+		utf16_string[ *utf16_string_index + 1 ] = (libuna_utf16_character_t) ( ( unicode_character & 0x03ff ) + LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START );
+
+		*utf16_string_index += 2;
+	}
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies a Unicode character from an UTF-32 string without argument checks
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+static LIBUNA_INLINE int libuna_unicode_character_copy_from_utf32_unchecked(
+     libuna_unicode_character_t *unicode_character,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index )
+{
+	if( *utf32_string_index >= utf32_string_size )
+	{
+		return( LIBUNA_STATUS_TRUNCATED_INPUT );
+	}
+	if( ( utf32_string[ *utf32_string_index ] >= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_START )
+	 && ( utf32_string[ *utf32_string_index ] <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+	{
+		*unicode_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+	}
+	else
+	{
+		*unicode_character = utf32_string[ *utf32_string_index ];
+	}
+	*utf32_string_index += 1;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies a Unicode character into an UTF-32 string without argument checks
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+static LIBUNA_INLINE int libuna_unicode_character_copy_to_utf32_unchecked(
+     libuna_unicode_character_t unicode_character,
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index )
+{
+	if( *utf32_string_index >= utf32_string_size )
+	{
+		return( LIBUNA_STATUS_OUTPUT_TOO_SMALL );
+	}
+	if( ( ( unicode_character >= LIBUNA_UNICODE_SURROGATE_HIGH_RANGE_START )
+	  && ( unicode_character <= LIBUNA_UNICODE_SURROGATE_LOW_RANGE_END ) )
+	 || ( unicode_character > LIBUNA_UTF32_CHARACTER_MAX ) )
+	{
+		unicode_character = LIBUNA_UNICODE_REPLACEMENT_CHARACTER;
+	}
+	utf32_string[ *utf32_string_index ] = (libuna_utf32_character_t) unicode_character;
+
+	*utf32_string_index += 1;
+
+	return( LIBUNA_STATUS_OK );
+}
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_transcode.h"
 #include "libuna_types.h"
 #include "libuna_unicode_character.h"
 #include "libuna_utf16_stream.h"
@@ -163,6 +164,22 @@ int libuna_utf16_stream_size_from_utf8(
 
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 utf16_stream_size );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -295,6 +312,25 @@ int libuna_utf16_stream_copy_from_utf8(
 	}
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf16_stream_copy_ascii_from_utf8(
+			 utf16_stream,
+			 utf16_stream_size,
+			 &utf16_stream_index,
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 byte_order );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -566,6 +602,22 @@ int libuna_utf16_stream_size_from_utf32(
 
 	while( utf32_string_index < utf32_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf32(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 utf16_stream_size );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -698,6 +750,25 @@ int libuna_utf16_stream_copy_from_utf32(
 	}
 	while( utf32_string_index < utf32_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf16_stream_copy_ascii_from_utf32(
+			 utf16_stream,
+			 utf16_stream_size,
+			 &utf16_stream_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 byte_order );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -739,3 +810,300 @@ int libuna_utf16_stream_copy_from_utf32(
 	return( 1 );
 }
 
+
+/* Validates an UTF-16 stream
+ * The UTF-16 stream index is set to the index of the first UTF-16 character that is
+ * invalid or incomplete or to the UTF-16 stream size if the UTF-16 stream is valid
+ * Unlike the conversion functions, which replace unpaired surrogates with
+ * the Unicode replacement character, unpaired surrogates are invalid
+ * A byte order of 0 represents the byte order of the byte order mark
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libuna_utf16_stream_validate(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *utf16_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf16_stream_validate";
+	int read_byte_order     = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	*utf16_stream_index = 0;
+
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( utf16_stream_size >= 2 )
+	{
+		if( ( utf16_stream[ 0 ] == 0xfe )
+		 && ( utf16_stream[ 1 ] == 0xff ) )
+		{
+			read_byte_order     = LIBUNA_ENDIAN_BIG;
+			*utf16_stream_index = 2;
+		}
+		else if( ( utf16_stream[ 0 ] == 0xff )
+		      && ( utf16_stream[ 1 ] == 0xfe ) )
+		{
+			read_byte_order     = LIBUNA_ENDIAN_LITTLE;
+			*utf16_stream_index = 2;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_transcode_utf16_stream_validate(
+	 utf16_stream,
+	 utf16_stream_size,
+	 utf16_stream_index,
+	 byte_order );
+
+	if( *utf16_stream_index != utf16_stream_size )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the number of Unicode characters in an UTF-16 stream
+ * A high surrogate starts a Unicode character of 2 UTF-16 characters, like in
+ * libuna_unicode_character_copy_from_utf16_stream
+ * A byte order mark (BOM) is not counted as a Unicode character
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf16_stream_get_number_of_characters(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_utf16_stream_get_number_of_characters";
+	size_t stream_index     = 0;
+	int read_byte_order     = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of characters.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( utf16_stream_size >= 2 )
+	{
+		if( ( utf16_stream[ 0 ] == 0xfe )
+		 && ( utf16_stream[ 1 ] == 0xff ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_BIG;
+			stream_index    = 2;
+		}
+		else if( ( utf16_stream[ 0 ] == 0xff )
+		      && ( utf16_stream[ 1 ] == 0xfe ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_LITTLE;
+			stream_index    = 2;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_transcode_utf16_count_characters(
+	 utf16_stream,
+	 utf16_stream_size,
+	 &stream_index,
+	 byte_order,
+	 utf16_stream_size,
+	 number_of_characters );
+
+	return( 1 );
+}
+
+/* Seeks a specific Unicode character in an UTF-16 stream
+ * A high surrogate starts a Unicode character of 2 UTF-16 characters, like in
+ * libuna_unicode_character_copy_from_utf16_stream
+ * A byte order mark (BOM) is not counted as a Unicode character
+ * The UTF-16 stream index is set to the index of the Unicode character or, if the UTF-16 stream
+ * contains less Unicode characters than the character index, to the end of the UTF-16 stream
+ * Returns 1 if successful, 0 if the UTF-16 stream contains less Unicode characters or -1 on error
+ */
+int libuna_utf16_stream_seek_character(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t character_index,
+     size_t *utf16_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libuna_utf16_stream_seek_character";
+	size_t stream_index         = 0;
+	size_t number_of_characters = 0;
+	int read_byte_order         = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( utf16_stream_size >= 2 )
+	{
+		if( ( utf16_stream[ 0 ] == 0xfe )
+		 && ( utf16_stream[ 1 ] == 0xff ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_BIG;
+			stream_index    = 2;
+		}
+		else if( ( utf16_stream[ 0 ] == 0xff )
+		      && ( utf16_stream[ 1 ] == 0xfe ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_LITTLE;
+			stream_index    = 2;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_transcode_utf16_count_characters(
+	 utf16_stream,
+	 utf16_stream_size,
+	 &stream_index,
+	 byte_order,
+	 character_index,
+	 &number_of_characters );
+
+	*utf16_stream_index = stream_index;
+
+	if( number_of_characters < character_index )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
@@ -101,6 +101,31 @@ int libuna_utf16_stream_copy_from_utf32(
  * libuna_utf32_string_copy_from_utf16_stream
  */
 
+LIBUNA_EXTERN \
+int libuna_utf16_stream_validate(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *utf16_stream_index,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf16_stream_get_number_of_characters(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *number_of_characters,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf16_stream_seek_character(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t character_index,
+     size_t *utf16_stream_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
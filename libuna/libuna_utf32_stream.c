@@ -24,6 +24,7 @@
 
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_transcode.h"
 #include "libuna_types.h"
 #include "libuna_unicode_character.h"
 #include "libuna_utf32_stream.h"
@@ -167,6 +168,22 @@ int libuna_utf32_stream_size_from_utf8(
 
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 utf32_stream_size );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -299,6 +316,25 @@ int libuna_utf32_stream_copy_from_utf8(
 	}
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_stream_copy_ascii_from_utf8(
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 byte_order );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -392,6 +428,22 @@ int libuna_utf32_stream_size_from_utf16(
 
 	while( utf16_string_index < utf16_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf16(
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index,
+			 utf32_stream_size );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16(
@@ -524,6 +576,25 @@ int libuna_utf32_stream_copy_from_utf16(
 	}
 	while( utf16_string_index < utf16_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_stream_copy_ascii_from_utf16(
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index,
+			 byte_order );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16(
@@ -751,3 +822,299 @@ int libuna_utf32_stream_copy_from_utf32(
 	return( 1 );
 }
 
+
+/* Validates an UTF-32 stream
+ * The UTF-32 stream index is set to the index of the first UTF-32 character that is
+ * invalid or incomplete or to the UTF-32 stream size if the UTF-32 stream is valid
+ * Unlike the conversion functions, which replace surrogates with the Unicode
+ * replacement character, surrogates and values that exceed the maximum Unicode
+ * character are invalid
+ * A byte order of 0 represents the byte order of the byte order mark
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libuna_utf32_stream_validate(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     size_t *utf32_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_stream_validate";
+	int read_byte_order     = 0;
+
+	if( utf32_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	*utf32_stream_index = 0;
+
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( utf32_stream_size >= 4 )
+	{
+		if( ( utf32_stream[ 0 ] == 0x00 )
+		 && ( utf32_stream[ 1 ] == 0x00 )
+		 && ( utf32_stream[ 2 ] == 0xfe )
+		 && ( utf32_stream[ 3 ] == 0xff ) )
+		{
+			read_byte_order     = LIBUNA_ENDIAN_BIG;
+			*utf32_stream_index = 4;
+		}
+		else if( ( utf32_stream[ 0 ] == 0xff )
+		      && ( utf32_stream[ 1 ] == 0xfe )
+		      && ( utf32_stream[ 2 ] == 0x00 )
+		      && ( utf32_stream[ 3 ] == 0x00 ) )
+		{
+			read_byte_order     = LIBUNA_ENDIAN_LITTLE;
+			*utf32_stream_index = 4;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_transcode_utf32_stream_validate(
+	 utf32_stream,
+	 utf32_stream_size,
+	 utf32_stream_index,
+	 byte_order );
+
+	if( *utf32_stream_index != utf32_stream_size )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the number of Unicode characters in an UTF-32 stream
+ * A byte order mark (BOM) is not counted as a Unicode character
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_stream_get_number_of_characters(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     size_t *number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_utf32_stream_get_number_of_characters";
+	size_t stream_index     = 0;
+	int read_byte_order     = 0;
+
+	if( utf32_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of characters.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( utf32_stream_size >= 4 )
+	{
+		if( ( utf32_stream[ 0 ] == 0x00 )
+		 && ( utf32_stream[ 1 ] == 0x00 )
+		 && ( utf32_stream[ 2 ] == 0xfe )
+		 && ( utf32_stream[ 3 ] == 0xff ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_BIG;
+			stream_index    = 4;
+		}
+		else if( ( utf32_stream[ 0 ] == 0xff )
+		      && ( utf32_stream[ 1 ] == 0xfe )
+		      && ( utf32_stream[ 2 ] == 0x00 )
+		      && ( utf32_stream[ 3 ] == 0x00 ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_LITTLE;
+			stream_index    = 4;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_characters = ( utf32_stream_size - stream_index ) / 4;
+
+	return( 1 );
+}
+
+/* Seeks a specific Unicode character in an UTF-32 stream
+ * A byte order mark (BOM) is not counted as a Unicode character
+ * The UTF-32 stream index is set to the index of the Unicode character or, if the UTF-32 stream
+ * contains less Unicode characters than the character index, to the end of the UTF-32 stream
+ * Returns 1 if successful, 0 if the UTF-32 stream contains less Unicode characters or -1 on error
+ */
+int libuna_utf32_stream_seek_character(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     size_t character_index,
+     size_t *utf32_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libuna_utf32_stream_seek_character";
+	size_t stream_index         = 0;
+	size_t number_of_characters = 0;
+	int read_byte_order         = 0;
+
+	if( utf32_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( utf32_stream_size >= 4 )
+	{
+		if( ( utf32_stream[ 0 ] == 0x00 )
+		 && ( utf32_stream[ 1 ] == 0x00 )
+		 && ( utf32_stream[ 2 ] == 0xfe )
+		 && ( utf32_stream[ 3 ] == 0xff ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_BIG;
+			stream_index    = 4;
+		}
+		else if( ( utf32_stream[ 0 ] == 0xff )
+		      && ( utf32_stream[ 1 ] == 0xfe )
+		      && ( utf32_stream[ 2 ] == 0x00 )
+		      && ( utf32_stream[ 3 ] == 0x00 ) )
+		{
+			read_byte_order = LIBUNA_ENDIAN_LITTLE;
+			stream_index    = 4;
+		}
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_characters = ( utf32_stream_size - stream_index ) / 4;
+
+	if( character_index > number_of_characters )
+	{
+		*utf32_stream_index = stream_index + ( number_of_characters * 4 );
+
+		return( 0 );
+	}
+	*utf32_stream_index = stream_index + ( character_index * 4 );
+
+	return( 1 );
+}
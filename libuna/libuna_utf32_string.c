@@ -22,8 +22,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libuna_case_folding.h"
+#include "libuna_codepage.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_transcode.h"
 #include "libuna_types.h"
 #include "libuna_unicode_character.h"
 #include "libuna_utf32_string.h"
@@ -39,6 +42,7 @@ int libuna_utf32_string_size_from_byte_stream(
      libcerror_error_t **error )
 {
 	static char *function                        = "libuna_utf32_string_size_from_byte_stream";
+	const uint16_t *byte_stream_to_unicode_table = NULL;
 	size_t byte_stream_index                     = 0;
 	libuna_unicode_character_t unicode_character = 0;
 
@@ -83,8 +87,37 @@ int libuna_utf32_string_size_from_byte_stream(
 	{
 		*utf32_string_size += 1;
 	}
+	byte_stream_to_unicode_table = libuna_codepage_get_byte_stream_to_unicode_table(
+	                                codepage );
+
+	if( byte_stream_to_unicode_table != NULL )
+	{
+		/* Every byte of a single-byte codepage is converted into 1 UTF-32 character
+		 */
+		*utf32_string_size += byte_stream_size;
+
+		return( 1 );
+	}
 	while( byte_stream_index < byte_stream_size )
 	{
+		if( ( unicode_character < 0x80 )
+		 && ( libuna_codepage_is_supported(
+		       codepage ) != 0 ) )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_byte_stream(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 utf32_string_size );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_byte_stream(
@@ -124,6 +157,53 @@ int libuna_utf32_string_size_from_byte_stream(
 	return( 1 );
 }
 
+
+/* Determines the maximum size of an UTF-32 string from a byte stream
+ * The maximum size is an upper bound that is determined without decoding the byte stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_byte_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_maximum_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_string_maximum_size_from_byte_stream";
+
+	if( byte_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every byte stream byte is converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = byte_stream_size;
+
+	/* A terminating end-of-string character is added if the byte stream is not terminated
+	 */
+	*utf32_string_size += 1;
+
+	return( 1 );
+}
+
 /* Copies an UTF-32 string from a byte stream
  * Returns 1 if successful or -1 on error
  */
@@ -172,6 +252,7 @@ int libuna_utf32_string_with_index_copy_from_byte_stream(
      libcerror_error_t **error )
 {
 	static char *function                        = "libuna_utf32_string_with_index_copy_from_byte_stream";
+	const uint16_t *byte_stream_to_unicode_table = NULL;
 	size_t byte_stream_index                     = 0;
 	libuna_unicode_character_t unicode_character = 0;
 	uint8_t zero_byte                            = 0;
@@ -237,8 +318,49 @@ int libuna_utf32_string_with_index_copy_from_byte_stream(
 	{
 		zero_byte = 1;
 	}
+	byte_stream_to_unicode_table = libuna_codepage_get_byte_stream_to_unicode_table(
+	                                codepage );
+
 	while( byte_stream_index < byte_stream_size )
 	{
+		if( byte_stream_to_unicode_table != NULL )
+		{
+			/* Convert the single-byte codepage characters in bulk
+			 */
+			libuna_transcode_utf32_copy_from_byte_stream(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 byte_stream_to_unicode_table );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
+		else if( ( unicode_character < 0x80 )
+		      && ( libuna_codepage_is_supported(
+		            codepage ) != 0 ) )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_byte_stream(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_byte_stream(
@@ -358,13 +480,15 @@ int libuna_utf32_string_compare_with_byte_stream(
 
 		return( -1 );
 	}
-	if( utf32_string[ utf32_string_size - 1 ] == 0 )
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
 	{
 		utf32_string_size -= 1;
 	}
 	/* Check if the byte stream is terminated with zero bytes
 	 */
-	if( byte_stream[ byte_stream_size - 1 ] == 0 )
+	if( ( byte_stream_size > 0 )
+	 && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
 	{
 		byte_stream_size -= 1;
 	}
@@ -423,6 +547,143 @@ int libuna_utf32_string_compare_with_byte_stream(
 	return( 1 );
 }
 
+/* Compares an UTF-32 string with a byte stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
+ */
+int libuna_utf32_string_compare_with_byte_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function                                    = "libuna_utf32_string_compare_with_byte_stream_case_insensitive";
+	size_t byte_stream_index                                 = 0;
+	size_t utf32_string_index                                = 0;
+	libuna_unicode_character_t utf32_unicode_character       = 0;
+	libuna_unicode_character_t byte_stream_unicode_character = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
+	/* Check if the byte stream is terminated with zero bytes
+	 */
+	if( ( byte_stream_size > 0 )
+	 && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
+	{
+		byte_stream_size -= 1;
+	}
+	while( ( utf32_string_index < utf32_string_size )
+	    && ( byte_stream_index < byte_stream_size ) )
+	{
+		/* Convert the UTF-32 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the byte stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &byte_stream_unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf32_unicode_character != byte_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf32_unicode_character ) != libuna_case_folding_get_character(
+			                                   byte_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf32_string_index != utf32_string_size )
+	 || ( byte_stream_index != byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Determines the size of an UTF-32 string from an UTF-7 stream
  * Returns 1 if successful or -1 on error
  */
@@ -491,6 +752,23 @@ int libuna_utf32_string_size_from_utf7_stream(
 	}
 	while( utf7_stream_index < utf7_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf7_stream(
+			 utf7_stream,
+			 utf7_stream_size,
+			 &utf7_stream_index,
+			 utf7_stream_base64_data,
+			 utf32_string_size );
+
+			if( utf7_stream_index >= utf7_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-7 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf7_stream(
@@ -530,6 +808,53 @@ int libuna_utf32_string_size_from_utf7_stream(
 	return( 1 );
 }
 
+
+/* Determines the maximum size of an UTF-32 string from an UTF-7 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-7 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_utf7_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_maximum_size_from_utf7_stream(
+     size_t utf7_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_string_maximum_size_from_utf7_stream";
+
+	if( utf7_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-7 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every UTF-7 stream byte is converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = utf7_stream_size;
+
+	/* A terminating end-of-string character is added if the UTF-7 stream is not terminated
+	 */
+	*utf32_string_size += 1;
+
+	return( 1 );
+}
+
 /* Copies an UTF-32 string from an UTF-7 stream
  * Returns 1 if successful or -1 on error
  */
@@ -654,6 +979,25 @@ int libuna_utf32_string_with_index_copy_from_utf7_stream(
 	}
 	while( utf7_stream_index < utf7_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf7_stream(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 utf7_stream,
+			 utf7_stream_size,
+			 &utf7_stream_index,
+			 utf7_stream_base64_data );
+
+			if( utf7_stream_index >= utf7_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-7 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf7_stream(
@@ -784,13 +1128,15 @@ int libuna_utf32_string_compare_with_utf7_stream(
 
 		return( -1 );
 	}
-	if( utf32_string[ utf32_string_size - 1 ] == 0 )
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
 	{
 		utf32_string_size -= 1;
 	}
 	/* Check if the UTF-7 stream is terminated with zero bytes
 	 */
-	if( utf7_stream[ utf7_stream_size - 1 ] == 0 )
+	if( ( utf7_stream_size > 0 )
+	 && ( utf7_stream[ utf7_stream_size - 1 ] == 0 ) )
 	{
 		utf7_stream_size -= 1;
 	}
@@ -849,92 +1195,285 @@ int libuna_utf32_string_compare_with_utf7_stream(
 	return( 1 );
 }
 
-
-/* Determines the size of an UTF-32 string from an UTF-8 string
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-32 string with an UTF-7 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf32_string_size_from_utf8(
-     const libuna_utf8_character_t *utf8_string,
-     size_t utf8_string_size,
-     size_t *utf32_string_size,
+int libuna_utf32_string_compare_with_utf7_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf7_stream,
+     size_t utf7_stream_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf32_string_size_from_utf8";
-	size_t utf8_string_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                                    = "libuna_utf32_string_compare_with_utf7_stream_case_insensitive";
+	size_t utf32_string_index                                = 0;
+	size_t utf7_stream_index                                 = 0;
+	libuna_unicode_character_t utf32_unicode_character       = 0;
+	libuna_unicode_character_t utf7_stream_unicode_character = 0;
+	uint32_t utf7_stream_base64_data                         = 0;
 
-	if( utf8_string == NULL )
+	if( utf32_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( utf32_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_size == NULL )
+	if( utf7_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string size.",
+		 "%s: invalid UTF-7 stream.",
 		 function );
 
 		return( -1 );
 	}
-	*utf32_string_size = 0;
+	if( utf7_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-7 stream size value exceeds maximum.",
+		 function );
 
-	while( utf8_string_index < utf8_string_size )
+		return( -1 );
+	}
+	if( utf7_stream_size < 1 )
 	{
-		/* Convert the UTF-8 character bytes into a Unicode character
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-7 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
+	/* Check if the UTF-7 stream is terminated with zero bytes
+	 */
+	if( ( utf7_stream_size > 0 )
+	 && ( utf7_stream[ utf7_stream_size - 1 ] == 0 ) )
+	{
+		utf7_stream_size -= 1;
+	}
+	while( ( utf32_string_index < utf32_string_size )
+	    && ( utf7_stream_index < utf7_stream_size ) )
+	{
+		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf8(
-		     &unicode_character,
-		     utf8_string,
-		     utf8_string_size,
-		     &utf8_string_index,
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the UTF-7 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf7_stream(
+		     &utf7_stream_unicode_character,
+		     utf7_stream,
+		     utf7_stream_size,
+		     &utf7_stream_index,
+		     &utf7_stream_base64_data,
+                     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-8.",
+			 "%s: unable to copy Unicode character from UTF-7 stream.",
 			 function );
 
 			return( -1 );
 		}
-		/* Determine how many UTF-32 character bytes are required
+		if( utf32_unicode_character != utf7_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf32_unicode_character ) != libuna_case_folding_get_character(
+			                                   utf7_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf32_string_index != utf32_string_size )
+	 || ( utf7_stream_index != utf7_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+
+/* Determines the size of an UTF-32 string from an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_size_from_utf8(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf32_string_size_from_utf8";
+	size_t utf8_string_index                     = 0;
+	libuna_unicode_character_t unicode_character = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf32_string_size = 0;
+
+	while( utf8_string_index < utf8_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 utf32_string_size );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_size_to_utf32(
-		     unicode_character,
-		     utf32_string_size,
-		     error ) != 1 )
+		if( libuna_unicode_character_copy_from_utf8_unchecked(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-32.",
+			 "%s: unable to copy Unicode character from UTF-8.",
 			 function );
 
 			return( -1 );
 		}
+		/* Determine how many UTF-32 character bytes are required
+		 */
+		*utf32_string_size += 1;
+	}
+	return( 1 );
+}
+
+
+/* Determines the maximum size of an UTF-32 string from an UTF-8 string
+ * The maximum size is an upper bound that is determined without decoding the UTF-8 string,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_utf8
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_maximum_size_from_utf8(
+     size_t utf8_string_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_string_maximum_size_from_utf8";
+
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
 	}
+	/* Every UTF-8 byte is converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = utf8_string_size;
+
 	return( 1 );
 }
 
@@ -1043,14 +1582,31 @@ int libuna_utf32_string_with_index_copy_from_utf8(
 	}
 	while( utf8_string_index < utf8_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf8(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf8(
+		if( libuna_unicode_character_copy_from_utf8_unchecked(
 		     &unicode_character,
 		     utf8_string,
 		     utf8_string_size,
-		     &utf8_string_index,
-		     error ) != 1 )
+		     &utf8_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1063,12 +1619,11 @@ int libuna_utf32_string_with_index_copy_from_utf8(
 		}
 		/* Convert the Unicode character into UTF-32 character bytes
 		 */
-		if( libuna_unicode_character_copy_to_utf32(
+		if( libuna_unicode_character_copy_to_utf32_unchecked(
 		     unicode_character,
 		     utf32_string,
 		     utf32_string_size,
-		     utf32_string_index,
-		     error ) != 1 )
+		     utf32_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1083,6 +1638,149 @@ int libuna_utf32_string_with_index_copy_from_utf8(
 	return( 1 );
 }
 
+/* Determines the size of an UTF-32 string from an UTF-8 string
+ * Reports an error as a status code and the offset of the UTF-8 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf32_string_size_from_utf8_with_status(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf32_string_size,
+     size_t *error_offset )
+{
+	size_t utf8_string_index                     = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf8_string == NULL )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX )
+	 || ( utf32_string_size == NULL )
+	 || ( error_offset == NULL ) )
+	{
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	*utf32_string_size = 0;
+
+	while( utf8_string_index < utf8_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf8(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 utf32_string_size );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		result = libuna_unicode_character_copy_from_utf8_unchecked(
+		          &unicode_character,
+		          utf8_string,
+		          utf8_string_size,
+		          &utf8_string_index );
+
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = utf8_string_index;
+
+			return( result );
+		}
+		/* Determine how many UTF-32 character bytes are required
+		 */
+		*utf32_string_size += 1;
+	}
+	*error_offset = utf8_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies an UTF-32 string from an UTF-8 string
+ * Reports an error as a status code and the offset of the UTF-8 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf32_string_copy_from_utf8_with_status(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *error_offset )
+{
+	size_t character_index                       = 0;
+	size_t utf32_string_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf32_string == NULL )
+	 || ( utf32_string_size > (size_t) SSIZE_MAX )
+	 || ( utf8_string == NULL )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX )
+	 || ( error_offset == NULL ) )
+	{
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	while( utf8_string_index < utf8_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf8(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index );
+
+			if( utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		character_index = utf8_string_index;
+
+		result = libuna_unicode_character_copy_from_utf8_unchecked(
+		          &unicode_character,
+		          utf8_string,
+		          utf8_string_size,
+		          &utf8_string_index );
+
+		/* Convert the Unicode character into UTF-32 character bytes
+		 */
+		if( result == LIBUNA_STATUS_OK )
+		{
+			result = libuna_unicode_character_copy_to_utf32_unchecked(
+			          unicode_character,
+			          utf32_string,
+			          utf32_string_size,
+			          &utf32_string_index );
+		}
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = character_index;
+
+			return( result );
+		}
+	}
+	*error_offset = utf8_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
 /* Determines the size of an UTF-32 string from an UTF-8 stream
  * Returns 1 if successful or -1 on error
  */
@@ -1161,6 +1859,22 @@ int libuna_utf32_string_size_from_utf8_stream(
 	}
 	while( utf8_stream_index < utf8_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf8_stream(
+			 utf8_stream,
+			 utf8_stream_size,
+			 &utf8_stream_index,
+			 utf32_string_size );
+
+			if( utf8_stream_index >= utf8_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -1199,32 +1913,79 @@ int libuna_utf32_string_size_from_utf8_stream(
 	return( 1 );
 }
 
-/* Copies an UTF-32 string from an UTF-8 stream
+
+/* Determines the maximum size of an UTF-32 string from an UTF-8 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-8 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_utf8_stream
  * Returns 1 if successful or -1 on error
  */
-int libuna_utf32_string_copy_from_utf8_stream(
-     libuna_utf32_character_t *utf32_string,
-     size_t utf32_string_size,
-     const uint8_t *utf8_stream,
+int libuna_utf32_string_maximum_size_from_utf8_stream(
      size_t utf8_stream_size,
+     size_t *utf32_string_size,
      libcerror_error_t **error )
 {
-	static char *function     = "libuna_utf32_string_copy_from_utf8_stream";
-	size_t utf32_string_index = 0;
+	static char *function = "libuna_utf32_string_maximum_size_from_utf8_stream";
 
-	if( libuna_utf32_string_with_index_copy_from_utf8_stream(
-	     utf32_string,
-	     utf32_string_size,
-	     &utf32_string_index,
-	     utf8_stream,
-	     utf8_stream_size,
-	     error ) != 1 )
+	if( utf8_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to UTF-8 stream to UTF-32 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every UTF-8 stream byte is converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = utf8_stream_size;
+
+	/* A terminating end-of-string character is added if the UTF-8 stream is not terminated
+	 */
+	*utf32_string_size += 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-32 string from an UTF-8 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_copy_from_utf8_stream(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libuna_utf32_string_copy_from_utf8_stream";
+	size_t utf32_string_index = 0;
+
+	if( libuna_utf32_string_with_index_copy_from_utf8_stream(
+	     utf32_string,
+	     utf32_string_size,
+	     &utf32_string_index,
+	     utf8_stream,
+	     utf8_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to UTF-8 stream to UTF-32 string.",
 		 function );
 
 		return( -1 );
@@ -1333,6 +2094,24 @@ int libuna_utf32_string_with_index_copy_from_utf8_stream(
 	}
 	while( utf8_stream_index < utf8_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf8_stream(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 utf8_stream,
+			 utf8_stream_size,
+			 &utf8_stream_index );
+
+			if( utf8_stream_index >= utf8_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -1403,6 +2182,7 @@ int libuna_utf32_string_compare_with_utf8_stream(
 	static char *function                                    = "libuna_utf32_string_compare_with_utf8_stream";
 	size_t utf32_string_index                                = 0;
 	size_t utf8_stream_index                                 = 0;
+	size_t number_of_characters                              = 0;
 	libuna_unicode_character_t utf32_unicode_character       = 0;
 	libuna_unicode_character_t utf8_stream_unicode_character = 0;
 
@@ -1472,19 +2252,44 @@ int libuna_utf32_string_compare_with_utf8_stream(
 			utf8_stream_index += 3;
 		}
 	}
-	if( utf32_string[ utf32_string_size - 1 ] == 0 )
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
 	{
 		utf32_string_size -= 1;
 	}
 	/* Check if the UTF-8 stream is terminated with zero bytes
 	 */
-	if( utf8_stream[ utf8_stream_size - 1 ] == 0 )
+	if( ( utf8_stream_size > 0 )
+	 && ( utf8_stream[ utf8_stream_size - 1 ] == 0 ) )
 	{
 		utf8_stream_size -= 1;
 	}
 	while( ( utf32_string_index < utf32_string_size )
 	    && ( utf8_stream_index < utf8_stream_size ) )
 	{
+		if( utf32_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0,
+			                        &( utf8_stream[ utf8_stream_index ] ),
+			                        utf8_stream_size - utf8_stream_index,
+			                        1,
+			                        0 );
+
+			utf32_string_index += number_of_characters;
+			utf8_stream_index  += number_of_characters;
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf8_stream_index >= utf8_stream_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -1536,6 +2341,188 @@ int libuna_utf32_string_compare_with_utf8_stream(
 	return( 1 );
 }
 
+/* Compares an UTF-32 string with an UTF-8 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
+ */
+int libuna_utf32_string_compare_with_utf8_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function                                    = "libuna_utf32_string_compare_with_utf8_stream_case_insensitive";
+	size_t utf32_string_index                                = 0;
+	size_t utf8_stream_index                                 = 0;
+	size_t number_of_characters                              = 0;
+	libuna_unicode_character_t utf32_unicode_character       = 0;
+	libuna_unicode_character_t utf8_stream_unicode_character = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-8 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-8 stream starts with a byte order mark (BOM)
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0x0ef )
+		 && ( utf8_stream[ 1 ] == 0x0bb )
+		 && ( utf8_stream[ 2 ] == 0x0bf ) )
+		{
+			utf8_stream_index += 3;
+		}
+	}
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
+	/* Check if the UTF-8 stream is terminated with zero bytes
+	 */
+	if( ( utf8_stream_size > 0 )
+	 && ( utf8_stream[ utf8_stream_size - 1 ] == 0 ) )
+	{
+		utf8_stream_size -= 1;
+	}
+	while( ( utf32_string_index < utf32_string_size )
+	    && ( utf8_stream_index < utf8_stream_size ) )
+	{
+		if( utf32_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0,
+			                        &( utf8_stream[ utf8_stream_index ] ),
+			                        utf8_stream_size - utf8_stream_index,
+			                        1,
+			                        0 );
+
+			utf32_string_index += number_of_characters;
+			utf8_stream_index  += number_of_characters;
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf8_stream_index >= utf8_stream_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_stream_unicode_character,
+		     utf8_stream,
+		     utf8_stream_size,
+		     &utf8_stream_index,
+                     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf32_unicode_character != utf8_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf32_unicode_character ) != libuna_case_folding_get_character(
+			                                   utf8_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf32_string_index != utf32_string_size )
+	 || ( utf8_stream_index != utf8_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Determines the size of an UTF-32 string from an UTF-16 string
  * Returns 1 if successful or -1 on error
  */
@@ -1586,14 +2573,29 @@ int libuna_utf32_string_size_from_utf16(
 
 	while( utf16_string_index < utf16_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf16(
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index,
+			 utf32_string_size );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16(
+		if( libuna_unicode_character_copy_from_utf16_unchecked(
 		     &unicode_character,
 		     utf16_string,
 		     utf16_string_size,
-		     &utf16_string_index,
-		     error ) != 1 )
+		     &utf16_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1606,21 +2608,51 @@ int libuna_utf32_string_size_from_utf16(
 		}
 		/* Determine how many UTF-32 character bytes are required
 		 */
-		if( libuna_unicode_character_size_to_utf32(
-		     unicode_character,
-		     utf32_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-32.",
-			 function );
+		*utf32_string_size += 1;
+	}
+	return( 1 );
+}
 
-			return( -1 );
-		}
+
+/* Determines the maximum size of an UTF-32 string from an UTF-16 string
+ * The maximum size is an upper bound that is determined without decoding the UTF-16 string,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_utf16
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_maximum_size_from_utf16(
+     size_t utf16_string_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_string_maximum_size_from_utf16";
+
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
 	}
+	/* Every UTF-16 character is converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = utf16_string_size;
+
 	return( 1 );
 }
 
@@ -1729,14 +2761,31 @@ int libuna_utf32_string_with_index_copy_from_utf16(
 	}
 	while( utf16_string_index < utf16_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf16(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16(
+		if( libuna_unicode_character_copy_from_utf16_unchecked(
 		     &unicode_character,
 		     utf16_string,
 		     utf16_string_size,
-		     &utf16_string_index,
-		     error ) != 1 )
+		     &utf16_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1749,12 +2798,11 @@ int libuna_utf32_string_with_index_copy_from_utf16(
 		}
 		/* Convert the Unicode character into UTF-32 character bytes
 		 */
-		if( libuna_unicode_character_copy_to_utf32(
+		if( libuna_unicode_character_copy_to_utf32_unchecked(
 		     unicode_character,
 		     utf32_string,
 		     utf32_string_size,
-		     utf32_string_index,
-		     error ) != 1 )
+		     utf32_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1769,7 +2817,150 @@ int libuna_utf32_string_with_index_copy_from_utf16(
 	return( 1 );
 }
 
-/* Determines the size of an UTF-32 string from an UTF-16 stream
+/* Determines the size of an UTF-32 string from an UTF-16 string
+ * Reports an error as a status code and the offset of the UTF-16 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf32_string_size_from_utf16_with_status(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf32_string_size,
+     size_t *error_offset )
+{
+	size_t utf16_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf16_string == NULL )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX )
+	 || ( utf32_string_size == NULL )
+	 || ( error_offset == NULL ) )
+	{
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	*utf32_string_size = 0;
+
+	while( utf16_string_index < utf16_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf16(
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index,
+			 utf32_string_size );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		result = libuna_unicode_character_copy_from_utf16_unchecked(
+		          &unicode_character,
+		          utf16_string,
+		          utf16_string_size,
+		          &utf16_string_index );
+
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = utf16_string_index;
+
+			return( result );
+		}
+		/* Determine how many UTF-32 character bytes are required
+		 */
+		*utf32_string_size += 1;
+	}
+	*error_offset = utf16_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies an UTF-32 string from an UTF-16 string
+ * Reports an error as a status code and the offset of the UTF-16 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf32_string_copy_from_utf16_with_status(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *error_offset )
+{
+	size_t character_index                       = 0;
+	size_t utf32_string_index                    = 0;
+	size_t utf16_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf32_string == NULL )
+	 || ( utf32_string_size > (size_t) SSIZE_MAX )
+	 || ( utf16_string == NULL )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX )
+	 || ( error_offset == NULL ) )
+	{
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	while( utf16_string_index < utf16_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf16(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 utf16_string,
+			 utf16_string_size,
+			 &utf16_string_index );
+
+			if( utf16_string_index >= utf16_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		character_index = utf16_string_index;
+
+		result = libuna_unicode_character_copy_from_utf16_unchecked(
+		          &unicode_character,
+		          utf16_string,
+		          utf16_string_size,
+		          &utf16_string_index );
+
+		/* Convert the Unicode character into UTF-32 character bytes
+		 */
+		if( result == LIBUNA_STATUS_OK )
+		{
+			result = libuna_unicode_character_copy_to_utf32_unchecked(
+			          unicode_character,
+			          utf32_string,
+			          utf32_string_size,
+			          &utf32_string_index );
+		}
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = character_index;
+
+			return( result );
+		}
+	}
+	*error_offset = utf16_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Determines the size of an UTF-32 string from an UTF-16 stream
  * Returns 1 if successful or -1 on error
  */
 int libuna_utf32_string_size_from_utf16_stream(
@@ -1870,6 +3061,23 @@ int libuna_utf32_string_size_from_utf16_stream(
 	}
 	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf16_stream(
+			 utf16_stream,
+			 utf16_stream_size,
+			 &utf16_stream_index,
+			 byte_order,
+			 utf32_string_size );
+
+			if( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16_stream(
@@ -1920,6 +3128,53 @@ int libuna_utf32_string_size_from_utf16_stream(
 	return( 1 );
 }
 
+
+/* Determines the maximum size of an UTF-32 string from an UTF-16 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-16 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_utf16_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_maximum_size_from_utf16_stream(
+     size_t utf16_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_string_maximum_size_from_utf16_stream";
+
+	if( utf16_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every 2 UTF-16 stream bytes are converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = utf16_stream_size / 2;
+
+	/* A terminating end-of-string character is added if the UTF-16 stream is not terminated
+	 */
+	*utf32_string_size += 1;
+
+	return( 1 );
+}
+
 /* Copies an UTF-32 string from an UTF-16 stream
  * Returns 1 if successful or -1 on error
  */
@@ -2079,6 +3334,25 @@ int libuna_utf32_string_with_index_copy_from_utf16_stream(
 	}
 	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf16_stream(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 utf16_stream,
+			 utf16_stream_size,
+			 &utf16_stream_index,
+			 byte_order );
+
+			if( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16_stream(
@@ -2162,6 +3436,7 @@ int libuna_utf32_string_compare_with_utf16_stream(
 	static char *function                                     = "libuna_utf32_string_compare_with_utf16_stream";
 	size_t utf16_stream_index                                 = 0;
 	size_t utf32_string_index                                 = 0;
+	size_t number_of_characters                               = 0;
 	libuna_unicode_character_t utf32_unicode_character        = 0;
 	libuna_unicode_character_t utf16_stream_unicode_character = 0;
 	int read_byte_order                                       = 0;
@@ -2252,13 +3527,15 @@ int libuna_utf32_string_compare_with_utf16_stream(
 
 		return( -1 );
 	}
-	if( utf32_string[ utf32_string_size - 1 ] == 0 )
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
 	{
 		utf32_string_size -= 1;
 	}
 	/* Check if the UTF-16 stream is terminated with zero bytes
 	 */
-	if( ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	if( ( utf16_stream_size >= 2 )
+	 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
 	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
 	{
 		utf16_stream_size -= 2;
@@ -2266,6 +3543,29 @@ int libuna_utf32_string_compare_with_utf16_stream(
 	while( ( utf32_string_index < utf32_string_size )
 	    && ( utf16_stream_index < utf16_stream_size ) )
 	{
+		if( utf32_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0,
+			                        &( utf16_stream[ utf16_stream_index ] ),
+			                        ( utf16_stream_size - utf16_stream_index ) / 2,
+			                        2,
+			                        byte_order );
+
+			utf32_string_index += number_of_characters;
+			utf16_stream_index += number_of_characters * 2;
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf16_stream_index >= utf16_stream_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -2318,85 +3618,96 @@ int libuna_utf32_string_compare_with_utf16_stream(
 	return( 1 );
 }
 
-/* Determines the size of an UTF-32 string from an UTF-32 stream
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-32 string with an UTF-16 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf32_string_size_from_utf32_stream(
-     const uint8_t *utf32_stream,
-     size_t utf32_stream_size,
+int libuna_utf32_string_compare_with_utf16_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
      int byte_order,
-     size_t *utf32_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf32_string_size_from_utf32_stream";
-	size_t utf32_stream_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
-	int read_byte_order                          = 0;
+	static char *function                                     = "libuna_utf32_string_compare_with_utf16_stream_case_insensitive";
+	size_t utf16_stream_index                                 = 0;
+	size_t utf32_string_index                                 = 0;
+	size_t number_of_characters                               = 0;
+	libuna_unicode_character_t utf32_unicode_character        = 0;
+	libuna_unicode_character_t utf16_stream_unicode_character = 0;
+	int read_byte_order                                       = 0;
 
-	if( utf32_stream == NULL )
+	if( utf32_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 stream.",
+		 "%s: invalid UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	if( utf32_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( utf32_stream_size < 4 )
-	 || ( ( utf32_stream_size % 4 ) != 0 ) )
+	if( utf16_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-32 stream bytes.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_size == NULL )
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	*utf32_string_size = 0;
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
 
-	/* Check if UTF-32 stream is in big or little endian
+		return( -1 );
+	}
+	/* Check if UTF-16 stream is in big or little endian
 	 */
-	if( ( utf32_stream[ 0 ] == 0x00 )
-	 && ( utf32_stream[ 1 ] == 0x00 )
-	 && ( utf32_stream[ 2 ] == 0xfe )
-	 && ( utf32_stream[ 3 ] == 0xff ) )
+	if( ( utf16_stream[ 0 ] == 0xfe )
+	 && ( utf16_stream[ 1 ] == 0xff ) )
 	{
 		read_byte_order    = LIBUNA_ENDIAN_BIG;
-		utf32_stream_index = 4;
+		utf16_stream_index = 2;
 	}
-	else if( ( utf32_stream[ 0 ] == 0xff )
-	      && ( utf32_stream[ 1 ] == 0xfe )
-	      && ( utf32_stream[ 2 ] == 0x00 )
-	      && ( utf32_stream[ 3 ] == 0x00 ) )
+	else if( ( utf16_stream[ 0 ] == 0xff )
+	      && ( utf16_stream[ 1 ] == 0xfe ) )
 	{
 		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
-		utf32_stream_index = 4;
+		utf16_stream_index = 2;
 	}
 	if( byte_order == 0 )
 	{
@@ -2414,48 +3725,543 @@ int libuna_utf32_string_size_from_utf32_stream(
 
 		return( -1 );
 	}
-	/* Check if the UTF-32 stream is terminated with zero bytes
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
+	/* Check if the UTF-16 stream is terminated with zero bytes
 	 */
-	if( ( utf32_stream[ utf32_stream_size - 4 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 3 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
+	if( ( utf16_stream_size >= 2 )
+	 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
 	{
-		*utf32_string_size += 1;
+		utf16_stream_size -= 2;
 	}
-	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
+	while( ( utf32_string_index < utf32_string_size )
+	    && ( utf16_stream_index < utf16_stream_size ) )
 	{
-		/* Convert the UTF-32 stream bytes into a Unicode character
+		if( utf32_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0,
+			                        &( utf16_stream[ utf16_stream_index ] ),
+			                        ( utf16_stream_size - utf16_stream_index ) / 2,
+			                        2,
+			                        byte_order );
+
+			utf32_string_index += number_of_characters;
+			utf16_stream_index += number_of_characters * 2;
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf16_stream_index >= utf16_stream_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf32_stream(
-		     &unicode_character,
-		     utf32_stream,
-		     utf32_stream_size,
-		     &utf32_stream_index,
-		     byte_order,
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-32 stream.",
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32.",
 			 function );
 
 			return( -1 );
 		}
-		/* Determine how many UTF-32 character bytes are required
+		/* Convert the UTF-16 stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_size_to_utf32(
-		     unicode_character,
-		     utf32_string_size,
-		     error ) != 1 )
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &utf16_stream_unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
+                     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-32.",
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf32_unicode_character != utf16_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf32_unicode_character ) != libuna_case_folding_get_character(
+			                                   utf16_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf32_string_index != utf32_string_size )
+	 || ( utf16_stream_index != utf16_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of an UTF-32 string from an UTF-32 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_size_from_utf32_stream(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf32_string_size_from_utf32_stream";
+	size_t utf32_stream_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int read_byte_order                          = 0;
+
+	if( utf32_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf32_stream_size < 4 )
+	 || ( ( utf32_stream_size % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf32_string_size = 0;
+
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( ( utf32_stream[ 0 ] == 0x00 )
+	 && ( utf32_stream[ 1 ] == 0x00 )
+	 && ( utf32_stream[ 2 ] == 0xfe )
+	 && ( utf32_stream[ 3 ] == 0xff ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_BIG;
+		utf32_stream_index = 4;
+	}
+	else if( ( utf32_stream[ 0 ] == 0xff )
+	      && ( utf32_stream[ 1 ] == 0xfe )
+	      && ( utf32_stream[ 2 ] == 0x00 )
+	      && ( utf32_stream[ 3 ] == 0x00 ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+		utf32_stream_index = 4;
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-32 stream is terminated with zero bytes
+	 */
+	if( ( utf32_stream[ utf32_stream_size - 4 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 3 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
+	{
+		*utf32_string_size += 1;
+	}
+	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf32_stream(
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 byte_order,
+			 utf32_string_size );
+
+			if( ( utf32_stream_index + 1 ) >= utf32_stream_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32_stream(
+		     &unicode_character,
+		     utf32_stream,
+		     utf32_stream_size,
+		     &utf32_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32 stream.",
+			 function );
+
+			return( -1 );
+		}
+		/* Determine how many UTF-32 character bytes are required
+		 */
+		if( libuna_unicode_character_size_to_utf32(
+		     unicode_character,
+		     utf32_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to unable to determine size of Unicode character in UTF-32.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( utf32_stream_index != utf32_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Determines the maximum size of an UTF-32 string from an UTF-32 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-32 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf32_string_with_index_copy_from_utf32_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_maximum_size_from_utf32_stream(
+     size_t utf32_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf32_string_maximum_size_from_utf32_stream";
+
+	if( utf32_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every 4 UTF-32 stream bytes are converted into at most 1 UTF-32 character
+	 */
+	*utf32_string_size = utf32_stream_size / 4;
+
+	/* A terminating end-of-string character is added if the UTF-32 stream is not terminated
+	 */
+	*utf32_string_size += 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-32 string from an UTF-32 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_copy_from_utf32_stream(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function     = "libuna_utf32_string_copy_from_utf32_stream";
+	size_t utf32_string_index = 0;
+
+	if( libuna_utf32_string_with_index_copy_from_utf32_stream(
+	     utf32_string,
+	     utf32_string_size,
+	     &utf32_string_index,
+	     utf32_stream,
+	     utf32_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-32 stream to UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-32 string from an UTF-32 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_with_index_copy_from_utf32_stream(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf32_string_with_index_copy_from_utf32_stream";
+	size_t utf32_stream_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	uint8_t zero_byte                            = 0;
+	int read_byte_order                          = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf32_stream_size < 4 )
+	 || ( ( utf32_stream_size % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( ( utf32_stream[ 0 ] == 0x00 )
+	 && ( utf32_stream[ 1 ] == 0x00 )
+	 && ( utf32_stream[ 2 ] == 0xfe )
+	 && ( utf32_stream[ 3 ] == 0xff ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_BIG;
+		utf32_stream_index = 4;
+	}
+	else if( ( utf32_stream[ 0 ] == 0xff )
+	      && ( utf32_stream[ 1 ] == 0xfe )
+	      && ( utf32_stream[ 2 ] == 0x00 )
+	      && ( utf32_stream[ 3 ] == 0x00 ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+		utf32_stream_index = 4;
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-32 stream is terminated with zero bytes
+	 */
+	if( ( utf32_stream[ utf32_stream_size - 4 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 3 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
+	{
+		zero_byte = 1;
+	}
+	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf32_copy_ascii_from_utf32_stream(
+			 utf32_string,
+			 utf32_string_size,
+			 utf32_string_index,
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 byte_order );
+
+			if( ( utf32_stream_index + 1 ) >= utf32_stream_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32_stream(
+		     &unicode_character,
+		     utf32_stream,
+		     utf32_stream_size,
+		     &utf32_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32 stream.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the Unicode character into UTF-32 character bytes
+		 */
+		if( libuna_unicode_character_copy_to_utf32(
+		     unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     utf32_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-32.",
 			 function );
 
 			return( -1 );
@@ -2472,61 +4278,44 @@ int libuna_utf32_string_size_from_utf32_stream(
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies an UTF-32 string from an UTF-32 stream
- * Returns 1 if successful or -1 on error
- */
-int libuna_utf32_string_copy_from_utf32_stream(
-     libuna_utf32_character_t *utf32_string,
-     size_t utf32_string_size,
-     const uint8_t *utf32_stream,
-     size_t utf32_stream_size,
-     int byte_order,
-     libcerror_error_t **error )
-{
-	static char *function     = "libuna_utf32_string_copy_from_utf32_stream";
-	size_t utf32_string_index = 0;
-
-	if( libuna_utf32_string_with_index_copy_from_utf32_stream(
-	     utf32_string,
-	     utf32_string_size,
-	     &utf32_string_index,
-	     utf32_stream,
-	     utf32_stream_size,
-	     byte_order,
-	     error ) != 1 )
+	if( zero_byte != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-32 stream to UTF-32 string.",
-		 function );
+		if( *utf32_string_index >= utf32_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-32 string too small.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		utf32_string[ *utf32_string_index ] = 0;
+
+		*utf32_string_index += 1;
 	}
 	return( 1 );
 }
 
-/* Copies an UTF-32 string from an UTF-32 stream
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-32 string with an UTF-32 stream
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf32_string_with_index_copy_from_utf32_stream(
-     libuna_utf32_character_t *utf32_string,
+int libuna_utf32_string_compare_with_utf32_stream(
+     const libuna_utf32_character_t *utf32_string,
      size_t utf32_string_size,
-     size_t *utf32_string_index,
      const uint8_t *utf32_stream,
      size_t utf32_stream_size,
      int byte_order,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf32_string_with_index_copy_from_utf32_stream";
-	size_t utf32_stream_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
-	uint8_t zero_byte                            = 0;
-	int read_byte_order                          = 0;
+	static char *function                                     = "libuna_utf32_string_compare_with_utf32_stream";
+	size_t utf32_stream_index                                 = 0;
+	size_t utf32_string_index                                 = 0;
+	size_t number_of_characters                               = 0;
+	libuna_unicode_character_t utf32_unicode_character        = 0;
+	libuna_unicode_character_t utf32_stream_unicode_character = 0;
+	int read_byte_order                                       = 0;
 
 	if( utf32_string == NULL )
 	{
@@ -2550,17 +4339,6 @@ int libuna_utf32_string_with_index_copy_from_utf32_stream(
 
 		return( -1 );
 	}
-	if( utf32_string_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string index.",
-		 function );
-
-		return( -1 );
-	}
 	if( utf32_stream == NULL )
 	{
 		libcerror_error_set(
@@ -2629,90 +4407,105 @@ int libuna_utf32_string_with_index_copy_from_utf32_stream(
 
 		return( -1 );
 	}
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
 	/* Check if the UTF-32 stream is terminated with zero bytes
 	 */
-	if( ( utf32_stream[ utf32_stream_size - 4 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 3 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
+	if( ( utf32_stream_size >= 4 )
+	 && ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 3 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 2 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 1 ] == 0 ) )
 	{
-		zero_byte = 1;
+		utf32_stream_size -= 4;
 	}
-	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
+	while( ( utf32_string_index < utf32_string_size )
+	    && ( utf32_stream_index < utf32_stream_size ) )
 	{
-		/* Convert the UTF-32 stream bytes into a Unicode character
-		 */
-		if( libuna_unicode_character_copy_from_utf32_stream(
-		     &unicode_character,
-		     utf32_stream,
-		     utf32_stream_size,
-		     &utf32_stream_index,
-		     byte_order,
-		     error ) != 1 )
+		if( utf32_unicode_character < 0x80 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-32 stream.",
-			 function );
-
-			return( -1 );
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0,
+			                        &( utf32_stream[ utf32_stream_index ] ),
+			                        ( utf32_stream_size - utf32_stream_index ) / 4,
+			                        4,
+			                        byte_order );
+
+			utf32_string_index += number_of_characters;
+			utf32_stream_index += number_of_characters * 4;
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf32_stream_index >= utf32_stream_size ) )
+			{
+				break;
+			}
 		}
-		/* Convert the Unicode character into UTF-32 character bytes
+		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_to_utf32(
-		     unicode_character,
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
 		     utf32_string,
 		     utf32_string_size,
-		     utf32_string_index,
+		     &utf32_string_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
-			 "%s: unable to copy Unicode character to UTF-32.",
+			 "%s: unable to copy Unicode character from UTF-32.",
 			 function );
 
 			return( -1 );
 		}
-	}
-	if( utf32_stream_index != utf32_stream_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-32 stream bytes.",
-		 function );
-
-		return( -1 );
-	}
-	if( zero_byte != 0 )
-	{
-		if( *utf32_string_index >= utf32_string_size )
+		/* Convert the UTF-32 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32_stream(
+		     &utf32_stream_unicode_character,
+		     utf32_stream,
+		     utf32_stream_size,
+		     &utf32_stream_index,
+		     byte_order,
+                     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-32 string too small.",
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32 stream.",
 			 function );
 
 			return( -1 );
 		}
-		utf32_string[ *utf32_string_index ] = 0;
-
-		*utf32_string_index += 1;
+		if( utf32_unicode_character != utf32_stream_unicode_character )
+		{
+			return( 0 );
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf32_string_index != utf32_string_size )
+	 || ( utf32_stream_index != utf32_stream_size ) )
+	{
+		return( 0 );
 	}
 	return( 1 );
 }
 
 /* Compares an UTF-32 string with an UTF-32 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
  * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf32_string_compare_with_utf32_stream(
+int libuna_utf32_string_compare_with_utf32_stream_case_insensitive(
      const libuna_utf32_character_t *utf32_string,
      size_t utf32_string_size,
      const uint8_t *utf32_stream,
@@ -2720,9 +4513,10 @@ int libuna_utf32_string_compare_with_utf32_stream(
      int byte_order,
      libcerror_error_t **error )
 {
-	static char *function                                     = "libuna_utf32_string_compare_with_utf32_stream";
+	static char *function                                     = "libuna_utf32_string_compare_with_utf32_stream_case_insensitive";
 	size_t utf32_stream_index                                 = 0;
 	size_t utf32_string_index                                 = 0;
+	size_t number_of_characters                               = 0;
 	libuna_unicode_character_t utf32_unicode_character        = 0;
 	libuna_unicode_character_t utf32_stream_unicode_character = 0;
 	int read_byte_order                                       = 0;
@@ -2817,22 +4611,48 @@ int libuna_utf32_string_compare_with_utf32_stream(
 
 		return( -1 );
 	}
-	if( utf32_string[ utf32_string_size - 1 ] == 0 )
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
 	{
 		utf32_string_size -= 1;
 	}
 	/* Check if the UTF-32 stream is terminated with zero bytes
 	 */
-	if( ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
+	if( ( utf32_stream_size >= 4 )
+	 && ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
 	 && ( utf32_stream[ utf32_stream_size - 3 ] == 0 )
 	 && ( utf32_stream[ utf32_stream_size - 2 ] == 0 )
 	 && ( utf32_stream[ utf32_stream_size - 1 ] == 0 ) )
 	{
-		utf32_stream_size -= 1;
+		utf32_stream_size -= 4;
 	}
 	while( ( utf32_string_index < utf32_string_size )
 	    && ( utf32_stream_index < utf32_stream_size ) )
 	{
+		if( utf32_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0,
+			                        &( utf32_stream[ utf32_stream_index ] ),
+			                        ( utf32_stream_size - utf32_stream_index ) / 4,
+			                        4,
+			                        byte_order );
+
+			utf32_string_index += number_of_characters;
+			utf32_stream_index += number_of_characters * 4;
+
+			if( ( utf32_string_index >= utf32_string_size )
+			 || ( utf32_stream_index >= utf32_stream_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -2872,7 +4692,14 @@ int libuna_utf32_string_compare_with_utf32_stream(
 		}
 		if( utf32_unicode_character != utf32_stream_unicode_character )
 		{
-			return( 0 );
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf32_unicode_character ) != libuna_case_folding_get_character(
+			                                   utf32_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
 		}
 	}
 	/* Check if both strings were entirely processed
@@ -2885,3 +4712,109 @@ int libuna_utf32_string_compare_with_utf32_stream(
 	return( 1 );
 }
 
+/* Determines the number of Unicode characters in an UTF-32 string
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf32_string_get_number_of_characters(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_utf32_string_get_number_of_characters";
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of characters.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_characters = utf32_string_size;
+
+	return( 1 );
+}
+
+/* Seeks a specific Unicode character in an UTF-32 string
+ * The UTF-32 string index is set to the index of the Unicode character or, if the UTF-32 string
+ * contains less Unicode characters than the character index, to the end of the UTF-32 string
+ * Returns 1 if successful, 0 if the UTF-32 string contains less Unicode characters or -1 on error
+ */
+int libuna_utf32_string_seek_character(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t character_index,
+     size_t *utf32_string_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_utf32_string_seek_character";
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( character_index > utf32_string_size )
+	{
+		*utf32_string_index = utf32_string_size;
+
+		return( 0 );
+	}
+	*utf32_string_index = character_index;
+
+	return( 1 );
+}
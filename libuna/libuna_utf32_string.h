@@ -41,6 +41,12 @@ int libuna_utf32_string_size_from_byte_stream(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_byte_stream(
      libuna_utf32_character_t *utf32_string,
@@ -73,6 +79,15 @@ int libuna_utf32_string_compare_with_byte_stream(
      int codepage,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_compare_with_byte_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_size_from_utf7_stream(
      const uint8_t *utf7_stream,
@@ -80,6 +95,12 @@ int libuna_utf32_string_size_from_utf7_stream(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_utf7_stream(
+     size_t utf7_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_utf7_stream(
      libuna_utf32_character_t *utf32_string,
@@ -109,6 +130,14 @@ int libuna_utf32_string_compare_with_utf7_stream(
      size_t utf7_stream_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_compare_with_utf7_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf7_stream,
+     size_t utf7_stream_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_size_from_utf8(
      const libuna_utf8_character_t *utf8_string,
@@ -116,6 +145,12 @@ int libuna_utf32_string_size_from_utf8(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_utf8(
+     size_t utf8_string_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_utf8(
      libuna_utf32_character_t *utf32_string,
@@ -137,10 +172,29 @@ int libuna_utf32_string_with_index_copy_from_utf8(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_size_from_utf8_with_status(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf32_string_size,
+     size_t *error_offset );
+
+LIBUNA_EXTERN \
+int libuna_utf32_string_copy_from_utf8_with_status(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *error_offset );
+
 /* The functionality for libuna_utf32_string_compare_with_utf8 is implemented by
  * libuna_utf8_string_compare_with_utf32
  */
 
+/* The functionality for libuna_utf32_string_compare_with_utf8_case_insensitive is implemented by
+ * libuna_utf8_string_compare_with_utf32_case_insensitive
+ */
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_size_from_utf8_stream(
      const uint8_t *utf32_stream,
@@ -148,6 +202,12 @@ int libuna_utf32_string_size_from_utf8_stream(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_utf8_stream(
+     size_t utf8_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_utf8_stream(
      libuna_utf32_character_t *utf32_string,
@@ -177,6 +237,14 @@ int libuna_utf32_string_compare_with_utf8_stream(
      size_t utf8_stream_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_compare_with_utf8_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_size_from_utf16(
      const libuna_utf16_character_t *utf16_string,
@@ -184,6 +252,12 @@ int libuna_utf32_string_size_from_utf16(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_utf16(
+     size_t utf16_string_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_utf16(
      libuna_utf32_character_t *utf32_string,
@@ -205,10 +279,29 @@ int libuna_utf32_string_with_index_copy_from_utf16(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_size_from_utf16_with_status(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf32_string_size,
+     size_t *error_offset );
+
+LIBUNA_EXTERN \
+int libuna_utf32_string_copy_from_utf16_with_status(
+     libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *error_offset );
+
 /* The functionality for libuna_utf32_string_compare_with_utf16 is implemented by
  * libuna_utf16_string_compare_with_utf32
  */
 
+/* The functionality for libuna_utf32_string_compare_with_utf16_case_insensitive is implemented by
+ * libuna_utf16_string_compare_with_utf32_case_insensitive
+ */
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_size_from_utf16_stream(
      const uint8_t *utf16_stream,
@@ -217,6 +310,12 @@ int libuna_utf32_string_size_from_utf16_stream(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_utf16_stream(
+     size_t utf16_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_utf16_stream(
      libuna_utf32_character_t *utf32_string,
@@ -249,6 +348,15 @@ int libuna_utf32_string_compare_with_utf16_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_compare_with_utf16_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_size_from_utf32_stream(
      const uint8_t *utf32_stream,
@@ -257,6 +365,12 @@ int libuna_utf32_string_size_from_utf32_stream(
      size_t *utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_maximum_size_from_utf32_stream(
+     size_t utf32_stream_size,
+     size_t *utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf32_string_copy_from_utf32_stream(
      libuna_utf32_character_t *utf32_string,
@@ -289,6 +403,30 @@ int libuna_utf32_string_compare_with_utf32_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf32_string_compare_with_utf32_stream_case_insensitive(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf32_string_get_number_of_characters(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *number_of_characters,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf32_string_seek_character(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t character_index,
+     size_t *utf32_string_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -25,6 +25,7 @@
 
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_transcode.h"
 #include "libuna_types.h"
 #include "libuna_unicode_character.h"
 #include "libuna_utf8_stream.h"
@@ -299,6 +300,18 @@ int libuna_utf8_stream_size_from_utf16(
 
 	while( utf16_string_index < utf16_string_size )
 	{
+		/* Determine the size of the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_size_from_utf16(
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index,
+		 utf8_stream_size );
+
+		if( utf16_string_index >= utf16_string_size )
+		{
+			break;
+		}
 		/* Convert the UTF-16 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16(
@@ -413,6 +426,20 @@ int libuna_utf8_stream_copy_from_utf16(
 	}
 	while( utf16_string_index < utf16_string_size )
 	{
+		/* Convert the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_copy_from_utf16(
+		 utf8_stream,
+		 utf8_stream_size,
+		 &utf8_stream_index,
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index );
+
+		if( utf16_string_index >= utf16_string_size )
+		{
+			break;
+		}
 		/* Convert the UTF-16 string bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16(
@@ -505,6 +532,22 @@ int libuna_utf8_stream_size_from_utf32(
 
 	while( utf32_string_index < utf32_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf32(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 utf8_stream_size );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -619,6 +662,24 @@ int libuna_utf8_stream_copy_from_utf32(
 	}
 	while( utf32_string_index < utf32_string_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_utf32(
+			 utf8_stream,
+			 utf8_stream_size,
+			 &utf8_stream_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32(
@@ -659,3 +720,212 @@ int libuna_utf8_stream_copy_from_utf32(
 	return( 1 );
 }
 
+
+/* Validates an UTF-8 stream
+ * The UTF-8 stream index is set to the index of the first UTF-8 character that is
+ * invalid or incomplete or to the UTF-8 stream size if the UTF-8 stream is valid
+ * The UTF-8 characters that are valid are the ones that are accepted by
+ * libuna_unicode_character_copy_from_utf8
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libuna_utf8_stream_validate(
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     size_t *utf8_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_stream_validate";
+
+	if( utf8_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_stream_index = 0;
+	libuna_transcode_utf8_stream_validate(
+	 utf8_stream,
+	 utf8_stream_size,
+	 utf8_stream_index );
+
+	if( *utf8_stream_index != utf8_stream_size )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the number of Unicode characters in an UTF-8 stream
+ * Every byte that is not an UTF-8 continuation byte starts a Unicode character,
+ * hence the UTF-8 stream is expected to be valid, see libuna_utf8_stream_validate
+ * A byte order mark (BOM) is not counted as a Unicode character
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_stream_get_number_of_characters(
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     size_t *number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_utf8_stream_get_number_of_characters";
+	size_t stream_index     = 0;
+
+	if( utf8_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of characters.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-8 stream starts with a byte order mark (BOM)
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0x0ef )
+		 && ( utf8_stream[ 1 ] == 0x0bb )
+		 && ( utf8_stream[ 2 ] == 0x0bf ) )
+		{
+			stream_index = 3;
+		}
+	}
+	libuna_transcode_utf8_count_characters(
+	 utf8_stream,
+	 utf8_stream_size,
+	 &stream_index,
+	 utf8_stream_size,
+	 number_of_characters );
+
+	return( 1 );
+}
+
+/* Seeks a specific Unicode character in an UTF-8 stream
+ * Every byte that is not an UTF-8 continuation byte starts a Unicode character,
+ * hence the UTF-8 stream is expected to be valid, see libuna_utf8_stream_validate
+ * A byte order mark (BOM) is not counted as a Unicode character
+ * The UTF-8 stream index is set to the index of the Unicode character or, if the UTF-8 stream
+ * contains less Unicode characters than the character index, to the end of the UTF-8 stream
+ * Returns 1 if successful, 0 if the UTF-8 stream contains less Unicode characters or -1 on error
+ */
+int libuna_utf8_stream_seek_character(
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     size_t character_index,
+     size_t *utf8_stream_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libuna_utf8_stream_seek_character";
+	size_t stream_index         = 0;
+	size_t number_of_characters = 0;
+
+	if( utf8_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-8 stream starts with a byte order mark (BOM)
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0x0ef )
+		 && ( utf8_stream[ 1 ] == 0x0bb )
+		 && ( utf8_stream[ 2 ] == 0x0bf ) )
+		{
+			stream_index = 3;
+		}
+	}
+	libuna_transcode_utf8_count_characters(
+	 utf8_stream,
+	 utf8_stream_size,
+	 &stream_index,
+	 character_index,
+	 &number_of_characters );
+
+	*utf8_stream_index = stream_index;
+
+	if( number_of_characters < character_index )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
@@ -22,8 +22,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libuna_case_folding.h"
+#include "libuna_codepage.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
+#include "libuna_normalization.h"
+#include "libuna_normalizer.h"
+#include "libuna_transcode.h"
 #include "libuna_types.h"
 #include "libuna_unicode_character.h"
 #include "libuna_utf8_string.h"
@@ -39,6 +44,7 @@ int libuna_utf8_string_size_from_byte_stream(
      libcerror_error_t **error )
 {
 	static char *function                        = "libuna_utf8_string_size_from_byte_stream";
+	const uint16_t *byte_stream_to_unicode_table = NULL;
 	size_t byte_stream_index                     = 0;
 	libuna_unicode_character_t unicode_character = 0;
 
@@ -83,8 +89,45 @@ int libuna_utf8_string_size_from_byte_stream(
 	{
 		*utf8_string_size += 1;
 	}
+	byte_stream_to_unicode_table = libuna_codepage_get_byte_stream_to_unicode_table(
+	                                codepage );
+
 	while( byte_stream_index < byte_stream_size )
 	{
+		if( byte_stream_to_unicode_table != NULL )
+		{
+			/* Determine the size of the single-byte codepage characters in bulk
+			 */
+			libuna_transcode_utf8_size_from_byte_stream(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 byte_stream_to_unicode_table,
+			 utf8_string_size );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
+		else if( ( unicode_character < 0x80 )
+		      && ( libuna_codepage_is_supported(
+		            codepage ) != 0 ) )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_byte_stream(
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 utf8_string_size );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_byte_stream(
@@ -124,6 +167,53 @@ int libuna_utf8_string_size_from_byte_stream(
 	return( 1 );
 }
 
+
+/* Determines the maximum size of an UTF-8 string from a byte stream
+ * The maximum size is an upper bound that is determined without decoding the byte stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_byte_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_byte_stream";
+
+	if( byte_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every byte stream byte is converted into at most 3 UTF-8 bytes
+	 */
+	*utf8_string_size = byte_stream_size * 3;
+
+	/* A terminating end-of-string character is added if the byte stream is not terminated
+	 */
+	*utf8_string_size += 1;
+
+	return( 1 );
+}
+
 /* Copies an UTF-8 string from a byte stream
  * Returns 1 if successful or -1 on error
  */
@@ -172,6 +262,7 @@ int libuna_utf8_string_with_index_copy_from_byte_stream(
      libcerror_error_t **error )
 {
 	static char *function                        = "libuna_utf8_string_with_index_copy_from_byte_stream";
+	const uint16_t *byte_stream_to_unicode_table = NULL;
 	size_t byte_stream_index                     = 0;
 	libuna_unicode_character_t unicode_character = 0;
 	uint8_t zero_byte                            = 0;
@@ -237,8 +328,49 @@ int libuna_utf8_string_with_index_copy_from_byte_stream(
 	{
 		zero_byte = 1;
 	}
+	byte_stream_to_unicode_table = libuna_codepage_get_byte_stream_to_unicode_table(
+	                                codepage );
+
 	while( byte_stream_index < byte_stream_size )
 	{
+		if( byte_stream_to_unicode_table != NULL )
+		{
+			/* Convert the single-byte codepage characters in bulk
+			 */
+			libuna_transcode_utf8_copy_from_byte_stream(
+			 utf8_string,
+			 utf8_string_size,
+			 utf8_string_index,
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index,
+			 byte_stream_to_unicode_table );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
+		else if( ( unicode_character < 0x80 )
+		      && ( libuna_codepage_is_supported(
+		            codepage ) != 0 ) )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_byte_stream(
+			 utf8_string,
+			 utf8_string_size,
+			 utf8_string_index,
+			 byte_stream,
+			 byte_stream_size,
+			 &byte_stream_index );
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_byte_stream(
@@ -358,13 +490,15 @@ int libuna_utf8_string_compare_with_byte_stream(
 
 		return( -1 );
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
 		utf8_string_size -= 1;
 	}
 	/* Check if the byte stream is terminated with zero bytes
 	 */
-	if( byte_stream[ byte_stream_size - 1 ] == 0 )
+	if( ( byte_stream_size > 0 )
+	 && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
 	{
 		byte_stream_size -= 1;
 	}
@@ -423,6 +557,143 @@ int libuna_utf8_string_compare_with_byte_stream(
 	return( 1 );
 }
 
+/* Compares an UTF-8 string with a byte stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
+ */
+int libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function                                    = "libuna_utf8_string_compare_with_byte_stream_case_insensitive";
+	size_t byte_stream_index                                 = 0;
+	size_t utf8_string_index                                 = 0;
+	libuna_unicode_character_t utf8_unicode_character        = 0;
+	libuna_unicode_character_t byte_stream_unicode_character = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
+	/* Check if the byte stream is terminated with zero bytes
+	 */
+	if( ( byte_stream_size > 0 )
+	 && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
+	{
+		byte_stream_size -= 1;
+	}
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( byte_stream_index < byte_stream_size ) )
+	{
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the byte stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &byte_stream_unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_unicode_character != byte_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  byte_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( byte_stream_index != byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Determines the size of an UTF-8 string from an UTF-7 stream
  * Returns 1 if successful or -1 on error
  */
@@ -491,6 +762,23 @@ int libuna_utf8_string_size_from_utf7_stream(
 	}
 	while( utf7_stream_index < utf7_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf7_stream(
+			 utf7_stream,
+			 utf7_stream_size,
+			 &utf7_stream_index,
+			 utf7_stream_base64_data,
+			 utf8_string_size );
+
+			if( utf7_stream_index >= utf7_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-7 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf7_stream(
@@ -530,6 +818,53 @@ int libuna_utf8_string_size_from_utf7_stream(
 	return( 1 );
 }
 
+
+/* Determines the maximum size of an UTF-8 string from an UTF-7 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-7 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_utf7_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_utf7_stream(
+     size_t utf7_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_utf7_stream";
+
+	if( utf7_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-7 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every UTF-7 stream byte is converted into at most 3 UTF-8 bytes
+	 */
+	*utf8_string_size = utf7_stream_size * 3;
+
+	/* A terminating end-of-string character is added if the UTF-7 stream is not terminated
+	 */
+	*utf8_string_size += 1;
+
+	return( 1 );
+}
+
 /* Copies an UTF-8 string from an UTF-7 stream
  * Returns 1 if successful or -1 on error
  */
@@ -654,6 +989,25 @@ int libuna_utf8_string_with_index_copy_from_utf7_stream(
 	}
 	while( utf7_stream_index < utf7_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_utf7_stream(
+			 utf8_string,
+			 utf8_string_size,
+			 utf8_string_index,
+			 utf7_stream,
+			 utf7_stream_size,
+			 &utf7_stream_index,
+			 utf7_stream_base64_data );
+
+			if( utf7_stream_index >= utf7_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-7 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf7_stream(
@@ -784,13 +1138,15 @@ int libuna_utf8_string_compare_with_utf7_stream(
 
 		return( -1 );
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
 		utf8_string_size -= 1;
 	}
 	/* Check if the UTF-7 stream is terminated with zero bytes
 	 */
-	if( utf7_stream[ utf7_stream_size - 1 ] == 0 )
+	if( ( utf7_stream_size > 0 )
+	 && ( utf7_stream[ utf7_stream_size - 1 ] == 0 ) )
 	{
 		utf7_stream_size -= 1;
 	}
@@ -849,72 +1205,220 @@ int libuna_utf8_string_compare_with_utf7_stream(
 	return( 1 );
 }
 
-/* Determines the size of an UTF-8 string from an UTF-8 stream
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-8 string with an UTF-7 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_size_from_utf8_stream(
-     const uint8_t *utf8_stream,
-     size_t utf8_stream_size,
-     size_t *utf8_string_size,
+int libuna_utf8_string_compare_with_utf7_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf7_stream,
+     size_t utf7_stream_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_size_from_utf8_stream";
-	size_t utf8_stream_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                                    = "libuna_utf8_string_compare_with_utf7_stream_case_insensitive";
+	size_t utf7_stream_index                                 = 0;
+	size_t utf8_string_index                                 = 0;
+	libuna_unicode_character_t utf8_unicode_character        = 0;
+	libuna_unicode_character_t utf7_stream_unicode_character = 0;
+	uint32_t utf7_stream_base64_data                         = 0;
 
-	if( utf8_stream == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 stream.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_stream_size < 1 )
+	if( utf7_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-8 stream bytes.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-7 stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( utf7_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-7 stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	*utf8_string_size = 0;
-
-	/* Check if UTF-8 stream starts with a byte order mark (BOM)
-	 */
-	if( utf8_stream_size >= 3 )
+	if( utf7_stream_size < 1 )
 	{
-		if( ( utf8_stream[ 0 ] == 0x0ef )
-		 && ( utf8_stream[ 1 ] == 0x0bb )
-		 && ( utf8_stream[ 2 ] == 0x0bf ) )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-7 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
+	/* Check if the UTF-7 stream is terminated with zero bytes
+	 */
+	if( ( utf7_stream_size > 0 )
+	 && ( utf7_stream[ utf7_stream_size - 1 ] == 0 ) )
+	{
+		utf7_stream_size -= 1;
+	}
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf7_stream_index < utf7_stream_size ) )
+	{
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the UTF-7 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf7_stream(
+		     &utf7_stream_unicode_character,
+		     utf7_stream,
+		     utf7_stream_size,
+		     &utf7_stream_index,
+		     &utf7_stream_base64_data,
+                     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-7 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_unicode_character != utf7_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  utf7_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf7_stream_index != utf7_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-8 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_size_from_utf8_stream(
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf8_string_size_from_utf8_stream";
+	size_t utf8_stream_index                     = 0;
+	libuna_unicode_character_t unicode_character = 0;
+
+	if( utf8_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_stream_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-8 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = 0;
+
+	/* Check if UTF-8 stream starts with a byte order mark (BOM)
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0x0ef )
+		 && ( utf8_stream[ 1 ] == 0x0bb )
+		 && ( utf8_stream[ 2 ] == 0x0bf ) )
 		{
 			utf8_stream_index += 3;
 		}
@@ -927,6 +1431,22 @@ int libuna_utf8_string_size_from_utf8_stream(
 	}
 	while( utf8_stream_index < utf8_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf8_stream(
+			 utf8_stream,
+			 utf8_stream_size,
+			 &utf8_stream_index,
+			 utf8_string_size );
+
+			if( utf8_stream_index >= utf8_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -965,6 +1485,53 @@ int libuna_utf8_string_size_from_utf8_stream(
 	return( 1 );
 }
 
+
+/* Determines the maximum size of an UTF-8 string from an UTF-8 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-8 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_utf8_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_utf8_stream(
+     size_t utf8_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_utf8_stream";
+
+	if( utf8_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every UTF-8 stream byte is converted into at most 1 UTF-8 byte
+	 */
+	*utf8_string_size = utf8_stream_size;
+
+	/* A terminating end-of-string character is added if the UTF-8 stream is not terminated
+	 */
+	*utf8_string_size += 1;
+
+	return( 1 );
+}
+
 /* Copies an UTF-8 string from an UTF-8 stream
  * Returns 1 if successful or -1 on error
  */
@@ -1099,6 +1666,24 @@ int libuna_utf8_string_with_index_copy_from_utf8_stream(
 	}
 	while( utf8_stream_index < utf8_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_utf8_stream(
+			 utf8_string,
+			 utf8_string_size,
+			 utf8_string_index,
+			 utf8_stream,
+			 utf8_stream_size,
+			 &utf8_stream_index );
+
+			if( utf8_stream_index >= utf8_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -1169,6 +1754,7 @@ int libuna_utf8_string_compare_with_utf8_stream(
 	static char *function                                    = "libuna_utf8_string_compare_with_utf8_stream";
 	size_t utf8_stream_index                                 = 0;
 	size_t utf8_string_index                                 = 0;
+	size_t number_of_characters                              = 0;
 	libuna_unicode_character_t utf8_unicode_character        = 0;
 	libuna_unicode_character_t utf8_stream_unicode_character = 0;
 
@@ -1238,19 +1824,44 @@ int libuna_utf8_string_compare_with_utf8_stream(
 			utf8_stream_index += 3;
 		}
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
 		utf8_string_size -= 1;
 	}
 	/* Check if the UTF-8 stream is terminated with zero bytes
 	 */
-	if( utf8_stream[ utf8_stream_size - 1 ] == 0 )
+	if( ( utf8_stream_size > 0 )
+	 && ( utf8_stream[ utf8_stream_size - 1 ] == 0 ) )
 	{
 		utf8_stream_size -= 1;
 	}
 	while( ( utf8_string_index < utf8_string_size )
 	    && ( utf8_stream_index < utf8_stream_size ) )
 	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        &( utf8_stream[ utf8_stream_index ] ),
+			                        utf8_stream_size - utf8_stream_index,
+			                        1,
+			                        0 );
+
+			utf8_string_index += number_of_characters;
+			utf8_stream_index += number_of_characters;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf8_stream_index >= utf8_stream_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -1302,91 +1913,316 @@ int libuna_utf8_string_compare_with_utf8_stream(
 	return( 1 );
 }
 
-/* Determines the size of an UTF-8 string from an UTF-16 string
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-8 string with an UTF-8 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_size_from_utf16(
-     const libuna_utf16_character_t *utf16_string,
-     size_t utf16_string_size,
-     size_t *utf8_string_size,
+int libuna_utf8_string_compare_with_utf8_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_size_from_utf16";
-	size_t utf16_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                                    = "libuna_utf8_string_compare_with_utf8_stream_case_insensitive";
+	size_t utf8_stream_index                                 = 0;
+	size_t utf8_string_index                                 = 0;
+	size_t number_of_characters                              = 0;
+	libuna_unicode_character_t utf8_unicode_character        = 0;
+	libuna_unicode_character_t utf8_stream_unicode_character = 0;
 
-	if( utf16_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( utf8_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 "%s: invalid UTF-8 stream.",
 		 function );
 
 		return( -1 );
 	}
-	*utf8_string_size = 0;
+	if( utf8_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 stream size value exceeds maximum.",
+		 function );
 
-	while( utf16_string_index < utf16_string_size )
+		return( -1 );
+	}
+	if( utf8_stream_size < 1 )
 	{
-		/* Convert the UTF-16 character bytes into a Unicode character
-		 */
-		if( libuna_unicode_character_copy_from_utf16(
-		     &unicode_character,
-		     utf16_string,
-		     utf16_string_size,
-		     &utf16_string_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-16.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-8 stream bytes.",
+		 function );
 
-			return( -1 );
+		return( -1 );
+	}
+	/* Check if UTF-8 stream starts with a byte order mark (BOM)
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0x0ef )
+		 && ( utf8_stream[ 1 ] == 0x0bb )
+		 && ( utf8_stream[ 2 ] == 0x0bf ) )
+		{
+			utf8_stream_index += 3;
 		}
-		/* Determine how many UTF-8 character bytes are required
+	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
+	/* Check if the UTF-8 stream is terminated with zero bytes
+	 */
+	if( ( utf8_stream_size > 0 )
+	 && ( utf8_stream[ utf8_stream_size - 1 ] == 0 ) )
+	{
+		utf8_stream_size -= 1;
+	}
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf8_stream_index < utf8_stream_size ) )
+	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        &( utf8_stream[ utf8_stream_index ] ),
+			                        utf8_stream_size - utf8_stream_index,
+			                        1,
+			                        0 );
+
+			utf8_string_index += number_of_characters;
+			utf8_stream_index += number_of_characters;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf8_stream_index >= utf8_stream_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_size_to_utf8(
-		     unicode_character,
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
 		     utf8_string_size,
+		     &utf8_string_index,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_stream_unicode_character,
+		     utf8_stream,
+		     utf8_stream_size,
+		     &utf8_stream_index,
+                     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+			 "%s: unable to copy Unicode character from UTF-8 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_unicode_character != utf8_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  utf8_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf8_stream_index != utf8_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_size_from_utf16(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf8_string_size_from_utf16";
+	size_t utf16_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = 0;
+
+	while( utf16_string_index < utf16_string_size )
+	{
+		/* Determine the size of the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_size_from_utf16(
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index,
+		 utf8_string_size );
+
+		if( utf16_string_index >= utf16_string_size )
+		{
+			break;
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16_unchecked(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_size,
+		     &utf16_string_index ) != LIBUNA_STATUS_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16.",
 			 function );
 
 			return( -1 );
 		}
+		/* Determine how many UTF-8 character bytes are required
+		 */
+		*utf8_string_size += libuna_unicode_character_size_to_utf8_unchecked(
+		                      unicode_character );
+	}
+	return( 1 );
+}
+
+
+/* Determines the maximum size of an UTF-8 string from an UTF-16 string
+ * The maximum size is an upper bound that is determined without decoding the UTF-16 string,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_utf16
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_utf16(
+     size_t utf16_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_utf16";
+
+	if( utf16_string_size > (size_t) ( SSIZE_MAX / 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
 	}
+	/* Every UTF-16 character is converted into at most 3 UTF-8 bytes,
+	 * a surrogate pair of 2 UTF-16 characters into 4 UTF-8 bytes
+	 */
+	*utf8_string_size = utf16_string_size * 3;
+
 	return( 1 );
 }
 
@@ -1495,14 +2331,27 @@ int libuna_utf8_string_with_index_copy_from_utf16(
 	}
 	while( utf16_string_index < utf16_string_size )
 	{
+		/* Convert the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_copy_from_utf16(
+		 utf8_string,
+		 utf8_string_size,
+		 utf8_string_index,
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index );
+
+		if( utf16_string_index >= utf16_string_size )
+		{
+			break;
+		}
 		/* Convert the UTF-16 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16(
+		if( libuna_unicode_character_copy_from_utf16_unchecked(
 		     &unicode_character,
 		     utf16_string,
 		     utf16_string_size,
-		     &utf16_string_index,
-		     error ) != 1 )
+		     &utf16_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1515,12 +2364,11 @@ int libuna_utf8_string_with_index_copy_from_utf16(
 		}
 		/* Convert the Unicode character into UTF-8 character bytes
 		 */
-		if( libuna_unicode_character_copy_to_utf8(
+		if( libuna_unicode_character_copy_to_utf8_unchecked(
 		     unicode_character,
 		     utf8_string,
 		     utf8_string_size,
-		     utf8_string_index,
-		     error ) != 1 )
+		     utf8_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -1535,77 +2383,1595 @@ int libuna_utf8_string_with_index_copy_from_utf16(
 	return( 1 );
 }
 
-/* Compares an UTF-8 string with an UTF-16 string
- * Returns 1 if the strings are equal, 0 if not or -1 on error
+/* Determines the size of an UTF-8 string from an UTF-16 string
+ * Reports an error as a status code and the offset of the UTF-16 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
  */
-int libuna_utf8_string_compare_with_utf16(
-     const libuna_utf8_character_t *utf8_string,
+int libuna_utf8_string_size_from_utf16_with_status(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf8_string_size,
+     size_t *error_offset )
+{
+	size_t utf16_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf16_string == NULL )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX )
+	 || ( utf8_string_size == NULL )
+	 || ( error_offset == NULL ) )
+	{
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	*utf8_string_size = 0;
+
+	while( utf16_string_index < utf16_string_size )
+	{
+		/* Determine the size of the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_size_from_utf16(
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index,
+		 utf8_string_size );
+
+		if( utf16_string_index >= utf16_string_size )
+		{
+			break;
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		result = libuna_unicode_character_copy_from_utf16_unchecked(
+		          &unicode_character,
+		          utf16_string,
+		          utf16_string_size,
+		          &utf16_string_index );
+
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = utf16_string_index;
+
+			return( result );
+		}
+		/* Determine how many UTF-8 character bytes are required
+		 */
+		*utf8_string_size += libuna_unicode_character_size_to_utf8_unchecked(
+		                      unicode_character );
+	}
+	*error_offset = utf16_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies an UTF-8 string from an UTF-16 string
+ * Reports an error as a status code and the offset of the UTF-16 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf8_string_copy_from_utf16_with_status(
+     libuna_utf8_character_t *utf8_string,
      size_t utf8_string_size,
      const libuna_utf16_character_t *utf16_string,
      size_t utf16_string_size,
+     size_t *error_offset )
+{
+	size_t character_index                       = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf16_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf8_string == NULL )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX )
+	 || ( utf16_string == NULL )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX )
+	 || ( error_offset == NULL ) )
+	{
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	while( utf16_string_index < utf16_string_size )
+	{
+		/* Convert the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_copy_from_utf16(
+		 utf8_string,
+		 utf8_string_size,
+		 &utf8_string_index,
+		 utf16_string,
+		 utf16_string_size,
+		 &utf16_string_index );
+
+		if( utf16_string_index >= utf16_string_size )
+		{
+			break;
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		character_index = utf16_string_index;
+
+		result = libuna_unicode_character_copy_from_utf16_unchecked(
+		          &unicode_character,
+		          utf16_string,
+		          utf16_string_size,
+		          &utf16_string_index );
+
+		/* Convert the Unicode character into UTF-8 character bytes
+		 */
+		if( result == LIBUNA_STATUS_OK )
+		{
+			result = libuna_unicode_character_copy_to_utf8_unchecked(
+			          unicode_character,
+			          utf8_string,
+			          utf8_string_size,
+			          &utf8_string_index );
+		}
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = character_index;
+
+			return( result );
+		}
+	}
+	*error_offset = utf16_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Determines the size of a normalized UTF-8 string from an UTF-16 string
+ * The UTF-16 string is decoded, normalized and encoded in a single pass
+ * An UTF-16 string that passes the normalization quick check is converted untouched
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_size_from_utf16_normalized(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     int normalization_form,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                              = "libuna_utf8_string_compare_with_utf16";
-	size_t utf16_string_index                          = 0;
-	size_t utf8_string_index                           = 0;
-	libuna_unicode_character_t utf8_unicode_character  = 0;
-	libuna_unicode_character_t utf16_unicode_character = 0;
+	libuna_unicode_character_t normalized_unicode_characters[ LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE ];
+	libuna_unicode_character_t unicode_characters[ LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE ];
+
+	libuna_normalizer_t *normalizer            = NULL;
+	static char *function                      = "libuna_utf8_string_size_from_utf16_normalized";
+	size_t normalized_unicode_characters_index = 0;
+	size_t output_index                        = 0;
+	size_t unicode_characters_index            = 0;
+	size_t unicode_characters_size             = 0;
+	size_t utf16_string_index                  = 0;
+	uint16_t quick_check_mask                  = 0;
+	int result                                 = 0;
 
-	if( utf8_string == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( utf16_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
+	if( libuna_normalization_get_quick_check_mask(
+	     normalization_form,
+	     &quick_check_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to retrieve quick check mask.",
+		 function );
+
+		return( -1 );
+	}
+	result = libuna_normalization_quick_check_utf16(
+	          utf16_string,
+	          utf16_string_size,
+	          quick_check_mask,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if UTF-16 string passes the quick check.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( libuna_utf8_string_size_from_utf16(
+		     utf16_string,
+		     utf16_string_size,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libuna_normalizer_initialize(
+	     &normalizer,
+	     normalization_form,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create normalizer.",
+		 function );
+
+		goto on_error;
+	}
+	*utf8_string_size = 0;
+
+	while( utf16_string_index < utf16_string_size )
+	{
+		/* Convert the UTF-16 character bytes into Unicode characters
+		 */
+		unicode_characters_size = 0;
+
+		while( ( utf16_string_index < utf16_string_size )
+		    && ( unicode_characters_size < LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE ) )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &( unicode_characters[ unicode_characters_size ] ),
+			     utf16_string,
+			     utf16_string_size,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-16.",
+				 function );
+
+				goto on_error;
+			}
+			unicode_characters_size++;
+		}
+		unicode_characters_index = 0;
+
+		while( unicode_characters_index < unicode_characters_size )
+		{
+			normalized_unicode_characters_index = 0;
+
+			if( libuna_normalizer_normalize(
+			     normalizer,
+			     unicode_characters,
+			     unicode_characters_size,
+			     &unicode_characters_index,
+			     normalized_unicode_characters,
+			     LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE,
+			     &normalized_unicode_characters_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to normalize Unicode characters.",
+				 function );
+
+				goto on_error;
+			}
+			for( output_index = 0;
+			     output_index < normalized_unicode_characters_index;
+			     output_index++ )
+			{
+				if( libuna_unicode_character_size_to_utf8(
+				     normalized_unicode_characters[ output_index ],
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+					 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	do
+	{
+		normalized_unicode_characters_index = 0;
+
+		result = libuna_normalizer_finalize(
+		          normalizer,
+		          normalized_unicode_characters,
+		          LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE,
+		          &normalized_unicode_characters_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to finalize normalizer.",
+			 function );
+
+			goto on_error;
+		}
+		for( output_index = 0;
+		     output_index < normalized_unicode_characters_index;
+		     output_index++ )
+		{
+			if( libuna_unicode_character_size_to_utf8(
+			     normalized_unicode_characters[ output_index ],
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result == 0 );
+
+	if( libuna_normalizer_free(
+	     &normalizer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free normalizer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( normalizer != NULL )
+	{
+		libuna_normalizer_free(
+		 &normalizer,
+		 NULL );
+	}
+	return( -1 );}
+
+
+/* Copies a normalized UTF-8 string from an UTF-16 string
+ * The UTF-16 string is decoded, normalized and encoded in a single pass
+ * An UTF-16 string that passes the normalization quick check is converted untouched
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_copy_from_utf16_normalized(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     int normalization_form,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t normalized_unicode_characters[ LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE ];
+	libuna_unicode_character_t unicode_characters[ LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE ];
+
+	libuna_normalizer_t *normalizer            = NULL;
+	static char *function                      = "libuna_utf8_string_copy_from_utf16_normalized";
+	size_t normalized_unicode_characters_index = 0;
+	size_t output_index                        = 0;
+	size_t unicode_characters_index            = 0;
+	size_t unicode_characters_size             = 0;
+	size_t utf16_string_index                  = 0;
+	size_t utf8_string_index                   = 0;
+	uint16_t quick_check_mask                  = 0;
+	int result                                 = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_normalization_get_quick_check_mask(
+	     normalization_form,
+	     &quick_check_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to retrieve quick check mask.",
+		 function );
+
+		return( -1 );
+	}
+	result = libuna_normalization_quick_check_utf16(
+	          utf16_string,
+	          utf16_string_size,
+	          quick_check_mask,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if UTF-16 string passes the quick check.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( libuna_utf8_string_with_index_copy_from_utf16(
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     utf16_string,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libuna_normalizer_initialize(
+	     &normalizer,
+	     normalization_form,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create normalizer.",
+		 function );
+
+		goto on_error;
+	}
+	while( utf16_string_index < utf16_string_size )
+	{
+		/* Convert the UTF-16 character bytes into Unicode characters
+		 */
+		unicode_characters_size = 0;
+
+		while( ( utf16_string_index < utf16_string_size )
+		    && ( unicode_characters_size < LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE ) )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &( unicode_characters[ unicode_characters_size ] ),
+			     utf16_string,
+			     utf16_string_size,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-16.",
+				 function );
+
+				goto on_error;
+			}
+			unicode_characters_size++;
+		}
+		unicode_characters_index = 0;
+
+		while( unicode_characters_index < unicode_characters_size )
+		{
+			normalized_unicode_characters_index = 0;
+
+			if( libuna_normalizer_normalize(
+			     normalizer,
+			     unicode_characters,
+			     unicode_characters_size,
+			     &unicode_characters_index,
+			     normalized_unicode_characters,
+			     LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE,
+			     &normalized_unicode_characters_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to normalize Unicode characters.",
+				 function );
+
+				goto on_error;
+			}
+			for( output_index = 0;
+			     output_index < normalized_unicode_characters_index;
+			     output_index++ )
+			{
+				if( libuna_unicode_character_copy_to_utf8(
+				     normalized_unicode_characters[ output_index ],
+				     utf8_string,
+				     utf8_string_size,
+				     &utf8_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+					 "%s: unable to copy Unicode character to UTF-8.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	do
+	{
+		normalized_unicode_characters_index = 0;
+
+		result = libuna_normalizer_finalize(
+		          normalizer,
+		          normalized_unicode_characters,
+		          LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE,
+		          &normalized_unicode_characters_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to finalize normalizer.",
+			 function );
+
+			goto on_error;
+		}
+		for( output_index = 0;
+		     output_index < normalized_unicode_characters_index;
+		     output_index++ )
+		{
+			if( libuna_unicode_character_copy_to_utf8(
+			     normalized_unicode_characters[ output_index ],
+			     utf8_string,
+			     utf8_string_size,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result == 0 );
+
+	if( libuna_normalizer_free(
+	     &normalizer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free normalizer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( normalizer != NULL )
+	{
+		libuna_normalizer_free(
+		 &normalizer,
+		 NULL );
+	}
+	return( -1 );}
+
+/* Compares an UTF-8 string with an UTF-16 string
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
+ */
+int libuna_utf8_string_compare_with_utf16(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                              = "libuna_utf8_string_compare_with_utf16";
+	size_t utf16_string_index                          = 0;
+	size_t utf8_string_index                           = 0;
+	size_t number_of_characters                        = 0;
+	libuna_unicode_character_t utf8_unicode_character  = 0;
+	libuna_unicode_character_t utf16_unicode_character = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
+	if( ( utf16_string_size > 0 )
+	 && ( utf16_string[ utf16_string_size - 1 ] == 0 ) )
+	{
+		utf16_string_size -= 1;
+	}
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf16_string_index < utf16_string_size ) )
+	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        (const uint8_t *) &( utf16_string[ utf16_string_index ] ),
+			                        utf16_string_size - utf16_string_index,
+			                        2,
+			                        0 );
+
+			utf8_string_index  += number_of_characters;
+			utf16_string_index += number_of_characters;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf16_string_index >= utf16_string_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16(
+		     &utf16_unicode_character,
+		     utf16_string,
+		     utf16_string_size,
+		     &utf16_string_index,
+                     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_unicode_character != utf16_unicode_character )
+		{
+			return( 0 );
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf16_string_index != utf16_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Compares an UTF-8 string with an UTF-16 string
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
+ */
+int libuna_utf8_string_compare_with_utf16_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                              = "libuna_utf8_string_compare_with_utf16_case_insensitive";
+	size_t utf16_string_index                          = 0;
+	size_t utf8_string_index                           = 0;
+	size_t number_of_characters                        = 0;
+	libuna_unicode_character_t utf8_unicode_character  = 0;
+	libuna_unicode_character_t utf16_unicode_character = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
+	if( ( utf16_string_size > 0 )
+	 && ( utf16_string[ utf16_string_size - 1 ] == 0 ) )
+	{
+		utf16_string_size -= 1;
+	}
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf16_string_index < utf16_string_size ) )
+	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        (const uint8_t *) &( utf16_string[ utf16_string_index ] ),
+			                        utf16_string_size - utf16_string_index,
+			                        2,
+			                        0 );
+
+			utf8_string_index  += number_of_characters;
+			utf16_string_index += number_of_characters;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf16_string_index >= utf16_string_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the UTF-16 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16(
+		     &utf16_unicode_character,
+		     utf16_string,
+		     utf16_string_size,
+		     &utf16_string_index,
+                     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_unicode_character != utf16_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  utf16_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf16_string_index != utf16_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf8_string_size_from_utf16_stream";
+	size_t utf16_stream_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int read_byte_order                          = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = 0;
+
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( ( utf16_stream[ 0 ] == 0xfe )
+	 && ( utf16_stream[ 1 ] == 0xff ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_BIG;
+		utf16_stream_index = 2;
+	}
+	else if( ( utf16_stream[ 0 ] == 0xff )
+	      && ( utf16_stream[ 1 ] == 0xfe ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+		utf16_stream_index = 2;
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-16 stream is terminated with zero bytes
+	 */
+	if( ( utf16_stream[ utf16_stream_size - 2 ] != 0 )
+	 || ( utf16_stream[ utf16_stream_size - 1 ] != 0 ) )
+	{
+		*utf8_string_size += 1;
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		/* Determine the size of the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_size_from_utf16_stream(
+		 utf16_stream,
+		 utf16_stream_size,
+		 &utf16_stream_index,
+		 byte_order,
+		 utf8_string_size );
+
+		if( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+		{
+			break;
+		}
+		/* Convert the UTF-16 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		/* Determine how many UTF-8 character bytes are required
+		 */
+		if( libuna_unicode_character_size_to_utf8(
+		     unicode_character,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( utf16_stream_index != utf16_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Determines the maximum size of an UTF-8 string from an UTF-16 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-16 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_utf16_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_utf16_stream(
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_utf16_stream";
+
+	if( utf16_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every 2 UTF-16 stream bytes are converted into at most 3 UTF-8 bytes,
+	 * a surrogate pair of 4 UTF-16 stream bytes into 4 UTF-8 bytes
+	 */
+	*utf8_string_size = ( utf16_stream_size / 2 ) * 3;
+
+	/* A terminating end-of-string character is added if the UTF-16 stream is not terminated
+	 */
+	*utf8_string_size += 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_copy_from_utf16_stream(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function    = "libuna_utf8_string_copy_from_utf16_stream";
+	size_t utf8_string_index = 0;
+
+	if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_with_index_copy_from_utf16_stream(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf8_string_with_index_copy_from_utf16_stream";
+	size_t utf16_stream_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	uint8_t zero_byte                            = 0;
+	int read_byte_order                          = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( ( utf16_stream[ 0 ] == 0xfe )
+	 && ( utf16_stream[ 1 ] == 0xff ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_BIG;
+		utf16_stream_index = 2;
+	}
+	else if( ( utf16_stream[ 0 ] == 0xff )
+	      && ( utf16_stream[ 1 ] == 0xfe ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+		utf16_stream_index = 2;
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-16 stream is terminated with zero bytes
+	 */
+	if( ( utf16_stream[ utf16_stream_size - 2 ] != 0 )
+	 || ( utf16_stream[ utf16_stream_size - 1 ] != 0 ) )
+	{
+		zero_byte = 1;
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		/* Convert the non-surrogate UTF-16 characters in bulk
+		 */
+		libuna_transcode_utf8_copy_from_utf16_stream(
+		 utf8_string,
+		 utf8_string_size,
+		 utf8_string_index,
+		 utf16_stream,
+		 utf16_stream_size,
+		 &utf16_stream_index,
+		 byte_order );
+
+		if( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+		{
+			break;
+		}
+		/* Convert the UTF-16 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		/* Convert the Unicode character into UTF-8 character bytes
+		 */
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( utf16_stream_index != utf16_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( zero_byte != 0 )
+	{
+		if( *utf8_string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ *utf8_string_index ] = 0;
+
+		*utf8_string_index += 1;
+	}
+	return( 1 );
+}
+
+/* Compares an UTF-8 string with an UTF-16 stream
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
+ */
+int libuna_utf8_string_compare_with_utf16_stream(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function                                     = "libuna_utf8_string_compare_with_utf16_stream";
+	size_t utf16_stream_index                                 = 0;
+	size_t utf8_string_index                                  = 0;
+	size_t number_of_characters                               = 0;
+	libuna_unicode_character_t utf8_unicode_character         = 0;
+	libuna_unicode_character_t utf16_stream_unicode_character = 0;
+	int read_byte_order                                       = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if UTF-16 stream is in big or little endian
+	 */
+	if( ( utf16_stream[ 0 ] == 0xfe )
+	 && ( utf16_stream[ 1 ] == 0xff ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_BIG;
+		utf16_stream_index = 2;
+	}
+	else if( ( utf16_stream[ 0 ] == 0xff )
+	      && ( utf16_stream[ 1 ] == 0xfe ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+		utf16_stream_index = 2;
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
 		utf8_string_size -= 1;
 	}
-	if( utf16_string[ utf16_string_size - 1 ] == 0 )
+	/* Check if the UTF-16 stream is terminated with zero bytes
+	 */
+	if( ( utf16_stream_size >= 2 )
+	 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
 	{
-		utf16_string_size -= 1;
+		utf16_stream_size -= 2;
 	}
 	while( ( utf8_string_index < utf8_string_size )
-	    && ( utf16_string_index < utf16_string_size ) )
+	    && ( utf16_stream_index < utf16_stream_size ) )
 	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        &( utf16_stream[ utf16_stream_index ] ),
+			                        ( utf16_stream_size - utf16_stream_index ) / 2,
+			                        2,
+			                        byte_order );
+
+			utf8_string_index  += number_of_characters;
+			utf16_stream_index += number_of_characters * 2;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf16_stream_index >= utf16_stream_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -1624,25 +3990,26 @@ int libuna_utf8_string_compare_with_utf16(
 
 			return( -1 );
 		}
-		/* Convert the UTF-16 character bytes into a Unicode character
+		/* Convert the UTF-16 stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16(
-		     &utf16_unicode_character,
-		     utf16_string,
-		     utf16_string_size,
-		     &utf16_string_index,
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &utf16_stream_unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
                      error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-16.",
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
 			 function );
 
 			return( -1 );
 		}
-		if( utf8_unicode_character != utf16_unicode_character )
+		if( utf8_unicode_character != utf16_stream_unicode_character )
 		{
 			return( 0 );
 		}
@@ -1650,75 +4017,90 @@ int libuna_utf8_string_compare_with_utf16(
 	/* Check if both strings were entirely processed
 	 */
 	if( ( utf8_string_index != utf8_string_size )
-	 || ( utf16_string_index != utf16_string_size ) )
+	 || ( utf16_stream_index != utf16_stream_size ) )
 	{
 		return( 0 );
 	}
 	return( 1 );
 }
 
-/* Determines the size of an UTF-8 string from an UTF-16 stream
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-8 string with an UTF-16 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_size_from_utf16_stream(
+int libuna_utf8_string_compare_with_utf16_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
      const uint8_t *utf16_stream,
      size_t utf16_stream_size,
      int byte_order,
-     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_size_from_utf16_stream";
-	size_t utf16_stream_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
-	int read_byte_order                          = 0;
+	static char *function                                     = "libuna_utf8_string_compare_with_utf16_stream_case_insensitive";
+	size_t utf16_stream_index                                 = 0;
+	size_t utf8_string_index                                  = 0;
+	size_t number_of_characters                               = 0;
+	libuna_unicode_character_t utf8_unicode_character         = 0;
+	libuna_unicode_character_t utf16_stream_unicode_character = 0;
+	int read_byte_order                                       = 0;
 
-	if( utf16_stream == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 stream.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( utf16_stream_size < 2 )
-	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	if( utf16_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-16 stream bytes.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	*utf8_string_size = 0;
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream bytes.",
+		 function );
 
+		return( -1 );
+	}
 	/* Check if UTF-16 stream is in big or little endian
 	 */
 	if( ( utf16_stream[ 0 ] == 0xfe )
@@ -1749,93 +4131,265 @@ int libuna_utf8_string_size_from_utf16_stream(
 
 		return( -1 );
 	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
 	/* Check if the UTF-16 stream is terminated with zero bytes
 	 */
-	if( ( utf16_stream[ utf16_stream_size - 2 ] != 0 )
-	 || ( utf16_stream[ utf16_stream_size - 1 ] != 0 ) )
+	if( ( utf16_stream_size >= 2 )
+	 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
 	{
-		*utf8_string_size += 1;
+		utf16_stream_size -= 2;
 	}
-	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf16_stream_index < utf16_stream_size ) )
 	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        &( utf16_stream[ utf16_stream_index ] ),
+			                        ( utf16_stream_size - utf16_stream_index ) / 2,
+			                        2,
+			                        byte_order );
+
+			utf8_string_index  += number_of_characters;
+			utf16_stream_index += number_of_characters * 2;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf16_stream_index >= utf16_stream_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
 		/* Convert the UTF-16 stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16_stream(
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &utf16_stream_unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
+                     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_unicode_character != utf16_stream_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  utf16_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf16_stream_index != utf16_stream_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-32 string
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_size_from_utf32(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libuna_utf8_string_size_from_utf32";
+	size_t utf32_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = 0;
+
+	while( utf32_string_index < utf32_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf32(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 utf8_string_size );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 character bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32_unchecked(
 		     &unicode_character,
-		     utf16_stream,
-		     utf16_stream_size,
-		     &utf16_stream_index,
-		     byte_order,
-		     error ) != 1 )
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 "%s: unable to copy Unicode character from UTF-32.",
 			 function );
 
 			return( -1 );
 		}
 		/* Determine how many UTF-8 character bytes are required
 		 */
-		if( libuna_unicode_character_size_to_utf8(
-		     unicode_character,
-		     utf8_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-8.",
-			 function );
+		*utf8_string_size += libuna_unicode_character_size_to_utf8_unchecked(
+		                      unicode_character );
+	}
+	return( 1 );
+}
 
-			return( -1 );
-		}
+
+/* Determines the maximum size of an UTF-8 string from an UTF-32 string
+ * The maximum size is an upper bound that is determined without decoding the UTF-32 string,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_utf32
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_utf32(
+     size_t utf32_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_utf32";
+
+	if( utf32_string_size > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	if( utf16_stream_index != utf16_stream_size )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-16 stream bytes.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
+	/* Every UTF-32 character is converted into at most 4 UTF-8 bytes
+	 */
+	*utf8_string_size = utf32_string_size * 4;
+
 	return( 1 );
 }
 
-/* Copies an UTF-8 string from an UTF-16 stream
+/* Copies an UTF-8 string from an UTF-32 string
  * Returns 1 if successful or -1 on error
  */
-int libuna_utf8_string_copy_from_utf16_stream(
+int libuna_utf8_string_copy_from_utf32(
      libuna_utf8_character_t *utf8_string,
      size_t utf8_string_size,
-     const uint8_t *utf16_stream,
-     size_t utf16_stream_size,
-     int byte_order,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
      libcerror_error_t **error )
 {
-	static char *function    = "libuna_utf8_string_copy_from_utf16_stream";
+	static char *function    = "libuna_utf8_string_copy_from_utf32";
 	size_t utf8_string_index = 0;
 
-	if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+	if( libuna_utf8_string_with_index_copy_from_utf32(
 	     utf8_string,
 	     utf8_string_size,
 	     &utf8_string_index,
-	     utf16_stream,
-	     utf16_stream_size,
-	     byte_order,
+	     utf32_string,
+	     utf32_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+		 "%s: unable to copy UTF-32 string to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -1843,23 +4397,20 @@ int libuna_utf8_string_copy_from_utf16_stream(
 	return( 1 );
 }
 
-/* Copies an UTF-8 string from an UTF-16 stream
+/* Copies an UTF-8 string from an UTF-32 string
  * Returns 1 if successful or -1 on error
  */
-int libuna_utf8_string_with_index_copy_from_utf16_stream(
+int libuna_utf8_string_with_index_copy_from_utf32(
      libuna_utf8_character_t *utf8_string,
      size_t utf8_string_size,
      size_t *utf8_string_index,
-     const uint8_t *utf16_stream,
-     size_t utf16_stream_size,
-     int byte_order,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_with_index_copy_from_utf16_stream";
-	size_t utf16_stream_index                    = 0;
+	static char *function                        = "libuna_utf8_string_with_index_copy_from_utf32";
+	size_t utf32_string_index                    = 0;
 	libuna_unicode_character_t unicode_character = 0;
-	uint8_t zero_byte                            = 0;
-	int read_byte_order                          = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -1894,106 +4445,72 @@ int libuna_utf8_string_with_index_copy_from_utf16_stream(
 
 		return( -1 );
 	}
-	if( utf16_stream == NULL )
+	if( utf32_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 stream.",
+		 "%s: invalid UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	if( utf32_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 stream size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( utf16_stream_size < 2 )
-	 || ( ( utf16_stream_size % 2 ) != 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-16 stream bytes.",
-		 function );
-
-		return( -1 );
-	}
-	/* Check if UTF-16 stream is in big or little endian
-	 */
-	if( ( utf16_stream[ 0 ] == 0xfe )
-	 && ( utf16_stream[ 1 ] == 0xff ) )
-	{
-		read_byte_order    = LIBUNA_ENDIAN_BIG;
-		utf16_stream_index = 2;
-	}
-	else if( ( utf16_stream[ 0 ] == 0xff )
-	      && ( utf16_stream[ 1 ] == 0xfe ) )
-	{
-		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
-		utf16_stream_index = 2;
-	}
-	if( byte_order == 0 )
-	{
-		byte_order = read_byte_order;
-	}
-	if( ( byte_order != LIBUNA_ENDIAN_BIG )
-	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported byte order.",
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	/* Check if the UTF-16 stream is terminated with zero bytes
-	 */
-	if( ( utf16_stream[ utf16_stream_size - 2 ] != 0 )
-	 || ( utf16_stream[ utf16_stream_size - 1 ] != 0 ) )
-	{
-		zero_byte = 1;
-	}
-	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	while( utf32_string_index < utf32_string_size )
 	{
-		/* Convert the UTF-16 stream bytes into a Unicode character
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_utf32(
+			 utf8_string,
+			 utf8_string_size,
+			 utf8_string_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16_stream(
+		if( libuna_unicode_character_copy_from_utf32_unchecked(
 		     &unicode_character,
-		     utf16_stream,
-		     utf16_stream_size,
-		     &utf16_stream_index,
-		     byte_order,
-		     error ) != 1 )
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 "%s: unable to copy Unicode character from UTF-32.",
 			 function );
 
 			return( -1 );
 		}
 		/* Convert the Unicode character into UTF-8 character bytes
 		 */
-		if( libuna_unicode_character_copy_to_utf8(
+		if( libuna_unicode_character_copy_to_utf8_unchecked(
 		     unicode_character,
 		     utf8_string,
 		     utf8_string_size,
-		     utf8_string_index,
-		     error ) != 1 )
+		     utf8_string_index ) != LIBUNA_STATUS_OK )
 		{
 			libcerror_error_set(
 			 error,
@@ -2005,54 +4522,169 @@ int libuna_utf8_string_with_index_copy_from_utf16_stream(
 			return( -1 );
 		}
 	}
-	if( utf16_stream_index != utf16_stream_size )
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-32 string
+ * Reports an error as a status code and the offset of the UTF-32 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf8_string_size_from_utf32_with_status(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf8_string_size,
+     size_t *error_offset )
+{
+	size_t utf32_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf32_string == NULL )
+	 || ( utf32_string_size > (size_t) SSIZE_MAX )
+	 || ( utf8_string_size == NULL )
+	 || ( error_offset == NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-16 stream bytes.",
-		 function );
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	*utf8_string_size = 0;
 
-		return( -1 );
+	while( utf32_string_index < utf32_string_size )
+	{
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf32(
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index,
+			 utf8_string_size );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 character bytes into a Unicode character
+		 */
+		result = libuna_unicode_character_copy_from_utf32_unchecked(
+		          &unicode_character,
+		          utf32_string,
+		          utf32_string_size,
+		          &utf32_string_index );
+
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = utf32_string_index;
+
+			return( result );
+		}
+		/* Determine how many UTF-8 character bytes are required
+		 */
+		*utf8_string_size += libuna_unicode_character_size_to_utf8_unchecked(
+		                      unicode_character );
 	}
-	if( zero_byte != 0 )
+	*error_offset = utf32_string_size;
+
+	return( LIBUNA_STATUS_OK );
+}
+
+/* Copies an UTF-8 string from an UTF-32 string
+ * Reports an error as a status code and the offset of the UTF-32 character
+ * that could not be converted, without allocating an error
+ * Returns LIBUNA_STATUS_OK if successful or the status code of the error
+ */
+int libuna_utf8_string_copy_from_utf32_with_status(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *error_offset )
+{
+	size_t character_index                       = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf32_string_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( utf8_string == NULL )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX )
+	 || ( utf32_string == NULL )
+	 || ( utf32_string_size > (size_t) SSIZE_MAX )
+	 || ( error_offset == NULL ) )
 	{
-		if( *utf8_string_index >= utf8_string_size )
+		return( LIBUNA_STATUS_INVALID_ARGUMENT );
+	}
+	while( utf32_string_index < utf32_string_size )
+	{
+		if( unicode_character < 0x80 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string too small.",
-			 function );
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_utf32(
+			 utf8_string,
+			 utf8_string_size,
+			 &utf8_string_index,
+			 utf32_string,
+			 utf32_string_size,
+			 &utf32_string_index );
+
+			if( utf32_string_index >= utf32_string_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 character bytes into a Unicode character
+		 */
+		character_index = utf32_string_index;
 
-			return( -1 );
+		result = libuna_unicode_character_copy_from_utf32_unchecked(
+		          &unicode_character,
+		          utf32_string,
+		          utf32_string_size,
+		          &utf32_string_index );
+
+		/* Convert the Unicode character into UTF-8 character bytes
+		 */
+		if( result == LIBUNA_STATUS_OK )
+		{
+			result = libuna_unicode_character_copy_to_utf8_unchecked(
+			          unicode_character,
+			          utf8_string,
+			          utf8_string_size,
+			          &utf8_string_index );
 		}
-		utf8_string[ *utf8_string_index ] = 0;
+		if( result != LIBUNA_STATUS_OK )
+		{
+			*error_offset = character_index;
 
-		*utf8_string_index += 1;
+			return( result );
+		}
 	}
-	return( 1 );
+	*error_offset = utf32_string_size;
+
+	return( LIBUNA_STATUS_OK );
 }
 
-/* Compares an UTF-8 string with an UTF-16 stream
+/* Compares an UTF-8 string with an UTF-32 string
  * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_compare_with_utf16_stream(
+int libuna_utf8_string_compare_with_utf32(
      const libuna_utf8_character_t *utf8_string,
      size_t utf8_string_size,
-     const uint8_t *utf16_stream,
-     size_t utf16_stream_size,
-     int byte_order,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
      libcerror_error_t **error )
 {
-	static char *function                                     = "libuna_utf8_string_compare_with_utf16_stream";
-	size_t utf16_stream_index                                 = 0;
-	size_t utf8_string_index                                  = 0;
-	libuna_unicode_character_t utf8_unicode_character         = 0;
-	libuna_unicode_character_t utf16_stream_unicode_character = 0;
-	int read_byte_order                                       = 0;
+	static char *function                              = "libuna_utf8_string_compare_with_utf32";
+	size_t utf32_string_index                          = 0;
+	size_t utf8_string_index                           = 0;
+	size_t number_of_characters                        = 0;
+	libuna_unicode_character_t utf8_unicode_character  = 0;
+	libuna_unicode_character_t utf32_unicode_character = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -2076,84 +4708,64 @@ int libuna_utf8_string_compare_with_utf16_stream(
 
 		return( -1 );
 	}
-	if( utf16_stream == NULL )
+	if( utf32_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 stream.",
+		 "%s: invalid UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	if( utf32_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 stream size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( utf16_stream_size < 2 )
-	 || ( ( utf16_stream_size % 2 ) != 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-16 stream bytes.",
-		 function );
-
-		return( -1 );
-	}
-	/* Check if UTF-16 stream is in big or little endian
-	 */
-	if( ( utf16_stream[ 0 ] == 0xfe )
-	 && ( utf16_stream[ 1 ] == 0xff ) )
-	{
-		read_byte_order    = LIBUNA_ENDIAN_BIG;
-		utf16_stream_index = 2;
-	}
-	else if( ( utf16_stream[ 0 ] == 0xff )
-	      && ( utf16_stream[ 1 ] == 0xfe ) )
-	{
-		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
-		utf16_stream_index = 2;
-	}
-	if( byte_order == 0 )
-	{
-		byte_order = read_byte_order;
-	}
-	if( ( byte_order != LIBUNA_ENDIAN_BIG )
-	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported byte order.",
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
 		utf8_string_size -= 1;
 	}
-	/* Check if the UTF-16 stream is terminated with zero bytes
-	 */
-	if( ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
-	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
 	{
-		utf16_stream_size -= 2;
+		utf32_string_size -= 1;
 	}
 	while( ( utf8_string_index < utf8_string_size )
-	    && ( utf16_stream_index < utf16_stream_size ) )
+	    && ( utf32_string_index < utf32_string_size ) )
 	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0 );
+
+			utf8_string_index  += number_of_characters;
+			utf32_string_index += number_of_characters;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf32_string_index >= utf32_string_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -2172,26 +4784,25 @@ int libuna_utf8_string_compare_with_utf16_stream(
 
 			return( -1 );
 		}
-		/* Convert the UTF-16 stream bytes into a Unicode character
+		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf16_stream(
-		     &utf16_stream_unicode_character,
-		     utf16_stream,
-		     utf16_stream_size,
-		     &utf16_stream_index,
-		     byte_order,
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
                      error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 "%s: unable to copy Unicode character from UTF-32.",
 			 function );
 
 			return( -1 );
 		}
-		if( utf8_unicode_character != utf16_stream_unicode_character )
+		if( utf8_unicode_character != utf32_unicode_character )
 		{
 			return( 0 );
 		}
@@ -2199,430 +4810,512 @@ int libuna_utf8_string_compare_with_utf16_stream(
 	/* Check if both strings were entirely processed
 	 */
 	if( ( utf8_string_index != utf8_string_size )
-	 || ( utf16_stream_index != utf16_stream_size ) )
+	 || ( utf32_string_index != utf32_string_size ) )
 	{
 		return( 0 );
 	}
 	return( 1 );
 }
 
-/* Determines the size of an UTF-8 string from an UTF-32 string
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-8 string with an UTF-32 string
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_size_from_utf32(
+int libuna_utf8_string_compare_with_utf32_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
      const libuna_utf32_character_t *utf32_string,
      size_t utf32_string_size,
-     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_size_from_utf32";
-	size_t utf32_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	static char *function                              = "libuna_utf8_string_compare_with_utf32_case_insensitive";
+	size_t utf32_string_index                          = 0;
+	size_t utf8_string_index                           = 0;
+	size_t number_of_characters                        = 0;
+	libuna_unicode_character_t utf8_unicode_character  = 0;
+	libuna_unicode_character_t utf32_unicode_character = 0;
 
-	if( utf32_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( utf32_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 "%s: invalid UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	*utf8_string_size = 0;
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
 
-	while( utf32_string_index < utf32_string_size )
+		return( -1 );
+	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
-		/* Convert the UTF-32 character bytes into a Unicode character
+		utf8_string_size -= 1;
+	}
+	if( ( utf32_string_size > 0 )
+	 && ( utf32_string[ utf32_string_size - 1 ] == 0 ) )
+	{
+		utf32_string_size -= 1;
+	}
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf32_string_index < utf32_string_size ) )
+	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        (const uint8_t *) &( utf32_string[ utf32_string_index ] ),
+			                        utf32_string_size - utf32_string_index,
+			                        4,
+			                        0 );
+
+			utf8_string_index  += number_of_characters;
+			utf32_string_index += number_of_characters;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf32_string_index >= utf32_string_size ) )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf32(
-		     &unicode_character,
-		     utf32_string,
-		     utf32_string_size,
-		     &utf32_string_index,
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-32.",
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
 			 function );
 
 			return( -1 );
 		}
-		/* Determine how many UTF-8 character bytes are required
+		/* Convert the UTF-32 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_size_to_utf8(
-		     unicode_character,
-		     utf8_string_size,
-		     error ) != 1 )
+		if( libuna_unicode_character_copy_from_utf32(
+		     &utf32_unicode_character,
+		     utf32_string,
+		     utf32_string_size,
+		     &utf32_string_index,
+                     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+			 "%s: unable to copy Unicode character from UTF-32.",
 			 function );
 
 			return( -1 );
 		}
+		if( utf8_unicode_character != utf32_unicode_character )
+		{
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  utf32_unicode_character ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf32_string_index != utf32_string_size ) )
+	{
+		return( 0 );
 	}
 	return( 1 );
 }
 
-/* Copies an UTF-8 string from an UTF-32 string
+/* Determines the size of an UTF-8 string from an UTF-32 stream
  * Returns 1 if successful or -1 on error
  */
-int libuna_utf8_string_copy_from_utf32(
-     libuna_utf8_character_t *utf8_string,
-     size_t utf8_string_size,
-     const libuna_utf32_character_t *utf32_string,
-     size_t utf32_string_size,
+int libuna_utf8_string_size_from_utf32_stream(
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function    = "libuna_utf8_string_copy_from_utf32";
-	size_t utf8_string_index = 0;
+	static char *function                        = "libuna_utf8_string_size_from_utf32_stream";
+	size_t utf32_stream_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	int read_byte_order                          = 0;
 
-	if( libuna_utf8_string_with_index_copy_from_utf32(
-	     utf8_string,
-	     utf8_string_size,
-	     &utf8_string_index,
-	     utf32_string,
-	     utf32_string_size,
-	     error ) != 1 )
+	if( utf32_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-32 string to UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 stream.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies an UTF-8 string from an UTF-32 string
- * Returns 1 if successful or -1 on error
- */
-int libuna_utf8_string_with_index_copy_from_utf32(
-     libuna_utf8_character_t *utf8_string,
-     size_t utf8_string_size,
-     size_t *utf8_string_index,
-     const libuna_utf32_character_t *utf32_string,
-     size_t utf32_string_size,
-     libcerror_error_t **error )
-{
-	static char *function                        = "libuna_utf8_string_with_index_copy_from_utf32";
-	size_t utf32_string_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
-
-	if( utf8_string == NULL )
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( ( utf32_stream_size < 4 )
+	 || ( ( utf32_stream_size % 4 ) != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_index == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string index.",
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string == NULL )
+	*utf8_string_size = 0;
+
+	/* Check if UTF-32 stream is in big or little endian
+	 */
+	if( ( utf32_stream[ 0 ] == 0x00 )
+	 && ( utf32_stream[ 1 ] == 0x00 )
+	 && ( utf32_stream[ 2 ] == 0xfe )
+	 && ( utf32_stream[ 3 ] == 0xff ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_BIG;
+		utf32_stream_index = 4;
+	}
+	else if( ( utf32_stream[ 0 ] == 0xff )
+	      && ( utf32_stream[ 1 ] == 0xfe )
+	      && ( utf32_stream[ 2 ] == 0x00 )
+	      && ( utf32_stream[ 3 ] == 0x00 ) )
+	{
+		read_byte_order    = LIBUNA_ENDIAN_LITTLE;
+		utf32_stream_index = 4;
+	}
+	if( byte_order == 0 )
+	{
+		byte_order = read_byte_order;
+	}
+	if( ( byte_order != LIBUNA_ENDIAN_BIG )
+	 && ( byte_order != LIBUNA_ENDIAN_LITTLE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_size > (size_t) SSIZE_MAX )
+	/* Check if the UTF-32 stream is terminated with zero bytes
+	 */
+	if( ( utf32_stream[ utf32_stream_size - 4 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 3 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
+	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 string size value exceeds maximum.",
-		 function );
-
-		return( -1 );
+		*utf8_string_size += 1;
 	}
-	while( utf32_string_index < utf32_string_size )
+	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
 	{
-		/* Convert the UTF-32 character bytes into a Unicode character
+		if( unicode_character < 0x80 )
+		{
+			/* Determine the size of the 7-bit ASCII characters in bulk, since these
+			 * are likely to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_ascii_size_from_utf32_stream(
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 byte_order,
+			 utf8_string_size );
+
+			if( ( utf32_stream_index + 1 ) >= utf32_stream_size )
+			{
+				break;
+			}
+		}
+		/* Convert the UTF-32 stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_utf32(
+		if( libuna_unicode_character_copy_from_utf32_stream(
 		     &unicode_character,
-		     utf32_string,
-		     utf32_string_size,
-		     &utf32_string_index,
+		     utf32_stream,
+		     utf32_stream_size,
+		     &utf32_stream_index,
+		     byte_order,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-32.",
+			 "%s: unable to copy Unicode character from UTF-32 stream.",
 			 function );
 
 			return( -1 );
 		}
-		/* Convert the Unicode character into UTF-8 character bytes
+		/* Determine how many UTF-8 character bytes are required
 		 */
-		if( libuna_unicode_character_copy_to_utf8(
+		if( libuna_unicode_character_size_to_utf8(
 		     unicode_character,
-		     utf8_string,
 		     utf8_string_size,
-		     utf8_string_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
-			 "%s: unable to copy Unicode character to UTF-8.",
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to unable to determine size of Unicode character in UTF-8.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	return( 1 );
-}
-
-/* Compares an UTF-8 string with an UTF-32 string
- * Returns 1 if the strings are equal, 0 if not or -1 on error
- */
-int libuna_utf8_string_compare_with_utf32(
-     const libuna_utf8_character_t *utf8_string,
-     size_t utf8_string_size,
-     const libuna_utf32_character_t *utf32_string,
-     size_t utf32_string_size,
-     libcerror_error_t **error )
-{
-	static char *function                              = "libuna_utf8_string_compare_with_utf32";
-	size_t utf32_string_index                          = 0;
-	size_t utf8_string_index                           = 0;
-	libuna_unicode_character_t utf8_unicode_character  = 0;
-	libuna_unicode_character_t utf32_unicode_character = 0;
-
-	if( utf8_string == NULL )
+	if( utf32_stream_index != utf32_stream_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	return( 1 );
+}
+
+
+/* Determines the maximum size of an UTF-8 string from an UTF-32 stream
+ * The maximum size is an upper bound that is determined without decoding the UTF-32 stream,
+ * a string of this size can be converted in a single pass with
+ * libuna_utf8_string_with_index_copy_from_utf32_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_maximum_size_from_utf32_stream(
+     size_t utf32_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libuna_utf8_string_maximum_size_from_utf32_stream";
+
+	if( utf32_stream_size > (size_t) ( ( SSIZE_MAX - 1 ) / 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string.",
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_size > (size_t) SSIZE_MAX )
+	/* Every 4 UTF-32 stream bytes are converted into at most 4 UTF-8 bytes
+	 */
+	*utf8_string_size = ( utf32_stream_size / 4 ) * 4;
+
+	/* A terminating end-of-string character is added if the UTF-32 stream is not terminated
+	 */
+	*utf8_string_size += 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-32 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_copy_from_utf32_stream(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function    = "libuna_utf8_string_copy_from_utf32_stream";
+	size_t utf8_string_index = 0;
+
+	if( libuna_utf8_string_with_index_copy_from_utf32_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     utf32_stream,
+	     utf32_stream_size,
+	     byte_order,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-32 stream to UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
-	{
-		utf8_string_size -= 1;
-	}
-	if( utf32_string[ utf32_string_size - 1 ] == 0 )
-	{
-		utf32_string_size -= 1;
-	}
-	while( ( utf8_string_index < utf8_string_size )
-	    && ( utf32_string_index < utf32_string_size ) )
-	{
-		/* Convert the UTF-8 character bytes into a Unicode character
-		 */
-		if( libuna_unicode_character_copy_from_utf8(
-		     &utf8_unicode_character,
-		     utf8_string,
-		     utf8_string_size,
-		     &utf8_string_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-8.",
-			 function );
-
-			return( -1 );
-		}
-		/* Convert the UTF-32 character bytes into a Unicode character
-		 */
-		if( libuna_unicode_character_copy_from_utf32(
-		     &utf32_unicode_character,
-		     utf32_string,
-		     utf32_string_size,
-		     &utf32_string_index,
-                     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-32.",
-			 function );
-
-			return( -1 );
-		}
-		if( utf8_unicode_character != utf32_unicode_character )
-		{
-			return( 0 );
-		}
-	}
-	/* Check if both strings were entirely processed
-	 */
-	if( ( utf8_string_index != utf8_string_size )
-	 || ( utf32_string_index != utf32_string_size ) )
-	{
-		return( 0 );
-	}
 	return( 1 );
 }
 
-/* Determines the size of an UTF-8 string from an UTF-32 stream
+/* Copies an UTF-8 string from an UTF-32 stream
  * Returns 1 if successful or -1 on error
  */
-int libuna_utf8_string_size_from_utf32_stream(
+int libuna_utf8_string_with_index_copy_from_utf32_stream(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
      const uint8_t *utf32_stream,
      size_t utf32_stream_size,
      int byte_order,
-     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_size_from_utf32_stream";
+	static char *function                        = "libuna_utf8_string_with_index_copy_from_utf32_stream";
 	size_t utf32_stream_index                    = 0;
 	libuna_unicode_character_t unicode_character = 0;
+	uint8_t zero_byte                            = 0;
 	int read_byte_order                          = 0;
 
-	if( utf32_stream == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 stream.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( utf32_stream_size < 4 )
-	 || ( ( utf32_stream_size % 4 ) != 0 ) )
+	if( utf8_string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-32 stream bytes.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( utf32_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 "%s: invalid UTF-32 stream.",
 		 function );
 
 		return( -1 );
 	}
-	*utf8_string_size = 0;
+	if( utf32_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf32_stream_size < 4 )
+	 || ( ( utf32_stream_size % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-32 stream bytes.",
+		 function );
 
+		return( -1 );
+	}
 	/* Check if UTF-32 stream is in big or little endian
 	 */
 	if( ( utf32_stream[ 0 ] == 0x00 )
@@ -2664,10 +5357,29 @@ int libuna_utf8_string_size_from_utf32_stream(
 	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
 	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
 	{
-		*utf8_string_size += 1;
+		zero_byte = 1;
 	}
 	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
 	{
+		if( unicode_character < 0x80 )
+		{
+			/* Copy the 7-bit ASCII characters in bulk, since these are likely
+			 * to follow a 7-bit ASCII character
+			 */
+			libuna_transcode_utf8_copy_ascii_from_utf32_stream(
+			 utf8_string,
+			 utf8_string_size,
+			 utf8_string_index,
+			 utf32_stream,
+			 utf32_stream_size,
+			 &utf32_stream_index,
+			 byte_order );
+
+			if( ( utf32_stream_index + 1 ) >= utf32_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-32 stream bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf32_stream(
@@ -2687,18 +5399,20 @@ int libuna_utf8_string_size_from_utf32_stream(
 
 			return( -1 );
 		}
-		/* Determine how many UTF-8 character bytes are required
+		/* Convert the Unicode character into UTF-8 character bytes
 		 */
-		if( libuna_unicode_character_size_to_utf8(
+		if( libuna_unicode_character_copy_to_utf8(
 		     unicode_character,
+		     utf8_string,
 		     utf8_string_size,
+		     utf8_string_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8.",
 			 function );
 
 			return( -1 );
@@ -2715,61 +5429,44 @@ int libuna_utf8_string_size_from_utf32_stream(
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies an UTF-8 string from an UTF-32 stream
- * Returns 1 if successful or -1 on error
- */
-int libuna_utf8_string_copy_from_utf32_stream(
-     libuna_utf8_character_t *utf8_string,
-     size_t utf8_string_size,
-     const uint8_t *utf32_stream,
-     size_t utf32_stream_size,
-     int byte_order,
-     libcerror_error_t **error )
-{
-	static char *function    = "libuna_utf8_string_copy_from_utf32_stream";
-	size_t utf8_string_index = 0;
-
-	if( libuna_utf8_string_with_index_copy_from_utf32_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     &utf8_string_index,
-	     utf32_stream,
-	     utf32_stream_size,
-	     byte_order,
-	     error ) != 1 )
+	if( zero_byte != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-32 stream to UTF-8 string.",
-		 function );
+		if( *utf8_string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		utf8_string[ *utf8_string_index ] = 0;
+
+		*utf8_string_index += 1;
 	}
 	return( 1 );
 }
 
-/* Copies an UTF-8 string from an UTF-32 stream
- * Returns 1 if successful or -1 on error
+/* Compares an UTF-8 string with an UTF-32 stream
+ * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_with_index_copy_from_utf32_stream(
-     libuna_utf8_character_t *utf8_string,
+int libuna_utf8_string_compare_with_utf32_stream(
+     const libuna_utf8_character_t *utf8_string,
      size_t utf8_string_size,
-     size_t *utf8_string_index,
      const uint8_t *utf32_stream,
      size_t utf32_stream_size,
      int byte_order,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_with_index_copy_from_utf32_stream";
-	size_t utf32_stream_index                    = 0;
-	libuna_unicode_character_t unicode_character = 0;
-	uint8_t zero_byte                            = 0;
-	int read_byte_order                          = 0;
+	static char *function                                     = "libuna_utf8_string_compare_with_utf32_stream";
+	size_t utf32_stream_index                                 = 0;
+	size_t utf8_string_index                                  = 0;
+	size_t number_of_characters                               = 0;
+	libuna_unicode_character_t utf8_unicode_character         = 0;
+	libuna_unicode_character_t utf32_stream_unicode_character = 0;
+	int read_byte_order                                       = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -2793,17 +5490,6 @@ int libuna_utf8_string_with_index_copy_from_utf32_stream(
 
 		return( -1 );
 	}
-	if( utf8_string_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string index.",
-		 function );
-
-		return( -1 );
-	}
 	if( utf32_stream == NULL )
 	{
 		libcerror_error_set(
@@ -2872,90 +5558,105 @@ int libuna_utf8_string_with_index_copy_from_utf32_stream(
 
 		return( -1 );
 	}
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size -= 1;
+	}
 	/* Check if the UTF-32 stream is terminated with zero bytes
 	 */
-	if( ( utf32_stream[ utf32_stream_size - 4 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 3 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 2 ] != 0 )
-	 || ( utf32_stream[ utf32_stream_size - 1 ] != 0 ) )
+	if( ( utf32_stream_size >= 4 )
+	 && ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 3 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 2 ] == 0 )
+	 && ( utf32_stream[ utf32_stream_size - 1 ] == 0 ) )
 	{
-		zero_byte = 1;
+		utf32_stream_size -= 4;
 	}
-	while( ( utf32_stream_index + 1 ) < utf32_stream_size )
+	while( ( utf8_string_index < utf8_string_size )
+	    && ( utf32_stream_index < utf32_stream_size ) )
 	{
-		/* Convert the UTF-32 stream bytes into a Unicode character
-		 */
-		if( libuna_unicode_character_copy_from_utf32_stream(
-		     &unicode_character,
-		     utf32_stream,
-		     utf32_stream_size,
-		     &utf32_stream_index,
-		     byte_order,
-		     error ) != 1 )
+		if( utf8_unicode_character < 0x80 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from UTF-32 stream.",
-			 function );
-
-			return( -1 );
+			/* Skip the ASCII characters that are equal without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        &( utf32_stream[ utf32_stream_index ] ),
+			                        ( utf32_stream_size - utf32_stream_index ) / 4,
+			                        4,
+			                        byte_order );
+
+			utf8_string_index  += number_of_characters;
+			utf32_stream_index += number_of_characters * 4;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf32_stream_index >= utf32_stream_size ) )
+			{
+				break;
+			}
 		}
-		/* Convert the Unicode character into UTF-8 character bytes
+		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_to_utf8(
-		     unicode_character,
+		if( libuna_unicode_character_copy_from_utf8(
+		     &utf8_unicode_character,
 		     utf8_string,
 		     utf8_string_size,
-		     utf8_string_index,
+		     &utf8_string_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
-			 "%s: unable to copy Unicode character to UTF-8.",
+			 "%s: unable to copy Unicode character from UTF-8.",
 			 function );
 
 			return( -1 );
 		}
-	}
-	if( utf32_stream_index != utf32_stream_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: missing UTF-32 stream bytes.",
-		 function );
-
-		return( -1 );
-	}
-	if( zero_byte != 0 )
-	{
-		if( *utf8_string_index >= utf8_string_size )
+		/* Convert the UTF-32 stream bytes into a Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf32_stream(
+		     &utf32_stream_unicode_character,
+		     utf32_stream,
+		     utf32_stream_size,
+		     &utf32_stream_index,
+		     byte_order,
+                     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string too small.",
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-32 stream.",
 			 function );
 
 			return( -1 );
 		}
-		utf8_string[ *utf8_string_index ] = 0;
-
-		*utf8_string_index += 1;
+		if( utf8_unicode_character != utf32_stream_unicode_character )
+		{
+			return( 0 );
+		}
+	}
+	/* Check if both strings were entirely processed
+	 */
+	if( ( utf8_string_index != utf8_string_size )
+	 || ( utf32_stream_index != utf32_stream_size ) )
+	{
+		return( 0 );
 	}
 	return( 1 );
 }
 
 /* Compares an UTF-8 string with an UTF-32 stream
+ * without considering the case of the characters
+ * The characters are compared in their simple case folded form
  * Returns 1 if the strings are equal, 0 if not or -1 on error
  */
-int libuna_utf8_string_compare_with_utf32_stream(
+int libuna_utf8_string_compare_with_utf32_stream_case_insensitive(
      const libuna_utf8_character_t *utf8_string,
      size_t utf8_string_size,
      const uint8_t *utf32_stream,
@@ -2963,9 +5664,10 @@ int libuna_utf8_string_compare_with_utf32_stream(
      int byte_order,
      libcerror_error_t **error )
 {
-	static char *function                                     = "libuna_utf8_string_compare_with_utf32_stream";
+	static char *function                                     = "libuna_utf8_string_compare_with_utf32_stream_case_insensitive";
 	size_t utf32_stream_index                                 = 0;
 	size_t utf8_string_index                                  = 0;
+	size_t number_of_characters                               = 0;
 	libuna_unicode_character_t utf8_unicode_character         = 0;
 	libuna_unicode_character_t utf32_stream_unicode_character = 0;
 	int read_byte_order                                       = 0;
@@ -3060,22 +5762,48 @@ int libuna_utf8_string_compare_with_utf32_stream(
 
 		return( -1 );
 	}
-	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
 	{
 		utf8_string_size -= 1;
 	}
 	/* Check if the UTF-32 stream is terminated with zero bytes
 	 */
-	if( ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
+	if( ( utf32_stream_size >= 4 )
+	 && ( utf32_stream[ utf32_stream_size - 4 ] == 0 )
 	 && ( utf32_stream[ utf32_stream_size - 3 ] == 0 )
 	 && ( utf32_stream[ utf32_stream_size - 2 ] == 0 )
 	 && ( utf32_stream[ utf32_stream_size - 1 ] == 0 ) )
 	{
-		utf32_stream_size -= 1;
+		utf32_stream_size -= 4;
 	}
 	while( ( utf8_string_index < utf8_string_size )
 	    && ( utf32_stream_index < utf32_stream_size ) )
 	{
+		if( utf8_unicode_character < 0x80 )
+		{
+			/* Skip the ASCII characters that are equal apart from their case
+			 * without converting them
+			 */
+			number_of_characters = libuna_transcode_compare_ascii_characters_case_insensitive(
+			                        &( utf8_string[ utf8_string_index ] ),
+			                        utf8_string_size - utf8_string_index,
+			                        1,
+			                        0,
+			                        &( utf32_stream[ utf32_stream_index ] ),
+			                        ( utf32_stream_size - utf32_stream_index ) / 4,
+			                        4,
+			                        byte_order );
+
+			utf8_string_index  += number_of_characters;
+			utf32_stream_index += number_of_characters * 4;
+
+			if( ( utf8_string_index >= utf8_string_size )
+			 || ( utf32_stream_index >= utf32_stream_size ) )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-8 character bytes into a Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf8(
@@ -3115,7 +5843,14 @@ int libuna_utf8_string_compare_with_utf32_stream(
 		}
 		if( utf8_unicode_character != utf32_stream_unicode_character )
 		{
-			return( 0 );
+			/* Compare the simple case folded form of characters that are not equal
+			 */
+			if( libuna_case_folding_get_character(
+			     utf8_unicode_character ) != libuna_case_folding_get_character(
+			                                  utf32_stream_unicode_character ) )
+			{
+				return( 0 );
+			}
 		}
 	}
 	/* Check if both strings were entirely processed
@@ -3128,3 +5863,126 @@ int libuna_utf8_string_compare_with_utf32_stream(
 	return( 1 );
 }
 
+/* Determines the number of Unicode characters in an UTF-8 string
+ * Every byte that is not an UTF-8 continuation byte starts a Unicode character,
+ * hence the UTF-8 string is expected to be valid, see libuna_utf8_stream_validate
+ * Returns 1 if successful or -1 on error
+ */
+int libuna_utf8_string_get_number_of_characters(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function   = "libuna_utf8_string_get_number_of_characters";
+	size_t string_index     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of characters.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_transcode_utf8_count_characters(
+	 (const uint8_t *) utf8_string,
+	 utf8_string_size,
+	 &string_index,
+	 utf8_string_size,
+	 number_of_characters );
+
+	return( 1 );
+}
+
+/* Seeks a specific Unicode character in an UTF-8 string
+ * Every byte that is not an UTF-8 continuation byte starts a Unicode character,
+ * hence the UTF-8 string is expected to be valid, see libuna_utf8_stream_validate
+ * The UTF-8 string index is set to the index of the Unicode character or, if the UTF-8 string
+ * contains less Unicode characters than the character index, to the end of the UTF-8 string
+ * Returns 1 if successful, 0 if the UTF-8 string contains less Unicode characters or -1 on error
+ */
+int libuna_utf8_string_seek_character(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t character_index,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libuna_utf8_string_seek_character";
+	size_t string_index         = 0;
+	size_t number_of_characters = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	libuna_transcode_utf8_count_characters(
+	 (const uint8_t *) utf8_string,
+	 utf8_string_size,
+	 &string_index,
+	 character_index,
+	 &number_of_characters );
+
+	*utf8_string_index = string_index;
+
+	if( number_of_characters < character_index )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
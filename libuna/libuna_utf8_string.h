@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+/* The number of Unicode characters that are normalized at a time
+ */
+#define LIBUNA_UTF8_STRING_NORMALIZATION_BUFFER_SIZE	64
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_byte_stream(
      const uint8_t *byte_stream,
@@ -41,6 +45,12 @@ int libuna_utf8_string_size_from_byte_stream(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_byte_stream(
      libuna_utf8_character_t *utf8_string,
@@ -73,6 +83,15 @@ int libuna_utf8_string_compare_with_byte_stream(
      int codepage,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_utf7_stream(
      const uint8_t *utf7_stream,
@@ -80,6 +99,12 @@ int libuna_utf8_string_size_from_utf7_stream(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_utf7_stream(
+     size_t utf7_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_utf7_stream(
      libuna_utf8_character_t *utf8_string,
@@ -109,6 +134,14 @@ int libuna_utf8_string_compare_with_utf7_stream(
      size_t utf7_stream_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_utf7_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf7_stream,
+     size_t utf7_stream_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_utf8_stream(
      const uint8_t *utf8_stream,
@@ -116,6 +149,12 @@ int libuna_utf8_string_size_from_utf8_stream(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_utf8_stream(
+     size_t utf8_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_utf8_stream(
      libuna_utf8_character_t *utf8_string,
@@ -145,6 +184,14 @@ int libuna_utf8_string_compare_with_utf8_stream(
      size_t utf8_stream_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_utf8_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_utf16(
      const libuna_utf16_character_t *utf16_string,
@@ -152,6 +199,12 @@ int libuna_utf8_string_size_from_utf16(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_utf16(
+     size_t utf16_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_utf16(
      libuna_utf8_character_t *utf8_string,
@@ -173,6 +226,38 @@ int libuna_utf8_string_with_index_copy_from_utf16(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_size_from_utf16_with_status(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf8_string_size,
+     size_t *error_offset );
+
+LIBUNA_EXTERN \
+int libuna_utf8_string_copy_from_utf16_with_status(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *error_offset );
+
+LIBUNA_EXTERN \
+int libuna_utf8_string_size_from_utf16_normalized(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     int normalization_form,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf8_string_copy_from_utf16_normalized(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     int normalization_form,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_compare_with_utf16(
      const libuna_utf8_character_t *utf8_string,
@@ -181,6 +266,14 @@ int libuna_utf8_string_compare_with_utf16(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_utf16_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_utf16_stream(
      const uint8_t *utf16_stream,
@@ -189,6 +282,12 @@ int libuna_utf8_string_size_from_utf16_stream(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_utf16_stream(
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_utf16_stream(
      libuna_utf8_character_t *utf8_string,
@@ -221,6 +320,15 @@ int libuna_utf8_string_compare_with_utf16_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_utf16_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_utf32(
      const libuna_utf32_character_t *utf32_string,
@@ -228,6 +336,12 @@ int libuna_utf8_string_size_from_utf32(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_utf32(
+     size_t utf32_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_utf32(
      libuna_utf8_character_t *utf8_string,
@@ -249,6 +363,21 @@ int libuna_utf8_string_with_index_copy_from_utf32(
      size_t utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_size_from_utf32_with_status(
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf8_string_size,
+     size_t *error_offset );
+
+LIBUNA_EXTERN \
+int libuna_utf8_string_copy_from_utf32_with_status(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *error_offset );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_compare_with_utf32(
      const libuna_utf8_character_t *utf8_string,
@@ -257,6 +386,14 @@ int libuna_utf8_string_compare_with_utf32(
      size_t utf32_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_utf32_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const libuna_utf32_character_t *utf32_string,
+     size_t utf32_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_size_from_utf32_stream(
      const uint8_t *utf32_stream,
@@ -265,6 +402,12 @@ int libuna_utf8_string_size_from_utf32_stream(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_maximum_size_from_utf32_stream(
+     size_t utf32_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBUNA_EXTERN \
 int libuna_utf8_string_copy_from_utf32_stream(
      libuna_utf8_character_t *utf8_string,
@@ -297,6 +440,30 @@ int libuna_utf8_string_compare_with_utf32_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBUNA_EXTERN \
+int libuna_utf8_string_compare_with_utf32_stream_case_insensitive(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf32_stream,
+     size_t utf32_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf8_string_get_number_of_characters(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *number_of_characters,
+     libcerror_error_t **error );
+
+LIBUNA_EXTERN \
+int libuna_utf8_string_seek_character(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t character_index,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,111 @@
+dnl Functions for pthread
+dnl
+dnl Version: 20161017
+
+dnl Function to detect if pthread is available
+dnl ac_pthread_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_PTHREAD_CHECK_LIB],
+ [AS_IF(
+  [test "x$ac_cv_enable_winapi" = xyes || test "x$ac_cv_enable_multi_threading_support" = xno],
+  [ac_cv_pthread=no],
+  [dnl Check for headers
+  AC_CHECK_HEADERS([pthread.h])
+
+  AS_IF(
+   [test "x$ac_cv_header_pthread_h" = xno],
+   [ac_cv_pthread=no],
+   [dnl Check for the individual functions
+   ac_cv_pthread=pthread
+
+   dnl Thread functions
+   AC_CHECK_LIB(
+    pthread,
+    pthread_create,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_join,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+
+   dnl Mutex functions
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_init,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_destroy,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_lock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_unlock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+
+   dnl Condition functions
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_init,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_destroy,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_broadcast,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_wait,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+
+   ac_cv_pthread_LIBADD="-lpthread";
+   ])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_pthread" = xpthread],
+  [AC_DEFINE(
+   [HAVE_PTHREAD],
+   [1],
+   [Define to 1 if the pthread library is available.])
+  AC_SUBST(
+   [HAVE_PTHREAD],
+   [1]) ],
+  [AC_SUBST(
+   [HAVE_PTHREAD],
+   [0])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_pthread" != xno && test "x$ac_cv_pthread_LIBADD" != "x"],
+  [AC_SUBST(
+   [PTHREAD_LIBADD],
+   [$ac_cv_pthread_LIBADD])
+  ])
+ ])
+
+dnl Function to detect whether multi-threading support should be enabled
+AC_DEFUN([AX_PTHREAD_CHECK_ENABLE],
+ [AX_COMMON_ARG_ENABLE(
+  [multi-threading-support],
+  [multi_threading_support],
+  [enable multi-threading support],
+  [yes])
+
+ AX_PTHREAD_CHECK_LIB
+ ])
@@ -46,6 +46,12 @@ uint8_t una_test_base32_stream_utf16le_base32_stream[ 64 ] = {
         'E', 0, 'B', 0, '2', 0, 'G', 0, 'K', 0, '4', 0, '3', 0, 'U', 0,
         'F', 0, 'Y', 0, '=', 0, '=', 0, '=', 0, '=', 0, '=', 0, '=', 0 };
 
+uint8_t una_test_base32_stream_hex_byte_stream[ 10 ] = {
+	0xe7, 0x7d, 0xfe, 0x77, 0xdf, 0x00, 0x44, 0x35, 0x2d, 0x8d };
+
+uint8_t una_test_base32_stream_hex_base32_stream[ 16 ] = {
+	'S', 'T', 'U', 'V', 'S', 'T', 'U', 'V', '0', '1', '2', '3', 'A', 'B', 'C', 'D' };
+
 char *una_test_base32_stream_byte_stream_long = \
 	"The test of success is not what you do when you are on top. " \
 	"Success is how high you bounce when you hit bottom.\n";
@@ -364,6 +370,36 @@ int una_test_base32_stream_copy_to_byte_stream(
 	 result,
 	 0 );
 
+	/* Test base32hex with the characters S to V
+	 */
+	result = libuna_base32_stream_copy_to_byte_stream(
+	          una_test_base32_stream_hex_base32_stream,
+	          16,
+		  byte_stream,
+		  10,
+	          LIBUNA_BASE32_VARIANT_HEX,
+	          0,
+		  &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_base32_stream_hex_byte_stream,
+	          10 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	result = libuna_base32_stream_copy_to_byte_stream(
@@ -756,6 +792,35 @@ int una_test_base32_stream_copy_from_byte_stream(
 	 result,
 	 0 );
 
+	/* Test base32hex with the characters S to V
+	 */
+	result = libuna_base32_stream_copy_from_byte_stream(
+		  base32_stream,
+		  16,
+		  una_test_base32_stream_hex_byte_stream,
+		  10,
+	          LIBUNA_BASE32_VARIANT_HEX,
+		  &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = memory_compare(
+	          base32_stream,
+	          una_test_base32_stream_hex_base32_stream,
+	          16 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 /* TODO test char limit */
 /* TODO test encodings */
 
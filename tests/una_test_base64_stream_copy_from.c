@@ -168,6 +168,10 @@ int main( int argc, char * const argv[] )
 		(uint8_t *) "VGhlIHRlc3Qgb2Ygc3VjY2VzcyBpcyBub3Qgd2hhdCB5b3UgZG8gd2hlbiB5b3UgYXJlIG9uIHRv\n"
 		            "cC4gU3VjY2VzcyBpcyBob3cgaGlnaCB5b3UgYm91bmNlIHdoZW4geW91IGhpdCBib3R0b20uCg==\n";
 
+	uint8_t *expected_unlimited_base64_stream = \
+		(uint8_t *) "VGhlIHRlc3Qgb2Ygc3VjY2VzcyBpcyBub3Qgd2hhdCB5b3UgZG8gd2hlbiB5b3UgYXJlIG9uIHRv"
+		            "cC4gU3VjY2VzcyBpcyBob3cgaGlnaCB5b3UgYm91bmNlIHdoZW4geW91IGhpdCBib3R0b20uCg==";
+
 	uint8_t byte_stream1[ 6 ] = { 0xe6, 0xb5, 0x8b, 0xe8, 0xaf, 0x95 };
 
 	uint8_t *expected_rfc1642_base64_stream1 = (uint8_t *) "5rWL6K+V";
@@ -470,6 +474,26 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* Case 15: byte stream is a buffer, byte stream size is 112
+	 *          base64 stream is a buffer, base64 stream size is 256, variant without character limit
+	 * Expected result: 1
+	 */
+	if( una_test_base64_stream_copy_from_byte_stream(
+	     long_byte_stream,
+	     112,
+	     base64_stream,
+	     256,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     expected_unlimited_base64_stream,
+	     152,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy byte stream to base64 stream.\n" );
+
+		goto on_error;
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -132,6 +132,108 @@ int una_test_base64_stream_copy_to_byte_stream(
 	return( result );
 }
 
+/* Tests copying a base64 stream to a byte stream of the maximum size in a single pass
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_base64_stream_with_index_copy_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t base64_variant,
+     uint8_t flags,
+     const uint8_t *expected_byte_stream,
+     size_t expected_byte_stream_size,
+     int expected_result )
+{
+	libuna_error_t *error           = NULL;
+	size_t maximum_byte_stream_size = 0;
+	size_t byte_stream_index        = 0;
+	int result                      = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying base64 stream to byte stream with index with variant: 0x%08" PRIx32 "\t",
+	 base64_variant );
+
+	result = libuna_base64_stream_maximum_size_to_byte_stream(
+	          base64_stream_size,
+	          &maximum_byte_stream_size,
+	          base64_variant,
+	          &error );
+
+	if( result == 1 )
+	{
+		if( ( maximum_byte_stream_size < expected_byte_stream_size )
+		 || ( maximum_byte_stream_size > byte_stream_size ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libuna_base64_stream_with_index_copy_to_byte_stream(
+			  base64_stream,
+			  base64_stream_size,
+			  byte_stream,
+			  maximum_byte_stream_size,
+			  &byte_stream_index,
+			  base64_variant,
+			  flags,
+			  &error );
+	}
+	if( result == 1 )
+	{
+		if( byte_stream_index != expected_byte_stream_size )
+		{
+			result = 0;
+		}
+		else if( memory_compare(
+		          byte_stream,
+		          expected_byte_stream,
+		          sizeof( uint8_t ) * expected_byte_stream_size ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( result == expected_result )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( result == -1 )
+	{
+		if( expected_result != -1 )
+		{
+			libuna_error_backtrace_fprint(
+			 error,
+			 stderr );
+		}
+		libuna_error_free(
+		 &error );
+	}
+	if( result == expected_result )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = 0;
+	}
+	return( result );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -175,6 +277,14 @@ int main( int argc, char * const argv[] )
 		(uint8_t *) "\tVGhlIHRlc3Qgb2Ygc3VjY2VzcyBpcyBub3Qgd2hhdCB5b3UgZG8gd2hlbiB5b3UgYXJlIG9uIHRv  \n"
 		            "  cC4gU3VjY2VzcyBpcyBob3cgaGlnaCB5b3UgYm91bmNlIHdoZW4geW91IGhpdCBib3R0b20uCg==\t\n";
 
+	uint8_t *unlimited_base64_stream = \
+		(uint8_t *) "VGhlIHRlc3Qgb2Ygc3VjY2VzcyBpcyBub3Qgd2hhdCB5b3UgZG8gd2hlbiB5b3UgYXJlIG9uIHRv"
+		            "cC4gU3VjY2VzcyBpcyBob3cgaGlnaCB5b3UgYm91bmNlIHdoZW4geW91IGhpdCBib3R0b20uCg==";
+
+	uint8_t *invalid_base64_stream = \
+		(uint8_t *) "VGhlIHRlc3Qgb2Ygc3VjY2VzcyBpcyBub3Qgd2hhdCB5b3UgZG8gd2hlbiB5b3UgYXJlIG9uIHRv"
+		            "cC4gU3VjY2VzcyBpcyBob3cgaGlnaCB5b3UgYm91*mNlIHdoZW4geW91IGhpdCBib3R0b20uCg==";
+
 	uint8_t expected_byte_stream1[ 6 ] = { 0xe6, 0xb5, 0x8b, 0xe8, 0xaf, 0x95 };
 
 	uint8_t *rfc1642_base64_stream1 = (uint8_t *) "5rWL6K+V";
@@ -533,6 +643,111 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* Case 18: base64 stream is a buffer, base64 stream size is 152, variant without character limit
+	 *          byte stream is a buffer, byte stream size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_base64_stream_copy_to_byte_stream(
+	     unlimited_base64_stream,
+	     152,
+	     byte_stream,
+	     256,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     0,
+	     expected_long_byte_stream,
+	     112,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy base64 stream to byte stream.\n" );
+
+		goto on_error;
+	}
+	/* Case 19: base64 stream is a buffer, base64 stream size is 152, variant without character limit
+	 *          byte stream is a buffer, byte stream size is 256
+	 * Expected result: -1
+	 */
+	if( una_test_base64_stream_copy_to_byte_stream(
+	     invalid_base64_stream,
+	     152,
+	     byte_stream,
+	     256,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     0,
+	     expected_long_byte_stream,
+	     112,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy base64 stream to byte stream.\n" );
+
+		goto on_error;
+	}
+	/* Case 20: base64 stream is a buffer, base64 stream size is 154, variant RFC2045
+	 *          byte stream is a buffer of the maximum size
+	 * Expected result: 1
+	 */
+	if( una_test_base64_stream_with_index_copy_to_byte_stream(
+	     rfc2045_base64_stream1,
+	     154,
+	     byte_stream,
+	     256,
+	     LIBUNA_BASE64_VARIANT_RFC2045,
+	     0,
+	     expected_long_byte_stream,
+	     112,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy base64 stream to byte stream.\n" );
+
+		goto on_error;
+	}
+	/* Case 21: base64 stream is a buffer, base64 stream size is 160, variant RFC2045
+	 *          byte stream is a buffer of the maximum size
+	 * Expected result: 1
+	 */
+	if( una_test_base64_stream_with_index_copy_to_byte_stream(
+	     rfc2045_base64_stream2,
+	     160,
+	     byte_stream,
+	     256,
+	     LIBUNA_BASE64_VARIANT_RFC2045,
+	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+	     expected_long_byte_stream,
+	     112,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy base64 stream to byte stream.\n" );
+
+		goto on_error;
+	}
+	/* Case 22: base64 stream is a buffer, base64 stream size is 152, variant without character limit
+	 *          byte stream is a buffer of the maximum size
+	 * Expected result: -1
+	 */
+	if( una_test_base64_stream_with_index_copy_to_byte_stream(
+	     invalid_base64_stream,
+	     152,
+	     byte_stream,
+	     256,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     0,
+	     expected_long_byte_stream,
+	     112,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy base64 stream to byte stream.\n" );
+
+		goto on_error;
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
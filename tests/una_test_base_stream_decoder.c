@@ -0,0 +1,625 @@
+/*
+ * Library base stream decoder functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_base_stream_decoder_byte_stream1[ 43 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g' };
+
+uint8_t una_test_base_stream_decoder_base16_stream1[ 90 ] = {
+	'5', '4', '6', '8', '6', '5', '2', '0', '7', '1', '7', '5', '6', '9', '6', '3',
+	'6', 'b', '2', '0', '6', '2', '7', '2', '6', 'f', '7', '7', '6', 'e', '2', '0',
+	'6', '6', '6', 'f', '7', '8', '2', '0', '6', 'a', '7', '5', '6', 'd', '7', '0',
+	'7', '3', '2', '0', '6', 'f', '7', '6', '6', '5', '7', '2', '2', '0', '7', '4',
+	'\n', '6', '8', '6', '5', '2', '0', '6', 'C', '6', '1', '7', 'A', '7', '9', '2',
+	'0', '6', '4', '6', 'F', '6', '7', ' ', '\t', '\n' };
+
+uint8_t una_test_base_stream_decoder_base64_stream1[ 66 ] = {
+	'V', 'G', 'h', 'l', 'I', 'H', 'F', '1', 'a', 'W', 'N', 'r', 'I', 'G', 'J', 'y',
+	'b', '3', 'd', 'u', '\r', '\n', 'I', 'G', 'Z', 'v', 'e', 'C', 'B', 'q', 'd', 'W',
+	'1', 'w', 'c', 'y', 'B', 'v', 'd', 'm', 'V', 'y', '\r', '\n', 'I', 'H', 'R', 'o',
+	'Z', 'S', 'B', 's', 'Y', 'X', 'p', '5', 'I', 'G', 'R', 'v', 'Z', 'w', '=', '=',
+	'\r', '\n' };
+
+uint8_t una_test_base_stream_decoder_byte_stream2[ 6 ] = {
+	'f', 'o', 'o', 'b', 'a', 'r' };
+
+uint8_t una_test_base_stream_decoder_base32_stream2[ 17 ] = {
+	'M', 'Z', 'X', 'W', '6', 'Y', 'T', 'B', 'O', 'I', '=', '=', '=', '=', '=', '=',
+	'\n' };
+
+uint8_t una_test_base_stream_decoder_base32_utf16le_stream2[ 32 ] = {
+	'M', 0, 'Z', 0, 'X', 0, 'W', 0, '6', 0, 'Y', 0, 'T', 0, 'B', 0,
+	'O', 0, 'I', 0, '=', 0, '=', 0, '=', 0, '=', 0, '=', 0, '=', 0 };
+
+/* Decodes a base stream in chunks of a specific size and compares the byte stream
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_base_stream_decoder_decode_chunks(
+     int base_format,
+     uint32_t base_variant,
+     uint8_t flags,
+     const uint8_t *base_stream,
+     size_t base_stream_size,
+     size_t chunk_size,
+     size_t byte_stream_size,
+     const uint8_t *expected_byte_stream,
+     size_t expected_byte_stream_size )
+{
+	uint8_t byte_stream[ 64 ];
+
+	libcerror_error_t *error              = NULL;
+	libuna_base_stream_decoder_t *decoder = NULL;
+	size_t base_stream_index              = 0;
+	size_t byte_stream_index              = 0;
+	size_t chunk_index                    = 0;
+	size_t maximum_byte_stream_size       = 0;
+	size_t previous_chunk_index           = 0;
+	size_t stream_index                   = 0;
+	int result                            = 0;
+
+	result = libuna_base_stream_decoder_initialize(
+	          &decoder,
+	          base_format,
+	          base_variant,
+	          flags,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	while( base_stream_index < base_stream_size )
+	{
+		chunk_index = 0;
+
+		if( ( base_stream_size - base_stream_index ) < chunk_size )
+		{
+			chunk_size = base_stream_size - base_stream_index;
+		}
+		while( chunk_index < chunk_size )
+		{
+			previous_chunk_index = chunk_index;
+			stream_index         = byte_stream_index;
+
+			maximum_byte_stream_size = byte_stream_index + byte_stream_size;
+
+			if( maximum_byte_stream_size > 64 )
+			{
+				maximum_byte_stream_size = 64;
+			}
+			result = libuna_base_stream_decoder_decode(
+			          decoder,
+			          &( base_stream[ base_stream_index ] ),
+			          chunk_size,
+			          &chunk_index,
+			          byte_stream,
+			          maximum_byte_stream_size,
+			          &byte_stream_index,
+			          &error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			/* The decoder should make progress with the size of the byte stream
+			 */
+			if( ( chunk_index == previous_chunk_index )
+			 && ( byte_stream_index == stream_index ) )
+			{
+				result = 0;
+
+				goto on_error;
+			}
+		}
+		base_stream_index += chunk_size;
+	}
+	result = libuna_base_stream_decoder_finalize(
+	          decoder,
+	          byte_stream,
+	          64,
+	          &byte_stream_index,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( byte_stream_index != expected_byte_stream_size )
+	{
+		result = 0;
+	}
+	else if( memory_compare(
+	          byte_stream,
+	          expected_byte_stream,
+	          expected_byte_stream_size ) != 0 )
+	{
+		result = 0;
+	}
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libuna_base_stream_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libuna_base_stream_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_base_stream_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libuna_base_stream_decoder_t *decoder = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_base_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_BASE_FORMAT_BASE64,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_base_stream_decoder_free(
+	          &decoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libuna_base_stream_decoder_initialize(
+	          NULL,
+	          LIBUNA_BASE_FORMAT_BASE64,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_decoder_initialize(
+	          &decoder,
+	          -1,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_BASE_FORMAT_BASE32,
+	          0xffffffffUL,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_BASE_FORMAT_BASE64,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          0xff,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libuna_base_stream_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_base_stream_decoder_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_base_stream_decoder_decode(
+     void )
+{
+	size_t chunk_size = 0;
+	int result        = 0;
+
+	/* Test every chunk size with a small and with a sufficient byte stream
+	 */
+	for( chunk_size = 1;
+	     chunk_size <= 96;
+	     chunk_size++ )
+	{
+		result = una_test_base_stream_decoder_decode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE16,
+		          LIBUNA_BASE16_VARIANT_CASE_MIXED | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_64,
+		          LIBUNA_BASE16_FLAG_STRIP_WHITESPACE,
+		          una_test_base_stream_decoder_base16_stream1,
+		          90,
+		          chunk_size,
+		          1,
+		          una_test_base_stream_decoder_byte_stream1,
+		          43 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_decoder_decode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE16,
+		          LIBUNA_BASE16_VARIANT_CASE_MIXED | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_64,
+		          LIBUNA_BASE16_FLAG_STRIP_WHITESPACE,
+		          una_test_base_stream_decoder_base16_stream1,
+		          90,
+		          chunk_size,
+		          48,
+		          una_test_base_stream_decoder_byte_stream1,
+		          43 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_decoder_decode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE64,
+		          LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+		          0,
+		          una_test_base_stream_decoder_base64_stream1,
+		          66,
+		          chunk_size,
+		          3,
+		          una_test_base_stream_decoder_byte_stream1,
+		          43 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_decoder_decode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE64,
+		          LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+		          0,
+		          una_test_base_stream_decoder_base64_stream1,
+		          66,
+		          chunk_size,
+		          48,
+		          una_test_base_stream_decoder_byte_stream1,
+		          43 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_decoder_decode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE32,
+		          LIBUNA_BASE32_VARIANT_RFC4648,
+		          0,
+		          una_test_base_stream_decoder_base32_stream2,
+		          17,
+		          chunk_size,
+		          5,
+		          una_test_base_stream_decoder_byte_stream2,
+		          6 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_decoder_decode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE32,
+		          LIBUNA_BASE32_VARIANT_RFC4648 | LIBUNA_BASE32_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN,
+		          0,
+		          una_test_base_stream_decoder_base32_utf16le_stream2,
+		          32,
+		          chunk_size,
+		          5,
+		          una_test_base_stream_decoder_byte_stream2,
+		          6 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libuna_base_stream_decoder_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_base_stream_decoder_finalize(
+     void )
+{
+	uint8_t byte_stream[ 64 ];
+
+	libcerror_error_t *error              = NULL;
+	libuna_base_stream_decoder_t *decoder = NULL;
+	size_t base_stream_index              = 0;
+	size_t byte_stream_index              = 0;
+	int result                            = 0;
+
+	result = libuna_base_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_BASE_FORMAT_BASE16,
+	          LIBUNA_BASE16_VARIANT_RFC4648,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test a base stream that ends with an incomplete block
+	 */
+	result = libuna_base_stream_decoder_decode(
+	          decoder,
+	          una_test_base_stream_decoder_base16_stream1,
+	          7,
+	          &base_stream_index,
+	          byte_stream,
+	          64,
+	          &byte_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "base_stream_index",
+	 base_stream_index,
+	 (size_t) 7 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 3 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_base_stream_decoder_finalize(
+	          decoder,
+	          byte_stream,
+	          64,
+	          &byte_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libuna_base_stream_decoder_finalize(
+	          NULL,
+	          byte_stream,
+	          64,
+	          &byte_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_decoder_free(
+	          &decoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libuna_base_stream_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_base_stream_decoder_initialize",
+	 una_test_base_stream_decoder_initialize );
+
+	UNA_TEST_RUN(
+	 "libuna_base_stream_decoder_decode",
+	 una_test_base_stream_decoder_decode );
+
+	UNA_TEST_RUN(
+	 "libuna_base_stream_decoder_finalize",
+	 una_test_base_stream_decoder_finalize );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
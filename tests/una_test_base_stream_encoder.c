@@ -0,0 +1,622 @@
+/*
+ * Library base stream encoder functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_base_stream_encoder_byte_stream1[ 43 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g' };
+
+uint8_t una_test_base_stream_encoder_base16_stream1[ 88 ] = {
+	'5', '4', '6', '8', '6', '5', '2', '0', '7', '1', '7', '5', '6', '9', '6', '3',
+	'6', 'B', '2', '0', '6', '2', '7', '2', '6', 'F', '7', '7', '6', 'E', '2', '0',
+	'6', '6', '6', 'F', '7', '8', '2', '0', '6', 'A', '7', '5', '6', 'D', '7', '0',
+	'7', '3', '2', '0', '6', 'F', '7', '6', '6', '5', '7', '2', '2', '0', '7', '4',
+	'\n',
+	'6', '8', '6', '5', '2', '0', '6', 'C', '6', '1', '7', 'A', '7', '9', '2', '0',
+	'6', '4', '6', 'F', '6', '7',
+	'\n' };
+
+uint8_t una_test_base_stream_encoder_base64_stream1[ 60 ] = {
+	'V', 'G', 'h', 'l', 'I', 'H', 'F', '1', 'a', 'W', 'N', 'r', 'I', 'G', 'J', 'y',
+	'b', '3', 'd', 'u', 'I', 'G', 'Z', 'v', 'e', 'C', 'B', 'q', 'd', 'W', '1', 'w',
+	'c', 'y', 'B', 'v', 'd', 'm', 'V', 'y', 'I', 'H', 'R', 'o', 'Z', 'S', 'B', 's',
+	'Y', 'X', 'p', '5', 'I', 'G', 'R', 'v', 'Z', 'w', '=', '=' };
+
+uint8_t una_test_base_stream_encoder_byte_stream2[ 6 ] = {
+	'f', 'o', 'o', 'b', 'a', 'r' };
+
+uint8_t una_test_base_stream_encoder_base32_stream2[ 16 ] = {
+	'M', 'Z', 'X', 'W', '6', 'Y', 'T', 'B', 'O', 'I', '=', '=', '=', '=', '=', '=' };
+
+uint8_t una_test_base_stream_encoder_base32_utf16le_stream2[ 32 ] = {
+	'M', 0, 'Z', 0, 'X', 0, 'W', 0, '6', 0, 'Y', 0, 'T', 0, 'B', 0,
+	'O', 0, 'I', 0, '=', 0, '=', 0, '=', 0, '=', 0, '=', 0, '=', 0 };
+
+/* Encodes a byte stream in chunks of a specific size and compares the base stream
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_base_stream_encoder_encode_chunks(
+     int base_format,
+     uint32_t base_variant,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t chunk_size,
+     size_t base_stream_size,
+     const uint8_t *expected_base_stream,
+     size_t expected_base_stream_size )
+{
+	uint8_t base_stream[ 256 ];
+
+	libcerror_error_t *error              = NULL;
+	libuna_base_stream_encoder_t *encoder = NULL;
+	size_t base_stream_index              = 0;
+	size_t byte_stream_index              = 0;
+	size_t chunk_index                    = 0;
+	size_t maximum_base_stream_size       = 0;
+	size_t previous_chunk_index           = 0;
+	size_t stream_index                   = 0;
+	int result                            = 0;
+
+	result = libuna_base_stream_encoder_initialize(
+	          &encoder,
+	          base_format,
+	          base_variant,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		chunk_index = 0;
+
+		if( ( byte_stream_size - byte_stream_index ) < chunk_size )
+		{
+			chunk_size = byte_stream_size - byte_stream_index;
+		}
+		while( chunk_index < chunk_size )
+		{
+			previous_chunk_index = chunk_index;
+			stream_index         = base_stream_index;
+
+			maximum_base_stream_size = base_stream_index + base_stream_size;
+
+			if( maximum_base_stream_size > 256 )
+			{
+				maximum_base_stream_size = 256;
+			}
+			result = libuna_base_stream_encoder_encode(
+			          encoder,
+			          &( byte_stream[ byte_stream_index ] ),
+			          chunk_size,
+			          &chunk_index,
+			          base_stream,
+			          maximum_base_stream_size,
+			          &base_stream_index,
+			          &error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			/* The encoder should make progress with the size of the base stream
+			 */
+			if( ( chunk_index == previous_chunk_index )
+			 && ( base_stream_index == stream_index ) )
+			{
+				result = 0;
+
+				goto on_error;
+			}
+		}
+		byte_stream_index += chunk_size;
+	}
+	result = libuna_base_stream_encoder_finalize(
+	          encoder,
+	          base_stream,
+	          256,
+	          &base_stream_index,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( base_stream_index != expected_base_stream_size )
+	{
+		result = 0;
+	}
+	else if( memory_compare(
+	          base_stream,
+	          expected_base_stream,
+	          expected_base_stream_size ) != 0 )
+	{
+		result = 0;
+	}
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+		libcerror_error_free(
+		 &error );
+	}
+	if( encoder != NULL )
+	{
+		libuna_base_stream_encoder_free(
+		 &encoder,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libuna_base_stream_encoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_base_stream_encoder_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libuna_base_stream_encoder_t *encoder = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_base_stream_encoder_initialize(
+	          &encoder,
+	          LIBUNA_BASE_FORMAT_BASE64,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "encoder",
+         encoder );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_base_stream_encoder_free(
+	          &encoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "encoder",
+         encoder );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libuna_base_stream_encoder_initialize(
+	          NULL,
+	          LIBUNA_BASE_FORMAT_BASE64,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_encoder_initialize(
+	          &encoder,
+	          -1,
+	          LIBUNA_BASE64_VARIANT_MIME,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "encoder",
+         encoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_encoder_initialize(
+	          &encoder,
+	          LIBUNA_BASE_FORMAT_BASE32,
+	          0xffffffffUL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "encoder",
+         encoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encoder != NULL )
+	{
+		libuna_base_stream_encoder_free(
+		 &encoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_base_stream_encoder_encode function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_base_stream_encoder_encode(
+     void )
+{
+	size_t chunk_size = 0;
+	int result        = 0;
+
+	/* Test every chunk size with a small and with a sufficient base stream
+	 */
+	for( chunk_size = 1;
+	     chunk_size <= 48;
+	     chunk_size++ )
+	{
+		result = una_test_base_stream_encoder_encode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE16,
+		          LIBUNA_BASE16_VARIANT_CASE_UPPER | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_64,
+		          una_test_base_stream_encoder_byte_stream1,
+		          43,
+		          chunk_size,
+		          4,
+		          una_test_base_stream_encoder_base16_stream1,
+		          88 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_encoder_encode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE16,
+		          LIBUNA_BASE16_VARIANT_CASE_UPPER | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_64,
+		          una_test_base_stream_encoder_byte_stream1,
+		          43,
+		          chunk_size,
+		          128,
+		          una_test_base_stream_encoder_base16_stream1,
+		          88 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_encoder_encode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE64,
+		          LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+		          una_test_base_stream_encoder_byte_stream1,
+		          43,
+		          chunk_size,
+		          6,
+		          una_test_base_stream_encoder_base64_stream1,
+		          60 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_encoder_encode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE64,
+		          LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+		          una_test_base_stream_encoder_byte_stream1,
+		          43,
+		          chunk_size,
+		          128,
+		          una_test_base_stream_encoder_base64_stream1,
+		          60 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_encoder_encode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE32,
+		          LIBUNA_BASE32_VARIANT_RFC4648,
+		          una_test_base_stream_encoder_byte_stream2,
+		          6,
+		          chunk_size,
+		          10,
+		          una_test_base_stream_encoder_base32_stream2,
+		          16 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_base_stream_encoder_encode_chunks(
+		          LIBUNA_BASE_FORMAT_BASE32,
+		          LIBUNA_BASE32_VARIANT_RFC4648 | LIBUNA_BASE32_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN,
+		          una_test_base_stream_encoder_byte_stream2,
+		          6,
+		          chunk_size,
+		          20,
+		          una_test_base_stream_encoder_base32_utf16le_stream2,
+		          32 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libuna_base_stream_encoder_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_base_stream_encoder_finalize(
+     void )
+{
+	uint8_t base_stream[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libuna_base_stream_encoder_t *encoder = NULL;
+	size_t base_stream_index              = 0;
+	size_t byte_stream_index              = 0;
+	int result                            = 0;
+
+	result = libuna_base_stream_encoder_initialize(
+	          &encoder,
+	          LIBUNA_BASE_FORMAT_BASE32,
+	          LIBUNA_BASE32_VARIANT_RFC4648,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test a byte stream that ends with an incomplete block
+	 */
+	result = libuna_base_stream_encoder_encode(
+	          encoder,
+	          una_test_base_stream_encoder_byte_stream2,
+	          6,
+	          &byte_stream_index,
+	          base_stream,
+	          16,
+	          &base_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 6 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "base_stream_index",
+	 base_stream_index,
+	 (size_t) 8 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test a base stream that is too small for the last block
+	 */
+	result = libuna_base_stream_encoder_finalize(
+	          encoder,
+	          base_stream,
+	          12,
+	          &base_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_encoder_finalize(
+	          encoder,
+	          base_stream,
+	          16,
+	          &base_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "base_stream_index",
+	 base_stream_index,
+	 (size_t) 16 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = memory_compare(
+	          base_stream,
+	          una_test_base_stream_encoder_base32_stream2,
+	          16 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libuna_base_stream_encoder_finalize(
+	          NULL,
+	          base_stream,
+	          16,
+	          &base_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_base_stream_encoder_free(
+	          &encoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encoder != NULL )
+	{
+		libuna_base_stream_encoder_free(
+		 &encoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_base_stream_encoder_initialize",
+	 una_test_base_stream_encoder_initialize );
+
+	UNA_TEST_RUN(
+	 "libuna_base_stream_encoder_encode",
+	 una_test_base_stream_encoder_encode );
+
+	UNA_TEST_RUN(
+	 "libuna_base_stream_encoder_finalize",
+	 una_test_base_stream_encoder_finalize );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,842 @@
+/*
+ * Library byte stream functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+libuna_utf8_character_t una_test_byte_stream_utf8_string[ 21 ] = {
+	'T', 'e', 's', 't', ' ', 0xc3, 0xa9, ' ', 0xe6, 0x97, 0xa5, 0xe6, 0x9c, 0xac, ' ', 0xf0, 0x9f, 0x98, 0x80, '!', 0 };
+
+libuna_utf16_character_t una_test_byte_stream_utf16_string[ 14 ] = {
+	'T', 'e', 's', 't', ' ', 0x00e9, ' ', 0x65e5, 0x672c, ' ', 0xd83d, 0xde00, '!', 0 };
+
+libuna_utf32_character_t una_test_byte_stream_utf32_string[ 13 ] = {
+	'T', 'e', 's', 't', ' ', 0x000000e9UL, ' ', 0x000065e5UL, 0x0000672cUL, ' ', 0x0001f600UL, '!', 0 };
+
+uint8_t una_test_byte_stream_windows_1252_byte_stream[ 13 ] = {
+	'T', 'e', 's', 't', ' ', 0xe9, ' ', 0x1a, 0x1a, ' ', 0x1a, '!', 0 };
+
+uint8_t una_test_byte_stream_windows_932_byte_stream[ 15 ] = {
+	'T', 'e', 's', 't', ' ', 0x1a, ' ', 0x93, 0xfa, 0x96, 0x7b, ' ', 0x1a, '!', 0 };
+
+/* Tests the libuna_byte_stream_size_from_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_byte_stream_size_from_utf8(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_byte_stream_size_from_utf8(
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 13 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_byte_stream_size_from_utf8(
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 15 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_byte_stream_size_from_utf8(
+	          NULL,
+	          21,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_byte_stream_size_from_utf8(
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          -1,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_byte_stream_copy_from_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_byte_stream_copy_from_utf8(
+     void )
+{
+	uint8_t byte_stream[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_byte_stream_copy_from_utf8(
+	          byte_stream,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_byte_stream_windows_1252_byte_stream,
+	          13 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libuna_byte_stream_copy_from_utf8(
+	          byte_stream,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_byte_stream_windows_932_byte_stream,
+	          15 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libuna_byte_stream_copy_from_utf8(
+	          NULL,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a byte stream that is too small
+	 */
+	result = libuna_byte_stream_copy_from_utf8(
+	          byte_stream,
+	          12,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a byte stream that is too small for the 2nd byte of a double-byte character
+	 */
+	result = libuna_byte_stream_copy_from_utf8(
+	          byte_stream,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          una_test_byte_stream_utf8_string,
+	          21,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_byte_stream_size_from_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_byte_stream_size_from_utf16(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_byte_stream_size_from_utf16(
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 13 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_byte_stream_size_from_utf16(
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 15 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_byte_stream_size_from_utf16(
+	          NULL,
+	          14,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_byte_stream_size_from_utf16(
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          -1,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_byte_stream_copy_from_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_byte_stream_copy_from_utf16(
+     void )
+{
+	uint8_t byte_stream[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_byte_stream_copy_from_utf16(
+	          byte_stream,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_byte_stream_windows_1252_byte_stream,
+	          13 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libuna_byte_stream_copy_from_utf16(
+	          byte_stream,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_byte_stream_windows_932_byte_stream,
+	          15 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libuna_byte_stream_copy_from_utf16(
+	          NULL,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a byte stream that is too small
+	 */
+	result = libuna_byte_stream_copy_from_utf16(
+	          byte_stream,
+	          12,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a byte stream that is too small for the 2nd byte of a double-byte character
+	 */
+	result = libuna_byte_stream_copy_from_utf16(
+	          byte_stream,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          una_test_byte_stream_utf16_string,
+	          14,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_byte_stream_size_from_utf32 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_byte_stream_size_from_utf32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_byte_stream_size_from_utf32(
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 13 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_byte_stream_size_from_utf32(
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 15 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_byte_stream_size_from_utf32(
+	          NULL,
+	          13,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_byte_stream_size_from_utf32(
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          -1,
+	          &byte_stream_size,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_byte_stream_copy_from_utf32 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_byte_stream_copy_from_utf32(
+     void )
+{
+	uint8_t byte_stream[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_byte_stream_copy_from_utf32(
+	          byte_stream,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_byte_stream_windows_1252_byte_stream,
+	          13 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libuna_byte_stream_copy_from_utf32(
+	          byte_stream,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          una_test_byte_stream_windows_932_byte_stream,
+	          15 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libuna_byte_stream_copy_from_utf32(
+	          NULL,
+	          32,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a byte stream that is too small
+	 */
+	result = libuna_byte_stream_copy_from_utf32(
+	          byte_stream,
+	          12,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a byte stream that is too small for the 2nd byte of a double-byte character
+	 */
+	result = libuna_byte_stream_copy_from_utf32(
+	          byte_stream,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_932,
+	          una_test_byte_stream_utf32_string,
+	          13,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_byte_stream_size_from_utf8",
+	 una_test_byte_stream_size_from_utf8 );
+
+	UNA_TEST_RUN(
+	 "libuna_byte_stream_copy_from_utf8",
+	 una_test_byte_stream_copy_from_utf8 );
+
+	UNA_TEST_RUN(
+	 "libuna_byte_stream_size_from_utf16",
+	 una_test_byte_stream_size_from_utf16 );
+
+	UNA_TEST_RUN(
+	 "libuna_byte_stream_copy_from_utf16",
+	 una_test_byte_stream_copy_from_utf16 );
+
+	UNA_TEST_RUN(
+	 "libuna_byte_stream_size_from_utf32",
+	 una_test_byte_stream_size_from_utf32 );
+
+	UNA_TEST_RUN(
+	 "libuna_byte_stream_copy_from_utf32",
+	 una_test_byte_stream_copy_from_utf32 );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2048 @@
+/*
+ * Library character count functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_character_count_utf8_stream[ 16 ] = {
+	'T', 'e', 's', 't', ' ', 0xc3, 0xa1, ' ', 0xe2, 0x82, 0xac, ' ', 0xf0, 0x9f, 0x98, 0x80 };
+
+libuna_utf16_character_t una_test_character_count_utf16_string[ 6 ] = {
+	'A', 0x00e1, 0xd83d, 0xde00, 0x20ac, 'C' };
+
+uint8_t una_test_character_count_utf16le_stream[ 12 ] = {
+	'A', 0, 0xe1, 0x00, 0x3d, 0xd8, 0x00, 0xde, 0xac, 0x20, 'C', 0 };
+
+libuna_utf32_character_t una_test_character_count_utf32_string[ 4 ] = {
+	'A', 0x0001f600UL, 0x000020acUL, 0 };
+
+uint8_t una_test_character_count_utf32be_stream[ 16 ] = {
+	0, 0, 0xfe, 0xff, 0, 0, 0, 'A', 0, 0x01, 0xf6, 0x00, 0, 0, 0x20, 0xac };
+
+/* Tests the libuna_utf8_string_get_number_of_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_get_number_of_characters(
+     void )
+{
+	uint8_t utf8_stream[ 99 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	size_t stream_index         = 0;
+	int result                  = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 16 )
+	{
+		memory_copy(
+		 &( utf8_stream[ stream_index + 3 ] ),
+		 una_test_character_count_utf8_stream,
+		 16 );
+	}
+	utf8_stream[ 0 ] = 0xef;
+	utf8_stream[ 1 ] = 0xbb;
+	utf8_stream[ 2 ] = 0xbf;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_get_number_of_characters(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 60 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an incomplete UTF-8 character at the end of the string
+	 */
+	result = libuna_utf8_string_get_number_of_characters(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          95,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 60 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_get_number_of_characters(
+	          NULL,
+	          96,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_string_get_number_of_characters(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_string_get_number_of_characters(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_string_seek_character function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_seek_character(
+     void )
+{
+	uint8_t utf8_stream[ 99 ];
+
+	libcerror_error_t *error = NULL;
+	size_t stream_index      = 0;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 16 )
+	{
+		memory_copy(
+		 &( utf8_stream[ stream_index + 3 ] ),
+		 una_test_character_count_utf8_stream,
+		 16 );
+	}
+	utf8_stream[ 0 ] = 0xef;
+	utf8_stream[ 1 ] = 0xbb;
+	utf8_stream[ 2 ] = 0xbf;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          0,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          55,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 85 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          59,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 92 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          60,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 96 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a character index beyond the end of the string
+	 */
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          61,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 96 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_seek_character(
+	          NULL,
+	          96,
+	          0,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &utf8_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_string_seek_character(
+	          (libuna_utf8_character_t *) &( utf8_stream[ 3 ] ),
+	          96,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_stream_get_number_of_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_stream_get_number_of_characters(
+     void )
+{
+	uint8_t utf8_stream[ 99 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	size_t stream_index         = 0;
+	int result                  = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 16 )
+	{
+		memory_copy(
+		 &( utf8_stream[ stream_index + 3 ] ),
+		 una_test_character_count_utf8_stream,
+		 16 );
+	}
+	utf8_stream[ 0 ] = 0xef;
+	utf8_stream[ 1 ] = 0xbb;
+	utf8_stream[ 2 ] = 0xbf;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf8_stream_get_number_of_characters(
+	          utf8_stream,
+	          99,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 60 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_stream_get_number_of_characters(
+	          NULL,
+	          99,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_stream_get_number_of_characters(
+	          utf8_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_stream_get_number_of_characters(
+	          utf8_stream,
+	          99,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_stream_seek_character function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_stream_seek_character(
+     void )
+{
+	uint8_t utf8_stream[ 99 ];
+
+	libcerror_error_t *error = NULL;
+	size_t stream_index      = 0;
+	size_t utf8_stream_index = 0;
+	int result               = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 16 )
+	{
+		memory_copy(
+		 &( utf8_stream[ stream_index + 3 ] ),
+		 una_test_character_count_utf8_stream,
+		 16 );
+	}
+	utf8_stream[ 0 ] = 0xef;
+	utf8_stream[ 1 ] = 0xbb;
+	utf8_stream[ 2 ] = 0xbf;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          99,
+	          0,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 3 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          99,
+	          55,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 88 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          99,
+	          59,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 95 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          99,
+	          60,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 99 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a character index beyond the end of the stream
+	 */
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          99,
+	          61,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 99 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_stream_seek_character(
+	          NULL,
+	          99,
+	          0,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_stream_seek_character(
+	          utf8_stream,
+	          99,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_string_get_number_of_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_string_get_number_of_characters(
+     void )
+{
+	libuna_utf16_character_t utf16_string[ 48 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	size_t string_index         = 0;
+	int result                  = 0;
+
+	for( string_index = 0;
+	     string_index < 48;
+	     string_index += 6 )
+	{
+		memory_copy(
+		 &( utf16_string[ string_index ] ),
+		 una_test_character_count_utf16_string,
+		 sizeof( libuna_utf16_character_t ) * 6 );
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf16_string_get_number_of_characters(
+	          utf16_string,
+	          48,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 40 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a high surrogate at the end of the string
+	 */
+	result = libuna_utf16_string_get_number_of_characters(
+	          utf16_string,
+	          45,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 38 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_string_get_number_of_characters(
+	          NULL,
+	          48,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_get_number_of_characters(
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_get_number_of_characters(
+	          utf16_string,
+	          48,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_string_seek_character function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_string_seek_character(
+     void )
+{
+	libuna_utf16_character_t utf16_string[ 48 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t string_index       = 0;
+	size_t utf16_string_index = 0;
+	int result                = 0;
+
+	for( string_index = 0;
+	     string_index < 48;
+	     string_index += 6 )
+	{
+		memory_copy(
+		 &( utf16_string[ string_index ] ),
+		 una_test_character_count_utf16_string,
+		 sizeof( libuna_utf16_character_t ) * 6 );
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf16_string_seek_character(
+	          utf16_string,
+	          48,
+	          37,
+	          &utf16_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 44 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_seek_character(
+	          utf16_string,
+	          48,
+	          38,
+	          &utf16_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 46 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_seek_character(
+	          utf16_string,
+	          48,
+	          40,
+	          &utf16_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 48 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a character index beyond the end of the string
+	 */
+	result = libuna_utf16_string_seek_character(
+	          utf16_string,
+	          48,
+	          41,
+	          &utf16_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 48 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_string_seek_character(
+	          NULL,
+	          48,
+	          0,
+	          &utf16_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_seek_character(
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &utf16_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_seek_character(
+	          utf16_string,
+	          48,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_stream_get_number_of_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_stream_get_number_of_characters(
+     void )
+{
+	uint8_t utf16_stream[ 98 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	size_t stream_index         = 0;
+	int result                  = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 12 )
+	{
+		memory_copy(
+		 &( utf16_stream[ stream_index + 2 ] ),
+		 una_test_character_count_utf16le_stream,
+		 12 );
+	}
+	utf16_stream[ 0 ] = 0xff;
+	utf16_stream[ 1 ] = 0xfe;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf16_stream_get_number_of_characters(
+	          utf16_stream,
+	          98,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 40 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_stream_get_number_of_characters(
+	          &( utf16_stream[ 2 ] ),
+	          96,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 40 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_stream_get_number_of_characters(
+	          NULL,
+	          98,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_get_number_of_characters(
+	          utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_get_number_of_characters(
+	          utf16_stream,
+	          98,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_get_number_of_characters(
+	          &( utf16_stream[ 2 ] ),
+	          96,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_stream_seek_character function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_stream_seek_character(
+     void )
+{
+	uint8_t utf16_stream[ 98 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t stream_index       = 0;
+	size_t utf16_stream_index = 0;
+	int result                = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 12 )
+	{
+		memory_copy(
+		 &( utf16_stream[ stream_index + 2 ] ),
+		 una_test_character_count_utf16le_stream,
+		 12 );
+	}
+	utf16_stream[ 0 ] = 0xff;
+	utf16_stream[ 1 ] = 0xfe;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          98,
+	          0,
+	          0,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 2 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          98,
+	          0,
+	          37,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 90 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          98,
+	          0,
+	          38,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 94 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          98,
+	          0,
+	          40,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 98 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a character index beyond the end of the stream
+	 */
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          98,
+	          0,
+	          41,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 98 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_stream_seek_character(
+	          NULL,
+	          98,
+	          0,
+	          0,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_seek_character(
+	          utf16_stream,
+	          98,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_seek_character(
+	          &( utf16_stream[ 2 ] ),
+	          96,
+	          0,
+	          0,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf32_string_get_number_of_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf32_string_get_number_of_characters(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf32_string_get_number_of_characters(
+	          una_test_character_count_utf32_string,
+	          4,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 4 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf32_string_get_number_of_characters(
+	          NULL,
+	          4,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_string_get_number_of_characters(
+	          una_test_character_count_utf32_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_string_get_number_of_characters(
+	          una_test_character_count_utf32_string,
+	          4,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf32_string_seek_character function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf32_string_seek_character(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	size_t utf32_string_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf32_string_seek_character(
+	          una_test_character_count_utf32_string,
+	          4,
+	          2,
+	          &utf32_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 2 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf32_string_seek_character(
+	          una_test_character_count_utf32_string,
+	          4,
+	          4,
+	          &utf32_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 4 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a character index beyond the end of the string
+	 */
+	result = libuna_utf32_string_seek_character(
+	          una_test_character_count_utf32_string,
+	          4,
+	          5,
+	          &utf32_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 4 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf32_string_seek_character(
+	          NULL,
+	          4,
+	          0,
+	          &utf32_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_string_seek_character(
+	          una_test_character_count_utf32_string,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &utf32_string_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_string_seek_character(
+	          una_test_character_count_utf32_string,
+	          4,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf32_stream_get_number_of_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf32_stream_get_number_of_characters(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf32_stream_get_number_of_characters(
+	          una_test_character_count_utf32be_stream,
+	          16,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 3 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an incomplete UTF-32 character at the end of the stream
+	 */
+	result = libuna_utf32_stream_get_number_of_characters(
+	          una_test_character_count_utf32be_stream,
+	          14,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 2 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf32_stream_get_number_of_characters(
+	          NULL,
+	          16,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_get_number_of_characters(
+	          una_test_character_count_utf32be_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_get_number_of_characters(
+	          una_test_character_count_utf32be_stream,
+	          16,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_get_number_of_characters(
+	          &( una_test_character_count_utf32be_stream[ 4 ] ),
+	          12,
+	          0,
+	          &number_of_characters,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf32_stream_seek_character function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf32_stream_seek_character(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	size_t utf32_stream_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf32_stream_seek_character(
+	          una_test_character_count_utf32be_stream,
+	          16,
+	          0,
+	          1,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_stream_index",
+	 utf32_stream_index,
+	 (size_t) 8 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf32_stream_seek_character(
+	          &( una_test_character_count_utf32be_stream[ 4 ] ),
+	          12,
+	          LIBUNA_ENDIAN_BIG,
+	          1,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_stream_index",
+	 utf32_stream_index,
+	 (size_t) 4 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a character index beyond the end of the stream
+	 */
+	result = libuna_utf32_stream_seek_character(
+	          una_test_character_count_utf32be_stream,
+	          16,
+	          0,
+	          4,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_stream_index",
+	 utf32_stream_index,
+	 (size_t) 16 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf32_stream_seek_character(
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_seek_character(
+	          una_test_character_count_utf32be_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_seek_character(
+	          una_test_character_count_utf32be_stream,
+	          16,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_seek_character(
+	          &( una_test_character_count_utf32be_stream[ 4 ] ),
+	          12,
+	          0,
+	          0,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_get_number_of_characters",
+	 una_test_utf8_string_get_number_of_characters );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_seek_character",
+	 una_test_utf8_string_seek_character );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_stream_get_number_of_characters",
+	 una_test_utf8_stream_get_number_of_characters );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_stream_seek_character",
+	 una_test_utf8_stream_seek_character );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_string_get_number_of_characters",
+	 una_test_utf16_string_get_number_of_characters );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_string_seek_character",
+	 una_test_utf16_string_seek_character );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_stream_get_number_of_characters",
+	 una_test_utf16_stream_get_number_of_characters );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_stream_seek_character",
+	 una_test_utf16_stream_seek_character );
+
+	UNA_TEST_RUN(
+	 "libuna_utf32_string_get_number_of_characters",
+	 una_test_utf32_string_get_number_of_characters );
+
+	UNA_TEST_RUN(
+	 "libuna_utf32_string_seek_character",
+	 una_test_utf32_string_seek_character );
+
+	UNA_TEST_RUN(
+	 "libuna_utf32_stream_get_number_of_characters",
+	 una_test_utf32_stream_get_number_of_characters );
+
+	UNA_TEST_RUN(
+	 "libuna_utf32_stream_seek_character",
+	 una_test_utf32_stream_seek_character );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
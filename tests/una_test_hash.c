@@ -0,0 +1,980 @@
+/*
+ * Library hash functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_hash_utf7_stream[ 17 ] = {
+	'T', 'e', 's', 't', ' ', '+', 'A', 'O', 'E', '-', ' ', '+',
+	'I', 'K', 'w', '-', 0x00 };
+
+libuna_utf8_character_t una_test_hash_utf8_string[ 16 ] = {
+	'T', 'e', 's', 't', ' ', 0xc3, 0xa1, ' ', 0xe2, 0x82, 0xac, ' ',
+	0xf0, 0x9f, 0x98, 0x80 };
+
+uint8_t una_test_hash_utf8_stream[ 20 ] = {
+	0xef, 0xbb, 0xbf, 'T', 'e', 's', 't', ' ', 0xc3, 0xa1, ' ', 0xe2,
+	0x82, 0xac, ' ', 0xf0, 0x9f, 0x98, 0x80, 0x00 };
+
+libuna_utf16_character_t una_test_hash_utf16_string[ 11 ] = {
+	'T', 'e', 's', 't', ' ', 0x00e1, ' ', 0x20ac,
+	' ', 0xd83d, 0xde00 };
+
+uint8_t una_test_hash_utf16le_stream[ 26 ] = {
+	0xff, 0xfe, 'T', 0x00, 'e', 0x00, 's', 0x00, 't', 0x00, 0x20, 0x00,
+	0xe1, 0x00, 0x20, 0x00, 0xac, 0x20, 0x20, 0x00, 0x3d, 0xd8, 0x00, 0xde,
+	0x00, 0x00 };
+
+libuna_utf32_character_t una_test_hash_utf32_string[ 11 ] = {
+	'T', 'e', 's', 't', ' ', 0x000000e1UL,
+	' ', 0x000020acUL, ' ', 0x0001f600UL, 0x00000000UL };
+
+uint8_t una_test_hash_utf32be_stream[ 44 ] = {
+	0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 'T', 0x00, 0x00, 0x00, 'e',
+	0x00, 0x00, 0x00, 's', 0x00, 0x00, 0x00, 't', 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0xac,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0xf6, 0x00 };
+
+uint8_t una_test_hash_byte_stream[ 8 ] = {
+	'T', 'e', 's', 't', ' ', 0xe1, ' ', 0x80 };
+
+/* Tests the libuna_hash_calculate_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_byte_stream(
+	          una_test_hash_byte_stream,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xc064ab11b2748283ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_byte_stream(
+	          NULL,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_byte_stream(
+	          una_test_hash_byte_stream,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf7_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf7_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf7_stream(
+	          una_test_hash_utf7_stream,
+	          17,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xc064ab11b2748283ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf7_stream(
+	          NULL,
+	          17,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf7_stream(
+	          una_test_hash_utf7_stream,
+	          17,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf8(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf8(
+	          una_test_hash_utf8_string,
+	          16,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the hash of an empty string
+	 */
+	result = libuna_hash_calculate_from_utf8(
+	          (libuna_utf8_character_t *) "",
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xef46db3751d8e999ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an end-of-string character is not included in the hash
+	 */
+	result = libuna_hash_calculate_from_utf8(
+	          (libuna_utf8_character_t *) "abc",
+	          4,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x44bc2cf5ad770999ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf8(
+	          NULL,
+	          16,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf8(
+	          una_test_hash_utf8_string,
+	          16,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf8_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf8_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf8_stream(
+	          una_test_hash_utf8_stream,
+	          20,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf8_stream(
+	          NULL,
+	          20,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf8_stream(
+	          una_test_hash_utf8_stream,
+	          20,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf16(
+     void )
+{
+	libuna_utf16_character_t utf16_string[ 264 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf16(
+	          una_test_hash_utf16_string,
+	          11,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that does not fit in the buffer used to hash the UTF-8 characters
+	 */
+	for( string_index = 0;
+	     string_index < 264;
+	     string_index += 11 )
+	{
+		memory_copy(
+		 &( utf16_string[ string_index ] ),
+		 &( una_test_hash_utf16_string[ 5 ] ),
+		 sizeof( libuna_utf16_character_t ) * 6 );
+
+		memory_copy(
+		 &( utf16_string[ string_index + 6 ] ),
+		 una_test_hash_utf16_string,
+		 sizeof( libuna_utf16_character_t ) * 5 );
+	}
+	result = libuna_hash_calculate_from_utf16(
+	          utf16_string,
+	          264,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x08d30eb92da0d713ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf16(
+	          NULL,
+	          11,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf16(
+	          una_test_hash_utf16_string,
+	          11,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf16_stream(
+	          una_test_hash_utf16le_stream,
+	          26,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_hash_calculate_from_utf16_stream(
+	          &( una_test_hash_utf16le_stream[ 2 ] ),
+	          22,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf16_stream(
+	          NULL,
+	          26,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf16_stream(
+	          una_test_hash_utf16le_stream,
+	          25,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf16_stream(
+	          &( una_test_hash_utf16le_stream[ 2 ] ),
+	          22,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf16_stream(
+	          una_test_hash_utf16le_stream,
+	          26,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf32 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf32(
+	          una_test_hash_utf32_string,
+	          11,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf32(
+	          NULL,
+	          11,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf32(
+	          una_test_hash_utf32_string,
+	          11,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_hash_calculate_from_utf32_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_hash_calculate_from_utf32_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_hash_calculate_from_utf32_stream(
+	          una_test_hash_utf32be_stream,
+	          44,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_hash_calculate_from_utf32_stream(
+	          &( una_test_hash_utf32be_stream[ 4 ] ),
+	          40,
+	          LIBUNA_ENDIAN_BIG,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x4f321bc47a3cf617ULL );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_hash_calculate_from_utf32_stream(
+	          NULL,
+	          44,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf32_stream(
+	          una_test_hash_utf32be_stream,
+	          43,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf32_stream(
+	          &( una_test_hash_utf32be_stream[ 4 ] ),
+	          40,
+	          0,
+	          &hash,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_hash_calculate_from_utf32_stream(
+	          una_test_hash_utf32be_stream,
+	          44,
+	          0,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_byte_stream",
+	 una_test_hash_calculate_from_byte_stream );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf7_stream",
+	 una_test_hash_calculate_from_utf7_stream );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf8",
+	 una_test_hash_calculate_from_utf8 );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf8_stream",
+	 una_test_hash_calculate_from_utf8_stream );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf16",
+	 una_test_hash_calculate_from_utf16 );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf16_stream",
+	 una_test_hash_calculate_from_utf16_stream );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf32",
+	 una_test_hash_calculate_from_utf32 );
+
+	UNA_TEST_RUN(
+	 "libuna_hash_calculate_from_utf32_stream",
+	 una_test_hash_calculate_from_utf32_stream );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
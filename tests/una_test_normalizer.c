@@ -0,0 +1,576 @@
+/*
+ * Library normalizer functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+libuna_unicode_character_t una_test_normalizer_unicode_characters[ 18 ] = {
+	'e', 0x0301, ' ', 'A', 0x030a, 0x0323, ' ', 0x212b, ' ', 0x1100, 0x1161, 0x11a8, ' ', 'q', 0x0307, 0x0323,
+	' ', 0xfb2c };
+
+libuna_unicode_character_t una_test_normalizer_nfc_unicode_characters[ 16 ] = {
+	0x00e9, ' ', 0x1ea0, 0x030a, ' ', 0x00c5, ' ', 0xac01, ' ', 'q', 0x0323, 0x0307, ' ', 0x05e9, 0x05bc, 0x05c1 };
+
+libuna_unicode_character_t una_test_normalizer_nfd_unicode_characters[ 21 ] = {
+	'e', 0x0301, ' ', 'A', 0x0323, 0x030a, ' ', 'A', 0x030a, ' ', 0x1100, 0x1161, 0x11a8, ' ', 'q', 0x0323,
+	0x0307, ' ', 0x05e9, 0x05bc, 0x05c1 };
+
+/* Normalizes Unicode characters in chunks of a specific size and compares the normalized Unicode characters
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_normalizer_normalize_chunks(
+     int normalization_form,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t unicode_characters_size,
+     size_t chunk_size,
+     size_t normalized_unicode_characters_size,
+     const libuna_unicode_character_t *expected_unicode_characters,
+     size_t expected_number_of_unicode_characters )
+{
+	libuna_unicode_character_t normalized_unicode_characters[ 32 ];
+
+	libcerror_error_t *error                   = NULL;
+	libuna_normalizer_t *normalizer            = NULL;
+	size_t chunk_index                         = 0;
+	size_t normalized_unicode_characters_index = 0;
+	size_t number_of_characters                = 0;
+	size_t unicode_characters_index            = 0;
+	int result                                 = 0;
+
+	result = libuna_normalizer_initialize(
+	          &normalizer,
+	          normalization_form,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	while( unicode_characters_index < unicode_characters_size )
+	{
+		chunk_index = 0;
+
+		if( ( unicode_characters_size - unicode_characters_index ) < chunk_size )
+		{
+			chunk_size = unicode_characters_size - unicode_characters_index;
+		}
+		while( chunk_index < chunk_size )
+		{
+			normalized_unicode_characters_index = number_of_characters;
+
+			result = libuna_normalizer_normalize(
+			          normalizer,
+			          &( unicode_characters[ unicode_characters_index ] ),
+			          chunk_size,
+			          &chunk_index,
+			          normalized_unicode_characters,
+			          number_of_characters + normalized_unicode_characters_size,
+			          &normalized_unicode_characters_index,
+			          &error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			number_of_characters = normalized_unicode_characters_index;
+
+			if( number_of_characters > ( 32 - normalized_unicode_characters_size ) )
+			{
+				result = 0;
+
+				goto on_error;
+			}
+		}
+		unicode_characters_index += chunk_size;
+	}
+	do
+	{
+		normalized_unicode_characters_index = number_of_characters;
+
+		result = libuna_normalizer_finalize(
+		          normalizer,
+		          normalized_unicode_characters,
+		          number_of_characters + normalized_unicode_characters_size,
+		          &normalized_unicode_characters_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		number_of_characters = normalized_unicode_characters_index;
+
+		if( ( result == 0 )
+		 && ( number_of_characters > ( 32 - normalized_unicode_characters_size ) ) )
+		{
+			goto on_error;
+		}
+	}
+	while( result == 0 );
+
+	if( number_of_characters != expected_number_of_unicode_characters )
+	{
+		result = 0;
+	}
+	else if( memory_compare(
+	          normalized_unicode_characters,
+	          expected_unicode_characters,
+	          sizeof( libuna_unicode_character_t ) * expected_number_of_unicode_characters ) != 0 )
+	{
+		result = 0;
+	}
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+		libcerror_error_free(
+		 &error );
+	}
+	if( normalizer != NULL )
+	{
+		libuna_normalizer_free(
+		 &normalizer,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libuna_normalizer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_normalizer_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libuna_normalizer_t *normalizer = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_normalizer_initialize(
+	          &normalizer,
+	          LIBUNA_NORMALIZATION_FORM_NFC,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "normalizer",
+         normalizer );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_normalizer_free(
+	          &normalizer,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "normalizer",
+         normalizer );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libuna_normalizer_initialize(
+	          NULL,
+	          LIBUNA_NORMALIZATION_FORM_NFC,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_normalizer_initialize(
+	          &normalizer,
+	          -1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "normalizer",
+         normalizer );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( normalizer != NULL )
+	{
+		libuna_normalizer_free(
+		 &normalizer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_normalizer_normalize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_normalizer_normalize(
+     void )
+{
+	size_t chunk_size = 0;
+	int result        = 0;
+
+	/* Test every chunk size with a single normalized Unicode character and with sufficient normalized Unicode characters
+	 */
+	for( chunk_size = 1;
+	     chunk_size <= 18;
+	     chunk_size++ )
+	{
+		result = una_test_normalizer_normalize_chunks(
+		          LIBUNA_NORMALIZATION_FORM_NFC,
+		          una_test_normalizer_unicode_characters,
+		          18,
+		          chunk_size,
+		          1,
+		          una_test_normalizer_nfc_unicode_characters,
+		          16 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_normalizer_normalize_chunks(
+		          LIBUNA_NORMALIZATION_FORM_NFC,
+		          una_test_normalizer_unicode_characters,
+		          18,
+		          chunk_size,
+		          8,
+		          una_test_normalizer_nfc_unicode_characters,
+		          16 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_normalizer_normalize_chunks(
+		          LIBUNA_NORMALIZATION_FORM_NFD,
+		          una_test_normalizer_unicode_characters,
+		          18,
+		          chunk_size,
+		          1,
+		          una_test_normalizer_nfd_unicode_characters,
+		          21 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_normalizer_normalize_chunks(
+		          LIBUNA_NORMALIZATION_FORM_NFD,
+		          una_test_normalizer_unicode_characters,
+		          18,
+		          chunk_size,
+		          8,
+		          una_test_normalizer_nfd_unicode_characters,
+		          21 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test that normalized Unicode characters are passed through untouched
+		 */
+		result = una_test_normalizer_normalize_chunks(
+		          LIBUNA_NORMALIZATION_FORM_NFC,
+		          una_test_normalizer_nfc_unicode_characters,
+		          16,
+		          chunk_size,
+		          4,
+		          una_test_normalizer_nfc_unicode_characters,
+		          16 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_normalizer_normalize_chunks(
+		          LIBUNA_NORMALIZATION_FORM_NFD,
+		          una_test_normalizer_nfd_unicode_characters,
+		          21,
+		          chunk_size,
+		          4,
+		          una_test_normalizer_nfd_unicode_characters,
+		          21 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libuna_normalizer_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_normalizer_finalize(
+     void )
+{
+	libuna_unicode_character_t normalized_unicode_characters[ 32 ];
+
+	libcerror_error_t *error                   = NULL;
+	libuna_normalizer_t *normalizer            = NULL;
+	size_t normalized_unicode_characters_index = 0;
+	size_t unicode_characters_index            = 0;
+	int result                                 = 0;
+
+	result = libuna_normalizer_initialize(
+	          &normalizer,
+	          LIBUNA_NORMALIZATION_FORM_NFC,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test that the last segment is kept by the normalizer
+	 */
+	result = libuna_normalizer_normalize(
+	          normalizer,
+	          una_test_normalizer_unicode_characters,
+	          18,
+	          &unicode_characters_index,
+	          normalized_unicode_characters,
+	          32,
+	          &normalized_unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "unicode_characters_index",
+	 unicode_characters_index,
+	 (size_t) 18 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "normalized_unicode_characters_index",
+	 normalized_unicode_characters_index,
+	 (size_t) 12 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test finalize with normalized Unicode characters that are too small
+	 */
+	result = libuna_normalizer_finalize(
+	          normalizer,
+	          normalized_unicode_characters,
+	          14,
+	          &normalized_unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "normalized_unicode_characters_index",
+	 normalized_unicode_characters_index,
+	 (size_t) 14 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_normalizer_finalize(
+	          normalizer,
+	          normalized_unicode_characters,
+	          32,
+	          &normalized_unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "normalized_unicode_characters_index",
+	 normalized_unicode_characters_index,
+	 (size_t) 16 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = memory_compare(
+	          normalized_unicode_characters,
+	          una_test_normalizer_nfc_unicode_characters,
+	          sizeof( libuna_unicode_character_t ) * 16 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libuna_normalizer_finalize(
+	          NULL,
+	          normalized_unicode_characters,
+	          32,
+	          &normalized_unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_normalizer_free(
+	          &normalizer,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( normalizer != NULL )
+	{
+		libuna_normalizer_free(
+		 &normalizer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_normalizer_initialize",
+	 una_test_normalizer_initialize );
+
+	UNA_TEST_RUN(
+	 "libuna_normalizer_normalize",
+	 una_test_normalizer_normalize );
+
+	UNA_TEST_RUN(
+	 "libuna_normalizer_finalize",
+	 una_test_normalizer_finalize );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
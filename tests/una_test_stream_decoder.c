@@ -0,0 +1,725 @@
+/*
+ * Library stream decoder functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_stream_decoder_utf8_stream[ 16 ] = {
+	'T', 'e', 's', 't', ' ', 0xc3, 0xa1, ' ', 0xe2, 0x82, 0xac, ' ', 0xf0, 0x9f, 0x98, 0x80 };
+
+libuna_unicode_character_t una_test_stream_decoder_utf8_stream_unicode_characters[ 10 ] = {
+	'T', 'e', 's', 't', ' ', 0x00e1, ' ', 0x20ac, ' ', 0x0001f600 };
+
+uint8_t una_test_stream_decoder_utf16le_stream[ 12 ] = {
+	'A', 0, 0xe1, 0x00, 0xe5, 0x65, 'B', 0, 0xac, 0x20, 'C', 0 };
+
+libuna_unicode_character_t una_test_stream_decoder_utf16le_stream_unicode_characters[ 6 ] = {
+	'A', 0x00e1, 0x65e5, 'B', 0x20ac, 'C' };
+
+uint8_t una_test_stream_decoder_utf32be_stream[ 12 ] = {
+	0, 0, 0, 'A', 0, 0x01, 0xf6, 0x00, 0, 0, 0x20, 0xac };
+
+libuna_unicode_character_t una_test_stream_decoder_utf32be_stream_unicode_characters[ 3 ] = {
+	'A', 0x0001f600, 0x20ac };
+
+uint8_t una_test_stream_decoder_utf7_stream[ 28 ] = {
+	'H', 'i', ' ', 'M', 'o', 'm', ' ', '+', 'J', 'j', 'o', '-', '!', ' ', '+', 'Z',
+	'e', 'V', 'n', 'L', 'I', 'q', 'e', '-', ' ', 'e', 'n', 'd' };
+
+libuna_unicode_character_t una_test_stream_decoder_utf7_stream_unicode_characters[ 17 ] = {
+	'H', 'i', ' ', 'M', 'o', 'm', ' ', 0x263a, '!', ' ', 0x65e5, 0x672c, 0x8a9e, ' ', 'e', 'n',
+	'd' };
+
+uint8_t una_test_stream_decoder_windows_932_stream[ 8 ] = {
+	'a', 0x82, 0xa0, 'b', 0x88, 0x9f, 0xb1, 'c' };
+
+libuna_unicode_character_t una_test_stream_decoder_windows_932_stream_unicode_characters[ 6 ] = {
+	'a', 0x3042, 'b', 0x4e9c, 0xff71, 'c' };
+
+/* Decodes a stream in chunks of a specific size and compares the Unicode characters
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_stream_decoder_decode_chunks(
+     int stream_format,
+     int codepage,
+     const uint8_t *stream,
+     size_t stream_size,
+     size_t chunk_size,
+     size_t unicode_characters_size,
+     const libuna_unicode_character_t *expected_unicode_characters,
+     size_t expected_number_of_unicode_characters )
+{
+	libuna_unicode_character_t unicode_characters[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	libuna_stream_decoder_t *decoder = NULL;
+	size_t chunk_index               = 0;
+	size_t number_of_characters      = 0;
+	size_t stream_index              = 0;
+	size_t unicode_characters_index  = 0;
+	int result                       = 0;
+
+	result = libuna_stream_decoder_initialize(
+	          &decoder,
+	          stream_format,
+	          codepage,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	while( stream_index < stream_size )
+	{
+		chunk_index = 0;
+
+		if( ( stream_size - stream_index ) < chunk_size )
+		{
+			chunk_size = stream_size - stream_index;
+		}
+		while( chunk_index < chunk_size )
+		{
+			unicode_characters_index = number_of_characters;
+
+			result = libuna_stream_decoder_decode(
+			          decoder,
+			          &( stream[ stream_index ] ),
+			          chunk_size,
+			          &chunk_index,
+			          unicode_characters,
+			          number_of_characters + unicode_characters_size,
+			          &unicode_characters_index,
+			          &error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			number_of_characters = unicode_characters_index;
+
+			if( number_of_characters > ( 32 - unicode_characters_size ) )
+			{
+				result = 0;
+
+				goto on_error;
+			}
+		}
+		stream_index += chunk_size;
+	}
+	result = libuna_stream_decoder_finalize(
+	          decoder,
+	          unicode_characters,
+	          32,
+	          &number_of_characters,
+	          &error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( number_of_characters != expected_number_of_unicode_characters )
+	{
+		result = 0;
+	}
+	else if( memory_compare(
+	          unicode_characters,
+	          expected_unicode_characters,
+	          sizeof( libuna_unicode_character_t ) * expected_number_of_unicode_characters ) != 0 )
+	{
+		result = 0;
+	}
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libuna_stream_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libuna_stream_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_stream_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libuna_stream_decoder_t *decoder = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_STREAM_FORMAT_UTF8,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_stream_decoder_free(
+	          &decoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libuna_stream_decoder_initialize(
+	          NULL,
+	          LIBUNA_STREAM_FORMAT_UTF8,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_stream_decoder_initialize(
+	          &decoder,
+	          -1,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_STREAM_FORMAT_BYTE_STREAM,
+	          -1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "decoder",
+         decoder );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libuna_stream_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_stream_decoder_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_stream_decoder_decode(
+     void )
+{
+	size_t chunk_size = 0;
+	int result        = 0;
+
+	/* Test every chunk size with a single Unicode character and with sufficient Unicode characters
+	 */
+	for( chunk_size = 1;
+	     chunk_size <= 32;
+	     chunk_size++ )
+	{
+		result = una_test_stream_decoder_decode_chunks(
+		          LIBUNA_STREAM_FORMAT_UTF8,
+		          0,
+		          una_test_stream_decoder_utf8_stream,
+		          16,
+		          chunk_size,
+		          1,
+		          una_test_stream_decoder_utf8_stream_unicode_characters,
+		          10 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_stream_decoder_decode_chunks(
+		          LIBUNA_STREAM_FORMAT_UTF8,
+		          0,
+		          una_test_stream_decoder_utf8_stream,
+		          16,
+		          chunk_size,
+		          16,
+		          una_test_stream_decoder_utf8_stream_unicode_characters,
+		          10 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_stream_decoder_decode_chunks(
+		          LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN,
+		          0,
+		          una_test_stream_decoder_utf16le_stream,
+		          12,
+		          chunk_size,
+		          1,
+		          una_test_stream_decoder_utf16le_stream_unicode_characters,
+		          6 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_stream_decoder_decode_chunks(
+		          LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN,
+		          0,
+		          una_test_stream_decoder_utf32be_stream,
+		          12,
+		          chunk_size,
+		          2,
+		          una_test_stream_decoder_utf32be_stream_unicode_characters,
+		          3 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_stream_decoder_decode_chunks(
+		          LIBUNA_STREAM_FORMAT_UTF7,
+		          0,
+		          una_test_stream_decoder_utf7_stream,
+		          28,
+		          chunk_size,
+		          1,
+		          una_test_stream_decoder_utf7_stream_unicode_characters,
+		          17 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = una_test_stream_decoder_decode_chunks(
+		          LIBUNA_STREAM_FORMAT_BYTE_STREAM,
+		          LIBUNA_CODEPAGE_WINDOWS_932,
+		          una_test_stream_decoder_windows_932_stream,
+		          8,
+		          chunk_size,
+		          3,
+		          una_test_stream_decoder_windows_932_stream_unicode_characters,
+		          6 );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libuna_stream_decoder_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_stream_decoder_finalize(
+     void )
+{
+	libuna_unicode_character_t unicode_characters[ 16 ];
+
+	libcerror_error_t *error         = NULL;
+	libuna_stream_decoder_t *decoder = NULL;
+	size_t stream_index              = 0;
+	size_t unicode_characters_index  = 0;
+	int result                       = 0;
+
+	result = libuna_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_STREAM_FORMAT_UTF8,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test a stream that ends with an incomplete character
+	 */
+	result = libuna_stream_decoder_decode(
+	          decoder,
+	          una_test_stream_decoder_utf8_stream,
+	          14,
+	          &stream_index,
+	          unicode_characters,
+	          16,
+	          &unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_index",
+	 stream_index,
+	 (size_t) 14 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "unicode_characters_index",
+	 unicode_characters_index,
+	 (size_t) 9 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_stream_decoder_finalize(
+	          decoder,
+	          unicode_characters,
+	          16,
+	          &unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a UTF-7 stream of which the buffered characters
+	 * do not fit in the Unicode characters at once
+	 */
+	result = libuna_stream_decoder_free(
+	          &decoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libuna_stream_decoder_initialize(
+	          &decoder,
+	          LIBUNA_STREAM_FORMAT_UTF7,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	stream_index             = 0;
+	unicode_characters_index = 0;
+
+	result = libuna_stream_decoder_decode(
+	          decoder,
+	          (uint8_t *) "ab+AGEAYQBiAGMAZABl-",
+	          20,
+	          &stream_index,
+	          unicode_characters,
+	          16,
+	          &unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_index",
+	 stream_index,
+	 (size_t) 20 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "unicode_characters_index",
+	 unicode_characters_index,
+	 (size_t) 2 );
+
+	result = libuna_stream_decoder_finalize(
+	          decoder,
+	          unicode_characters,
+	          unicode_characters_index + 1,
+	          &unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "unicode_characters_index",
+	 unicode_characters_index,
+	 (size_t) 3 );
+
+	result = libuna_stream_decoder_finalize(
+	          decoder,
+	          unicode_characters,
+	          16,
+	          &unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "unicode_characters_index",
+	 unicode_characters_index,
+	 (size_t) 8 );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 0 ]",
+	 unicode_characters[ 0 ],
+	 (uint32_t) 'a' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 1 ]",
+	 unicode_characters[ 1 ],
+	 (uint32_t) 'b' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 2 ]",
+	 unicode_characters[ 2 ],
+	 (uint32_t) 'a' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 3 ]",
+	 unicode_characters[ 3 ],
+	 (uint32_t) 'a' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 4 ]",
+	 unicode_characters[ 4 ],
+	 (uint32_t) 'b' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 5 ]",
+	 unicode_characters[ 5 ],
+	 (uint32_t) 'c' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 6 ]",
+	 unicode_characters[ 6 ],
+	 (uint32_t) 'd' );
+
+	UNA_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_characters[ 7 ]",
+	 unicode_characters[ 7 ],
+	 (uint32_t) 'e' );
+
+	/* Test error cases
+	 */
+	result = libuna_stream_decoder_finalize(
+	          NULL,
+	          unicode_characters,
+	          16,
+	          &unicode_characters_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        UNA_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_stream_decoder_free(
+	          &decoder,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        UNA_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libuna_stream_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_stream_decoder_initialize",
+	 una_test_stream_decoder_initialize );
+
+	UNA_TEST_RUN(
+	 "libuna_stream_decoder_decode",
+	 una_test_stream_decoder_decode );
+
+	UNA_TEST_RUN(
+	 "libuna_stream_decoder_finalize",
+	 una_test_stream_decoder_finalize );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,577 @@
+/*
+ * Library stream validate functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_stream_validate_utf8_stream[ 16 ] = {
+	'T', 'e', 's', 't', ' ', 0xc3, 0xa1, ' ', 0xe2, 0x82, 0xac, ' ', 0xf0, 0x9f, 0x98, 0x80 };
+
+uint8_t una_test_stream_validate_utf8_invalid_sequences[ 6 ][ 4 ] = {
+	{ 0x80, 0x00, 0x00, 0x00 },
+	{ 0xc3, 'a', 0x00, 0x00 },
+	{ 0xe0, 0x80, 0x80, 0x00 },
+	{ 0xed, 0xa0, 0x80, 0x00 },
+	{ 0xf4, 0x90, 0x80, 0x80 },
+	{ 0xf5, 0x80, 0x80, 0x80 } };
+
+size_t una_test_stream_validate_utf8_invalid_sequence_sizes[ 6 ] = {
+	1, 2, 3, 3, 4, 4 };
+
+uint8_t una_test_stream_validate_utf16le_stream[ 14 ] = {
+	0xff, 0xfe, 'A', 0, 0xe1, 0x00, 0x3d, 0xd8, 0x00, 0xde, 0xac, 0x20, 'C', 0 };
+
+uint8_t una_test_stream_validate_utf32be_stream[ 12 ] = {
+	0, 0, 0, 'A', 0, 0x01, 0xf6, 0x00, 0, 0x10, 0xff, 0xff };
+
+/* Tests the libuna_utf8_stream_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_stream_validate(
+     void )
+{
+	uint8_t utf8_stream[ 96 ];
+
+	libcerror_error_t *error = NULL;
+	size_t sequence_index    = 0;
+	size_t stream_index      = 0;
+	size_t utf8_stream_index = 0;
+	int result               = 0;
+
+	for( stream_index = 0;
+	     stream_index < 96;
+	     stream_index += 16 )
+	{
+		memory_copy(
+		 &( utf8_stream[ stream_index ] ),
+		 una_test_stream_validate_utf8_stream,
+		 16 );
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf8_stream_validate(
+	          utf8_stream,
+	          96,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 96 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an incomplete UTF-8 character at the end of the stream
+	 */
+	result = libuna_utf8_stream_validate(
+	          utf8_stream,
+	          95,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_stream_index",
+	 utf8_stream_index,
+	 (size_t) 92 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the overlong 2-byte form that libuna_unicode_character_copy_from_utf8 accepts
+	 */
+	utf8_stream[ 32 ] = 0xc0;
+	utf8_stream[ 33 ] = 0x80;
+
+	result = libuna_utf8_stream_validate(
+	          utf8_stream,
+	          96,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &( utf8_stream[ 32 ] ),
+	 una_test_stream_validate_utf8_stream,
+	 16 );
+
+	/* Test invalid UTF-8 characters at every position in and between the blocks
+	 */
+	for( sequence_index = 0;
+	     sequence_index < 6;
+	     sequence_index++ )
+	{
+		for( stream_index = 0;
+		     stream_index < ( 96 - 4 );
+		     stream_index++ )
+		{
+			memory_set(
+			 utf8_stream,
+			 'a',
+			 96 );
+
+			memory_copy(
+			 &( utf8_stream[ stream_index ] ),
+			 una_test_stream_validate_utf8_invalid_sequences[ sequence_index ],
+			 una_test_stream_validate_utf8_invalid_sequence_sizes[ sequence_index ] );
+
+			result = libuna_utf8_stream_validate(
+			          utf8_stream,
+			          96,
+			          &utf8_stream_index,
+			          &error );
+
+			UNA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			UNA_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_stream_index",
+			 utf8_stream_index,
+			 stream_index );
+
+			UNA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libuna_utf8_stream_validate(
+	          NULL,
+	          96,
+	          &utf8_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_stream_validate(
+	          utf8_stream,
+	          96,
+	          NULL,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_stream_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_stream_validate(
+     void )
+{
+	uint8_t utf16_stream[ 14 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf16_stream_index = 0;
+	int result                = 0;
+
+	memory_copy(
+	 utf16_stream,
+	 una_test_stream_validate_utf16le_stream,
+	 14 );
+
+	/* Test regular cases
+	 */
+	result = libuna_utf16_stream_validate(
+	          utf16_stream,
+	          14,
+	          0,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 14 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an incomplete UTF-16 character at the end of the stream
+	 */
+	result = libuna_utf16_stream_validate(
+	          utf16_stream,
+	          13,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 12 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an unpaired high surrogate
+	 */
+	utf16_stream[ 9 ] = 0x00;
+
+	result = libuna_utf16_stream_validate(
+	          utf16_stream,
+	          14,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 6 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an unpaired low surrogate
+	 */
+	utf16_stream[ 7 ] = 0x00;
+	utf16_stream[ 9 ] = 0xde;
+
+	result = libuna_utf16_stream_validate(
+	          utf16_stream,
+	          14,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 8 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_stream_validate(
+	          NULL,
+	          14,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_stream_validate(
+	          &( utf16_stream[ 2 ] ),
+	          12,
+	          0,
+	          &utf16_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf32_stream_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf32_stream_validate(
+     void )
+{
+	uint8_t utf32_stream[ 12 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf32_stream_index = 0;
+	int result                = 0;
+
+	memory_copy(
+	 utf32_stream,
+	 una_test_stream_validate_utf32be_stream,
+	 12 );
+
+	/* Test regular cases
+	 */
+	result = libuna_utf32_stream_validate(
+	          utf32_stream,
+	          12,
+	          LIBUNA_ENDIAN_BIG,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_stream_index",
+	 utf32_stream_index,
+	 (size_t) 12 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value that exceeds the maximum Unicode character
+	 */
+	utf32_stream[ 9 ] = 0x11;
+
+	result = libuna_utf32_stream_validate(
+	          utf32_stream,
+	          12,
+	          LIBUNA_ENDIAN_BIG,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_stream_index",
+	 utf32_stream_index,
+	 (size_t) 8 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a surrogate
+	 */
+	utf32_stream[ 5 ] = 0x00;
+	utf32_stream[ 6 ] = 0xdc;
+
+	result = libuna_utf32_stream_validate(
+	          utf32_stream,
+	          12,
+	          LIBUNA_ENDIAN_BIG,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_stream_index",
+	 utf32_stream_index,
+	 (size_t) 4 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf32_stream_validate(
+	          NULL,
+	          12,
+	          LIBUNA_ENDIAN_BIG,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf32_stream_validate(
+	          utf32_stream,
+	          12,
+	          -1,
+	          &utf32_stream_index,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_stream_validate",
+	 una_test_utf8_stream_validate );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_stream_validate",
+	 una_test_utf16_stream_validate );
+
+	UNA_TEST_RUN(
+	 "libuna_utf32_stream_validate",
+	 una_test_utf32_stream_validate );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1417 @@
+/*
+ * Library string compare functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+uint8_t una_test_string_compare_utf8_string[ 41 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 0xc3, 0xbc, 'b', 'e', 'r', ' ',
+	't', 'h', 'e', ' ', 'd', 'o', 'g', '.', 0 };
+
+libuna_utf16_character_t una_test_string_compare_utf16_string[ 40 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 0x00fc, 'b', 'e', 'r', ' ',
+	't', 'h', 'e', ' ', 'd', 'o', 'g', '.', 0 };
+
+libuna_utf16_character_t una_test_string_compare_utf16_upper_case_string[ 40 ] = {
+	'T', 'H', 'E', ' ', 'Q', 'U', 'I', 'C', 'K', ' ', 'B', 'R', 'O', 'W', 'N', ' ',
+	'F', 'O', 'X', ' ', 'J', 'U', 'M', 'P', 'S', ' ', 0x00dc, 'B', 'E', 'R', ' ',
+	'T', 'H', 'E', ' ', 'D', 'O', 'G', '.', 0 };
+
+libuna_utf32_character_t una_test_string_compare_utf32_folded_string[ 40 ] = {
+	't', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 0x212a, ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 0x017f, ' ', 0x00fc, 'b', 'e', 'r', ' ',
+	't', 'h', 'e', ' ', 'd', 'o', 'g', '.', 0 };
+
+/* Tests the libuna_utf8_string_compare_with_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_compare_with_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 40 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		byte_stream[ string_index ] = (uint8_t) una_test_string_compare_utf16_string[ string_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_compare_with_byte_stream(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          byte_stream,
+	          40,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test empty strings
+	 */
+	result = libuna_utf8_string_compare_with_byte_stream(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          byte_stream,
+	          0,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_byte_stream(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          byte_stream,
+	          40,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_byte_stream(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          byte_stream,
+	          0,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_compare_with_byte_stream(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          NULL,
+	          40,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_string_compare_with_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_compare_with_utf16(
+     void )
+{
+	libuna_utf16_character_t utf16_string[ 40 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          una_test_string_compare_utf16_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that only differ in the end-of-string character
+	 */
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          40,
+	          una_test_string_compare_utf16_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings of a different length
+	 */
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          20,
+	          una_test_string_compare_utf16_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that differ in a single character at every position
+	 */
+	for( string_index = 0;
+	     string_index < 39;
+	     string_index++ )
+	{
+		memory_copy(
+		 utf16_string,
+		 una_test_string_compare_utf16_string,
+		 sizeof( libuna_utf16_character_t ) * 40 );
+
+		utf16_string[ string_index ] = 'X';
+
+		result = libuna_utf8_string_compare_with_utf16(
+		          una_test_string_compare_utf8_string,
+		          41,
+		          utf16_string,
+		          40,
+		          &error );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test empty strings
+	 */
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          una_test_string_compare_utf16_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          una_test_string_compare_utf16_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          una_test_string_compare_utf16_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_compare_with_utf16(
+	          NULL,
+	          41,
+	          una_test_string_compare_utf16_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          NULL,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_string_compare_with_utf32 function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_string_compare_with_utf32(
+     void )
+{
+	libuna_utf32_character_t utf32_string[ 40 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		utf32_string[ string_index ] = una_test_string_compare_utf16_string[ string_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          40,
+	          utf32_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that only differ in the end-of-string character
+	 */
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          39,
+	          utf32_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that differ in a non-ASCII character
+	 */
+	utf32_string[ 26 ] = 0x000000fdUL;
+
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          40,
+	          utf32_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test empty strings
+	 */
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          0,
+	          utf32_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          0,
+	          utf32_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          40,
+	          utf32_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_string_compare_with_utf32(
+	          una_test_string_compare_utf16_string,
+	          40,
+	          NULL,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_string_compare_with_utf32_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_compare_with_utf32_stream(
+     void )
+{
+	uint8_t utf32_stream[ 164 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Create an UTF-32 big-endian stream with a byte order mark
+	 */
+	memory_set(
+	 utf32_stream,
+	 0,
+	 164 );
+
+	utf32_stream[ 2 ] = 0xfe;
+	utf32_stream[ 3 ] = 0xff;
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		utf32_stream[ ( string_index * 4 ) + 6 ] = (uint8_t) ( una_test_string_compare_utf16_string[ string_index ] >> 8 );
+		utf32_stream[ ( string_index * 4 ) + 7 ] = (uint8_t) ( una_test_string_compare_utf16_string[ string_index ] & 0xff );
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_compare_with_utf32_stream(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that differ in the last character
+	 */
+	utf32_stream[ 159 ] = '!';
+
+	result = libuna_utf8_string_compare_with_utf32_stream(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string with an empty stream, which only contains a byte order mark
+	 */
+	result = libuna_utf8_string_compare_with_utf32_stream(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          utf32_stream,
+	          4,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_utf32_stream(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_compare_with_utf32_stream(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          NULL,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_string_compare_with_utf16_case_insensitive function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_compare_with_utf16_case_insensitive(
+     void )
+{
+	libuna_utf16_character_t utf16_string[ 40 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the strings differ when compared case sensitive
+	 */
+	result = libuna_utf8_string_compare_with_utf16(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings of a different length
+	 */
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          20,
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that differ in a single character at every position
+	 */
+	for( string_index = 0;
+	     string_index < 39;
+	     string_index++ )
+	{
+		memory_copy(
+		 utf16_string,
+		 una_test_string_compare_utf16_upper_case_string,
+		 sizeof( libuna_utf16_character_t ) * 40 );
+
+		utf16_string[ string_index ] = '#';
+
+		result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+		          una_test_string_compare_utf8_string,
+		          41,
+		          utf16_string,
+		          40,
+		          &error );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test empty strings
+	 */
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          NULL,
+	          41,
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          NULL,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_string_compare_with_byte_stream_case_insensitive function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_compare_with_byte_stream_case_insensitive(
+     void )
+{
+	uint8_t byte_stream[ 40 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		byte_stream[ string_index ] = (uint8_t) una_test_string_compare_utf16_upper_case_string[ string_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          byte_stream,
+	          40,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test empty strings
+	 */
+	result = libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          byte_stream,
+	          0,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          0,
+	          byte_stream,
+	          40,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          byte_stream,
+	          0,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf8_string_compare_with_byte_stream_case_insensitive(
+	          una_test_string_compare_utf8_string,
+	          41,
+	          NULL,
+	          40,
+	          LIBUNA_CODEPAGE_ISO_8859_1,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_string_compare_with_utf32_case_insensitive function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_string_compare_with_utf32_case_insensitive(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          una_test_string_compare_utf32_folded_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_string,
+	          40,
+	          una_test_string_compare_utf32_folded_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings of a different length
+	 */
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          una_test_string_compare_utf32_folded_string,
+	          20,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test empty strings
+	 */
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          una_test_string_compare_utf32_folded_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          una_test_string_compare_utf32_folded_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          una_test_string_compare_utf32_folded_string,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          NULL,
+	          40,
+	          una_test_string_compare_utf32_folded_string,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          NULL,
+	          40,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf16_string_compare_with_utf32_stream_case_insensitive function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf16_string_compare_with_utf32_stream_case_insensitive(
+     void )
+{
+	uint8_t utf32_stream[ 164 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Create an UTF-32 big-endian stream with a byte order mark
+	 */
+	memory_set(
+	 utf32_stream,
+	 0,
+	 164 );
+
+	utf32_stream[ 2 ] = 0xfe;
+	utf32_stream[ 3 ] = 0xff;
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		utf32_stream[ ( string_index * 4 ) + 5 ] = (uint8_t) ( una_test_string_compare_utf32_folded_string[ string_index ] >> 16 );
+		utf32_stream[ ( string_index * 4 ) + 6 ] = (uint8_t) ( una_test_string_compare_utf32_folded_string[ string_index ] >> 8 );
+		utf32_stream[ ( string_index * 4 ) + 7 ] = (uint8_t) ( una_test_string_compare_utf32_folded_string[ string_index ] & 0xff );
+	}
+	/* Test regular cases
+	 */
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the strings differ when compared case sensitive
+	 */
+	result = libuna_utf16_string_compare_with_utf32_stream(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test strings that differ in the last character
+	 */
+	utf32_stream[ 159 ] = '!';
+
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string with an empty stream, which only contains a byte order mark
+	 */
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          utf32_stream,
+	          4,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          utf32_stream,
+	          4,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	UNA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          NULL,
+	          40,
+	          utf32_stream,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          40,
+	          NULL,
+	          164,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+	          una_test_string_compare_utf16_upper_case_string,
+	          0,
+	          utf32_stream,
+	          0,
+	          0,
+	          &error );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_compare_with_byte_stream",
+	 una_test_utf8_string_compare_with_byte_stream );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_compare_with_utf16",
+	 una_test_utf8_string_compare_with_utf16 );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_string_compare_with_utf32",
+	 una_test_utf16_string_compare_with_utf32 );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_compare_with_utf32_stream",
+	 una_test_utf8_string_compare_with_utf32_stream );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_compare_with_utf16_case_insensitive",
+	 una_test_utf8_string_compare_with_utf16_case_insensitive );
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_compare_with_byte_stream_case_insensitive",
+	 una_test_utf8_string_compare_with_byte_stream_case_insensitive );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_string_compare_with_utf32_case_insensitive",
+	 una_test_utf16_string_compare_with_utf32_case_insensitive );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_string_compare_with_utf32_stream_case_insensitive",
+	 una_test_utf16_string_compare_with_utf32_stream_case_insensitive );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
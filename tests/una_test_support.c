@@ -59,6 +59,91 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libuna_get_status_code_string function
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_get_status_code_string(
+     void )
+{
+	const char *status_code_string = NULL;
+	int result                     = 0;
+
+	status_code_string = libuna_get_status_code_string(
+	                      LIBUNA_STATUS_OK );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "status_code_string",
+	 status_code_string );
+
+	result = narrow_string_compare(
+	          status_code_string,
+	          "Success",
+	          8 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	status_code_string = libuna_get_status_code_string(
+	                      LIBUNA_STATUS_TRUNCATED_INPUT );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "status_code_string",
+	 status_code_string );
+
+	result = narrow_string_compare(
+	          status_code_string,
+	          "Truncated input",
+	          16 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	status_code_string = libuna_get_status_code_string(
+	                      LIBUNA_STATUS_OUTPUT_TOO_SMALL );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "status_code_string",
+	 status_code_string );
+
+	result = narrow_string_compare(
+	          status_code_string,
+	          "Output too small",
+	          17 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test an unsupported status code
+	 */
+	status_code_string = libuna_get_status_code_string(
+	                      -1 );
+
+	UNA_TEST_ASSERT_IS_NOT_NULL(
+	 "status_code_string",
+	 status_code_string );
+
+	result = narrow_string_compare(
+	          status_code_string,
+	          "Unknown status code",
+	          20 );
+
+	UNA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -78,6 +163,10 @@ int main(
 	 "libuna_get_version",
 	 una_test_get_version );
 
+	UNA_TEST_RUN(
+	 "libuna_get_status_code_string",
+	 una_test_get_status_code_string );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,2090 @@
+/*
+ * Library 7-bit ASCII transcode functions test program
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "una_test_libcerror.h"
+#include "una_test_libuna.h"
+#include "una_test_macros.h"
+#include "una_test_unused.h"
+
+/* The strings are converted by the 7-bit ASCII transcode functions, that
+ * process 16, 32 or 64 bytes per iteration, and compared with the strings
+ * converted one Unicode character at a time. The lengths are longer than
+ * 64 bytes and mostly odd so that the tail is handled as well, a run of
+ * non-ASCII characters starts at every index so that it falls on every block edge
+ */
+#define UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS	258
+
+size_t una_test_transcode_numbers_of_characters[ 8 ] = {
+	65, 67, 96, 127, 128, 131, 200, 257 };
+
+libuna_unicode_character_t una_test_transcode_non_ascii_characters[ 3 ] = {
+	0x000000e9, 0x000020ac, 0x0001f600 };
+
+/* ASCII characters that only differ in bit 5 but are not letters
+ */
+libuna_unicode_character_t una_test_transcode_case_neighbour_characters[ 3 ] = {
+	'@', '[', ']' };
+
+libuna_unicode_character_t una_test_transcode_lower_case_neighbour_characters[ 3 ] = {
+	'`', '{', '}' };
+
+typedef struct una_test_transcode_text una_test_transcode_text_t;
+
+struct una_test_transcode_text
+{
+	/* The Unicode characters including the end-of-string character
+	 */
+	libuna_unicode_character_t unicode_characters[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS ];
+
+	/* The number of Unicode characters including the end-of-string character
+	 */
+	size_t number_of_unicode_characters;
+
+	/* The UTF-8 string including the end-of-string character
+	 */
+	libuna_utf8_character_t utf8_string[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4 ];
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+
+	/* The UTF-16 string including the end-of-string character
+	 */
+	libuna_utf16_character_t utf16_string[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 2 ];
+
+	/* The UTF-16 string size
+	 */
+	size_t utf16_string_size;
+
+	/* The UTF-32 string including the end-of-string character
+	 */
+	libuna_utf32_character_t utf32_string[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS ];
+
+	/* The UTF-32 string size
+	 */
+	size_t utf32_string_size;
+
+	/* The UTF-7 stream without the end-of-string character
+	 */
+	uint8_t utf7_stream[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 8 ];
+
+	/* The UTF-7 stream size
+	 */
+	size_t utf7_stream_size;
+
+	/* Value to indicate the UTF-7 stream can be decoded one Unicode character at a time
+	 */
+	int utf7_stream_is_decodable;
+
+	/* The big-endian UTF-16 stream without byte order mark and end-of-string character
+	 */
+	uint8_t utf16_stream[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4 ];
+
+	/* The UTF-16 stream size
+	 */
+	size_t utf16_stream_size;
+
+	/* The little-endian UTF-32 stream without byte order mark and end-of-string character
+	 */
+	uint8_t utf32_stream[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4 ];
+
+	/* The UTF-32 stream size
+	 */
+	size_t utf32_stream_size;
+
+	/* The ISO 8859-1 byte stream without end-of-string character
+	 * or 0 if the text cannot be represented in ISO 8859-1
+	 */
+	uint8_t byte_stream[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS ];
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+};
+
+una_test_transcode_text_t una_test_transcode_text;
+una_test_transcode_text_t una_test_transcode_upper_case_text;
+una_test_transcode_text_t una_test_transcode_ascii_text;
+una_test_transcode_text_t una_test_transcode_case_neighbour_text;
+una_test_transcode_text_t una_test_transcode_lower_case_neighbour_text;
+
+/* Buffers for the converted strings and streams
+ */
+libuna_utf8_character_t una_test_transcode_utf8_string[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4 ];
+libuna_utf16_character_t una_test_transcode_utf16_string[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 2 ];
+libuna_utf32_character_t una_test_transcode_utf32_string[ UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS ];
+uint8_t una_test_transcode_stream[ ( UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS + 1 ) * 4 ];
+uint8_t una_test_transcode_expected_stream[ ( UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS + 1 ) * 4 ];
+
+/* Initializes a text of ASCII characters with an optional run of 3 other characters
+ * The representations are encoded one Unicode character at a time
+ * Returns 1 if successful or -1 on error
+ */
+int una_test_transcode_text_initialize(
+     una_test_transcode_text_t *text,
+     size_t number_of_characters,
+     size_t run_index,
+     const libuna_unicode_character_t *run_characters,
+     int upper_case,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_index                       = 0;
+	size_t byte_stream_index                     = 0;
+	size_t utf16_stream_index                    = 0;
+	size_t utf32_stream_index                    = 0;
+	size_t utf7_stream_index                     = 0;
+	uint32_t utf7_stream_base64_data             = 0;
+	int result                                   = 0;
+
+	if( ( number_of_characters + 1 ) > UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS )
+	{
+		return( -1 );
+	}
+	text->utf8_string_size  = 0;
+	text->utf16_string_size = 0;
+	text->utf32_string_size = 0;
+	text->utf7_stream_size  = 0;
+	text->byte_stream_size  = 0;
+
+	for( character_index = 0;
+	     character_index <= number_of_characters;
+	     character_index++ )
+	{
+		if( character_index == number_of_characters )
+		{
+			unicode_character = 0;
+		}
+		else if( ( character_index >= run_index )
+		      && ( character_index < ( run_index + 3 ) ) )
+		{
+			unicode_character = run_characters[ character_index - run_index ];
+		}
+		else
+		{
+			/* Use the printable ASCII characters except for \ and ~
+			 * that are base64 encoded in UTF-7
+			 */
+			unicode_character = (libuna_unicode_character_t) ( ' ' + ( ( character_index * 37 ) % 95 ) );
+
+			if( unicode_character == (libuna_unicode_character_t) '\\' )
+			{
+				unicode_character = (libuna_unicode_character_t) '/';
+			}
+			else if( unicode_character == (libuna_unicode_character_t) '~' )
+			{
+				unicode_character = (libuna_unicode_character_t) '-';
+			}
+			else if( ( upper_case != 0 )
+			      && ( unicode_character >= (libuna_unicode_character_t) 'a' )
+			      && ( unicode_character <= (libuna_unicode_character_t) 'z' ) )
+			{
+				unicode_character -= (libuna_unicode_character_t) 'a' - 'A';
+			}
+			else if( ( upper_case == 0 )
+			      && ( unicode_character >= (libuna_unicode_character_t) 'A' )
+			      && ( unicode_character <= (libuna_unicode_character_t) 'Z' ) )
+			{
+				unicode_character += (libuna_unicode_character_t) 'a' - 'A';
+			}
+		}
+		text->unicode_characters[ character_index ] = unicode_character;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     text->utf8_string,
+		     UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4,
+		     &( text->utf8_string_size ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_to_utf16(
+		     unicode_character,
+		     text->utf16_string,
+		     UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 2,
+		     &( text->utf16_string_size ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_to_utf32(
+		     unicode_character,
+		     text->utf32_string,
+		     UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS,
+		     &( text->utf32_string_size ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( character_index == number_of_characters )
+		{
+			break;
+		}
+		if( libuna_unicode_character_copy_to_utf16_stream(
+		     unicode_character,
+		     text->utf16_stream,
+		     UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4,
+		     &utf16_stream_index,
+		     LIBUNA_ENDIAN_BIG,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_to_utf32_stream(
+		     unicode_character,
+		     text->utf32_stream,
+		     UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 4,
+		     &utf32_stream_index,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( unicode_character <= 0xff )
+		{
+			text->byte_stream[ byte_stream_index++ ] = (uint8_t) unicode_character;
+		}
+	}
+	text->number_of_unicode_characters = number_of_characters + 1;
+	text->utf16_stream_size            = utf16_stream_index;
+	text->utf32_stream_size            = utf32_stream_index;
+
+	if( byte_stream_index == number_of_characters )
+	{
+		text->byte_stream_size = byte_stream_index;
+	}
+	/* UTF-7 is encoded one Unicode character at a time
+	 */
+	result = libuna_utf7_stream_size_from_utf32(
+	          text->utf32_string,
+	          text->utf32_string_size - 1,
+	          &( text->utf7_stream_size ),
+	          error );
+
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( text->utf7_stream_size > ( UNA_TEST_TRANSCODE_MAXIMUM_NUMBER_OF_CHARACTERS * 8 ) )
+	{
+		return( -1 );
+	}
+	result = libuna_utf7_stream_copy_from_utf32(
+	          text->utf7_stream,
+	          text->utf7_stream_size,
+	          text->utf32_string,
+	          text->utf32_string_size - 1,
+	          error );
+
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	/* A base64 encoded run that does not end on a 24-bit boundary
+	 * is not decoded correctly one Unicode character at a time
+	 */
+	text->utf7_stream_is_decodable = 1;
+
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		result = libuna_unicode_character_copy_from_utf7_stream(
+		          &unicode_character,
+		          text->utf7_stream,
+		          text->utf7_stream_size,
+		          &utf7_stream_index,
+		          &utf7_stream_base64_data,
+		          NULL );
+
+		if( ( result != 1 )
+		 || ( unicode_character != text->unicode_characters[ character_index ] ) )
+		{
+			text->utf7_stream_is_decodable = 0;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Initializes the test texts for a specific number of characters and non-ASCII character
+ * Returns 1 if successful or -1 on error
+ */
+int una_test_transcode_texts_initialize(
+     size_t number_of_characters,
+     size_t run_index,
+     libuna_unicode_character_t non_ascii_character,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t case_neighbour_characters[ 3 ];
+	libuna_unicode_character_t lower_case_neighbour_characters[ 3 ];
+	libuna_unicode_character_t non_ascii_characters[ 3 ];
+	int character_index = 0;
+
+	for( character_index = 0;
+	     character_index < 3;
+	     character_index++ )
+	{
+		non_ascii_characters[ character_index ]            = non_ascii_character;
+		case_neighbour_characters[ character_index ]       = una_test_transcode_case_neighbour_characters[ run_index % 3 ];
+		lower_case_neighbour_characters[ character_index ] = una_test_transcode_lower_case_neighbour_characters[ run_index % 3 ];
+	}
+
+	if( una_test_transcode_text_initialize(
+	     &una_test_transcode_text,
+	     number_of_characters,
+	     run_index,
+	     non_ascii_characters,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( una_test_transcode_text_initialize(
+	     &una_test_transcode_upper_case_text,
+	     number_of_characters,
+	     run_index,
+	     non_ascii_characters,
+	     1,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( una_test_transcode_text_initialize(
+	     &una_test_transcode_ascii_text,
+	     number_of_characters,
+	     number_of_characters,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( una_test_transcode_text_initialize(
+	     &una_test_transcode_case_neighbour_text,
+	     number_of_characters,
+	     run_index,
+	     case_neighbour_characters,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( una_test_transcode_text_initialize(
+	     &una_test_transcode_lower_case_neighbour_text,
+	     number_of_characters,
+	     run_index,
+	     lower_case_neighbour_characters,
+	     1,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the UTF-8 string size and copy from functions with a text
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf8_string_copy_from_text(
+     una_test_transcode_text_t *text )
+{
+	libcerror_error_t *error = NULL;
+	size_t error_offset      = 0;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+	int source_format        = 0;
+
+	for( source_format = 0;
+	     source_format < 8;
+	     source_format++ )
+	{
+		utf8_string_size = 0;
+
+		switch( source_format )
+		{
+			case 0:
+				if( text->utf7_stream_is_decodable == 0 )
+				{
+					continue;
+				}
+				result = libuna_utf8_string_size_from_utf7_stream(
+				          text->utf7_stream,
+				          text->utf7_stream_size,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf8_string_size_from_utf8_stream(
+				          (uint8_t *) text->utf8_string,
+				          text->utf8_string_size - 1,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf8_string_size_from_utf16(
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf8_string_size_from_utf16_stream(
+				          text->utf16_stream,
+				          text->utf16_stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf8_string_size_from_utf32(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_utf8_string_size_from_utf32_stream(
+				          text->utf32_stream,
+				          text->utf32_stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 6:
+				if( text->byte_stream_size == 0 )
+				{
+					continue;
+				}
+				result = libuna_utf8_string_size_from_byte_stream(
+				          text->byte_stream,
+				          text->byte_stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &utf8_string_size,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_utf8_string_size_from_utf32_with_status(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &utf8_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		UNA_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 text->utf8_string_size );
+
+		if( memory_set(
+		     una_test_transcode_utf8_string,
+		     0xff,
+		     sizeof( una_test_transcode_utf8_string ) ) == NULL )
+		{
+			goto on_error;
+		}
+		switch( source_format )
+		{
+			case 0:
+				result = libuna_utf8_string_copy_from_utf7_stream(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->utf7_stream,
+				          text->utf7_stream_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf8_string_copy_from_utf8_stream(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          (uint8_t *) text->utf8_string,
+				          text->utf8_string_size - 1,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf8_string_copy_from_utf16(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf8_string_copy_from_utf16_stream(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->utf16_stream,
+				          text->utf16_stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf8_string_copy_from_utf32(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_utf8_string_copy_from_utf32_stream(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->utf32_stream,
+				          text->utf32_stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          &error );
+				break;
+
+			case 6:
+				result = libuna_utf8_string_copy_from_byte_stream(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->byte_stream,
+				          text->byte_stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_utf8_string_copy_from_utf32_with_status(
+				          una_test_transcode_utf8_string,
+				          utf8_string_size,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          una_test_transcode_utf8_string,
+		          text->utf8_string,
+		          sizeof( libuna_utf8_character_t ) * text->utf8_string_size );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "source format: %d, number of characters: %" PRIzd "\n",
+	 source_format,
+	 text->number_of_unicode_characters );
+
+	return( 0 );
+}
+
+/* Tests the UTF-16 string size and copy from functions with a text
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf16_string_copy_from_text(
+     una_test_transcode_text_t *text )
+{
+	libcerror_error_t *error = NULL;
+	size_t error_offset      = 0;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+	int source_format        = 0;
+
+	for( source_format = 0;
+	     source_format < 8;
+	     source_format++ )
+	{
+		utf16_string_size = 0;
+
+		switch( source_format )
+		{
+			case 0:
+				if( text->utf7_stream_is_decodable == 0 )
+				{
+					continue;
+				}
+				result = libuna_utf16_string_size_from_utf7_stream(
+				          text->utf7_stream,
+				          text->utf7_stream_size,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf16_string_size_from_utf8(
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf16_string_size_from_utf8_stream(
+				          (uint8_t *) text->utf8_string,
+				          text->utf8_string_size - 1,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf16_string_size_from_utf16_stream(
+				          text->utf16_stream,
+				          text->utf16_stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf16_string_size_from_utf32(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_utf16_string_size_from_utf32_stream(
+				          text->utf32_stream,
+				          text->utf32_stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 6:
+				if( text->byte_stream_size == 0 )
+				{
+					continue;
+				}
+				result = libuna_utf16_string_size_from_byte_stream(
+				          text->byte_stream,
+				          text->byte_stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &utf16_string_size,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_utf16_string_size_from_utf32_with_status(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &utf16_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		UNA_TEST_ASSERT_EQUAL_SIZE(
+		 "utf16_string_size",
+		 utf16_string_size,
+		 text->utf16_string_size );
+
+		if( memory_set(
+		     una_test_transcode_utf16_string,
+		     0xff,
+		     sizeof( una_test_transcode_utf16_string ) ) == NULL )
+		{
+			goto on_error;
+		}
+		switch( source_format )
+		{
+			case 0:
+				result = libuna_utf16_string_copy_from_utf7_stream(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->utf7_stream,
+				          text->utf7_stream_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf16_string_copy_from_utf8(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf16_string_copy_from_utf8_stream(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          (uint8_t *) text->utf8_string,
+				          text->utf8_string_size - 1,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf16_string_copy_from_utf16_stream(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->utf16_stream,
+				          text->utf16_stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf16_string_copy_from_utf32(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_utf16_string_copy_from_utf32_stream(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->utf32_stream,
+				          text->utf32_stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          &error );
+				break;
+
+			case 6:
+				result = libuna_utf16_string_copy_from_byte_stream(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->byte_stream,
+				          text->byte_stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_utf16_string_copy_from_utf32_with_status(
+				          una_test_transcode_utf16_string,
+				          utf16_string_size,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          una_test_transcode_utf16_string,
+		          text->utf16_string,
+		          sizeof( libuna_utf16_character_t ) * text->utf16_string_size );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "source format: %d, number of characters: %" PRIzd "\n",
+	 source_format,
+	 text->number_of_unicode_characters );
+
+	return( 0 );
+}
+
+/* Tests the UTF-32 string size and copy from functions with a text
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf32_string_copy_from_text(
+     una_test_transcode_text_t *text )
+{
+	libcerror_error_t *error = NULL;
+	size_t error_offset      = 0;
+	size_t utf32_string_size = 0;
+	int result               = 0;
+	int source_format        = 0;
+
+	for( source_format = 0;
+	     source_format < 9;
+	     source_format++ )
+	{
+		utf32_string_size = 0;
+
+		switch( source_format )
+		{
+			case 0:
+				if( text->utf7_stream_is_decodable == 0 )
+				{
+					continue;
+				}
+				result = libuna_utf32_string_size_from_utf7_stream(
+				          text->utf7_stream,
+				          text->utf7_stream_size,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf32_string_size_from_utf8(
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf32_string_size_from_utf8_stream(
+				          (uint8_t *) text->utf8_string,
+				          text->utf8_string_size - 1,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf32_string_size_from_utf16(
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf32_string_size_from_utf16_stream(
+				          text->utf16_stream,
+				          text->utf16_stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_utf32_string_size_from_utf32_stream(
+				          text->utf32_stream,
+				          text->utf32_stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 6:
+				if( text->byte_stream_size == 0 )
+				{
+					continue;
+				}
+				result = libuna_utf32_string_size_from_byte_stream(
+				          text->byte_stream,
+				          text->byte_stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &utf32_string_size,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_utf32_string_size_from_utf8_with_status(
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &utf32_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+
+			case 8:
+				result = libuna_utf32_string_size_from_utf16_with_status(
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &utf32_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		UNA_TEST_ASSERT_EQUAL_SIZE(
+		 "utf32_string_size",
+		 utf32_string_size,
+		 text->utf32_string_size );
+
+		if( memory_set(
+		     una_test_transcode_utf32_string,
+		     0xff,
+		     sizeof( una_test_transcode_utf32_string ) ) == NULL )
+		{
+			goto on_error;
+		}
+		switch( source_format )
+		{
+			case 0:
+				result = libuna_utf32_string_copy_from_utf7_stream(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf7_stream,
+				          text->utf7_stream_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf32_string_copy_from_utf8(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf32_string_copy_from_utf8_stream(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          (uint8_t *) text->utf8_string,
+				          text->utf8_string_size - 1,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf32_string_copy_from_utf16(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf32_string_copy_from_utf16_stream(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf16_stream,
+				          text->utf16_stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_utf32_string_copy_from_utf32_stream(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf32_stream,
+				          text->utf32_stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          &error );
+				break;
+
+			case 6:
+				result = libuna_utf32_string_copy_from_byte_stream(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->byte_stream,
+				          text->byte_stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_utf32_string_copy_from_utf8_with_status(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+
+			case 8:
+				result = libuna_utf32_string_copy_from_utf16_with_status(
+				          una_test_transcode_utf32_string,
+				          utf32_string_size,
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &error_offset );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 LIBUNA_STATUS_OK );
+
+				result = 1;
+
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          una_test_transcode_utf32_string,
+		          text->utf32_string,
+		          sizeof( libuna_utf32_character_t ) * text->utf32_string_size );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "source format: %d, number of characters: %" PRIzd "\n",
+	 source_format,
+	 text->number_of_unicode_characters );
+
+	return( 0 );
+}
+
+/* Tests the stream size and copy from functions with a text
+ * The streams are compared with the byte order mark, the encoded characters
+ * and the end-of-string character
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_stream_copy_from_text(
+     una_test_transcode_text_t *text )
+{
+	libcerror_error_t *error    = NULL;
+	size_t expected_stream_size = 0;
+	size_t stream_size          = 0;
+	int result                  = 0;
+	int source_format           = 0;
+
+	for( source_format = 0;
+	     source_format < 8;
+	     source_format++ )
+	{
+		/* Determine the expected stream
+		 */
+		switch( source_format )
+		{
+			case 0:
+				una_test_transcode_expected_stream[ 0 ] = 0xef;
+				una_test_transcode_expected_stream[ 1 ] = 0xbb;
+				una_test_transcode_expected_stream[ 2 ] = 0xbf;
+
+				if( memory_copy(
+				     &( una_test_transcode_expected_stream[ 3 ] ),
+				     text->utf8_string,
+				     text->utf8_string_size ) == NULL )
+				{
+					goto on_error;
+				}
+				expected_stream_size = 3 + text->utf8_string_size;
+
+				break;
+
+			case 1:
+			case 2:
+				una_test_transcode_expected_stream[ 0 ] = 0xfe;
+				una_test_transcode_expected_stream[ 1 ] = 0xff;
+
+				if( memory_copy(
+				     &( una_test_transcode_expected_stream[ 2 ] ),
+				     text->utf16_stream,
+				     text->utf16_stream_size ) == NULL )
+				{
+					goto on_error;
+				}
+				expected_stream_size = 2 + text->utf16_stream_size;
+
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+
+				break;
+
+			case 3:
+			case 4:
+				una_test_transcode_expected_stream[ 0 ] = 0xff;
+				una_test_transcode_expected_stream[ 1 ] = 0xfe;
+				una_test_transcode_expected_stream[ 2 ] = 0;
+				una_test_transcode_expected_stream[ 3 ] = 0;
+
+				if( memory_copy(
+				     &( una_test_transcode_expected_stream[ 4 ] ),
+				     text->utf32_stream,
+				     text->utf32_stream_size ) == NULL )
+				{
+					goto on_error;
+				}
+				expected_stream_size = 4 + text->utf32_stream_size;
+
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+
+				break;
+
+			case 5:
+			case 6:
+			case 7:
+				if( text->byte_stream_size == 0 )
+				{
+					continue;
+				}
+				if( memory_copy(
+				     una_test_transcode_expected_stream,
+				     text->byte_stream,
+				     text->byte_stream_size ) == NULL )
+				{
+					goto on_error;
+				}
+				expected_stream_size = text->byte_stream_size;
+
+				una_test_transcode_expected_stream[ expected_stream_size++ ] = 0;
+
+				break;
+		}
+		stream_size = 0;
+
+		switch( source_format )
+		{
+			case 0:
+				result = libuna_utf8_stream_size_from_utf32(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf16_stream_size_from_utf8(
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf16_stream_size_from_utf32(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf32_stream_size_from_utf8(
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf32_stream_size_from_utf16(
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_byte_stream_size_from_utf8(
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 6:
+				result = libuna_byte_stream_size_from_utf16(
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &stream_size,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_byte_stream_size_from_utf32(
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          &stream_size,
+				          &error );
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		UNA_TEST_ASSERT_EQUAL_SIZE(
+		 "stream_size",
+		 stream_size,
+		 expected_stream_size );
+
+		if( memory_set(
+		     una_test_transcode_stream,
+		     0xff,
+		     sizeof( una_test_transcode_stream ) ) == NULL )
+		{
+			goto on_error;
+		}
+		switch( source_format )
+		{
+			case 0:
+				result = libuna_utf8_stream_copy_from_utf32(
+				          una_test_transcode_stream,
+				          stream_size,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error );
+				break;
+
+			case 1:
+				result = libuna_utf16_stream_copy_from_utf8(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &error );
+				break;
+
+			case 2:
+				result = libuna_utf16_stream_copy_from_utf32(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_ENDIAN_BIG,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error );
+				break;
+
+			case 3:
+				result = libuna_utf32_stream_copy_from_utf8(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &error );
+				break;
+
+			case 4:
+				result = libuna_utf32_stream_copy_from_utf16(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_ENDIAN_LITTLE,
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &error );
+				break;
+
+			case 5:
+				result = libuna_byte_stream_copy_from_utf8(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          text->utf8_string,
+				          text->utf8_string_size,
+				          &error );
+				break;
+
+			case 6:
+				result = libuna_byte_stream_copy_from_utf16(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          text->utf16_string,
+				          text->utf16_string_size,
+				          &error );
+				break;
+
+			case 7:
+				result = libuna_byte_stream_copy_from_utf32(
+				          una_test_transcode_stream,
+				          stream_size,
+				          LIBUNA_CODEPAGE_ISO_8859_1,
+				          text->utf32_string,
+				          text->utf32_string_size,
+				          &error );
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          una_test_transcode_stream,
+		          una_test_transcode_expected_stream,
+		          expected_stream_size );
+
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "source format: %d, number of characters: %" PRIzd "\n",
+	 source_format,
+	 text->number_of_unicode_characters );
+
+	return( 0 );
+}
+
+/* Compares a string with the different representations of another text
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_string_compare_with_text(
+     una_test_transcode_text_t *string_text,
+     una_test_transcode_text_t *text,
+     int case_insensitive,
+     int expected_result )
+{
+	libcerror_error_t *error = NULL;
+	int compare_function     = 0;
+	int result               = 0;
+
+	for( compare_function = 0;
+	     compare_function < 12;
+	     compare_function++ )
+	{
+		switch( compare_function )
+		{
+			case 0:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf8_string_compare_with_utf16(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf16_string,
+					          text->utf16_string_size,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf8_string_compare_with_utf16_case_insensitive(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf16_string,
+					          text->utf16_string_size,
+					          &error );
+				}
+				break;
+
+			case 1:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf8_string_compare_with_utf16_stream(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf16_stream,
+					          text->utf16_stream_size,
+					          LIBUNA_ENDIAN_BIG,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf8_string_compare_with_utf16_stream_case_insensitive(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf16_stream,
+					          text->utf16_stream_size,
+					          LIBUNA_ENDIAN_BIG,
+					          &error );
+				}
+				break;
+
+			case 2:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf8_string_compare_with_utf32(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf32_string,
+					          text->utf32_string_size,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf8_string_compare_with_utf32_case_insensitive(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf32_string,
+					          text->utf32_string_size,
+					          &error );
+				}
+				break;
+
+			case 3:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf8_string_compare_with_utf32_stream(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf32_stream,
+					          text->utf32_stream_size,
+					          LIBUNA_ENDIAN_LITTLE,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf8_string_compare_with_utf32_stream_case_insensitive(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          text->utf32_stream,
+					          text->utf32_stream_size,
+					          LIBUNA_ENDIAN_LITTLE,
+					          &error );
+				}
+				break;
+
+			case 4:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf8_string_compare_with_utf8_stream(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          (uint8_t *) text->utf8_string,
+					          text->utf8_string_size - 1,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf8_string_compare_with_utf8_stream_case_insensitive(
+					          string_text->utf8_string,
+					          string_text->utf8_string_size,
+					          (uint8_t *) text->utf8_string,
+					          text->utf8_string_size - 1,
+					          &error );
+				}
+				break;
+
+			case 5:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf16_string_compare_with_utf16_stream(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          text->utf16_stream,
+					          text->utf16_stream_size,
+					          LIBUNA_ENDIAN_BIG,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf16_string_compare_with_utf16_stream_case_insensitive(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          text->utf16_stream,
+					          text->utf16_stream_size,
+					          LIBUNA_ENDIAN_BIG,
+					          &error );
+				}
+				break;
+
+			case 6:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf16_string_compare_with_utf32(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          text->utf32_string,
+					          text->utf32_string_size,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf16_string_compare_with_utf32_case_insensitive(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          text->utf32_string,
+					          text->utf32_string_size,
+					          &error );
+				}
+				break;
+
+			case 7:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf16_string_compare_with_utf32_stream(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          text->utf32_stream,
+					          text->utf32_stream_size,
+					          LIBUNA_ENDIAN_LITTLE,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf16_string_compare_with_utf32_stream_case_insensitive(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          text->utf32_stream,
+					          text->utf32_stream_size,
+					          LIBUNA_ENDIAN_LITTLE,
+					          &error );
+				}
+				break;
+
+			case 8:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf16_string_compare_with_utf8_stream(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          (uint8_t *) text->utf8_string,
+					          text->utf8_string_size - 1,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf16_string_compare_with_utf8_stream_case_insensitive(
+					          string_text->utf16_string,
+					          string_text->utf16_string_size,
+					          (uint8_t *) text->utf8_string,
+					          text->utf8_string_size - 1,
+					          &error );
+				}
+				break;
+
+			case 9:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf32_string_compare_with_utf16_stream(
+					          string_text->utf32_string,
+					          string_text->utf32_string_size,
+					          text->utf16_stream,
+					          text->utf16_stream_size,
+					          LIBUNA_ENDIAN_BIG,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf32_string_compare_with_utf16_stream_case_insensitive(
+					          string_text->utf32_string,
+					          string_text->utf32_string_size,
+					          text->utf16_stream,
+					          text->utf16_stream_size,
+					          LIBUNA_ENDIAN_BIG,
+					          &error );
+				}
+				break;
+
+			case 10:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf32_string_compare_with_utf32_stream(
+					          string_text->utf32_string,
+					          string_text->utf32_string_size,
+					          text->utf32_stream,
+					          text->utf32_stream_size,
+					          LIBUNA_ENDIAN_LITTLE,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf32_string_compare_with_utf32_stream_case_insensitive(
+					          string_text->utf32_string,
+					          string_text->utf32_string_size,
+					          text->utf32_stream,
+					          text->utf32_stream_size,
+					          LIBUNA_ENDIAN_LITTLE,
+					          &error );
+				}
+				break;
+
+			case 11:
+				if( case_insensitive == 0 )
+				{
+					result = libuna_utf32_string_compare_with_utf8_stream(
+					          string_text->utf32_string,
+					          string_text->utf32_string_size,
+					          (uint8_t *) text->utf8_string,
+					          text->utf8_string_size - 1,
+					          &error );
+				}
+				else
+				{
+					result = libuna_utf32_string_compare_with_utf8_stream_case_insensitive(
+					          string_text->utf32_string,
+					          string_text->utf32_string_size,
+					          (uint8_t *) text->utf8_string,
+					          text->utf8_string_size - 1,
+					          &error );
+				}
+				break;
+		}
+		UNA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_result );
+
+		UNA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "compare function: %d, number of characters: %" PRIzd "\n",
+	 compare_function,
+	 text->number_of_unicode_characters );
+
+	return( 0 );
+}
+
+/* Tests the transcode functions with all the texts
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_texts(
+     int (*test_function)(
+            void ) )
+{
+	libcerror_error_t *error            = NULL;
+	size_t non_ascii_character_index    = 0;
+	size_t number_of_characters         = 0;
+	int non_ascii_character_array_index = 0;
+	int number_of_characters_index      = 0;
+	int result                          = 0;
+
+	for( number_of_characters_index = 0;
+	     number_of_characters_index < 8;
+	     number_of_characters_index++ )
+	{
+		number_of_characters = una_test_transcode_numbers_of_characters[ number_of_characters_index ];
+
+		for( non_ascii_character_array_index = 0;
+		     non_ascii_character_array_index < 3;
+		     non_ascii_character_array_index++ )
+		{
+			/* A non-ASCII character index equal to the number of characters
+			 * results in a text of only ASCII characters
+			 */
+			for( non_ascii_character_index = 0;
+			     non_ascii_character_index <= number_of_characters;
+			     non_ascii_character_index++ )
+			{
+				result = una_test_transcode_texts_initialize(
+				          number_of_characters,
+				          non_ascii_character_index,
+				          una_test_transcode_non_ascii_characters[ non_ascii_character_array_index ],
+				          &error );
+
+				UNA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				UNA_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = test_function();
+
+				if( result != 1 )
+				{
+					fprintf(
+					 stdout,
+					 "non-ASCII character: U+%04" PRIx32 " at index: %" PRIzd "\n",
+					 una_test_transcode_non_ascii_characters[ non_ascii_character_array_index ],
+					 non_ascii_character_index );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libuna_utf8_string_size_from_ and libuna_utf8_string_copy_from_ functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf8_string_copy_from_function(
+     void )
+{
+	return( una_test_transcode_utf8_string_copy_from_text(
+	         &una_test_transcode_text ) );
+}
+
+/* Tests the libuna_utf16_string_size_from_ and libuna_utf16_string_copy_from_ functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf16_string_copy_from_function(
+     void )
+{
+	return( una_test_transcode_utf16_string_copy_from_text(
+	         &una_test_transcode_text ) );
+}
+
+/* Tests the libuna_utf32_string_size_from_ and libuna_utf32_string_copy_from_ functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf32_string_copy_from_function(
+     void )
+{
+	return( una_test_transcode_utf32_string_copy_from_text(
+	         &una_test_transcode_text ) );
+}
+
+/* Tests the stream size_from and copy_from functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_stream_copy_from_function(
+     void )
+{
+	return( una_test_transcode_stream_copy_from_text(
+	         &una_test_transcode_text ) );
+}
+
+/* Tests the string compare functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_string_compare_function(
+     void )
+{
+	int expected_result = 1;
+
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_text,
+	     &una_test_transcode_text,
+	     0,
+	     1 ) != 1 )
+	{
+		return( 0 );
+	}
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_text,
+	     &una_test_transcode_upper_case_text,
+	     1,
+	     1 ) != 1 )
+	{
+		return( 0 );
+	}
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_upper_case_text,
+	     &una_test_transcode_text,
+	     1,
+	     1 ) != 1 )
+	{
+		return( 0 );
+	}
+	/* The text with a non-ASCII character differs from the ASCII text
+	 */
+	if( memory_compare(
+	     una_test_transcode_text.unicode_characters,
+	     una_test_transcode_ascii_text.unicode_characters,
+	     sizeof( libuna_unicode_character_t ) * una_test_transcode_text.number_of_unicode_characters ) != 0 )
+	{
+		expected_result = 0;
+	}
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_text,
+	     &una_test_transcode_ascii_text,
+	     0,
+	     expected_result ) != 1 )
+	{
+		return( 0 );
+	}
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_ascii_text,
+	     &una_test_transcode_text,
+	     0,
+	     expected_result ) != 1 )
+	{
+		return( 0 );
+	}
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_ascii_text,
+	     &una_test_transcode_upper_case_text,
+	     1,
+	     expected_result ) != 1 )
+	{
+		return( 0 );
+	}
+	/* Characters that only differ in bit 5 but are not letters are not equal
+	 * when compared case insensitive
+	 */
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_case_neighbour_text,
+	     &una_test_transcode_lower_case_neighbour_text,
+	     1,
+	     expected_result ) != 1 )
+	{
+		return( 0 );
+	}
+	if( una_test_transcode_string_compare_with_text(
+	     &una_test_transcode_lower_case_neighbour_text,
+	     &una_test_transcode_case_neighbour_text,
+	     1,
+	     expected_result ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the UTF-8 string size and copy from functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf8_string_copy_from(
+     void )
+{
+	return( una_test_transcode_texts(
+	         &una_test_transcode_utf8_string_copy_from_function ) );
+}
+
+/* Tests the UTF-16 string size and copy from functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf16_string_copy_from(
+     void )
+{
+	return( una_test_transcode_texts(
+	         &una_test_transcode_utf16_string_copy_from_function ) );
+}
+
+/* Tests the UTF-32 string size and copy from functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_utf32_string_copy_from(
+     void )
+{
+	return( una_test_transcode_texts(
+	         &una_test_transcode_utf32_string_copy_from_function ) );
+}
+
+/* Tests the stream size and copy from functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_stream_copy_from(
+     void )
+{
+	return( una_test_transcode_texts(
+	         &una_test_transcode_stream_copy_from_function ) );
+}
+
+/* Tests the string compare functions
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_transcode_string_compare(
+     void )
+{
+	return( una_test_transcode_texts(
+	         &una_test_transcode_string_compare_function ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc UNA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] UNA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	UNA_TEST_UNREFERENCED_PARAMETER( argc )
+	UNA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	UNA_TEST_RUN(
+	 "libuna_utf8_string_copy_from",
+	 una_test_transcode_utf8_string_copy_from );
+
+	UNA_TEST_RUN(
+	 "libuna_utf16_string_copy_from",
+	 una_test_transcode_utf16_string_copy_from );
+
+	UNA_TEST_RUN(
+	 "libuna_utf32_string_copy_from",
+	 una_test_transcode_utf32_string_copy_from );
+
+	UNA_TEST_RUN(
+	 "libuna_stream_copy_from",
+	 una_test_transcode_stream_copy_from );
+
+	UNA_TEST_RUN(
+	 "libuna_string_compare",
+	 una_test_transcode_string_compare );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
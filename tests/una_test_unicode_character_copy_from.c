@@ -155,6 +155,188 @@ int una_test_unicode_character_copy_from_byte_stream(
 	return( result );
 }
 
+/* U+1F600 as an UTF-16 surrogate pair
+ */
+libuna_utf16_character_t una_test_utf16_surrogate_pair_string[ 2 ] = {
+	0xd83d, 0xde00 };
+
+uint8_t una_test_utf16be_surrogate_pair_stream[ 4 ] = {
+	0xd8, 0x3d, 0xde, 0x00 };
+
+uint8_t una_test_utf16le_surrogate_pair_stream[ 4 ] = {
+	0x3d, 0xd8, 0x00, 0xde };
+
+/* U+1F600 followed by 'a' so that the base64 encoded run ends on a 24-bit boundary
+ */
+uint8_t una_test_utf7_surrogate_pair_stream[ 10 ] = {
+	'+', '2', 'D', '3', 'e', 'A', 'A', 'B', 'h', '-' };
+
+/* Prints the result of a test
+ */
+void una_test_unicode_character_copy_from_print_result(
+      int result,
+      libuna_error_t **error )
+{
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( result == -1 )
+	{
+		libuna_error_backtrace_fprint(
+		 *error,
+		 stderr );
+		libuna_error_free(
+		 error );
+	}
+}
+
+/* Tests copying an Unicode character from an UTF-16 string with a surrogate pair
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_unicode_character_copy_from_utf16(
+     void )
+{
+	libuna_error_t *error                        = NULL;
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	int result                                   = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying Unicode character from UTF-16 string with surrogate pair\t" );
+
+	result = libuna_unicode_character_copy_from_utf16(
+		  &unicode_character,
+		  una_test_utf16_surrogate_pair_string,
+		  2,
+		  &utf16_string_index,
+		  &error );
+
+	if( result == 1 )
+	{
+		if( ( unicode_character != 0x0001f600UL )
+		 || ( utf16_string_index != 2 ) )
+		{
+			result = 0;
+		}
+	}
+	una_test_unicode_character_copy_from_print_result(
+	 result,
+	 &error );
+
+	return( result );
+}
+
+/* Tests copying an Unicode character from an UTF-16 stream with a surrogate pair
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_unicode_character_copy_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     int byte_order )
+{
+	libuna_error_t *error                        = NULL;
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_stream_index                    = 0;
+	int result                                   = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying Unicode character from UTF-16 stream with surrogate pair and byte order: %c\t",
+	 (char) byte_order );
+
+	result = libuna_unicode_character_copy_from_utf16_stream(
+		  &unicode_character,
+		  utf16_stream,
+		  4,
+		  &utf16_stream_index,
+		  byte_order,
+		  &error );
+
+	if( result == 1 )
+	{
+		if( ( unicode_character != 0x0001f600UL )
+		 || ( utf16_stream_index != 4 ) )
+		{
+			result = 0;
+		}
+	}
+	una_test_unicode_character_copy_from_print_result(
+	 result,
+	 &error );
+
+	return( result );
+}
+
+/* Tests copying an Unicode character from an UTF-7 stream with a surrogate pair
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_unicode_character_copy_from_utf7_stream(
+     void )
+{
+	libuna_error_t *error                        = NULL;
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf7_stream_index                     = 0;
+	uint32_t utf7_stream_base64_data             = 0;
+	int result                                   = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying Unicode character from UTF-7 stream with surrogate pair\t" );
+
+	result = libuna_unicode_character_copy_from_utf7_stream(
+		  &unicode_character,
+		  una_test_utf7_surrogate_pair_stream,
+		  10,
+		  &utf7_stream_index,
+		  &utf7_stream_base64_data,
+		  &error );
+
+	if( result == 1 )
+	{
+		if( unicode_character != 0x0001f600UL )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libuna_unicode_character_copy_from_utf7_stream(
+			  &unicode_character,
+			  una_test_utf7_surrogate_pair_stream,
+			  10,
+			  &utf7_stream_index,
+			  &utf7_stream_base64_data,
+			  &error );
+
+		if( result == 1 )
+		{
+			if( ( unicode_character != (libuna_unicode_character_t) 'a' )
+			 || ( utf7_stream_index != 10 ) )
+			{
+				result = 0;
+			}
+		}
+	}
+	una_test_unicode_character_copy_from_print_result(
+	 result,
+	 &error );
+
+	return( result );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -589,6 +771,50 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* Case: UTF-16 string with surrogate pair
+	 */
+	if( una_test_unicode_character_copy_from_utf16() != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to Unicode character.\n" );
+
+		goto on_error;
+	}
+	/* Case: UTF-16 big-endian stream with surrogate pair
+	 */
+	if( una_test_unicode_character_copy_from_utf16_stream(
+	     una_test_utf16be_surrogate_pair_stream,
+	     LIBUNA_ENDIAN_BIG ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 big-endian stream to Unicode character.\n" );
+
+		goto on_error;
+	}
+	/* Case: UTF-16 little-endian stream with surrogate pair
+	 */
+	if( una_test_unicode_character_copy_from_utf16_stream(
+	     una_test_utf16le_surrogate_pair_stream,
+	     LIBUNA_ENDIAN_LITTLE ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 little-endian stream to Unicode character.\n" );
+
+		goto on_error;
+	}
+	/* Case: UTF-7 stream with surrogate pair
+	 */
+	if( una_test_unicode_character_copy_from_utf7_stream() != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-7 stream to Unicode character.\n" );
+
+		goto on_error;
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -629,6 +629,181 @@ int una_test_utf32_string_copy_from_utf8_string(
 	return( result );
 }
 
+/* Tests copying an UTF-32 string from an UTF-8 string in a single pass
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_utf32_string_with_index_copy_from_utf8_string(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     const uint32_t *expected_utf32_string,
+     size_t expected_utf32_string_size,
+     int expected_result )
+{
+	libuna_error_t *error            = NULL;
+	size_t maximum_utf32_string_size = 0;
+	size_t utf32_string_index        = 0;
+	int result                       = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying UTF-32 string from UTF-8 string in a single pass\t" );
+
+	result = libuna_utf32_string_maximum_size_from_utf8(
+	          utf8_string_size,
+	          &maximum_utf32_string_size,
+	          &error );
+
+	if( result == 1 )
+	{
+		if( ( maximum_utf32_string_size < expected_utf32_string_size )
+		 || ( maximum_utf32_string_size > utf32_string_size ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libuna_utf32_string_with_index_copy_from_utf8(
+			  utf32_string,
+			  maximum_utf32_string_size,
+			  &utf32_string_index,
+			  utf8_string,
+			  utf8_string_size,
+			  &error );
+	}
+	if( result == 1 )
+	{
+		if( utf32_string_index != expected_utf32_string_size )
+		{
+			result = 0;
+		}
+		else if( memory_compare(
+		          utf32_string,
+		          expected_utf32_string,
+		          sizeof( uint32_t ) * expected_utf32_string_size ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( result == expected_result )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( result == -1 )
+	{
+		if( expected_result != -1 )
+		{
+			libuna_error_backtrace_fprint(
+			 error,
+			 stderr );
+		}
+		libuna_error_free(
+		 &error );
+	}
+	if( result == expected_result )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = 0;
+	}
+	return( result );
+}
+
+/* Tests copying an UTF-32 string from an UTF-8 string with a status code
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf32_string_copy_from_utf8_string_with_status(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     const uint32_t *expected_utf32_string,
+     size_t expected_utf32_string_size,
+     int expected_status,
+     size_t expected_error_offset )
+{
+	size_t error_offset             = 0;
+	size_t result_utf32_string_size = 0;
+	int result                      = 1;
+	int status                      = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying UTF-32 string from UTF-8 string with a status code\t" );
+
+	status = libuna_utf32_string_size_from_utf8_with_status(
+	          utf8_string,
+	          utf8_string_size,
+	          &result_utf32_string_size,
+	          &error_offset );
+
+	if( status == LIBUNA_STATUS_OK )
+	{
+		if( result_utf32_string_size != expected_utf32_string_size )
+		{
+			result = 0;
+		}
+		status = libuna_utf32_string_copy_from_utf8_with_status(
+		          utf32_string,
+		          utf32_string_size,
+		          utf8_string,
+		          utf8_string_size,
+		          &error_offset );
+	}
+	if( status != expected_status )
+	{
+		result = 0;
+	}
+	else if( status == LIBUNA_STATUS_OK )
+	{
+		if( memory_compare(
+		     utf32_string,
+		     expected_utf32_string,
+		     sizeof( uint32_t ) * expected_utf32_string_size ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( ( status != LIBUNA_STATUS_INVALID_ARGUMENT )
+	 && ( error_offset != expected_error_offset ) )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( result );
+}
+
 /* Tests copying an UTF-32 string from an UTF-16 string
  * Returns 1 if successful, 0 if not or -1 on error
  */
@@ -745,6 +920,16 @@ int main( int argc, char * const argv[] )
 	uint8_t utf7_stream[ 20 ]            = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', '+', 'A', 'O', 'E', '-', ' ', 't', 'e', 's', 't', '.', 0 };
 	uint8_t utf8_stream[ 17 ]            = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 0xc3, 0xa1, ' ', 't', 'e', 's', 't', '.', 0 };
 	uint8_t utf8_string[ 17 ]            = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 0xc3, 0xa1, ' ', 't', 'e', 's', 't', '.', 0 };
+	uint8_t utf8_string_invalid[ 5 ]     = { 'T', 'h', 'e', 0x80, '!' };
+	uint8_t utf8_string_long[ 57 ]       = { 'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	                                         'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	                                         0xd0, 0xb0, 0xd0, 0xb1, 0xd0, 0xb2, 0xd0, 0xb3, 0xd0, 0xb4, 0xd0, 0xb5, 0xd0, 0xb6, 0xd0, 0xb7,
+	                                         0xe2, 0x82, 0xac, 0xf0, 0x9f, 0x98, 0x80, '!', 0 };
+	uint32_t expected_utf32_string_long[ 44 ] = {
+	                                         'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	                                         'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	                                         0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+	                                         0x20ac, 0x1f600, '!', 0 };
 	libuna_error_t *error                = NULL;
 
 	if( argc != 1 )
@@ -1281,6 +1466,149 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* UTF-8 string single pass tests
+	 */
+
+	/* Case 1: UTF-8 string is NULL, UTF-8 string size is 17
+	 *         UTF-32 string is a buffer, UTF-32 string size is 256
+	 * Expected result: -1
+	 */
+	if( una_test_utf32_string_with_index_copy_from_utf8_string(
+	     NULL,
+	     17,
+	     utf32_string,
+	     256,
+	     expected_utf32_string,
+	     16,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string in a single pass.\n" );
+
+		goto on_error;
+	}
+	/* Case 2: UTF-8 string is a buffer, UTF-8 string size is 17
+	 *         UTF-32 string is a buffer, UTF-32 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf32_string_with_index_copy_from_utf8_string(
+	     utf8_string,
+	     17,
+	     utf32_string,
+	     256,
+	     expected_utf32_string,
+	     16,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string in a single pass.\n" );
+
+		goto on_error;
+	}
+	/* Case 3: UTF-8 string is a buffer, UTF-8 string size is 57
+	 *         UTF-32 string is a buffer, UTF-32 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf32_string_with_index_copy_from_utf8_string(
+	     utf8_string_long,
+	     57,
+	     utf32_string,
+	     256,
+	     expected_utf32_string_long,
+	     44,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string in a single pass.\n" );
+
+		goto on_error;
+	}
+	/* UTF-8 string status code tests
+	 */
+
+	/* Case 1: UTF-8 string is NULL, UTF-8 string size is 17
+	 *         UTF-32 string is a buffer, UTF-32 string size is 256
+	 * Expected result: LIBUNA_STATUS_INVALID_ARGUMENT
+	 */
+	if( una_test_utf32_string_copy_from_utf8_string_with_status(
+	     NULL,
+	     17,
+	     utf32_string,
+	     256,
+	     expected_utf32_string,
+	     16,
+	     LIBUNA_STATUS_INVALID_ARGUMENT,
+	     0 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* Case 2: UTF-8 string is a buffer, UTF-8 string size is 17
+	 *         UTF-32 string is a buffer, UTF-32 string size is 256
+	 * Expected result: LIBUNA_STATUS_OK
+	 */
+	if( una_test_utf32_string_copy_from_utf8_string_with_status(
+	     utf8_string,
+	     17,
+	     utf32_string,
+	     256,
+	     expected_utf32_string,
+	     16,
+	     LIBUNA_STATUS_OK,
+	     17 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* Case 3: UTF-8 string is a buffer, UTF-8 string size is 17
+	 *         UTF-32 string is a buffer, UTF-32 string size is 8
+	 * Expected result: LIBUNA_STATUS_OUTPUT_TOO_SMALL
+	 */
+	if( una_test_utf32_string_copy_from_utf8_string_with_status(
+	     utf8_string,
+	     17,
+	     utf32_string,
+	     8,
+	     expected_utf32_string,
+	     16,
+	     LIBUNA_STATUS_OUTPUT_TOO_SMALL,
+	     8 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* Case 4: UTF-8 string is a buffer with an invalid character, UTF-8 string size is 5
+	 *         UTF-32 string is a buffer, UTF-32 string size is 256
+	 * Expected result: LIBUNA_STATUS_INVALID_INPUT
+	 */
+	if( una_test_utf32_string_copy_from_utf8_string_with_status(
+	     utf8_string_invalid,
+	     5,
+	     utf32_string,
+	     256,
+	     expected_utf32_string,
+	     16,
+	     LIBUNA_STATUS_INVALID_INPUT,
+	     3 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-8 string to UTF-32 string with a status code.\n" );
+
+		goto on_error;
+	}
 	/* UTF-16 string tests
 	 */
 
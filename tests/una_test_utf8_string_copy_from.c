@@ -629,6 +629,275 @@ int una_test_utf8_string_copy_from_utf16_string(
 	return( result );
 }
 
+/* Tests copying an UTF-8 string from an UTF-16 string in a single pass
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_utf8_string_with_index_copy_from_utf16_string(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *expected_utf8_string,
+     size_t expected_utf8_string_size,
+     int expected_result )
+{
+	libuna_error_t *error           = NULL;
+	size_t maximum_utf8_string_size = 0;
+	size_t utf8_string_index        = 0;
+	int result                      = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying UTF-8 string from UTF-16 string in a single pass\t" );
+
+	result = libuna_utf8_string_maximum_size_from_utf16(
+	          utf16_string_size,
+	          &maximum_utf8_string_size,
+	          &error );
+
+	if( result == 1 )
+	{
+		if( ( maximum_utf8_string_size < expected_utf8_string_size )
+		 || ( maximum_utf8_string_size > utf8_string_size ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libuna_utf8_string_with_index_copy_from_utf16(
+			  utf8_string,
+			  maximum_utf8_string_size,
+			  &utf8_string_index,
+			  utf16_string,
+			  utf16_string_size,
+			  &error );
+	}
+	if( result == 1 )
+	{
+		if( utf8_string_index != expected_utf8_string_size )
+		{
+			result = 0;
+		}
+		else if( memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          sizeof( uint8_t ) * expected_utf8_string_size ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( result == expected_result )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( result == -1 )
+	{
+		if( expected_result != -1 )
+		{
+			libuna_error_backtrace_fprint(
+			 error,
+			 stderr );
+		}
+		libuna_error_free(
+		 &error );
+	}
+	if( result == expected_result )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = 0;
+	}
+	return( result );
+}
+
+/* Tests copying an UTF-8 string from an UTF-16 string with a status code
+ * Returns 1 if successful or 0 if not
+ */
+int una_test_utf8_string_copy_from_utf16_string_with_status(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *expected_utf8_string,
+     size_t expected_utf8_string_size,
+     int expected_status,
+     size_t expected_error_offset )
+{
+	size_t error_offset            = 0;
+	size_t result_utf8_string_size = 0;
+	int result                     = 1;
+	int status                     = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying UTF-8 string from UTF-16 string with a status code\t" );
+
+	status = libuna_utf8_string_size_from_utf16_with_status(
+	          utf16_string,
+	          utf16_string_size,
+	          &result_utf8_string_size,
+	          &error_offset );
+
+	if( status == LIBUNA_STATUS_OK )
+	{
+		if( result_utf8_string_size != expected_utf8_string_size )
+		{
+			result = 0;
+		}
+		status = libuna_utf8_string_copy_from_utf16_with_status(
+		          utf8_string,
+		          utf8_string_size,
+		          utf16_string,
+		          utf16_string_size,
+		          &error_offset );
+	}
+	if( status != expected_status )
+	{
+		result = 0;
+	}
+	else if( status == LIBUNA_STATUS_OK )
+	{
+		if( memory_compare(
+		     utf8_string,
+		     expected_utf8_string,
+		     sizeof( uint8_t ) * expected_utf8_string_size ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( ( status != LIBUNA_STATUS_INVALID_ARGUMENT )
+	 && ( error_offset != expected_error_offset ) )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( result );
+}
+
+/* Tests copying a normalized UTF-8 string from an UTF-16 string
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int una_test_utf8_string_copy_from_utf16_string_normalized(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_size,
+     int normalization_form,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *expected_utf8_string,
+     size_t expected_utf8_string_size,
+     int expected_result )
+{
+	libuna_error_t *error          = NULL;
+	size_t result_utf8_string_size = 0;
+	int result                     = 0;
+
+        fprintf(
+         stdout,
+         "Testing copying normalized UTF-8 string from UTF-16 string\t" );
+
+	result = libuna_utf8_string_size_from_utf16_normalized(
+	          utf16_string,
+	          utf16_string_size,
+	          normalization_form,
+	          &result_utf8_string_size,
+	          &error );
+
+	if( result == 1 )
+	{
+		if( ( result_utf8_string_size != expected_utf8_string_size )
+		 || ( result_utf8_string_size > utf8_string_size ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libuna_utf8_string_copy_from_utf16_normalized(
+			  utf8_string,
+			  result_utf8_string_size,
+			  utf16_string,
+			  utf16_string_size,
+			  normalization_form,
+			  &error );
+	}
+	if( result == 1 )
+	{
+		if( memory_compare(
+		     utf8_string,
+		     expected_utf8_string,
+		     sizeof( uint8_t ) * expected_utf8_string_size ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( result == expected_result )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( result == -1 )
+	{
+		if( expected_result != -1 )
+		{
+			libuna_error_backtrace_fprint(
+			 error,
+			 stderr );
+		}
+		libuna_error_free(
+		 &error );
+	}
+	if( result == expected_result )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = 0;
+	}
+	return( result );
+}
+
 /* Tests copying an UTF-8 string from an UTF-32 string
  * Returns 1 if successful, 0 if not or -1 on error
  */
@@ -736,8 +1005,21 @@ int main( int argc, char * const argv[] )
 
 	uint32_t utf32_string[ 16 ]        = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 0xe1, ' ', 't', 'e', 's', 't', '.', 0 };
 	uint16_t utf16_string[ 16 ]        = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 0xe1, ' ', 't', 'e', 's', 't', '.', 0 };
+	uint16_t utf16_string_decomposed[ 17 ] = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 'a', 0x0301, ' ', 't', 'e', 's', 't', '.', 0 };
+	uint16_t utf16_string_truncated[ 4 ] = { 'T', 'h', 'e', 0xd800 };
+	uint16_t utf16_string_long[ 35 ]   = { 'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	                                       0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+	                                       0x4e00, 0x4e01, 0x4e02, 0x4e03, 0x4e04, 0x4e05, 0x4e06, 0x4e07,
+	                                       0x20ac, '!', 0 };
 	uint8_t byte_stream[ 16 ]          = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 0xe1, ' ', 't', 'e', 's', 't', '.', 0 };
 	uint8_t expected_utf8_string[ 17 ] = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 0xc3, 0xa1, ' ', 't', 'e', 's', 't', '.', 0 };
+	uint8_t expected_utf8_string_long[ 61 ] = {
+	                                       'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	                                       0xd0, 0xb0, 0xd0, 0xb1, 0xd0, 0xb2, 0xd0, 0xb3, 0xd0, 0xb4, 0xd0, 0xb5, 0xd0, 0xb6, 0xd0, 0xb7,
+	                                       0xe4, 0xb8, 0x80, 0xe4, 0xb8, 0x81, 0xe4, 0xb8, 0x82, 0xe4, 0xb8, 0x83,
+	                                       0xe4, 0xb8, 0x84, 0xe4, 0xb8, 0x85, 0xe4, 0xb8, 0x86, 0xe4, 0xb8, 0x87,
+	                                       0xe2, 0x82, 0xac, '!', 0 };
+	uint8_t expected_utf8_string_decomposed[ 18 ] = { 'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 'a', 0xcc, 0x81, ' ', 't', 'e', 's', 't', '.', 0 };
 	uint8_t utf32_stream[ 64 ]         = { 'T', 0, 0, 0, 'h', 0, 0, 0, 'i', 0, 0, 0, 's', 0, 0, 0, ' ', 0, 0, 0,
 	                                       'i', 0, 0, 0, 's', 0, 0, 0, ' ', 0, 0, 0, 0xe1, 0, 0, 0, ' ', 0, 0, 0,
 	                                       't', 0, 0, 0, 'e', 0, 0, 0, 's', 0, 0, 0, 't', 0, 0, 0, '.', 0, 0, 0, 0, 0, 0, 0 };
@@ -1281,6 +1563,295 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* Case 5: UTF-16 string is a buffer, UTF-16 string size is 35
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string(
+	     utf16_string_long,
+	     35,
+	     utf8_string,
+	     256,
+	     expected_utf8_string_long,
+	     61,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	/* Case 6: UTF-16 string is a buffer, UTF-16 string size is 35
+	 *         UTF-8 string is a buffer, UTF-8 string size is 40
+	 * Expected result: -1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string(
+	     utf16_string_long,
+	     35,
+	     utf8_string,
+	     40,
+	     expected_utf8_string_long,
+	     61,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	/* UTF-16 string single pass tests
+	 */
+
+	/* Case 1: UTF-16 string is NULL, UTF-16 string size is 16
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: -1
+	 */
+	if( una_test_utf8_string_with_index_copy_from_utf16_string(
+	     NULL,
+	     16,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string in a single pass.\n" );
+
+		goto on_error;
+	}
+	/* Case 2: UTF-16 string is a buffer, UTF-16 string size is 16
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf8_string_with_index_copy_from_utf16_string(
+	     utf16_string,
+	     16,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string in a single pass.\n" );
+
+		goto on_error;
+	}
+	/* Case 3: UTF-16 string is a buffer, UTF-16 string size is 35
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf8_string_with_index_copy_from_utf16_string(
+	     utf16_string_long,
+	     35,
+	     utf8_string,
+	     256,
+	     expected_utf8_string_long,
+	     61,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string in a single pass.\n" );
+
+		goto on_error;
+	}
+	/* UTF-16 string status code tests
+	 */
+
+	/* Case 1: UTF-16 string is NULL, UTF-16 string size is 16
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: LIBUNA_STATUS_INVALID_ARGUMENT
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_with_status(
+	     NULL,
+	     16,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     LIBUNA_STATUS_INVALID_ARGUMENT,
+	     0 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* Case 2: UTF-16 string is a buffer, UTF-16 string size is 16
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: LIBUNA_STATUS_OK
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_with_status(
+	     utf16_string,
+	     16,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     LIBUNA_STATUS_OK,
+	     16 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* Case 3: UTF-16 string is a buffer, UTF-16 string size is 16
+	 *         UTF-8 string is a buffer, UTF-8 string size is 8
+	 * Expected result: LIBUNA_STATUS_OUTPUT_TOO_SMALL
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_with_status(
+	     utf16_string,
+	     16,
+	     utf8_string,
+	     8,
+	     expected_utf8_string,
+	     17,
+	     LIBUNA_STATUS_OUTPUT_TOO_SMALL,
+	     8 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* Case 4: UTF-16 string is a buffer with a truncated character, UTF-16 string size is 4
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: LIBUNA_STATUS_TRUNCATED_INPUT
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_with_status(
+	     utf16_string_truncated,
+	     4,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     LIBUNA_STATUS_TRUNCATED_INPUT,
+	     3 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to UTF-8 string with a status code.\n" );
+
+		goto on_error;
+	}
+	/* UTF-16 string normalization tests
+	 */
+
+	/* Case 1: UTF-16 string is NULL, UTF-16 string size is 16
+	 *         normalization form is NFC
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: -1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_normalized(
+	     NULL,
+	     16,
+	     LIBUNA_NORMALIZATION_FORM_NFC,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to normalized UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	/* Case 2: UTF-16 string is a buffer in NFC, UTF-16 string size is 16
+	 *         normalization form is NFC
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_normalized(
+	     utf16_string,
+	     16,
+	     LIBUNA_NORMALIZATION_FORM_NFC,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to normalized UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	/* Case 3: UTF-16 string is a buffer in NFD, UTF-16 string size is 17
+	 *         normalization form is NFC
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_normalized(
+	     utf16_string_decomposed,
+	     17,
+	     LIBUNA_NORMALIZATION_FORM_NFC,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to normalized UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	/* Case 4: UTF-16 string is a buffer in NFC, UTF-16 string size is 16
+	 *         normalization form is NFD
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: 1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_normalized(
+	     utf16_string,
+	     16,
+	     LIBUNA_NORMALIZATION_FORM_NFD,
+	     utf8_string,
+	     256,
+	     expected_utf8_string_decomposed,
+	     18,
+	     1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to normalized UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	/* Case 5: UTF-16 string is a buffer, UTF-16 string size is 16
+	 *         normalization form is unsupported
+	 *         UTF-8 string is a buffer, UTF-8 string size is 256
+	 * Expected result: -1
+	 */
+	if( una_test_utf8_string_copy_from_utf16_string_normalized(
+	     utf16_string,
+	     16,
+	     -1,
+	     utf8_string,
+	     256,
+	     expected_utf8_string,
+	     17,
+	     -1 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy UTF-16 string to normalized UTF-8 string.\n" );
+
+		goto on_error;
+	}
 	/* UTF-32 string tests
 	 */
 
@@ -19,6 +19,7 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -26,6 +27,22 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "export_handle.h"
 #include "process_status.h"
 #include "unacommon.h"
@@ -34,12 +51,44 @@
 #include "unatools_libcerror.h"
 #include "unatools_libcfile.h"
 #include "unatools_libclocale.h"
+#include "unatools_libcnotify.h"
 #include "unatools_libuna.h"
+#include "uring_handle.h"
 
 #define EXPORT_HANDLE_BUFFER_SIZE		8 * 1024 * 1024
+
+/* The size of the buffers in the rings of the pipeline
+ */
+#define EXPORT_HANDLE_PIPELINE_BUFFER_SIZE	1024 * 1024
+
+/* The number of reads and the number of writes in flight and the size
+ * of their buffers when io_uring is used
+ */
+#define EXPORT_HANDLE_IO_URING_QUEUE_DEPTH	8
+#define EXPORT_HANDLE_IO_URING_BUFFER_SIZE	1024 * 1024
+
 #define EXPORT_HANDLE_STRING_SIZE		1024
 #define EXPORT_HANDLE_NOTIFY_STREAM		stderr
 
+/* The number of Unicode characters decoded per call to the stream decoder
+ */
+#define EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS	64 * 1024
+
+/* The number of Unicode characters after newline conversion, where every
+ * decoded character can be converted into a carriage return and line feed
+ * and a carriage return can be kept back from the previous decode
+ */
+#define EXPORT_HANDLE_NUMBER_OF_CONVERTED_CHARACTERS	( ( 2 * EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS ) + 1 )
+
+/* The room kept in the destination buffer for encoding a Unicode character
+ */
+#define EXPORT_HANDLE_MAXIMUM_ENCODED_CHARACTER_SIZE	32
+
+/* The maximum number of bytes the UTF-7 encoder rewrites when it continues
+ * a base64 encoded sequence, the partial base64 characters and the terminator
+ */
+#define EXPORT_HANDLE_UTF7_STREAM_TAIL_SIZE		4
+
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -159,6 +208,7 @@ int export_handle_initialize(
 		( *export_handle )->text_export_byte_order_mark = 1;
 		( *export_handle )->text_byte_stream_codepage   = LIBUNA_CODEPAGE_ASCII;
 	}
+	( *export_handle )->number_of_threads = 1;
 	( *export_handle )->notify_stream = EXPORT_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
@@ -213,6 +263,37 @@ int export_handle_free(
 			memory_free(
 			 ( *export_handle )->destination_filename );
 		}
+		if( export_handle_unmap_source(
+		     *export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap source file.",
+			 function );
+
+			result = -1;
+		}
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+		if( ( *export_handle )->uring_handle != NULL )
+		{
+			if( uring_handle_free(
+			     &( ( *export_handle )->uring_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free io_uring handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( libcfile_file_free(
 		     &( ( *export_handle )->source_file ),
 		     error ) != 1 )
@@ -280,6 +361,7 @@ int export_handle_open_input(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_open_input";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -327,7 +409,74 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( export_handle->use_io_uring != 0 )
+	{
+		if( export_handle->uring_handle == NULL )
+		{
+			if( uring_handle_initialize(
+			     &( export_handle->uring_handle ),
+			     EXPORT_HANDLE_IO_URING_QUEUE_DEPTH,
+			     EXPORT_HANDLE_IO_URING_BUFFER_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create io_uring handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Only regular files and block devices are read using io_uring
+		 * otherwise the source file is mapped or read using the source file
+		 */
+		result = uring_handle_open_source(
+		          export_handle->uring_handle,
+		          export_handle->source_filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open source file: %" PRIs_SYSTEM " using io_uring.",
+			 function,
+			 export_handle->source_filename );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( result == 0 )
+	{
+		if( export_handle_map_source(
+		     export_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to map source file: %" PRIs_SYSTEM ".",
+			 function,
+			 export_handle->source_filename );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	libcfile_file_close(
+	 export_handle->source_file,
+	 NULL );
+
+	return( -1 );
 }
 
 /* Opens the output of the export handle
@@ -338,6 +487,9 @@ int export_handle_open_output(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_open_output";
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	int result            = 0;
+#endif
 
 	if( export_handle == NULL )
 	{
@@ -385,7 +537,59 @@ int export_handle_open_output(
 
 		return( -1 );
 	}
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( export_handle->use_io_uring != 0 )
+	{
+		if( export_handle->uring_handle == NULL )
+		{
+			if( uring_handle_initialize(
+			     &( export_handle->uring_handle ),
+			     EXPORT_HANDLE_IO_URING_QUEUE_DEPTH,
+			     EXPORT_HANDLE_IO_URING_BUFFER_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create io_uring handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Only regular files are written using io_uring
+		 * otherwise the destination file is used
+		 */
+		result = uring_handle_open_destination(
+		          export_handle->uring_handle,
+		          export_handle->destination_filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open destination file: %" PRIs_SYSTEM " using io_uring.",
+			 function,
+			 export_handle->destination_filename );
+
+			goto on_error;
+		}
+	}
+#endif
 	return( 1 );
+
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+on_error:
+	libcfile_file_close(
+	 export_handle->destination_file,
+	 NULL );
+
+	return( -1 );
+#endif
 }
 
 /* Closes the export handle
@@ -409,6 +613,37 @@ int export_handle_close(
 
 		return( -1 );
 	}
+	if( export_handle_unmap_source(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap source file.",
+		 function );
+
+		result = -1;
+	}
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( export_handle->uring_handle != NULL )
+	{
+		if( uring_handle_close(
+		     export_handle->uring_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close io_uring handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
 	if( libcfile_file_close(
 	     export_handle->source_file,
 	     error ) != 0 )
@@ -438,18 +673,22 @@ int export_handle_close(
 	return( result );
 }
 
-/* Sets a string
- * Returns 1 if successful or -1 on error
+/* Maps the source file into memory
+ * Only regular files are mapped, other files like pipes and devices
+ * are read using the source file
+ * Returns 1 if successful, 0 if the source file was not mapped or -1 on error
  */
-int export_handle_set_string(
+int export_handle_map_source(
      export_handle_t *export_handle,
-     const system_character_t *string,
-     system_character_t **internal_string,
-     size_t *internal_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_string";
-	size_t string_length  = 0;
+#if defined( EXPORT_HANDLE_HAVE_SOURCE_MAPPING )
+	struct stat file_statistics;
+
+	void *source_mapping  = NULL;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "export_handle_map_source";
 
 	if( export_handle == NULL )
 	{
@@ -462,109 +701,104 @@ int export_handle_set_string(
 
 		return( -1 );
 	}
-	if( string == NULL )
+	if( export_handle->source_mapping != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - source mapping value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_string == NULL )
+	if( export_handle->source_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing source filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_string_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal string size.",
-		 function );
+	export_handle->source_mapping_size   = 0;
+	export_handle->source_mapping_offset = 0;
 
-		return( -1 );
+#if defined( EXPORT_HANDLE_HAVE_SOURCE_MAPPING )
+	file_descriptor = open(
+	                   export_handle->source_filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
 	}
-	if( *internal_string != NULL )
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
 	{
-		memory_free(
-		 *internal_string );
+		close(
+		 file_descriptor );
 
-		*internal_string      = NULL;
-		*internal_string_size = 0;
+		return( 0 );
 	}
-	string_length = system_string_length(
-	                 string );
-
-	if( string_length > 0 )
+	/* Empty files cannot be mapped and files that exceed the address space
+	 * are read using the source file
+	 */
+	if( !S_ISREG( file_statistics.st_mode )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
 	{
-		*internal_string = system_string_allocate(
-		                    string_length + 1 );
-
-		if( *internal_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create internal string.",
-			 function );
-
-			goto on_error;
-		}
-		if( system_string_copy(
-		     *internal_string,
-		     string,
-		     string_length ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy string.",
-			 function );
-
-			goto on_error;
-		}
-		( *internal_string )[ string_length ] = 0;
+		close(
+		 file_descriptor );
 
-		*internal_string_size = string_length + 1;
+		return( 0 );
 	}
-	return( 1 );
-
-on_error:
-	if( *internal_string != NULL )
+	source_mapping = mmap(
+	                  NULL,
+	                  (size_t) file_statistics.st_size,
+	                  PROT_READ,
+	                  MAP_PRIVATE,
+	                  file_descriptor,
+	                  0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( source_mapping == MAP_FAILED )
 	{
-		memory_free(
-		 *internal_string );
-
-		*internal_string = NULL;
+		return( 0 );
 	}
-	*internal_string_size = 0;
+#if defined( HAVE_MADVISE ) && defined( MADV_SEQUENTIAL )
+	/* The source is read front to back, the advice is only a hint
+	 * hence its result is ignored
+	 */
+	madvise(
+	 source_mapping,
+	 (size_t) file_statistics.st_size,
+	 MADV_SEQUENTIAL );
+#endif
+	export_handle->source_mapping      = (uint8_t *) source_mapping;
+	export_handle->source_mapping_size = (size_t) file_statistics.st_size;
 
-	return( -1 );
+	return( 1 );
+#else
+	return( 0 );
+#endif
 }
 
-/* Sets the encoding
- * Returns 1 if successful, 0 if unsupported value or -1 on error
+/* Unmaps the source file from memory
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_set_encoding(
+int export_handle_unmap_source(
      export_handle_t *export_handle,
-     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_encoding";
-	int result            = 0;
+	static char *function = "export_handle_unmap_source";
 
 	if( export_handle == NULL )
 	{
@@ -577,46 +811,167 @@ int export_handle_set_encoding(
 
 		return( -1 );
 	}
-	if( export_handle->mode != EXPORT_HANDLE_MODE_BASE_ENCODING )
+	if( export_handle->source_mapping == NULL )
+	{
+		return( 1 );
+	}
+#if defined( EXPORT_HANDLE_HAVE_SOURCE_MAPPING )
+	if( munmap(
+	     export_handle->source_mapping,
+	     export_handle->source_mapping_size ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid export handle - unsupported mode.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap source.",
 		 function );
 
 		return( -1 );
 	}
-	result = unainput_determine_encoding(
-		  string,
-		  &( export_handle->base_encoding ),
-		  error );
+#endif
+	export_handle->source_mapping        = NULL;
+	export_handle->source_mapping_size   = 0;
+	export_handle->source_mapping_offset = 0;
 
-	if( result == -1 )
+	return( 1 );
+}
+
+/* Reads data from the source
+ * If the source file is mapped data is set to the next part of the mapping,
+ * if the source file is read using io_uring data is set to the next part of
+ * a read request buffer, otherwise the source file is read into the buffer
+ * and data is set to the buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t export_handle_read_source(
+         export_handle_t *export_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         const uint8_t **data,
+         libcerror_error_t **error )
+{
+	static char *function = "export_handle_read_source";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine encoding.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
-}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
 
-/* Sets the encoding mode
- * Returns 1 if successful, 0 if unsupported value or -1 on error
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->source_mapping != NULL )
+	{
+		read_size = export_handle->source_mapping_size - export_handle->source_mapping_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		*data = &( export_handle->source_mapping[ export_handle->source_mapping_offset ] );
+
+		export_handle->source_mapping_offset += read_size;
+
+		return( (ssize_t) read_size );
+	}
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( ( export_handle->uring_handle != NULL )
+	 && ( export_handle->uring_handle->source_file_descriptor != -1 ) )
+	{
+		read_count = uring_handle_read_buffer(
+		              export_handle->uring_handle,
+		              buffer_size,
+		              data,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from source file using io_uring.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+#endif
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libcfile_file_read_buffer(
+	              export_handle->source_file,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from source file.",
+		 function );
+
+		return( -1 );
+	}
+	*data = buffer;
+
+	return( read_count );
+}
+
+/* Writes data to the destination
+ * If the destination file is written using io_uring the data is written
+ * in the background otherwise the data is written to the destination file
+ * Returns the number of bytes written or -1 on error
  */
-int export_handle_set_encoding_mode(
-     export_handle_t *export_handle,
-     const system_character_t *string,
-     libcerror_error_t **error )
+ssize_t export_handle_write_destination(
+         export_handle_t *export_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_encoding_mode";
-	int result            = 0;
+	static char *function = "export_handle_write_destination";
+	ssize_t write_count   = 0;
 
 	if( export_handle == NULL )
 	{
@@ -629,47 +984,105 @@ int export_handle_set_encoding_mode(
 
 		return( -1 );
 	}
-	if( export_handle->mode != EXPORT_HANDLE_MODE_BASE_ENCODING )
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( ( export_handle->uring_handle != NULL )
+	 && ( export_handle->uring_handle->destination_file_descriptor != -1 ) )
+	{
+		write_count = uring_handle_write_buffer(
+		               export_handle->uring_handle,
+		               buffer,
+		               buffer_size,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination file using io_uring.",
+			 function );
+
+			return( -1 );
+		}
+		return( write_count );
+	}
+#endif
+	write_count = libcfile_file_write_buffer(
+	               export_handle->destination_file,
+	               buffer,
+	               buffer_size,
+	               error );
+
+	if( write_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid export handle - unsupported mode.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to destination file.",
 		 function );
 
 		return( -1 );
 	}
-	result = unainput_determine_encoding_mode(
-		  string,
-		  &( export_handle->base_encoding_mode ),
-		  error );
+	return( write_count );
+}
 
-	if( result == -1 )
+/* Flushes the destination
+ * Waits for the writes to the destination file that are in the background
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_flush_destination(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_flush_destination";
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine encoding mode.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( ( export_handle->uring_handle != NULL )
+	 && ( export_handle->uring_handle->destination_file_descriptor != -1 ) )
+	{
+		if( uring_handle_flush(
+		     export_handle->uring_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush destination file using io_uring.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
 }
 
-/* Sets the input format
- * Returns 1 if successful, 0 if unsupported value or -1 on error
+/* Sets a string
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_set_input_format(
+int export_handle_set_string(
      export_handle_t *export_handle,
      const system_character_t *string,
+     system_character_t **internal_string,
+     size_t *internal_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_input_format";
+	static char *function = "export_handle_set_string";
 	size_t string_length  = 0;
-	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -682,62 +1095,108 @@ int export_handle_set_input_format(
 
 		return( -1 );
 	}
-	if( export_handle->mode != EXPORT_HANDLE_MODE_TEXT_ENCODING )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid export handle - unsupported mode.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal string size.",
 		 function );
 
 		return( -1 );
 	}
+	if( *internal_string != NULL )
+	{
+		memory_free(
+		 *internal_string );
+
+		*internal_string      = NULL;
+		*internal_string_size = 0;
+	}
 	string_length = system_string_length(
 	                 string );
 
-	if( string_length == 11 )
+	if( string_length > 0 )
 	{
-		if( system_string_compare(
-		     string,
-		     _SYSTEM_STRING( "auto-detect" ),
-		     11 ) == 0 )
+		*internal_string = system_string_allocate(
+		                    string_length + 1 );
+
+		if( *internal_string == NULL )
 		{
-			export_handle->text_input_format = UNACOMMON_FORMAT_AUTO_DETECT;
-			result                      = 1;
-		}
-	}
-	if( result == 0 )
-	{
-		result = unainput_determine_format(
-		          string,
-		          &( export_handle->text_input_format ),
-		          error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create internal string.",
+			 function );
 
-		if( result == -1 )
+			goto on_error;
+		}
+		if( system_string_copy(
+		     *internal_string,
+		     string,
+		     string_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine input format.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
+		( *internal_string )[ string_length ] = 0;
+
+		*internal_string_size = string_length + 1;
 	}
-	return( result );
+	return( 1 );
+
+on_error:
+	if( *internal_string != NULL )
+	{
+		memory_free(
+		 *internal_string );
+
+		*internal_string = NULL;
+	}
+	*internal_string_size = 0;
+
+	return( -1 );
 }
 
-/* Sets the output format
+/* Sets the encoding
  * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_output_format(
+int export_handle_set_encoding(
      export_handle_t *export_handle,
      const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_output_format";
+	static char *function = "export_handle_set_encoding";
 	int result            = 0;
 
 	if( export_handle == NULL )
@@ -751,7 +1210,7 @@ int export_handle_set_output_format(
 
 		return( -1 );
 	}
-	if( export_handle->mode != EXPORT_HANDLE_MODE_TEXT_ENCODING )
+	if( export_handle->mode != EXPORT_HANDLE_MODE_BASE_ENCODING )
 	{
 		libcerror_error_set(
 		 error,
@@ -762,9 +1221,9 @@ int export_handle_set_output_format(
 
 		return( -1 );
 	}
-	result = unainput_determine_format(
+	result = unainput_determine_encoding(
 		  string,
-		  &( export_handle->text_output_format ),
+		  &( export_handle->base_encoding ),
 		  error );
 
 	if( result == -1 )
@@ -773,7 +1232,7 @@ int export_handle_set_output_format(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine output format.",
+		 "%s: unable to determine encoding.",
 		 function );
 
 		return( -1 );
@@ -781,15 +1240,15 @@ int export_handle_set_output_format(
 	return( result );
 }
 
-/* Sets the newline conversion
+/* Sets the encoding mode
  * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_newline_conversion(
+int export_handle_set_encoding_mode(
      export_handle_t *export_handle,
      const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_newline_conversion";
+	static char *function = "export_handle_set_encoding_mode";
 	int result            = 0;
 
 	if( export_handle == NULL )
@@ -803,7 +1262,7 @@ int export_handle_set_newline_conversion(
 
 		return( -1 );
 	}
-	if( export_handle->mode != EXPORT_HANDLE_MODE_TEXT_ENCODING )
+	if( export_handle->mode != EXPORT_HANDLE_MODE_BASE_ENCODING )
 	{
 		libcerror_error_set(
 		 error,
@@ -814,9 +1273,9 @@ int export_handle_set_newline_conversion(
 
 		return( -1 );
 	}
-	result = unainput_determine_newline_conversion(
+	result = unainput_determine_encoding_mode(
 		  string,
-		  &( export_handle->text_newline_conversion ),
+		  &( export_handle->base_encoding_mode ),
 		  error );
 
 	if( result == -1 )
@@ -825,7 +1284,7 @@ int export_handle_set_newline_conversion(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine newline conversion.",
+		 "%s: unable to determine encoding mode.",
 		 function );
 
 		return( -1 );
@@ -833,8 +1292,182 @@ int export_handle_set_newline_conversion(
 	return( result );
 }
 
-/* Sets the byte stream codepage
- * Returns 1 if successful or -1 on error
+/* Sets the input format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_input_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_input_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->mode != EXPORT_HANDLE_MODE_TEXT_ENCODING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 11 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "auto-detect" ),
+		     11 ) == 0 )
+		{
+			export_handle->text_input_format = UNACOMMON_FORMAT_AUTO_DETECT;
+			result                      = 1;
+		}
+	}
+	if( result == 0 )
+	{
+		result = unainput_determine_format(
+		          string,
+		          &( export_handle->text_input_format ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine input format.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_output_format";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->mode != EXPORT_HANDLE_MODE_TEXT_ENCODING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	result = unainput_determine_format(
+		  string,
+		  &( export_handle->text_output_format ),
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine output format.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the newline conversion
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_newline_conversion(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_newline_conversion";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->mode != EXPORT_HANDLE_MODE_TEXT_ENCODING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	result = unainput_determine_newline_conversion(
+		  string,
+		  &( export_handle->text_newline_conversion ),
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine newline conversion.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the byte stream codepage
+ * Returns 1 if successful or -1 on error
  */
 int export_handle_set_byte_stream_codepage(
      export_handle_t *export_handle,
@@ -904,6 +1537,47 @@ int export_handle_set_byte_stream_codepage(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = unainput_determine_number_of_threads(
+		  string,
+		  &( export_handle->number_of_threads ),
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Exports the source file to the destination file
  * Returns the number of bytes of the source processed or -1 on error
  */
@@ -1016,26 +1690,24 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the base-encoded source file to the destination file
- * Returns the number of bytes of the source processed or -1 on error
+/* Converts base encoded data
+ * The base stream decoder or encoder is finalized if the source data size is 0
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_export_base_encoded_input(
+int export_handle_convert_base_encoded_data(
      export_handle_t *export_handle,
-     process_status_t *process_status,
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     libuna_base_stream_encoder_t *base_stream_encoder,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t *source_data_index,
+     uint8_t *destination_buffer,
+     size_t destination_buffer_size,
+     size_t *write_size,
      libcerror_error_t **error )
 {
-	uint8_t *destination_buffer      = NULL;
-	uint8_t *source_buffer           = NULL;
-	const char *encoding_string      = NULL;
-	const char *encoding_mode_string = NULL;
-	static char *function            = "export_handle_export_base_encoded_input";
-	size64_t export_count            = 0;
-	size_t destination_buffer_size   = 0;
-	size_t source_buffer_size        = 0;
-	size_t write_size                = 0;
-	ssize_t read_count               = 0;
-	ssize_t write_count              = 0;
-	int result                       = 0;
+	static char *function = "export_handle_convert_base_encoded_data";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1048,513 +1720,2513 @@ int export_handle_export_base_encoded_input(
 
 		return( -1 );
 	}
-	if( export_handle->mode != EXPORT_HANDLE_MODE_BASE_ENCODING )
+	if( write_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid export handle - unsupported mode.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write size.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE16 )
-	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE32 )
-	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE32HEX )
-	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE64 )
-	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE64URL ) )
+	*write_size = 0;
+
+	if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid export handle - unsupported encoding.",
-		 function );
+		if( source_data_size == 0 )
+		{
+			result = libuna_base_stream_decoder_finalize(
+			          base_stream_decoder,
+			          destination_buffer,
+			          destination_buffer_size,
+			          write_size,
+			          error );
+		}
+		else
+		{
+			result = libuna_base_stream_decoder_decode(
+			          base_stream_decoder,
+			          source_data,
+			          source_data_size,
+			          source_data_index,
+			          destination_buffer,
+			          destination_buffer_size,
+			          write_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to decode source data.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( ( export_handle->base_encoding_mode != UNACOMMON_ENCODING_MODE_DECODE )
-	 && ( export_handle->base_encoding_mode != UNACOMMON_ENCODING_MODE_ENCODE ) )
+	else
 	{
-		libcerror_error_set(
-		 error,
+		if( source_data_size == 0 )
+		{
+			result = libuna_base_stream_encoder_finalize(
+			          base_stream_encoder,
+			          destination_buffer,
+			          destination_buffer_size,
+			          write_size,
+			          error );
+		}
+		else
+		{
+			result = libuna_base_stream_encoder_encode(
+			          base_stream_encoder,
+			          source_data,
+			          source_data_size,
+			          source_data_index,
+			          destination_buffer,
+			          destination_buffer_size,
+			          write_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to encode source data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) || defined( EXPORT_HANDLE_HAVE_PIPELINE )
+
+/* Takes the error of a thread so that the caller can add to it
+ * The error of the thread is freed if the caller cannot take it
+ */
+void export_handle_take_thread_error(
+      libcerror_error_t **thread_error,
+      libcerror_error_t **error )
+{
+	if( ( thread_error == NULL )
+	 || ( *thread_error == NULL ) )
+	{
+		return;
+	}
+	if( ( error != NULL )
+	 && ( *error == NULL ) )
+	{
+		*error        = *thread_error;
+		*thread_error = NULL;
+	}
+	else
+	{
+		libcerror_error_free(
+		 thread_error );
+	}
+}
+
+#endif /* defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) || defined( EXPORT_HANDLE_HAVE_PIPELINE ) */
+
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+
+/* Reads the source into the read ring of the pipeline
+ * A buffer with a data size of 0 is added to the read ring at the end of the source
+ * The error of a failed read is kept in the pipeline
+ * Returns NULL
+ */
+void *export_handle_pipeline_read_thread(
+       void *arguments )
+{
+	export_handle_pipeline_buffer_t *buffer = NULL;
+	export_handle_pipeline_t *pipeline      = NULL;
+	ssize_t read_count                      = 0;
+
+	pipeline = (export_handle_pipeline_t *) arguments;
+
+	if( pipeline == NULL )
+	{
+		return( NULL );
+	}
+	pthread_mutex_lock(
+	 &( pipeline->mutex ) );
+
+	while( pipeline->abort == 0 )
+	{
+		if( pipeline->read_ring.number_of_filled_buffers >= EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS )
+		{
+			pthread_cond_wait(
+			 &( pipeline->ring_changed ),
+			 &( pipeline->mutex ) );
+
+			continue;
+		}
+		buffer = &( pipeline->read_ring.buffers[ pipeline->read_ring.fill_index ] );
+
+		pthread_mutex_unlock(
+		 &( pipeline->mutex ) );
+
+		read_count = export_handle_read_source(
+		              pipeline->export_handle,
+		              buffer->buffer,
+		              EXPORT_HANDLE_PIPELINE_BUFFER_SIZE,
+		              &( buffer->data ),
+		              &( pipeline->read_error ) );
+
+		pthread_mutex_lock(
+		 &( pipeline->mutex ) );
+
+		if( read_count < 0 )
+		{
+			pipeline->read_failed = 1;
+			pipeline->abort       = 1;
+
+			break;
+		}
+		buffer->data_size = (size_t) read_count;
+
+		pipeline->read_ring.fill_index = ( pipeline->read_ring.fill_index + 1 ) % EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+
+		pipeline->read_ring.number_of_filled_buffers += 1;
+
+		pthread_cond_broadcast(
+		 &( pipeline->ring_changed ) );
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+	}
+	pthread_cond_broadcast(
+	 &( pipeline->ring_changed ) );
+
+	pthread_mutex_unlock(
+	 &( pipeline->mutex ) );
+
+	return( NULL );
+}
+
+/* Writes the write ring of the pipeline to the destination
+ * The error of a failed write is kept in the pipeline
+ * Returns NULL
+ */
+void *export_handle_pipeline_write_thread(
+       void *arguments )
+{
+	export_handle_pipeline_buffer_t *buffer = NULL;
+	export_handle_pipeline_t *pipeline      = NULL;
+	ssize_t write_count                     = 0;
+
+	pipeline = (export_handle_pipeline_t *) arguments;
+
+	if( pipeline == NULL )
+	{
+		return( NULL );
+	}
+	pthread_mutex_lock(
+	 &( pipeline->mutex ) );
+
+	while( pipeline->abort == 0 )
+	{
+		if( pipeline->write_ring.number_of_filled_buffers == 0 )
+		{
+			if( pipeline->end_of_output != 0 )
+			{
+				break;
+			}
+			pthread_cond_wait(
+			 &( pipeline->ring_changed ),
+			 &( pipeline->mutex ) );
+
+			continue;
+		}
+		buffer = &( pipeline->write_ring.buffers[ pipeline->write_ring.consume_index ] );
+
+		pthread_mutex_unlock(
+		 &( pipeline->mutex ) );
+
+		write_count = export_handle_write_destination(
+		               pipeline->export_handle,
+		               buffer->data,
+		               buffer->data_size,
+		               &( pipeline->write_error ) );
+
+		pthread_mutex_lock(
+		 &( pipeline->mutex ) );
+
+		if( write_count < 0 )
+		{
+			pipeline->write_failed = 1;
+			pipeline->abort        = 1;
+
+			break;
+		}
+		pipeline->write_ring.consume_index = ( pipeline->write_ring.consume_index + 1 ) % EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+
+		pipeline->write_ring.number_of_filled_buffers -= 1;
+
+		pthread_cond_broadcast(
+		 &( pipeline->ring_changed ) );
+	}
+	pthread_cond_broadcast(
+	 &( pipeline->ring_changed ) );
+
+	pthread_mutex_unlock(
+	 &( pipeline->mutex ) );
+
+	return( NULL );
+}
+
+/* Exports the base encoded input using a pipeline
+ * The source is read and the destination is written by separate threads
+ * while the base encoded data is converted, the threads pass the data
+ * through rings of reusable buffers
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_base_encoded_input_in_pipeline(
+     export_handle_t *export_handle,
+     process_status_t *process_status,
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     libuna_base_stream_encoder_t *base_stream_encoder,
+     size64_t *export_count,
+     libcerror_error_t **error )
+{
+	export_handle_pipeline_buffer_t *read_buffer  = NULL;
+	export_handle_pipeline_buffer_t *write_buffer = NULL;
+	export_handle_pipeline_t pipeline;
+	pthread_t read_thread;
+	pthread_t write_thread;
+	static char *function                         = "export_handle_export_base_encoded_input_in_pipeline";
+	size_t read_size                              = 0;
+	size_t source_data_index                      = 0;
+	size_t write_size                             = 0;
+	int buffer_index                              = 0;
+	int is_aborted                                = 0;
+	int read_thread_created                       = 0;
+	int write_thread_created                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export count.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &pipeline,
+	     0,
+	     sizeof( export_handle_pipeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	pipeline.export_handle = export_handle;
+
+	if( pthread_mutex_init(
+	     &( pipeline.mutex ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( pthread_cond_init(
+	     &( pipeline.ring_changed ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		pthread_mutex_destroy(
+		 &( pipeline.mutex ) );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		/* A mapped source is read directly from the mapping
+		 */
+		if( export_handle->source_mapping == NULL )
+		{
+			pipeline.read_ring.buffers[ buffer_index ].buffer = (uint8_t *) memory_allocate(
+			                                                                 sizeof( uint8_t ) * EXPORT_HANDLE_PIPELINE_BUFFER_SIZE );
+
+			if( pipeline.read_ring.buffers[ buffer_index ].buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create read buffer: %d.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+		}
+		pipeline.write_ring.buffers[ buffer_index ].buffer = (uint8_t *) memory_allocate(
+		                                                                  sizeof( uint8_t ) * EXPORT_HANDLE_PIPELINE_BUFFER_SIZE );
+
+		if( pipeline.write_ring.buffers[ buffer_index ].buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create write buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		pipeline.write_ring.buffers[ buffer_index ].data = pipeline.write_ring.buffers[ buffer_index ].buffer;
+	}
+	if( pthread_create(
+	     &read_thread,
+	     NULL,
+	     &export_handle_pipeline_read_thread,
+	     (void *) &pipeline ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread.",
+		 function );
+
+		goto on_error;
+	}
+	read_thread_created = 1;
+
+	if( pthread_create(
+	     &write_thread,
+	     NULL,
+	     &export_handle_pipeline_write_thread,
+	     (void *) &pipeline ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create write thread.",
+		 function );
+
+		goto on_error;
+	}
+	write_thread_created = 1;
+
+	/* The buffers of the read ring are converted into the buffers of the write ring
+	 * in order, the read thread ends with a buffer with a data size of 0
+	 */
+	do
+	{
+		pthread_mutex_lock(
+		 &( pipeline.mutex ) );
+
+		while( ( pipeline.abort == 0 )
+		    && ( pipeline.read_ring.number_of_filled_buffers == 0 ) )
+		{
+			pthread_cond_wait(
+			 &( pipeline.ring_changed ),
+			 &( pipeline.mutex ) );
+		}
+		read_buffer = &( pipeline.read_ring.buffers[ pipeline.read_ring.consume_index ] );
+		read_size   = read_buffer->data_size;
+		is_aborted  = pipeline.abort;
+
+		pthread_mutex_unlock(
+		 &( pipeline.mutex ) );
+
+		if( is_aborted != 0 )
+		{
+			break;
+		}
+		source_data_index = 0;
+
+		do
+		{
+			pthread_mutex_lock(
+			 &( pipeline.mutex ) );
+
+			while( ( pipeline.abort == 0 )
+			    && ( pipeline.write_ring.number_of_filled_buffers >= EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS ) )
+			{
+				pthread_cond_wait(
+				 &( pipeline.ring_changed ),
+				 &( pipeline.mutex ) );
+			}
+			write_buffer = &( pipeline.write_ring.buffers[ pipeline.write_ring.fill_index ] );
+			is_aborted   = pipeline.abort;
+
+			pthread_mutex_unlock(
+			 &( pipeline.mutex ) );
+
+			if( is_aborted != 0 )
+			{
+				break;
+			}
+			if( export_handle_convert_base_encoded_data(
+			     export_handle,
+			     base_stream_decoder,
+			     base_stream_encoder,
+			     read_buffer->data,
+			     read_size,
+			     &source_data_index,
+			     write_buffer->buffer,
+			     EXPORT_HANDLE_PIPELINE_BUFFER_SIZE,
+			     &write_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to convert source data.",
+				 function );
+
+				goto on_error;
+			}
+			if( write_size > 0 )
+			{
+				pthread_mutex_lock(
+				 &( pipeline.mutex ) );
+
+				write_buffer->data_size = write_size;
+
+				pipeline.write_ring.fill_index = ( pipeline.write_ring.fill_index + 1 ) % EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+
+				pipeline.write_ring.number_of_filled_buffers += 1;
+
+				pthread_cond_broadcast(
+				 &( pipeline.ring_changed ) );
+
+				pthread_mutex_unlock(
+				 &( pipeline.mutex ) );
+			}
+		}
+		while( source_data_index < read_size );
+
+		if( is_aborted != 0 )
+		{
+			break;
+		}
+		*export_count += read_size;
+
+		/* The read buffer can be refilled once it is released
+		 */
+
+		pthread_mutex_lock(
+		 &( pipeline.mutex ) );
+
+		pipeline.read_ring.consume_index = ( pipeline.read_ring.consume_index + 1 ) % EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+
+		pipeline.read_ring.number_of_filled_buffers -= 1;
+
+		pthread_cond_broadcast(
+		 &( pipeline.ring_changed ) );
+
+		pthread_mutex_unlock(
+		 &( pipeline.mutex ) );
+
+		if( process_status_update_unknown_total(
+		     process_status,
+		     *export_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update process status.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( read_size > 0 );
+
+	pthread_mutex_lock(
+	 &( pipeline.mutex ) );
+
+	pipeline.end_of_output = 1;
+
+	pthread_cond_broadcast(
+	 &( pipeline.ring_changed ) );
+
+	pthread_mutex_unlock(
+	 &( pipeline.mutex ) );
+
+	pthread_join(
+	 read_thread,
+	 NULL );
+
+	read_thread_created = 0;
+
+	pthread_join(
+	 write_thread,
+	 NULL );
+
+	write_thread_created = 0;
+
+	if( pipeline.read_failed != 0 )
+	{
+		export_handle_take_thread_error(
+		 &( pipeline.read_error ),
+		 error );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from source.",
+		 function );
+
+		goto on_error;
+	}
+	if( pipeline.write_failed != 0 )
+	{
+		export_handle_take_thread_error(
+		 &( pipeline.write_error ),
+		 error );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to destination.",
+		 function );
+
+		goto on_error;
+	}
+	pthread_cond_destroy(
+	 &( pipeline.ring_changed ) );
+	pthread_mutex_destroy(
+	 &( pipeline.mutex ) );
+
+	for( buffer_index = 0;
+	     buffer_index < EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( pipeline.read_ring.buffers[ buffer_index ].buffer != NULL )
+		{
+			memory_free(
+			 pipeline.read_ring.buffers[ buffer_index ].buffer );
+		}
+		if( pipeline.write_ring.buffers[ buffer_index ].buffer != NULL )
+		{
+			memory_free(
+			 pipeline.write_ring.buffers[ buffer_index ].buffer );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( ( read_thread_created != 0 )
+	 || ( write_thread_created != 0 ) )
+	{
+		pthread_mutex_lock(
+		 &( pipeline.mutex ) );
+
+		pipeline.abort = 1;
+
+		pthread_cond_broadcast(
+		 &( pipeline.ring_changed ) );
+
+		pthread_mutex_unlock(
+		 &( pipeline.mutex ) );
+	}
+	if( read_thread_created != 0 )
+	{
+		pthread_join(
+		 read_thread,
+		 NULL );
+	}
+	if( write_thread_created != 0 )
+	{
+		pthread_join(
+		 write_thread,
+		 NULL );
+	}
+	if( pipeline.read_error != NULL )
+	{
+		libcerror_error_free(
+		 &( pipeline.read_error ) );
+	}
+	if( pipeline.write_error != NULL )
+	{
+		libcerror_error_free(
+		 &( pipeline.write_error ) );
+	}
+	pthread_cond_destroy(
+	 &( pipeline.ring_changed ) );
+	pthread_mutex_destroy(
+	 &( pipeline.mutex ) );
+
+	for( buffer_index = 0;
+	     buffer_index < EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( pipeline.read_ring.buffers[ buffer_index ].buffer != NULL )
+		{
+			memory_free(
+			 pipeline.read_ring.buffers[ buffer_index ].buffer );
+		}
+		if( pipeline.write_ring.buffers[ buffer_index ].buffer != NULL )
+		{
+			memory_free(
+			 pipeline.write_ring.buffers[ buffer_index ].buffer );
+		}
+	}
+	return( -1 );
+}
+
+#endif /* defined( EXPORT_HANDLE_HAVE_PIPELINE ) */
+
+/* Exports the base-encoded source file to the destination file
+ * Returns the number of bytes of the source processed or -1 on error
+ */
+int export_handle_export_base_encoded_input(
+     export_handle_t *export_handle,
+     process_status_t *process_status,
+     libcerror_error_t **error )
+{
+	libuna_base_stream_decoder_t *base_stream_decoder = NULL;
+	libuna_base_stream_encoder_t *base_stream_encoder = NULL;
+	uint8_t *destination_buffer                       = NULL;
+	uint8_t *source_buffer                            = NULL;
+	const uint8_t *source_data                        = NULL;
+	const char *encoding_string                       = NULL;
+	const char *encoding_mode_string                  = NULL;
+	static char *function                             = "export_handle_export_base_encoded_input";
+	size64_t export_count                             = 0;
+	size_t destination_buffer_size                    = 0;
+	size_t source_buffer_index                        = 0;
+	size_t source_buffer_size                         = 0;
+	size_t write_size                                 = 0;
+	ssize_t read_count                                = 0;
+	ssize_t write_count                               = 0;
+	uint32_t base_variant                             = 0;
+	int base_format                                   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->mode != EXPORT_HANDLE_MODE_BASE_ENCODING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE16 )
+	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE32 )
+	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE32HEX )
+	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE64 )
+	 && ( export_handle->base_encoding != UNACOMMON_ENCODING_BASE64URL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->base_encoding_mode != UNACOMMON_ENCODING_MODE_DECODE )
+	 && ( export_handle->base_encoding_mode != UNACOMMON_ENCODING_MODE_ENCODE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unsupported encoding mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+	{
+		encoding_mode_string = "decode";
+	}
+	else
+	{
+		encoding_mode_string = "encode";
+	}
+	switch( export_handle->base_encoding )
+	{
+		case UNACOMMON_ENCODING_BASE16:
+			base_format = LIBUNA_BASE_FORMAT_BASE16;
+
+			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+			{
+				base_variant = LIBUNA_BASE16_VARIANT_CASE_MIXED
+				             | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
+			}
+			else
+			{
+				base_variant = LIBUNA_BASE16_VARIANT_CASE_UPPER
+				             | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_76;
+			}
+			encoding_string = "base16";
+
+			break;
+
+		case UNACOMMON_ENCODING_BASE32:
+			base_format = LIBUNA_BASE_FORMAT_BASE32;
+
+			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+			{
+				base_variant = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
+				             | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
+				             | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
+			}
+			else
+			{
+				base_variant = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
+				             | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64
+				             | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
+			}
+			encoding_string = "base32";
+
+			break;
+
+		case UNACOMMON_ENCODING_BASE32HEX:
+			base_format = LIBUNA_BASE_FORMAT_BASE32;
+
+			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+			{
+				base_variant = LIBUNA_BASE32_VARIANT_ALPHABET_HEX
+				             | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
+				             | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
+			}
+			else
+			{
+				base_variant = LIBUNA_BASE32_VARIANT_ALPHABET_HEX
+				             | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64
+				             | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
+			}
+			encoding_string = "base32hex";
+
+			break;
+
+		case UNACOMMON_ENCODING_BASE64:
+			base_format = LIBUNA_BASE_FORMAT_BASE64;
+
+			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+			{
+				base_variant = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
+				             | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
+				             | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
+			}
+			else
+			{
+				base_variant = LIBUNA_BASE64_VARIANT_MIME;
+			}
+			encoding_string = "base64";
+
+			break;
+
+		case UNACOMMON_ENCODING_BASE64URL:
+			base_format  = LIBUNA_BASE_FORMAT_BASE64;
+			base_variant = LIBUNA_BASE64_VARIANT_URL;
+
+			encoding_string = "base64url";
+
+			break;
+	}
+	/* The base stream encoder and decoder keep the bytes of a block or character
+	 * that is split by the end of the source buffer, hence the buffer sizes
+	 * do not need to be a multitude of the block size
+	 */
+	if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+	{
+		if( libuna_base_stream_decoder_initialize(
+		     &base_stream_decoder,
+		     base_format,
+		     base_variant,
+		     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create %s stream decoder.",
+			 function,
+			 encoding_string );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libuna_base_stream_encoder_initialize(
+		     &base_stream_encoder,
+		     base_format,
+		     base_variant,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create %s stream encoder.",
+			 function,
+			 encoding_string );
+
+			goto on_error;
+		}
+	}
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+	/* The pipeline is not used when io_uring was requested since
+	 * the io_uring handle is not shared between the threads
+	 */
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	if( ( export_handle->number_of_threads > 1 )
+	 && ( export_handle->uring_handle == NULL ) )
+#else
+	if( export_handle->number_of_threads > 1 )
+#endif
+	{
+		if( export_handle_export_base_encoded_input_in_pipeline(
+		     export_handle,
+		     process_status,
+		     base_stream_decoder,
+		     base_stream_encoder,
+		     &export_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to %s %s source data.",
+			 function,
+			 encoding_string,
+			 encoding_mode_string );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		source_buffer_size      = EXPORT_HANDLE_BUFFER_SIZE;
+		destination_buffer_size = EXPORT_HANDLE_BUFFER_SIZE;
+
+		/* A mapped source is converted directly from the mapping
+		 */
+		if( export_handle->source_mapping == NULL )
+		{
+			source_buffer = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * source_buffer_size );
+
+			if( source_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create source buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		destination_buffer = (uint8_t *) memory_allocate(
+		                                  sizeof( uint8_t ) * destination_buffer_size );
+
+		if( destination_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination buffer.",
+			 function );
+
+			goto on_error;
+		}
+		while( 1 )
+		{
+			read_count = export_handle_read_source(
+			              export_handle,
+			              source_buffer,
+			              source_buffer_size,
+			              &source_data,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from source.",
+				 function );
+
+				goto on_error;
+			}
+			export_count += read_count;
+
+			source_buffer_index = 0;
+
+			do
+			{
+				if( export_handle_convert_base_encoded_data(
+				     export_handle,
+				     base_stream_decoder,
+				     base_stream_encoder,
+				     source_data,
+				     (size_t) read_count,
+				     &source_buffer_index,
+				     destination_buffer,
+				     destination_buffer_size,
+				     &write_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+					 "%s: unable to %s %s source data.",
+					 function,
+					 encoding_string,
+					 encoding_mode_string );
+
+					goto on_error;
+				}
+				if( write_size > 0 )
+				{
+					write_count = export_handle_write_destination(
+						       export_handle,
+						       destination_buffer,
+						       write_size,
+						       error );
+
+					if( write_count < 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write to destination.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			while( source_buffer_index < (size_t) read_count );
+
+			if( read_count == 0 )
+			{
+				break;
+			}
+			if( process_status_update_unknown_total(
+			     process_status,
+			     export_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update process status.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( export_handle_flush_destination(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush destination.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_stop(
+	     process_status,
+	     (size64_t) export_count,
+	     PROCESS_STATUS_COMPLETED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_buffer != NULL )
+	{
+		memory_free(
+		 source_buffer );
+
+		source_buffer = NULL;
+	}
+	if( destination_buffer != NULL )
+	{
+		memory_free(
+		 destination_buffer );
+
+		destination_buffer = NULL;
+	}
+	if( base_stream_decoder != NULL )
+	{
+		if( libuna_base_stream_decoder_free(
+		     &base_stream_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free %s stream decoder.",
+			 function,
+			 encoding_string );
+
+			goto on_error;
+		}
+	}
+	if( base_stream_encoder != NULL )
+	{
+		if( libuna_base_stream_encoder_free(
+		     &base_stream_encoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free %s stream encoder.",
+			 function,
+			 encoding_string );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( process_status != NULL )
+	{
+		process_status_stop(
+		 process_status,
+		 (size64_t) export_count,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+	}
+	if( destination_buffer != NULL )
+	{
+		memory_free(
+		 destination_buffer );
+	}
+	if( source_buffer != NULL )
+	{
+		memory_free(
+		 source_buffer );
+	}
+	if( base_stream_decoder != NULL )
+	{
+		libuna_base_stream_decoder_free(
+		 &base_stream_decoder,
+		 NULL );
+	}
+	if( base_stream_encoder != NULL )
+	{
+		libuna_base_stream_encoder_free(
+		 &base_stream_encoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Converts the newlines of Unicode characters
+ * A carriage return (CR) at the end of the Unicode characters is kept back,
+ * in carriage_return_pending, until the next character is known
+ * The converted Unicode characters size should be at least twice the number
+ * of Unicode characters plus 1
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_convert_newlines(
+     export_handle_t *export_handle,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t number_of_unicode_characters,
+     libuna_unicode_character_t *converted_unicode_characters,
+     size_t converted_unicode_characters_size,
+     size_t *number_of_converted_unicode_characters,
+     uint8_t *carriage_return_pending,
+     libcerror_error_t **error )
+{
+	static char *function                        = "export_handle_convert_newlines";
+	size_t converted_unicode_character_index     = 0;
+	size_t unicode_character_index               = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	uint8_t newline_conversion                   = 0;
+	uint8_t safe_carriage_return_pending         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_unicode_characters > (size_t) ( ( SSIZE_MAX - 1 ) / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of Unicode characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( converted_unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid converted Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( converted_unicode_characters_size < ( ( 2 * number_of_unicode_characters ) + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid converted Unicode characters size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_converted_unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of converted Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( carriage_return_pending == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carriage return pending.",
+		 function );
+
+		return( -1 );
+	}
+	newline_conversion           = export_handle->text_newline_conversion;
+	safe_carriage_return_pending = *carriage_return_pending;
+
+	for( unicode_character_index = 0;
+	     unicode_character_index < number_of_unicode_characters;
+	     unicode_character_index++ )
+	{
+		unicode_character = unicode_characters[ unicode_character_index ];
+
+		/* Determine if character is a carriage return (CR)
+		 */
+		if( unicode_character == 0x000d )
+		{
+			/* A carriage return that is not followed by a line feed (LF) is not converted
+			 */
+			if( safe_carriage_return_pending != 0 )
+			{
+				converted_unicode_characters[ converted_unicode_character_index++ ] = 0x000d;
+			}
+			safe_carriage_return_pending = 1;
+		}
+		/* Determine if character is a line feed (LF), either on its own or
+		 * as part of a carriage return followed by a line feed (CRLF)
+		 */
+		else if( unicode_character == 0x000a )
+		{
+			if( newline_conversion == UNACOMMON_NEWLINE_CONVERSION_CRLF )
+			{
+				converted_unicode_characters[ converted_unicode_character_index++ ] = 0x000d;
+				converted_unicode_characters[ converted_unicode_character_index++ ] = 0x000a;
+			}
+			else if( newline_conversion == UNACOMMON_NEWLINE_CONVERSION_CR )
+			{
+				converted_unicode_characters[ converted_unicode_character_index++ ] = 0x000d;
+			}
+			else
+			{
+				converted_unicode_characters[ converted_unicode_character_index++ ] = 0x000a;
+			}
+			safe_carriage_return_pending = 0;
+		}
+		else
+		{
+			if( safe_carriage_return_pending != 0 )
+			{
+				converted_unicode_characters[ converted_unicode_character_index++ ] = 0x000d;
+			}
+			converted_unicode_characters[ converted_unicode_character_index++ ] = unicode_character;
+
+			safe_carriage_return_pending = 0;
+		}
+	}
+	*number_of_converted_unicode_characters = converted_unicode_character_index;
+	*carriage_return_pending                = safe_carriage_return_pending;
+
+	return( 1 );
+}
+
+/* Encodes Unicode characters into the destination buffer in the text output format
+ * The output format is determined once for all the Unicode characters, where
+ * libuna provides a string conversion for the output format it is used
+ * The destination buffer should have room for EXPORT_HANDLE_MAXIMUM_ENCODED_CHARACTER_SIZE
+ * bytes per Unicode character
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_encode_unicode_characters(
+     export_handle_t *export_handle,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t number_of_unicode_characters,
+     uint8_t *destination_buffer,
+     size_t destination_buffer_size,
+     size_t *destination_buffer_index,
+     uint32_t *utf7_stream_base64_data,
+     libcerror_error_t **error )
+{
+	static char *function          = "export_handle_encode_unicode_characters";
+	size_t byte_stream_size        = 0;
+	size_t unicode_character_index = 0;
+	int byte_order                 = 0;
+	int result                     = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( unicode_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Unicode characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_buffer_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination buffer index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_buffer_index > destination_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid destination buffer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf7_stream_base64_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-7 stream base64 data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_unicode_characters == 0 )
+	{
+		return( 1 );
+	}
+	switch( export_handle->text_output_format )
+	{
+		case UNACOMMON_FORMAT_BYTE_STREAM:
+			result = libuna_byte_stream_size_from_utf32(
+			          unicode_characters,
+			          number_of_unicode_characters,
+			          export_handle->text_byte_stream_codepage,
+			          &byte_stream_size,
+			          error );
+
+			if( result == 1 )
+			{
+				if( byte_stream_size > ( destination_buffer_size - *destination_buffer_index ) )
+				{
+					result = -1;
+				}
+			}
+			if( result == 1 )
+			{
+				result = libuna_byte_stream_copy_from_utf32(
+				          &( destination_buffer[ *destination_buffer_index ] ),
+				          destination_buffer_size - *destination_buffer_index,
+				          export_handle->text_byte_stream_codepage,
+				          unicode_characters,
+				          number_of_unicode_characters,
+				          error );
+			}
+			if( result == 1 )
+			{
+				*destination_buffer_index += byte_stream_size;
+			}
+			break;
+
+		case UNACOMMON_FORMAT_UTF7:
+			for( unicode_character_index = 0;
+			     unicode_character_index < number_of_unicode_characters;
+			     unicode_character_index++ )
+			{
+				result = libuna_unicode_character_copy_to_utf7_stream(
+				          unicode_characters[ unicode_character_index ],
+				          destination_buffer,
+				          destination_buffer_size,
+				          destination_buffer_index,
+				          utf7_stream_base64_data,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+			}
+			break;
+
+		case UNACOMMON_FORMAT_UTF8:
+			result = libuna_utf8_string_with_index_copy_from_utf32(
+			          (libuna_utf8_character_t *) destination_buffer,
+			          destination_buffer_size,
+			          destination_buffer_index,
+			          (libuna_utf32_character_t *) unicode_characters,
+			          number_of_unicode_characters,
+			          error );
+			break;
+
+		case UNACOMMON_FORMAT_UTF16BE:
+		case UNACOMMON_FORMAT_UTF16LE:
+			if( export_handle->text_output_format == UNACOMMON_FORMAT_UTF16BE )
+			{
+				byte_order = LIBUNA_ENDIAN_BIG;
+			}
+			else
+			{
+				byte_order = LIBUNA_ENDIAN_LITTLE;
+			}
+			for( unicode_character_index = 0;
+			     unicode_character_index < number_of_unicode_characters;
+			     unicode_character_index++ )
+			{
+				result = libuna_unicode_character_copy_to_utf16_stream(
+				          unicode_characters[ unicode_character_index ],
+				          destination_buffer,
+				          destination_buffer_size,
+				          destination_buffer_index,
+				          byte_order,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+			}
+			break;
+
+		case UNACOMMON_FORMAT_UTF32BE:
+		case UNACOMMON_FORMAT_UTF32LE:
+			if( export_handle->text_output_format == UNACOMMON_FORMAT_UTF32BE )
+			{
+				byte_order = LIBUNA_ENDIAN_BIG;
+			}
+			else
+			{
+				byte_order = LIBUNA_ENDIAN_LITTLE;
+			}
+			for( unicode_character_index = 0;
+			     unicode_character_index < number_of_unicode_characters;
+			     unicode_character_index++ )
+			{
+				result = libuna_unicode_character_copy_to_utf32_stream(
+				          unicode_characters[ unicode_character_index ],
+				          destination_buffer,
+				          destination_buffer_size,
+				          destination_buffer_index,
+				          byte_order,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+			}
+			break;
+
+		default:
+			result = -1;
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+		 "%s: unable to convert output characters.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if an offset in the source data is a boundary where the text can be split
+ * The text is only split between characters and never between a carriage return
+ * and a line feed, a double-byte character set (DBCS) byte stream is only split
+ * after a line feed since that byte is never part of a double-byte character
+ * Returns 1 if the offset is a boundary, 0 if not or -1 on error
+ */
+int export_handle_is_text_chunk_boundary(
+     export_handle_t *export_handle,
+     int stream_format,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t source_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_handle_is_text_chunk_boundary";
+	uint32_t previous_value = 0;
+	uint32_t value          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_data_offset == 0 )
+	 || ( source_data_offset >= source_data_size ) )
+	{
+		return( 1 );
+	}
+	switch( stream_format )
+	{
+		case LIBUNA_STREAM_FORMAT_BYTE_STREAM:
+			if( ( export_handle->text_byte_stream_codepage == LIBUNA_CODEPAGE_WINDOWS_932 )
+			 || ( export_handle->text_byte_stream_codepage == LIBUNA_CODEPAGE_WINDOWS_936 )
+			 || ( export_handle->text_byte_stream_codepage == LIBUNA_CODEPAGE_WINDOWS_949 )
+			 || ( export_handle->text_byte_stream_codepage == LIBUNA_CODEPAGE_WINDOWS_950 ) )
+			{
+				return( (int) ( source_data[ source_data_offset - 1 ] == 0x0a ) );
+			}
+			previous_value = source_data[ source_data_offset - 1 ];
+			value          = source_data[ source_data_offset ];
+
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF8:
+			previous_value = source_data[ source_data_offset - 1 ];
+			value          = source_data[ source_data_offset ];
+
+			/* A continuation byte is part of the previous character
+			 */
+			if( ( value & 0xc0 ) == 0x80 )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN:
+		case LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN:
+			if( ( ( source_data_offset % 2 ) != 0 )
+			 || ( ( source_data_offset + 2 ) > source_data_size ) )
+			{
+				return( 0 );
+			}
+			if( stream_format == LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN )
+			{
+				byte_stream_copy_to_uint16_big_endian(
+				 &( source_data[ source_data_offset - 2 ] ),
+				 previous_value );
+				byte_stream_copy_to_uint16_big_endian(
+				 &( source_data[ source_data_offset ] ),
+				 value );
+			}
+			else
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( source_data[ source_data_offset - 2 ] ),
+				 previous_value );
+				byte_stream_copy_to_uint16_little_endian(
+				 &( source_data[ source_data_offset ] ),
+				 value );
+			}
+			/* A low surrogate is part of the previous character
+			 */
+			if( ( value >= 0xdc00 )
+			 && ( value <= 0xdfff ) )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN:
+		case LIBUNA_STREAM_FORMAT_UTF32_LITTLE_ENDIAN:
+			if( ( ( source_data_offset % 4 ) != 0 )
+			 || ( ( source_data_offset + 4 ) > source_data_size ) )
+			{
+				return( 0 );
+			}
+			if( stream_format == LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 &( source_data[ source_data_offset - 4 ] ),
+				 previous_value );
+				byte_stream_copy_to_uint32_big_endian(
+				 &( source_data[ source_data_offset ] ),
+				 value );
+			}
+			else
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( source_data[ source_data_offset - 4 ] ),
+				 previous_value );
+				byte_stream_copy_to_uint32_little_endian(
+				 &( source_data[ source_data_offset ] ),
+				 value );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported stream format.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( previous_value == 0x0000000dUL )
+	 && ( value == 0x0000000aUL ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of the next chunk of the source data
+ * The chunk ends at the last boundary before the maximum chunk size,
+ * if there is no such boundary the chunk ends at the first boundary after it
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_determine_text_chunk_size(
+     export_handle_t *export_handle,
+     int stream_format,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t maximum_chunk_size,
+     size_t *chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_determine_text_chunk_size";
+	size_t source_data_offset = 0;
+	int result                = 0;
+
+	if( source_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum chunk size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data_size <= maximum_chunk_size )
+	{
+		*chunk_size = source_data_size;
+
+		return( 1 );
+	}
+	for( source_data_offset = maximum_chunk_size;
+	     source_data_offset > 0;
+	     source_data_offset-- )
+	{
+		result = export_handle_is_text_chunk_boundary(
+		          export_handle,
+		          stream_format,
+		          source_data,
+		          source_data_size,
+		          source_data_offset,
+		          error );
+
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( result == 0 )
+	{
+		for( source_data_offset = maximum_chunk_size + 1;
+		     source_data_offset < source_data_size;
+		     source_data_offset++ )
+		{
+			result = export_handle_is_text_chunk_boundary(
+			          export_handle,
+			          stream_format,
+			          source_data,
+			          source_data_size,
+			          source_data_offset,
+			          error );
+
+			if( result != 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid export handle - unsupported encoding mode.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if offset: %" PRIzd " is a chunk boundary.",
+		 function,
+		 source_data_offset );
+
+		return( -1 );
+	}
+	*chunk_size = source_data_offset;
+
+	return( 1 );
+}
+
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+
+/* Converts the source data of a text chunk into its destination buffer
+ * The destination buffer is resized when needed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_convert_text_chunk(
+     export_handle_t *export_handle,
+     int stream_format,
+     export_handle_text_chunk_t *chunk,
+     libuna_unicode_character_t *decoded_characters,
+     libuna_unicode_character_t *converted_characters,
+     libcerror_error_t **error )
+{
+	libuna_stream_decoder_t *stream_decoder        = NULL;
+	libuna_unicode_character_t *unicode_characters = NULL;
+	uint8_t *reallocation                          = NULL;
+	static char *function                          = "export_handle_convert_text_chunk";
+	size_t destination_buffer_size                 = 0;
+	size_t number_of_decoded_characters            = 0;
+	size_t number_of_unicode_characters            = 0;
+	size_t source_data_index                       = 0;
+	uint32_t destination_utf7_stream_base64_data   = 0;
+	uint8_t carriage_return_pending                = 0;
+	uint8_t end_of_input                           = 0;
+	int result                                     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+	if( chunk == NULL )
 	{
-		encoding_mode_string = "decode";
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( decoded_characters == NULL )
 	{
-		encoding_mode_string = "encode";
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded characters.",
+		 function );
+
+		return( -1 );
 	}
-	switch( export_handle->base_encoding )
+	if( ( export_handle->text_newline_conversion != UNACOMMON_NEWLINE_CONVERSION_NONE )
+	 && ( converted_characters == NULL ) )
 	{
-		case UNACOMMON_ENCODING_BASE16:
-			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid converted characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_stream_decoder_initialize(
+	     &stream_decoder,
+	     stream_format,
+	     export_handle->text_byte_stream_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	chunk->destination_buffer_index = 0;
+
+	while( end_of_input == 0 )
+	{
+		number_of_decoded_characters = 0;
+
+		if( source_data_index < chunk->source_data_size )
+		{
+			result = libuna_stream_decoder_decode(
+			          stream_decoder,
+			          chunk->source_data,
+			          chunk->source_data_size,
+			          &source_data_index,
+			          decoded_characters,
+			          EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS,
+			          &number_of_decoded_characters,
+			          error );
+		}
+		else
+		{
+			result = libuna_stream_decoder_finalize(
+			          stream_decoder,
+			          decoded_characters,
+			          EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS,
+			          &number_of_decoded_characters,
+			          error );
+
+			end_of_input = 1;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to convert input character.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle->text_newline_conversion != UNACOMMON_NEWLINE_CONVERSION_NONE )
+		{
+			if( export_handle_convert_newlines(
+			     export_handle,
+			     decoded_characters,
+			     number_of_decoded_characters,
+			     converted_characters,
+			     EXPORT_HANDLE_NUMBER_OF_CONVERTED_CHARACTERS,
+			     &number_of_unicode_characters,
+			     &carriage_return_pending,
+			     error ) != 1 )
 			{
-				source_buffer_size      = ( EXPORT_HANDLE_BUFFER_SIZE / 2 ) * 2;
-				destination_buffer_size = EXPORT_HANDLE_BUFFER_SIZE / 2;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to convert newlines.",
+				 function );
+
+				goto on_error;
 			}
-			else
+			/* A chunk never ends between a carriage return and a line feed
+			 */
+			if( ( end_of_input != 0 )
+			 && ( carriage_return_pending != 0 ) )
 			{
-				source_buffer_size       = EXPORT_HANDLE_BUFFER_SIZE;
-				destination_buffer_size  = EXPORT_HANDLE_BUFFER_SIZE * 2;
-				destination_buffer_size += ( destination_buffer_size / 76 ) + 1;
+				converted_characters[ number_of_unicode_characters++ ] = 0x000d;
+
+				carriage_return_pending = 0;
 			}
-			encoding_string = "base16";
+			unicode_characters = converted_characters;
+		}
+		else
+		{
+			unicode_characters           = decoded_characters;
+			number_of_unicode_characters = number_of_decoded_characters;
+		}
+		if( number_of_unicode_characters == 0 )
+		{
+			continue;
+		}
+		destination_buffer_size = chunk->destination_buffer_index + ( number_of_unicode_characters * EXPORT_HANDLE_MAXIMUM_ENCODED_CHARACTER_SIZE );
 
-			break;
+		if( destination_buffer_size > chunk->destination_buffer_size )
+		{
+			if( destination_buffer_size < ( 2 * chunk->destination_buffer_size ) )
+			{
+				destination_buffer_size = 2 * chunk->destination_buffer_size;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            chunk->destination_buffer,
+			                            sizeof( uint8_t ) * destination_buffer_size );
 
-		case UNACOMMON_ENCODING_BASE32:
-			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
+			if( reallocation == NULL )
 			{
-				source_buffer_size      = ( EXPORT_HANDLE_BUFFER_SIZE / 5 ) * 5;
-				destination_buffer_size = ( EXPORT_HANDLE_BUFFER_SIZE * 5 ) / 8;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize destination buffer.",
+				 function );
+
+				goto on_error;
 			}
-			else
+			chunk->destination_buffer      = reallocation;
+			chunk->destination_buffer_size = destination_buffer_size;
+		}
+		if( export_handle_encode_unicode_characters(
+		     export_handle,
+		     unicode_characters,
+		     number_of_unicode_characters,
+		     chunk->destination_buffer,
+		     chunk->destination_buffer_size,
+		     &( chunk->destination_buffer_index ),
+		     &destination_utf7_stream_base64_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to convert output characters.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libuna_stream_decoder_free(
+	     &stream_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream_decoder != NULL )
+	{
+		libuna_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Converts the chunks of a text conversion
+ * Each thread takes the next part of the source data and converts it into
+ * the next free chunk, the chunks are written in order by the export function
+ * The error of a failed chunk is kept in the chunk
+ * Returns NULL
+ */
+void *export_handle_text_conversion_thread(
+       void *arguments )
+{
+	export_handle_text_chunk_t *chunk                = NULL;
+	export_handle_text_conversion_t *conversion      = NULL;
+	libcerror_error_t *error                         = NULL;
+	libuna_unicode_character_t *converted_characters = NULL;
+	libuna_unicode_character_t *decoded_characters   = NULL;
+	size_t chunk_size                                = 0;
+	int result                                       = 0;
+
+	conversion = (export_handle_text_conversion_t *) arguments;
+
+	if( conversion == NULL )
+	{
+		return( NULL );
+	}
+	decoded_characters = (libuna_unicode_character_t *) memory_allocate(
+	                                                     sizeof( libuna_unicode_character_t ) * EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS );
+
+	if( ( decoded_characters != NULL )
+	 && ( conversion->export_handle->text_newline_conversion != UNACOMMON_NEWLINE_CONVERSION_NONE ) )
+	{
+		converted_characters = (libuna_unicode_character_t *) memory_allocate(
+		                                                       sizeof( libuna_unicode_character_t ) * EXPORT_HANDLE_NUMBER_OF_CONVERTED_CHARACTERS );
+
+		if( converted_characters == NULL )
+		{
+			memory_free(
+			 decoded_characters );
+
+			decoded_characters = NULL;
+		}
+	}
+	pthread_mutex_lock(
+	 &( conversion->mutex ) );
+
+	if( decoded_characters == NULL )
+	{
+		conversion->abort = 1;
+	}
+	while( ( conversion->abort == 0 )
+	    && ( conversion->source_data_offset < conversion->source_data_size ) )
+	{
+		chunk = &( conversion->chunks[ conversion->next_chunk_number % conversion->number_of_chunks ] );
+
+		if( chunk->state != EXPORT_HANDLE_CHUNK_STATE_EMPTY )
+		{
+			pthread_cond_wait(
+			 &( conversion->chunk_state_changed ),
+			 &( conversion->mutex ) );
+
+			continue;
+		}
+		if( export_handle_determine_text_chunk_size(
+		     conversion->export_handle,
+		     conversion->stream_format,
+		     &( conversion->source_data[ conversion->source_data_offset ] ),
+		     conversion->source_data_size - conversion->source_data_offset,
+		     EXPORT_HANDLE_BUFFER_SIZE,
+		     &chunk_size,
+		     &error ) != 1 )
+		{
+			/* Only the error of the first thread that aborts is kept
+			 */
+			if( conversion->error == NULL )
 			{
-				source_buffer_size       = ( EXPORT_HANDLE_BUFFER_SIZE / 8 ) * 8;
-				destination_buffer_size  = ( ( EXPORT_HANDLE_BUFFER_SIZE / 5 ) + 1 ) * 8;
-				destination_buffer_size += ( destination_buffer_size / 76 ) + 1;
+				conversion->error = error;
+				error             = NULL;
 			}
-			encoding_string = "base32";
+			conversion->abort = 1;
 
 			break;
+		}
+		chunk->source_data      = &( conversion->source_data[ conversion->source_data_offset ] );
+		chunk->source_data_size = chunk_size;
+		chunk->state            = EXPORT_HANDLE_CHUNK_STATE_CONVERTING;
 
-		case UNACOMMON_ENCODING_BASE32HEX:
-			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-			{
-				source_buffer_size      = ( EXPORT_HANDLE_BUFFER_SIZE / 5 ) * 5;
-				destination_buffer_size = ( EXPORT_HANDLE_BUFFER_SIZE * 5 ) / 8;
-			}
-			else
-			{
-				source_buffer_size       = ( EXPORT_HANDLE_BUFFER_SIZE / 8 ) * 8;
-				destination_buffer_size  = ( ( EXPORT_HANDLE_BUFFER_SIZE / 5 ) + 1 ) * 8;
-				destination_buffer_size += ( destination_buffer_size / 76 ) + 1;
-			}
-			encoding_string = "base32hex";
+		conversion->source_data_offset += chunk_size;
+		conversion->next_chunk_number  += 1;
 
-			break;
+		pthread_mutex_unlock(
+		 &( conversion->mutex ) );
 
-		case UNACOMMON_ENCODING_BASE64:
-			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-			{
-				source_buffer_size      = ( EXPORT_HANDLE_BUFFER_SIZE / 3 ) * 3;
-				destination_buffer_size = ( EXPORT_HANDLE_BUFFER_SIZE * 3 ) / 4;
-			}
-			else
-			{
-				source_buffer_size       = ( EXPORT_HANDLE_BUFFER_SIZE / 4 ) * 4;
-				destination_buffer_size  = ( ( EXPORT_HANDLE_BUFFER_SIZE / 3 ) + 1 ) * 4;
-				destination_buffer_size += ( destination_buffer_size / 76 ) + 1;
-			}
-			encoding_string = "base64";
+		result = export_handle_convert_text_chunk(
+		          conversion->export_handle,
+		          conversion->stream_format,
+		          chunk,
+		          decoded_characters,
+		          converted_characters,
+		          &error );
 
-			break;
+		pthread_mutex_lock(
+		 &( conversion->mutex ) );
 
-		case UNACOMMON_ENCODING_BASE64URL:
-			if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-			{
-				source_buffer_size      = ( EXPORT_HANDLE_BUFFER_SIZE / 3 ) * 3;
-				destination_buffer_size = ( EXPORT_HANDLE_BUFFER_SIZE * 3 ) / 4;
-			}
-			else
-			{
-				source_buffer_size       = ( EXPORT_HANDLE_BUFFER_SIZE / 4 ) * 4;
-				destination_buffer_size  = ( ( EXPORT_HANDLE_BUFFER_SIZE / 3 ) + 1 ) * 4;
-				destination_buffer_size += ( destination_buffer_size / 76 ) + 1;
-			}
-			encoding_string = "base64url";
+		if( result != 1 )
+		{
+			chunk->state = EXPORT_HANDLE_CHUNK_STATE_FAILED;
+			chunk->error = error;
+			error        = NULL;
+		}
+		else
+		{
+			chunk->state = EXPORT_HANDLE_CHUNK_STATE_CONVERTED;
+		}
+		pthread_cond_broadcast(
+		 &( conversion->chunk_state_changed ) );
+	}
+	pthread_cond_broadcast(
+	 &( conversion->chunk_state_changed ) );
 
-			break;
+	pthread_mutex_unlock(
+	 &( conversion->mutex ) );
+
+	if( error != NULL )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	if( converted_characters != NULL )
+	{
+		memory_free(
+		 converted_characters );
+	}
+	if( decoded_characters != NULL )
+	{
+		memory_free(
+		 decoded_characters );
+	}
+	return( NULL );
+}
+
+/* Exports the source data of the text encoded input using multiple threads
+ * The source data is split into chunks that are converted concurrently
+ * and written to the destination in order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_text_encoded_input_in_parallel(
+     export_handle_t *export_handle,
+     process_status_t *process_status,
+     int stream_format,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size64_t *export_count,
+     libcerror_error_t **error )
+{
+	export_handle_text_chunk_t *chunk          = NULL;
+	export_handle_text_conversion_t conversion;
+	pthread_t *threads                         = NULL;
+	static char *function                      = "export_handle_export_text_encoded_input_in_parallel";
+	uint64_t chunk_number                      = 0;
+	ssize_t write_count                        = 0;
+	int chunk_index                            = 0;
+	int number_of_threads                      = 0;
+	int thread_index                           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( source_buffer_size == 0 )
+	if( ( export_handle->number_of_threads < 1 )
+	 || ( export_handle->number_of_threads > UNACOMMON_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing source buffer size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of threads value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	source_buffer = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * source_buffer_size );
+	if( source_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data.",
+		 function );
 
-	if( source_buffer == NULL )
+		return( -1 );
+	}
+	if( export_count == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create source buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export count.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( destination_buffer_size == 0 )
+	if( memory_set(
+	     &conversion,
+	     0,
+	     sizeof( export_handle_text_conversion_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing destination buffer size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear conversion.",
 		 function );
 
 		return( -1 );
 	}
-	destination_buffer = (uint8_t *) memory_allocate(
-	                                  sizeof( uint8_t ) * destination_buffer_size );
+	conversion.export_handle    = export_handle;
+	conversion.stream_format    = stream_format;
+	conversion.source_data      = source_data;
+	conversion.source_data_size = source_data_size;
 
-	if( destination_buffer == NULL )
+	/* Every thread can convert a chunk while the chunks that are converted
+	 * before it are waiting to be written
+	 */
+	conversion.number_of_chunks = 2 * export_handle->number_of_threads;
+
+	conversion.chunks = (export_handle_text_chunk_t *) memory_allocate(
+	                                                    sizeof( export_handle_text_chunk_t ) * conversion.number_of_chunks );
+
+	if( conversion.chunks == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create destination buffer.",
+		 "%s: unable to create chunks.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( 1 )
+	if( memory_set(
+	     conversion.chunks,
+	     0,
+	     sizeof( export_handle_text_chunk_t ) * conversion.number_of_chunks ) == NULL )
 	{
-		read_count = libcfile_file_read_buffer(
-		              export_handle->source_file,
-		              source_buffer,
-		              source_buffer_size,
-		              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
 
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from source.",
-			 function );
+		memory_free(
+		 conversion.chunks );
 
-			goto on_error;
-		}
-		export_count += read_count;
+		return( -1 );
+	}
+	threads = (pthread_t *) memory_allocate(
+	                         sizeof( pthread_t ) * export_handle->number_of_threads );
 
-		if( read_count == 0 )
-		{
-			break;
-		}
-		switch( export_handle->base_encoding )
-		{
-			case UNACOMMON_ENCODING_BASE16:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base16_stream_size_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE16_VARIANT_CASE_MIXED \
-					           | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE,
-					          LIBUNA_BASE16_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base16_stream_size_from_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE16_VARIANT_CASE_UPPER \
-					           | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_76,
-					          error );
-				}
-				break;
+	if( threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
 
-			case UNACOMMON_ENCODING_BASE32:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base32_stream_size_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          LIBUNA_BASE32_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base32_stream_size_from_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64 \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          error );
-				}
-				break;
+		memory_free(
+		 conversion.chunks );
 
-			case UNACOMMON_ENCODING_BASE32HEX:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base32_stream_size_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_HEX \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          LIBUNA_BASE32_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base32_stream_size_from_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_HEX \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64 \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          error );
-				}
-				break;
+		return( -1 );
+	}
+	if( pthread_mutex_init(
+	     &( conversion.mutex ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
 
-			case UNACOMMON_ENCODING_BASE64:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base64_stream_size_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL \
-					           | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE \
-					           | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
-					          LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base64_stream_size_from_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE64_VARIANT_MIME,
-					          error );
-				}
-				break;
+		memory_free(
+		 threads );
+		memory_free(
+		 conversion.chunks );
 
-			case UNACOMMON_ENCODING_BASE64URL:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base64_stream_size_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE64_VARIANT_URL,
-					          LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base64_stream_size_from_byte_stream(
-					          source_buffer,
-					          read_count,
-					          &write_size,
-					          LIBUNA_BASE64_VARIANT_URL,
-					          error );
-				}
-				break;
-		}
-		if( result != 1 )
+		return( -1 );
+	}
+	if( pthread_cond_init(
+	     &( conversion.chunk_state_changed ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		pthread_mutex_destroy(
+		 &( conversion.mutex ) );
+		memory_free(
+		 threads );
+		memory_free(
+		 conversion.chunks );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < export_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( pthread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     &export_handle_text_conversion_thread,
+		     (void *) &conversion ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to determine %s size of %s source data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
 			 function,
-			 encoding_string,
-			 encoding_mode_string );
+			 thread_index );
 
 			goto on_error;
 		}
-		switch( export_handle->base_encoding )
-		{
-			case UNACOMMON_ENCODING_BASE16:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base16_stream_copy_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          destination_buffer,
-					          destination_buffer_size,
-					          LIBUNA_BASE16_VARIANT_CASE_MIXED \
-					           | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE,
-					          LIBUNA_BASE16_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base16_stream_copy_from_byte_stream(
-					          destination_buffer,
-					          destination_buffer_size,
-					          source_buffer,
-					          read_count,
-					          LIBUNA_BASE16_VARIANT_CASE_UPPER \
-					           | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_76,
-					          error );
-				}
-				break;
-
-			case UNACOMMON_ENCODING_BASE32:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base32_stream_copy_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          destination_buffer,
-					          destination_buffer_size,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          LIBUNA_BASE32_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base32_stream_copy_from_byte_stream(
-					          destination_buffer,
-					          destination_buffer_size,
-					          source_buffer,
-					          read_count,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64 \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          error );
-				}
-				break;
+		number_of_threads++;
+	}
+	/* The chunks are written in the order of the source data
+	 */
+	for( chunk_number = 0;
+	     ;
+	     chunk_number++ )
+	{
+		chunk = &( conversion.chunks[ chunk_number % conversion.number_of_chunks ] );
 
-			case UNACOMMON_ENCODING_BASE32HEX:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base32_stream_copy_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          destination_buffer,
-					          destination_buffer_size,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_HEX \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          LIBUNA_BASE32_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base32_stream_copy_from_byte_stream(
-					          destination_buffer,
-					          destination_buffer_size,
-					          source_buffer,
-					          read_count,
-					          LIBUNA_BASE32_VARIANT_ALPHABET_HEX \
-					           | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_64 \
-					           | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED,
-					          error );
-				}
-				break;
+		pthread_mutex_lock(
+		 &( conversion.mutex ) );
 
-			case UNACOMMON_ENCODING_BASE64:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base64_stream_copy_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          destination_buffer,
-					          destination_buffer_size,
-					          LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL \
-					           | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE \
-					           | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
-					          LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base64_stream_copy_from_byte_stream(
-					          destination_buffer,
-					          destination_buffer_size,
-					          source_buffer,
-					          read_count,
-					          LIBUNA_BASE64_VARIANT_MIME,
-					          error );
-				}
+		while( ( chunk_number >= conversion.next_chunk_number )
+		    || ( chunk->state == EXPORT_HANDLE_CHUNK_STATE_CONVERTING ) )
+		{
+			if( ( chunk_number >= conversion.next_chunk_number )
+			 && ( ( conversion.abort != 0 )
+			  ||  ( conversion.source_data_offset >= conversion.source_data_size ) ) )
+			{
 				break;
+			}
+			pthread_cond_wait(
+			 &( conversion.chunk_state_changed ),
+			 &( conversion.mutex ) );
+		}
+		if( chunk_number >= conversion.next_chunk_number )
+		{
+			chunk = NULL;
+		}
+		pthread_mutex_unlock(
+		 &( conversion.mutex ) );
 
-			case UNACOMMON_ENCODING_BASE64URL:
-				if( export_handle->base_encoding_mode == UNACOMMON_ENCODING_MODE_DECODE )
-				{
-					result = libuna_base64_stream_copy_to_byte_stream(
-					          source_buffer,
-					          read_count,
-					          destination_buffer,
-					          destination_buffer_size,
-					          LIBUNA_BASE64_VARIANT_URL,
-					          LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
-					          error );
-				}
-				else
-				{
-					result = libuna_base64_stream_copy_from_byte_stream(
-					          destination_buffer,
-					          destination_buffer_size,
-					          source_buffer,
-					          read_count,
-					          LIBUNA_BASE64_VARIANT_URL,
-					          error );
-				}
-				break;
+		if( chunk == NULL )
+		{
+			break;
 		}
-		if( result != 1 )
+		if( chunk->state == EXPORT_HANDLE_CHUNK_STATE_FAILED )
 		{
+			export_handle_take_thread_error(
+			 &( chunk->error ),
+			 error );
+
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to %s %s source data.",
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to convert chunk: %" PRIu64 " at offset: %" PRIzd ".",
 			 function,
-			 encoding_string,
-			 encoding_mode_string );
+			 chunk_number,
+			 (size_t) ( chunk->source_data - source_data ) );
 
 			goto on_error;
 		}
-		write_count = libcfile_file_write_buffer(
-			       export_handle->destination_file,
-			       destination_buffer,
-			       write_size,
-			       error );
-
-		if( write_count < 0 )
+		if( chunk->destination_buffer_index > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to destination.",
-			 function );
+			write_count = export_handle_write_destination(
+			               export_handle,
+			               chunk->destination_buffer,
+			               chunk->destination_buffer_index,
+			               error );
+
+			if( write_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to destination.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
+		*export_count += chunk->source_data_size;
+
+		pthread_mutex_lock(
+		 &( conversion.mutex ) );
+
+		chunk->state = EXPORT_HANDLE_CHUNK_STATE_EMPTY;
+
+		pthread_cond_broadcast(
+		 &( conversion.chunk_state_changed ) );
+
+		pthread_mutex_unlock(
+		 &( conversion.mutex ) );
+
 		if( process_status_update_unknown_total(
 		     process_status,
-		     export_count,
+		     *export_count,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1567,55 +4239,111 @@ int export_handle_export_base_encoded_input(
 			goto on_error;
 		}
 	}
-	if( process_status_stop(
-	     process_status,
-	     (size64_t) export_count,
-	     PROCESS_STATUS_COMPLETED,
-	     error ) != 1 )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	number_of_threads = 0;
+
+	if( conversion.abort != 0 )
 	{
+		export_handle_take_thread_error(
+		 &( conversion.error ),
+		 error );
+
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to stop process status.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to convert source data.",
 		 function );
 
 		goto on_error;
 	}
+	pthread_cond_destroy(
+	 &( conversion.chunk_state_changed ) );
+	pthread_mutex_destroy(
+	 &( conversion.mutex ) );
+
+	for( chunk_index = 0;
+	     chunk_index < conversion.number_of_chunks;
+	     chunk_index++ )
+	{
+		if( conversion.chunks[ chunk_index ].destination_buffer != NULL )
+		{
+			memory_free(
+			 conversion.chunks[ chunk_index ].destination_buffer );
+		}
+	}
 	memory_free(
-	 source_buffer );
-
-	source_buffer = NULL;
-
+	 conversion.chunks );
 	memory_free(
-	 destination_buffer );
-
-	destination_buffer = NULL;
+	 threads );
 
 	return( 1 );
 
 on_error:
-	if( process_status != NULL )
+	if( number_of_threads > 0 )
 	{
-		process_status_stop(
-		 process_status,
-		 (size64_t) export_count,
-		 PROCESS_STATUS_FAILED,
-		 NULL );
+		pthread_mutex_lock(
+		 &( conversion.mutex ) );
+
+		conversion.abort = 1;
+
+		pthread_cond_broadcast(
+		 &( conversion.chunk_state_changed ) );
+
+		pthread_mutex_unlock(
+		 &( conversion.mutex ) );
+
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			pthread_join(
+			 threads[ thread_index ],
+			 NULL );
+		}
 	}
-	if( destination_buffer != NULL )
+	if( conversion.error != NULL )
 	{
-		memory_free(
-		 destination_buffer );
+		libcerror_error_free(
+		 &( conversion.error ) );
 	}
-	if( source_buffer != NULL )
+	pthread_cond_destroy(
+	 &( conversion.chunk_state_changed ) );
+	pthread_mutex_destroy(
+	 &( conversion.mutex ) );
+
+	for( chunk_index = 0;
+	     chunk_index < conversion.number_of_chunks;
+	     chunk_index++ )
 	{
-		memory_free(
-		 source_buffer );
+		if( conversion.chunks[ chunk_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( conversion.chunks[ chunk_index ].error ) );
+		}
+		if( conversion.chunks[ chunk_index ].destination_buffer != NULL )
+		{
+			memory_free(
+			 conversion.chunks[ chunk_index ].destination_buffer );
+		}
 	}
+	memory_free(
+	 conversion.chunks );
+	memory_free(
+	 threads );
+
 	return( -1 );
 }
 
+#endif /* defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) */
+
 /* Exports the text-encoded source file to the destination file
  * Returns the number of bytes of the source processed or -1 on error
  */
@@ -1624,26 +4352,30 @@ int export_handle_export_text_encoded_input(
      process_status_t *process_status,
      libcerror_error_t **error )
 {
-	libuna_unicode_character_t unicode_character[ 2 ];
-
-	uint8_t *destination_buffer                  = NULL;
-	uint8_t *source_buffer                       = NULL;
-	static char *function                        = "export_handle_export_text_encoded_input";
-	size64_t export_count                        = 0;
-	size_t destination_buffer_index              = 0;
-	size_t destination_buffer_size               = EXPORT_HANDLE_BUFFER_SIZE;
-	size_t last_source_buffer_index              = 0;
-	size_t realignment_iterator                  = 0;
-	size_t source_buffer_index                   = 0;
-	size_t source_buffer_size                    = EXPORT_HANDLE_BUFFER_SIZE;
-	ssize_t read_count                           = 0;
-	ssize_t write_count                          = 0;
-	uint32_t destination_utf7_stream_base64_data = 0;
-	uint32_t source_utf7_stream_base64_data      = 0;
-	uint8_t analyze_first_character              = 1;
-	uint8_t number_of_unicode_characters         = 0;
-	uint8_t unicode_character_index              = 0;
-	int result                                   = 1;
+	libuna_stream_decoder_t *stream_decoder            = NULL;
+	libuna_unicode_character_t *converted_characters   = NULL;
+	libuna_unicode_character_t *decoded_characters     = NULL;
+	libuna_unicode_character_t *unicode_characters     = NULL;
+	uint8_t *destination_buffer                        = NULL;
+	uint8_t *source_buffer                             = NULL;
+	const uint8_t *source_data                         = NULL;
+	static char *function                              = "export_handle_export_text_encoded_input";
+	size64_t export_count                              = 0;
+	size_t destination_buffer_index                    = 0;
+	size_t destination_buffer_size                     = EXPORT_HANDLE_BUFFER_SIZE;
+	size_t destination_buffer_tail_size                = 0;
+	size_t number_of_decoded_characters                = 0;
+	size_t number_of_unicode_characters                = 0;
+	size_t source_buffer_index                         = 0;
+	size_t source_buffer_size                          = EXPORT_HANDLE_BUFFER_SIZE;
+	ssize_t read_count                                 = 0;
+	ssize_t write_count                                = 0;
+	uint32_t destination_utf7_stream_base64_data       = 0;
+	uint8_t analyze_first_character                    = 1;
+	uint8_t carriage_return_pending                    = 0;
+	uint8_t end_of_input                               = 0;
+	int stream_format                                  = 0;
+	int result                                         = 1;
 
 	if( export_handle == NULL )
 	{
@@ -1716,34 +4448,70 @@ int export_handle_export_text_encoded_input(
 
 		return( -1 );
 	}
-	source_buffer = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * source_buffer_size );
+	/* A mapped source is decoded directly from the mapping
+	 */
+	if( export_handle->source_mapping == NULL )
+	{
+		source_buffer = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * source_buffer_size );
+
+		if( source_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	destination_buffer = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * destination_buffer_size );
 
-	if( source_buffer == NULL )
+	if( destination_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create source buffer.",
+		 "%s: unable to create destination buffer.",
 		 function );
 
 		goto on_error;
 	}
-	destination_buffer = (uint8_t *) memory_allocate(
-	                                  sizeof( uint8_t ) * destination_buffer_size );
+	decoded_characters = (libuna_unicode_character_t *) memory_allocate(
+	                                                     sizeof( libuna_unicode_character_t ) * EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS );
 
-	if( destination_buffer == NULL )
+	if( decoded_characters == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create destination buffer.",
+		 "%s: unable to create decoded characters.",
 		 function );
 
 		goto on_error;
 	}
+	if( export_handle->text_newline_conversion != UNACOMMON_NEWLINE_CONVERSION_NONE )
+	{
+		converted_characters = (libuna_unicode_character_t *) memory_allocate(
+		                                                       sizeof( libuna_unicode_character_t ) * EXPORT_HANDLE_NUMBER_OF_CONVERTED_CHARACTERS );
+
+		if( converted_characters == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create converted characters.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( export_handle->text_export_byte_order_mark != 0 )
 	{
 		switch( export_handle->text_output_format )
@@ -1808,12 +4576,13 @@ int export_handle_export_text_encoded_input(
 			goto on_error;
 		}
 	}
-	while( 1 )
+	while( end_of_input == 0 )
 	{
-		read_count = libcfile_file_read_buffer(
-		              export_handle->source_file,
-		              &( source_buffer[ source_buffer_index ] ),
-		              source_buffer_size - source_buffer_index,
+		read_count = export_handle_read_source(
+		              export_handle,
+		              source_buffer,
+		              source_buffer_size,
+		              &source_data,
 		              error );
 
 		if( read_count < 0 )
@@ -1828,19 +4597,26 @@ int export_handle_export_text_encoded_input(
 			goto on_error;
 		}
 		export_count       += read_count;
-		read_count         += (ssize_t) source_buffer_index;
 		source_buffer_index = 0;
 
 		if( read_count == 0 )
 		{
-			break;
+			if( stream_decoder == NULL )
+			{
+				/* An empty source is exported without a byte order mark
+				 */
+				destination_buffer_index = 0;
+
+				break;
+			}
+			end_of_input = 1;
 		}
 		if( analyze_first_character != 0 )
 		{
 			if( ( read_count >= 3 )
-			 && ( source_buffer[ 0 ] == 0xef )
-			 && ( source_buffer[ 1 ] == 0xbb )
-			 && ( source_buffer[ 2 ] == 0xbf ) )
+			 && ( source_data[ 0 ] == 0xef )
+			 && ( source_data[ 1 ] == 0xbb )
+			 && ( source_data[ 2 ] == 0xbf ) )
 			{
 				if( export_handle->text_input_format == UNACOMMON_FORMAT_AUTO_DETECT )
 				{
@@ -1852,8 +4628,8 @@ int export_handle_export_text_encoded_input(
 				}
 			}
 			else if( ( read_count >= 2 )
-			      && ( source_buffer[ 0 ] == 0xfe )
-			      && ( source_buffer[ 1 ] == 0xff ) )
+			      && ( source_data[ 0 ] == 0xfe )
+			      && ( source_data[ 1 ] == 0xff ) )
 			{
 				if( export_handle->text_input_format == UNACOMMON_FORMAT_AUTO_DETECT )
 				{
@@ -1865,12 +4641,12 @@ int export_handle_export_text_encoded_input(
 				}
 			}
 			else if( ( read_count >= 2 )
-			      && ( source_buffer[ 0 ] == 0xff )
-			      && ( source_buffer[ 1 ] == 0xfe ) )
+			      && ( source_data[ 0 ] == 0xff )
+			      && ( source_data[ 1 ] == 0xfe ) )
 			{
 				if( ( read_count >= 4 )
-				 && ( source_buffer[ 2 ] == 0x00 )
-			         && ( source_buffer[ 3 ] == 0x00 ) )
+				 && ( source_data[ 2 ] == 0x00 )
+			         && ( source_data[ 3 ] == 0x00 ) )
 				{
 					if( export_handle->text_input_format == UNACOMMON_FORMAT_AUTO_DETECT )
 					{
@@ -1894,10 +4670,10 @@ int export_handle_export_text_encoded_input(
 				}
 			}
 			else if( ( read_count >= 4 )
-			      && ( source_buffer[ 0 ] == 0x00 )
-			      && ( source_buffer[ 1 ] == 0x00 )
-			      && ( source_buffer[ 1 ] == 0xfe )
-			      && ( source_buffer[ 1 ] == 0xff ) )
+			      && ( source_data[ 0 ] == 0x00 )
+			      && ( source_data[ 1 ] == 0x00 )
+			      && ( source_data[ 1 ] == 0xfe )
+			      && ( source_data[ 1 ] == 0xff ) )
 			{
 				if( export_handle->text_input_format == UNACOMMON_FORMAT_AUTO_DETECT )
 				{
@@ -1912,100 +4688,138 @@ int export_handle_export_text_encoded_input(
 			{
 				export_handle->text_input_format = UNACOMMON_FORMAT_BYTE_STREAM;
 			}
-			read_count -= (ssize_t) source_buffer_index;
-
-			analyze_first_character = 0;
-		}
-		last_source_buffer_index = source_buffer_index;
-
-		while( read_count > 0 )
-		{
-			/* Sanity check
-			 */
-			if( source_buffer_index >= source_buffer_size )
-			{
-				break;
-			}
-			/* Make sure to have at least room for a 6 byte character in the destination buffer
-			 */
-		 	if( destination_buffer_index >= ( destination_buffer_size - 5 ) )
-			{
-				break;
-			}
 			switch( export_handle->text_input_format )
 			{
 				case UNACOMMON_FORMAT_BYTE_STREAM:
-					result = libuna_unicode_character_copy_from_byte_stream(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-						  export_handle->text_byte_stream_codepage,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_BYTE_STREAM;
 					break;
 
 				case UNACOMMON_FORMAT_UTF7:
-					result = libuna_unicode_character_copy_from_utf7_stream(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-						  &source_utf7_stream_base64_data,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_UTF7;
 					break;
 
 				case UNACOMMON_FORMAT_UTF8:
-					result = libuna_unicode_character_copy_from_utf8(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_UTF8;
 					break;
 
 				case UNACOMMON_FORMAT_UTF16BE:
-					result = libuna_unicode_character_copy_from_utf16_stream(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-						  LIBUNA_ENDIAN_BIG,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_UTF16_BIG_ENDIAN;
 					break;
 
 				case UNACOMMON_FORMAT_UTF16LE:
-					result = libuna_unicode_character_copy_from_utf16_stream(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-						  LIBUNA_ENDIAN_LITTLE,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_UTF16_LITTLE_ENDIAN;
 					break;
 
 				case UNACOMMON_FORMAT_UTF32BE:
-					result = libuna_unicode_character_copy_from_utf32_stream(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-						  LIBUNA_ENDIAN_BIG,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_UTF32_BIG_ENDIAN;
 					break;
 
 				case UNACOMMON_FORMAT_UTF32LE:
-					result = libuna_unicode_character_copy_from_utf32_stream(
-						  &unicode_character[ unicode_character_index ],
-						  source_buffer,
-						  source_buffer_size,
-						  &source_buffer_index,
-						  LIBUNA_ENDIAN_LITTLE,
-					          error );
+					stream_format = LIBUNA_STREAM_FORMAT_UTF32_LITTLE_ENDIAN;
 					break;
+			}
+			if( libuna_stream_decoder_initialize(
+			     &stream_decoder,
+			     stream_format,
+			     export_handle->text_byte_stream_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create stream decoder.",
+				 function );
 
-				default:
-					result = -1;
-					break;
+				goto on_error;
+			}
+			analyze_first_character = 0;
+
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+			/* A mapped source is converted in parallel, except when
+			 * UTF-7 is used since its base64 encoded sequences cannot be split
+			 */
+			if( ( export_handle->number_of_threads > 1 )
+			 && ( export_handle->source_mapping != NULL )
+			 && ( stream_format != LIBUNA_STREAM_FORMAT_UTF7 )
+			 && ( export_handle->text_output_format != UNACOMMON_FORMAT_UTF7 ) )
+			{
+				if( destination_buffer_index > 0 )
+				{
+					write_count = export_handle_write_destination(
+					               export_handle,
+					               destination_buffer,
+					               destination_buffer_index,
+					               error );
+
+					if( write_count < 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write to destination.",
+						 function );
+
+						goto on_error;
+					}
+					destination_buffer_index = 0;
+				}
+				/* The first read started at the beginning of the mapping
+				 */
+				export_count = (size64_t) source_buffer_index;
+
+				if( export_handle_export_text_encoded_input_in_parallel(
+				     export_handle,
+				     process_status,
+				     stream_format,
+				     &( source_data[ source_buffer_index ] ),
+				     export_handle->source_mapping_size - source_buffer_index,
+				     &export_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to convert source in parallel.",
+					 function );
+
+					goto on_error;
+				}
+				export_handle->source_mapping_offset = export_handle->source_mapping_size;
+
+				break;
+			}
+#endif /* defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) */
+		}
+		/* The stream decoder keeps the bytes of a character that is split
+		 * between successive reads until the next read completes it
+		 */
+		do
+		{
+			number_of_decoded_characters = 0;
+
+			if( end_of_input == 0 )
+			{
+				result = libuna_stream_decoder_decode(
+				          stream_decoder,
+				          source_data,
+				          (size_t) read_count,
+				          &source_buffer_index,
+				          decoded_characters,
+				          EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS,
+				          &number_of_decoded_characters,
+				          error );
+			}
+			else
+			{
+				result = libuna_stream_decoder_finalize(
+				          stream_decoder,
+				          decoded_characters,
+				          EXPORT_HANDLE_NUMBER_OF_DECODED_CHARACTERS,
+				          &number_of_decoded_characters,
+				          error );
 			}
 			if( result != 1 )
 			{
@@ -2018,188 +4832,122 @@ int export_handle_export_text_encoded_input(
 
 				goto on_error;
 			}
-			number_of_unicode_characters++;
-
-			read_count -= source_buffer_index - last_source_buffer_index;
-
-			last_source_buffer_index = source_buffer_index;
-
+			/* The newline conversion and the output format are applied to
+			 * all the decoded characters at once
+			 */
 			if( export_handle->text_newline_conversion != UNACOMMON_NEWLINE_CONVERSION_NONE )
 			{
-				/* Determine if character is a line feed (LF)
-				 */
-				if( unicode_character[ unicode_character_index ] == 0x000a )
+				if( export_handle_convert_newlines(
+				     export_handle,
+				     decoded_characters,
+				     number_of_decoded_characters,
+				     converted_characters,
+				     EXPORT_HANDLE_NUMBER_OF_CONVERTED_CHARACTERS,
+				     &number_of_unicode_characters,
+				     &carriage_return_pending,
+				     error ) != 1 )
 				{
-					if( export_handle->text_newline_conversion == UNACOMMON_NEWLINE_CONVERSION_CRLF )
-					{
-						if( unicode_character_index == 0 )
-						{
-							unicode_character[ unicode_character_index     ] = 0x000d;
-							unicode_character[ unicode_character_index + 1 ] = 0x000a;
-			
-							number_of_unicode_characters++;
-						}
-					}
-					else if( export_handle->text_newline_conversion == UNACOMMON_NEWLINE_CONVERSION_CR )
-					{
-						if( unicode_character_index == 0 )
-						{
-							unicode_character[ unicode_character_index ] = 0x000d;
-						}
-						else if( unicode_character_index == 1 )
-						{
-							unicode_character[ unicode_character_index - 1 ] = 0x000d;
-
-							number_of_unicode_characters--;
-						}
-					}
-					else if( export_handle->text_newline_conversion == UNACOMMON_NEWLINE_CONVERSION_LF )
-					{
-						if( unicode_character_index == 1 )
-						{
-							unicode_character[ unicode_character_index - 1 ] = 0x000a;
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to convert newlines.",
+					 function );
 
-							number_of_unicode_characters--;
-						}
-					}
+					goto on_error;
 				}
-				/* Determine if character is a carriage return (CR)
+				/* A carriage return at the end of the input is not followed by a line feed
 				 */
-				else if( unicode_character[ unicode_character_index ] == 0x000d )
+				if( ( end_of_input != 0 )
+				 && ( carriage_return_pending != 0 ) )
 				{
-					unicode_character_index++;
+					converted_characters[ number_of_unicode_characters++ ] = 0x000d;
 
-					continue;
+					carriage_return_pending = 0;
 				}
+				unicode_characters = converted_characters;
 			}
-			/* Write all unicode characters
-			 */
-			for( unicode_character_index = 0;
-			     unicode_character_index < number_of_unicode_characters;
-			     unicode_character_index++ )
+			else
+			{
+				unicode_characters           = decoded_characters;
+				number_of_unicode_characters = number_of_decoded_characters;
+			}
+			if( number_of_unicode_characters == 0 )
+			{
+				continue;
+			}
+			if( ( destination_buffer_size - destination_buffer_index ) < ( number_of_unicode_characters * EXPORT_HANDLE_MAXIMUM_ENCODED_CHARACTER_SIZE ) )
 			{
-				switch( export_handle->text_output_format )
+				/* The UTF-7 encoder rewrites the last bytes of the destination buffer
+				 * when it continues a base64 encoded sequence, hence these bytes
+				 * are kept in the destination buffer
+				 */
+				destination_buffer_tail_size = 0;
+
+				if( ( export_handle->text_output_format == UNACOMMON_FORMAT_UTF7 )
+				 && ( destination_utf7_stream_base64_data != 0 ) )
 				{
-					case UNACOMMON_FORMAT_BYTE_STREAM:
-						result = libuna_unicode_character_copy_to_byte_stream(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-							  export_handle->text_byte_stream_codepage,
-						          error );
-						break;
-
-					case UNACOMMON_FORMAT_UTF7:
-						result = libuna_unicode_character_copy_to_utf7_stream(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-							  &destination_utf7_stream_base64_data,
-						          error );
-						break;
-
-					case UNACOMMON_FORMAT_UTF8:
-						result = libuna_unicode_character_copy_to_utf8(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-						          error );
-						break;
-
-					case UNACOMMON_FORMAT_UTF16BE:
-						result = libuna_unicode_character_copy_to_utf16_stream(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-							  LIBUNA_ENDIAN_BIG,
-						          error );
-						break;
-
-					case UNACOMMON_FORMAT_UTF16LE:
-						result = libuna_unicode_character_copy_to_utf16_stream(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-							  LIBUNA_ENDIAN_LITTLE,
-						          error );
-						break;
-
-					case UNACOMMON_FORMAT_UTF32BE:
-						result = libuna_unicode_character_copy_to_utf32_stream(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-							  LIBUNA_ENDIAN_BIG,
-						          error );
-						break;
-
-					case UNACOMMON_FORMAT_UTF32LE:
-						result = libuna_unicode_character_copy_to_utf32_stream(
-							  unicode_character[ unicode_character_index ],
-							  destination_buffer,
-							  destination_buffer_size,
-							  &destination_buffer_index,
-							  LIBUNA_ENDIAN_LITTLE,
-						          error );
-						break;
-
-					default:
-						result = -1;
-						break;
+					destination_buffer_tail_size = EXPORT_HANDLE_UTF7_STREAM_TAIL_SIZE;
 				}
-				if( result != 1 )
+				write_count = export_handle_write_destination(
+				               export_handle,
+				               destination_buffer,
+				               destination_buffer_index - destination_buffer_tail_size,
+				               error );
+
+				if( write_count < 0 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-					 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
-					 "%s: unable to convert output character.",
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write to destination.",
 					 function );
 
 					goto on_error;
 				}
+				if( destination_buffer_tail_size > 0 )
+				{
+					if( memory_copy(
+					     destination_buffer,
+					     &( destination_buffer[ destination_buffer_index - destination_buffer_tail_size ] ),
+					     destination_buffer_tail_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy destination buffer tail.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				destination_buffer_index = destination_buffer_tail_size;
 			}
-			number_of_unicode_characters = 0;
-			unicode_character_index      = 0;
-		}
-		if( destination_buffer_index > 0 )
-		{
-			write_count = libcfile_file_write_buffer(
-			               export_handle->destination_file,
-			               destination_buffer,
-		        	       destination_buffer_index,
-			               error );
-
-			if( write_count < 0 )
+			if( export_handle_encode_unicode_characters(
+			     export_handle,
+			     unicode_characters,
+			     number_of_unicode_characters,
+			     destination_buffer,
+			     destination_buffer_size,
+			     &destination_buffer_index,
+			     &destination_utf7_stream_base64_data,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write to destination.",
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to convert output characters.",
 				 function );
 
 				goto on_error;
 			}
-			destination_buffer_index = 0;
 		}
-		/* Realign the remaining bytes to the start of the source buffer
-		 */
-		realignment_iterator = source_buffer_index;
-		source_buffer_index  = 0;
+		while( ( end_of_input == 0 )
+		    && ( source_buffer_index < (size_t) read_count ) );
 
-		for( ;
-		     read_count > 0;
-		     read_count-- )
-		{
-			source_buffer[ source_buffer_index++ ] = source_buffer[ realignment_iterator++ ];
-		}
 		if( process_status_update_unknown_total(
 		     process_status,
 		     export_count,
@@ -2215,6 +4963,40 @@ int export_handle_export_text_encoded_input(
 			goto on_error;
 		}
 	}
+	if( destination_buffer_index > 0 )
+	{
+		write_count = export_handle_write_destination(
+		               export_handle,
+		               destination_buffer,
+	        	       destination_buffer_index,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination.",
+			 function );
+
+			goto on_error;
+		}
+		destination_buffer_index = 0;
+	}
+	if( export_handle_flush_destination(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush destination.",
+		 function );
+
+		goto on_error;
+	}
 	if( process_status_stop(
 	     process_status,
 	     (size64_t) export_count,
@@ -2230,10 +5012,38 @@ int export_handle_export_text_encoded_input(
 
 		goto on_error;
 	}
+	if( libuna_stream_decoder_free(
+	     &stream_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( converted_characters != NULL )
+	{
+		memory_free(
+		 converted_characters );
+
+		converted_characters = NULL;
+	}
 	memory_free(
-	 source_buffer );
+	 decoded_characters );
+
+	decoded_characters = NULL;
+
+	if( source_buffer != NULL )
+	{
+		memory_free(
+		 source_buffer );
 
-	source_buffer = NULL;
+		source_buffer = NULL;
+	}
 
 	memory_free(
 	 destination_buffer );
@@ -2251,6 +5061,22 @@ on_error:
 		 PROCESS_STATUS_FAILED,
 		 NULL );
 	}
+	if( stream_decoder != NULL )
+	{
+		libuna_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	if( converted_characters != NULL )
+	{
+		memory_free(
+		 converted_characters );
+	}
+	if( decoded_characters != NULL )
+	{
+		memory_free(
+		 decoded_characters );
+	}
 	if( destination_buffer != NULL )
 	{
 		memory_free(
@@ -2441,6 +5267,11 @@ int export_handle_print_parameters(
 		fprintf(
 		 export_handle->notify_stream,
 		 "\n" );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tnumber of threads:\t%d\n",
+		 export_handle->number_of_threads );
 	}
 	fprintf(
 	 export_handle->notify_stream,
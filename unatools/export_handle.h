@@ -25,15 +25,50 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
 #include "process_status.h"
 #include "unatools_libcerror.h"
 #include "unatools_libcfile.h"
 #include "unatools_libuna.h"
+#include "uring_handle.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The source can only be memory mapped using a narrow system character filename
+ */
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_OPEN ) && defined( HAVE_FSTAT ) && defined( HAVE_CLOSE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define EXPORT_HANDLE_HAVE_SOURCE_MAPPING	1
+#endif
+
+/* The source is split into chunks that are converted in parallel,
+ * which requires the source to be memory mapped
+ */
+#if defined( HAVE_PTHREAD ) && defined( HAVE_PTHREAD_H ) && defined( EXPORT_HANDLE_HAVE_SOURCE_MAPPING )
+#define EXPORT_HANDLE_HAVE_MULTI_THREADING	1
+#endif
+
+/* The base encoded input is read, converted and written by separate threads
+ */
+#if defined( HAVE_PTHREAD ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define EXPORT_HANDLE_HAVE_PIPELINE		1
+#endif
+
+/* The source and destination can only be read and written using io_uring
+ * with a narrow system character filename
+ */
+#if defined( URING_HANDLE_HAVE_IO_URING ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define EXPORT_HANDLE_HAVE_IO_URING		1
+#endif
+
+/* The number of buffers in each ring of the pipeline
+ */
+#define EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS	4
+
 enum EXPORT_HANDLE_MODE
 {
 	EXPORT_HANDLE_MODE_BASE_ENCODING	= (uint8_t) 'b',
@@ -72,6 +107,29 @@ struct export_handle
 	 */
 	libcfile_file_t *destination_file;
 
+	/* The source mapping, which is only used for regular files
+	 */
+	uint8_t *source_mapping;
+
+	/* The source mapping size
+	 */
+	size_t source_mapping_size;
+
+	/* The source mapping offset
+	 */
+	size_t source_mapping_offset;
+
+	/* Value to indicate the source and destination should be read
+	 * and written using io_uring if available
+	 */
+	uint8_t use_io_uring;
+
+#if defined( EXPORT_HANDLE_HAVE_IO_URING )
+	/* The io_uring handle, which is only set when io_uring was requested
+	 */
+	uring_handle_t *uring_handle;
+#endif
+
 	/* Values for base encoding export
 	 */
 
@@ -106,6 +164,10 @@ struct export_handle
 	 */
 	int text_byte_stream_codepage;
 
+	/* The number of threads used to convert the text
+	 */
+	int number_of_threads;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -115,6 +177,195 @@ struct export_handle
 	int abort;
 };
 
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+
+enum EXPORT_HANDLE_CHUNK_STATES
+{
+	EXPORT_HANDLE_CHUNK_STATE_EMPTY,
+	EXPORT_HANDLE_CHUNK_STATE_CONVERTING,
+	EXPORT_HANDLE_CHUNK_STATE_CONVERTED,
+	EXPORT_HANDLE_CHUNK_STATE_FAILED
+};
+
+typedef struct export_handle_text_chunk export_handle_text_chunk_t;
+
+struct export_handle_text_chunk
+{
+	/* The source data
+	 */
+	const uint8_t *source_data;
+
+	/* The source data size
+	 */
+	size_t source_data_size;
+
+	/* The destination buffer
+	 */
+	uint8_t *destination_buffer;
+
+	/* The destination buffer size
+	 */
+	size_t destination_buffer_size;
+
+	/* The number of bytes in the destination buffer
+	 */
+	size_t destination_buffer_index;
+
+	/* The state
+	 */
+	int state;
+
+	/* The error that occurred while converting the chunk
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct export_handle_text_conversion export_handle_text_conversion_t;
+
+struct export_handle_text_conversion
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The stream format
+	 */
+	int stream_format;
+
+	/* The source data
+	 */
+	const uint8_t *source_data;
+
+	/* The source data size
+	 */
+	size_t source_data_size;
+
+	/* The offset of the source data that has not yet been assigned to a chunk
+	 */
+	size_t source_data_offset;
+
+	/* The chunks, which are used as a ring buffer
+	 */
+	export_handle_text_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of the next chunk that is assigned to a thread
+	 */
+	uint64_t next_chunk_number;
+
+	/* Value to indicate if the conversion was aborted
+	 */
+	int abort;
+
+	/* The error that caused the conversion to be aborted
+	 */
+	libcerror_error_t *error;
+
+	/* The mutex that protects the values above and the chunk states
+	 */
+	pthread_mutex_t mutex;
+
+	/* The condition that is signalled when a chunk changes state
+	 */
+	pthread_cond_t chunk_state_changed;
+};
+
+#endif /* defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) */
+
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+
+typedef struct export_handle_pipeline_buffer export_handle_pipeline_buffer_t;
+
+struct export_handle_pipeline_buffer
+{
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The data, which is either the buffer or part of the source mapping
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct export_handle_pipeline_ring export_handle_pipeline_ring_t;
+
+struct export_handle_pipeline_ring
+{
+	/* The buffers
+	 */
+	export_handle_pipeline_buffer_t buffers[ EXPORT_HANDLE_PIPELINE_NUMBER_OF_BUFFERS ];
+
+	/* The index of the next buffer to fill
+	 */
+	int fill_index;
+
+	/* The index of the next buffer to consume
+	 */
+	int consume_index;
+
+	/* The number of filled buffers
+	 */
+	int number_of_filled_buffers;
+};
+
+typedef struct export_handle_pipeline export_handle_pipeline_t;
+
+struct export_handle_pipeline
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The ring of buffers that are read from the source
+	 */
+	export_handle_pipeline_ring_t read_ring;
+
+	/* The ring of buffers that are written to the destination
+	 */
+	export_handle_pipeline_ring_t write_ring;
+
+	/* Value to indicate all converted data was added to the write ring
+	 */
+	int end_of_output;
+
+	/* Value to indicate if the pipeline was aborted
+	 */
+	int abort;
+
+	/* Value to indicate reading from the source failed
+	 */
+	int read_failed;
+
+	/* Value to indicate writing to the destination failed
+	 */
+	int write_failed;
+
+	/* The error that occurred while reading from the source
+	 */
+	libcerror_error_t *read_error;
+
+	/* The error that occurred while writing to the destination
+	 */
+	libcerror_error_t *write_error;
+
+	/* The mutex that protects the rings and the values above
+	 */
+	pthread_mutex_t mutex;
+
+	/* The condition that is signalled when a ring changes
+	 */
+	pthread_cond_t ring_changed;
+};
+
+#endif /* defined( EXPORT_HANDLE_HAVE_PIPELINE ) */
+
 int export_handle_initialize(
      export_handle_t **export_handle,
      uint8_t mode,
@@ -140,6 +391,31 @@ int export_handle_close(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_map_source(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_unmap_source(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+ssize_t export_handle_read_source(
+         export_handle_t *export_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         const uint8_t **data,
+         libcerror_error_t **error );
+
+ssize_t export_handle_write_destination(
+         export_handle_t *export_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int export_handle_flush_destination(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_set_string(
      export_handle_t *export_handle,
      const system_character_t *string,
@@ -177,16 +453,120 @@ int export_handle_set_byte_stream_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_export_input(
      export_handle_t *export_handle,
      uint8_t print_status_information,
      libcerror_error_t **error );
 
+int export_handle_convert_base_encoded_data(
+     export_handle_t *export_handle,
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     libuna_base_stream_encoder_t *base_stream_encoder,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t *source_data_index,
+     uint8_t *destination_buffer,
+     size_t destination_buffer_size,
+     size_t *write_size,
+     libcerror_error_t **error );
+
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) || defined( EXPORT_HANDLE_HAVE_PIPELINE )
+
+void export_handle_take_thread_error(
+      libcerror_error_t **thread_error,
+      libcerror_error_t **error );
+
+#endif /* defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) || defined( EXPORT_HANDLE_HAVE_PIPELINE ) */
+
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+
+void *export_handle_pipeline_read_thread(
+       void *arguments );
+
+void *export_handle_pipeline_write_thread(
+       void *arguments );
+
+int export_handle_export_base_encoded_input_in_pipeline(
+     export_handle_t *export_handle,
+     process_status_t *process_status,
+     libuna_base_stream_decoder_t *base_stream_decoder,
+     libuna_base_stream_encoder_t *base_stream_encoder,
+     size64_t *export_count,
+     libcerror_error_t **error );
+
+#endif /* defined( EXPORT_HANDLE_HAVE_PIPELINE ) */
+
 int export_handle_export_base_encoded_input(
      export_handle_t *export_handle,
      process_status_t *process_status,
      libcerror_error_t **error );
 
+int export_handle_convert_newlines(
+     export_handle_t *export_handle,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t number_of_unicode_characters,
+     libuna_unicode_character_t *converted_unicode_characters,
+     size_t converted_unicode_characters_size,
+     size_t *number_of_converted_unicode_characters,
+     uint8_t *carriage_return_pending,
+     libcerror_error_t **error );
+
+int export_handle_encode_unicode_characters(
+     export_handle_t *export_handle,
+     const libuna_unicode_character_t *unicode_characters,
+     size_t number_of_unicode_characters,
+     uint8_t *destination_buffer,
+     size_t destination_buffer_size,
+     size_t *destination_buffer_index,
+     uint32_t *utf7_stream_base64_data,
+     libcerror_error_t **error );
+
+int export_handle_is_text_chunk_boundary(
+     export_handle_t *export_handle,
+     int stream_format,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t source_data_offset,
+     libcerror_error_t **error );
+
+int export_handle_determine_text_chunk_size(
+     export_handle_t *export_handle,
+     int stream_format,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t maximum_chunk_size,
+     size_t *chunk_size,
+     libcerror_error_t **error );
+
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+
+int export_handle_convert_text_chunk(
+     export_handle_t *export_handle,
+     int stream_format,
+     export_handle_text_chunk_t *chunk,
+     libuna_unicode_character_t *decoded_characters,
+     libuna_unicode_character_t *converted_characters,
+     libcerror_error_t **error );
+
+void *export_handle_text_conversion_thread(
+       void *arguments );
+
+int export_handle_export_text_encoded_input_in_parallel(
+     export_handle_t *export_handle,
+     process_status_t *process_status,
+     int stream_format,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size64_t *export_count,
+     libcerror_error_t **error );
+
+#endif /* defined( EXPORT_HANDLE_HAVE_MULTI_THREADING ) */
+
 int export_handle_export_text_encoded_input(
      export_handle_t *export_handle,
      process_status_t *process_status,
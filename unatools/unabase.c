@@ -57,8 +57,13 @@ void usage_fprint(
 	fprintf( stream, "Use unabase to de/encode data form/to different base\n"
 	                 "encodings\n\n" );
 
-	fprintf( stream, "Usage: unabase [ -e encoding ] [ -m mode ] [ -hqvV ] source\n"
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+	fprintf( stream, "Usage: unabase [ -e encoding ] [ -m mode ] [ -t number_of_threads ]\n"
+	                 "               [ -hquvV ] source destination\n\n" );
+#else
+	fprintf( stream, "Usage: unabase [ -e encoding ] [ -m mode ] [ -hquvV ] source\n"
 	                 "               destination\n\n" );
+#endif
 
 	fprintf( stream, "\tsource:      the source file\n" );
 	fprintf( stream, "\tdestination: the destination file\n\n" );
@@ -68,6 +73,11 @@ void usage_fprint(
 	fprintf( stream, "\t-m:          encoding mode, options: decode, encode (default)\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
 	fprintf( stream, "\t-q:          quiet shows no status information\n" );
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+	fprintf( stream, "\t-t:          number of threads, options: 1 (default) to 64, more than\n"
+	                 "\t             1 reads and writes in separate threads\n" );
+#endif
+	fprintf( stream, "\t-u:          use io_uring to read and write regular files if available\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr\n" );
 	fprintf( stream, "\t-V:          print version\n" );
 }
@@ -119,16 +129,18 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error                 = NULL;
-	system_character_t *destination_filename = NULL;
-	system_character_t *option_encoding      = NULL;
-	system_character_t *option_encoding_mode = NULL;
-	system_character_t *source_filename      = NULL;
-	char *program                            = "unabase";
-	system_integer_t option                  = 0;
-	uint8_t print_status_information         = 1;
-	int result                               = 0;
-	int verbose                              = 0;
+	libcerror_error_t *error                     = NULL;
+	system_character_t *destination_filename     = NULL;
+	system_character_t *option_encoding          = NULL;
+	system_character_t *option_encoding_mode     = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *source_filename          = NULL;
+	char *program                                = "unabase";
+	system_integer_t option                      = 0;
+	uint8_t print_status_information             = 1;
+	uint8_t use_io_uring                         = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -163,7 +175,11 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "e:hm:qvV" ) ) ) != (system_integer_t) -1 )
+#if defined( EXPORT_HANDLE_HAVE_PIPELINE )
+	                   _SYSTEM_STRING( "e:hm:qt:uvV" ) ) ) != (system_integer_t) -1 )
+#else
+	                   _SYSTEM_STRING( "e:hm:quvV" ) ) ) != (system_integer_t) -1 )
+#endif
 	{
 		switch( option )
 		{
@@ -200,6 +216,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				use_io_uring = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -335,6 +361,30 @@ int main( int argc, char * const argv[] )
 			 "Unsupported encoding mode defaulting to: encode.\n" );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  unabase_export_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	unabase_export_handle->use_io_uring = use_io_uring;
+
 	if( export_handle_print_parameters(
 	     unabase_export_handle,
 	     &error ) != 1 )
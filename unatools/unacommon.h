@@ -28,6 +28,10 @@
 extern "C" {
 #endif
 
+/* The maximum number of threads used to convert the input
+ */
+#define UNACOMMON_MAXIMUM_NUMBER_OF_THREADS	64
+
 enum UNACOMMON_ENCODINGS
 {
 	UNACOMMON_ENCODING_BASE16,
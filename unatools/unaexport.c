@@ -56,8 +56,14 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use unaexport to export text in one encoding to another.\n\n" );
 
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
 	fprintf( stream, "Usage: unaexport [ -c codepage ] [ -i input_format ] [ -n newline_conversion ]\n"
-	                 "                 [ -o output_format ] [ -BhlqvV ] source destination\n\n" );
+	                 "                 [ -o output_format ] [ -t number_of_threads ] [ -BhlquvV ]\n"
+	                 "                 source destination\n\n" );
+#else
+	fprintf( stream, "Usage: unaexport [ -c codepage ] [ -i input_format ] [ -n newline_conversion ]\n"
+	                 "                 [ -o output_format ] [ -BhlquvV ] source destination\n\n" );
+#endif
 
 	fprintf( stream, "\tsource:      the source file\n" );
 	fprintf( stream, "\tdestination: the destination file\n\n" );
@@ -80,6 +86,12 @@ void usage_fprint(
 	fprintf( stream, "\t-o:          output format, options: byte-stream, utf7, utf8 (default),\n"
 	                 "\t             utf16be, utf16le, utf32be or utf32le\n" );
 	fprintf( stream, "\t-q:          quiet shows no status information\n" );
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+	fprintf( stream, "\t-t:          number of threads that convert a source file that is\n"
+	                 "\t             a regular file, options: 1 (default) to 64, UTF-7 input\n"
+	                 "\t             or output requires 1\n" );
+#endif
+	fprintf( stream, "\t-u:          use io_uring to read and write regular files if available\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr\n" );
 	fprintf( stream, "\t-V:          print version\n" );
 }
@@ -136,12 +148,14 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_byte_stream_codepage = NULL;
 	system_character_t *option_input_format         = NULL;
 	system_character_t *option_newline_conversion   = NULL;
+	system_character_t *option_number_of_threads    = NULL;
 	system_character_t *option_output_format        = NULL;
 	system_character_t *source_filename             = NULL;
 	char *program                                   = "unaexport";
 	system_integer_t option                         = 0;
 	uint8_t export_byte_order_mark                  = 1;
 	uint8_t print_status_information                = 1;
+	uint8_t use_io_uring                            = 0;
 	int verbose                                     = 0;
 	int result                                      = 0;
 
@@ -178,7 +192,11 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "Bc:hi:ln:o:qvV" ) ) ) != (system_integer_t) -1 )
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+	                   _SYSTEM_STRING( "Bc:hi:ln:o:qt:uvV" ) ) ) != (system_integer_t) -1 )
+#else
+	                   _SYSTEM_STRING( "Bc:hi:ln:o:quvV" ) ) ) != (system_integer_t) -1 )
+#endif
 	{
 		switch( option )
 		{
@@ -236,6 +254,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				use_io_uring = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -394,6 +422,7 @@ int main( int argc, char * const argv[] )
 		}
 	}
 	unaexport_export_handle->text_export_byte_order_mark = export_byte_order_mark;
+	unaexport_export_handle->use_io_uring                = use_io_uring;
 
 	if( option_byte_stream_codepage != NULL )
 	{
@@ -417,6 +446,43 @@ int main( int argc, char * const argv[] )
 			 "Unsupported byte stream codepage defaulting to: ascii.\n" );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  unaexport_export_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+#if defined( EXPORT_HANDLE_HAVE_MULTI_THREADING )
+	/* The base64 encoded sequences of UTF-7 carry state across characters
+	 * and cannot be split into chunks that are converted in parallel
+	 */
+	if( ( unaexport_export_handle->number_of_threads > 1 )
+	 && ( ( unaexport_export_handle->text_input_format == UNACOMMON_FORMAT_UTF7 )
+	  ||  ( unaexport_export_handle->text_output_format == UNACOMMON_FORMAT_UTF7 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads for UTF-7 input or output.\n" );
+
+		goto on_error;
+	}
+#endif
 	if( export_handle_print_parameters(
 	     unaexport_export_handle,
 	     &error ) != 1 )
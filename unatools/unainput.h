@@ -56,6 +56,11 @@ int unainput_determine_newline_conversion(
      uint8_t *newline_conversion,
      libcerror_error_t **error );
 
+int unainput_determine_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1388 @@
+/*
+ * io_uring handle
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "unatools_libcerror.h"
+#include "uring_handle.h"
+
+#if defined( URING_HANDLE_HAVE_IO_URING )
+
+/* Creates an io_uring handle
+ * Make sure the value uring_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int uring_handle_initialize(
+     uring_handle_t **uring_handle,
+     int queue_depth,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "uring_handle_initialize";
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uring_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth < 1 )
+	 || ( queue_depth > 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size of a read or write is passed to io_uring as a 32-bit value
+	 */
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) INT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*uring_handle = memory_allocate_structure(
+	                 uring_handle_t );
+
+	if( *uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *uring_handle,
+	     0,
+	     sizeof( uring_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring handle.",
+		 function );
+
+		memory_free(
+		 *uring_handle );
+
+		*uring_handle = NULL;
+
+		return( -1 );
+	}
+	( *uring_handle )->queue_depth                 = queue_depth;
+	( *uring_handle )->buffer_size                 = buffer_size;
+	( *uring_handle )->source_file_descriptor      = -1;
+	( *uring_handle )->returned_read_request_index = -1;
+	( *uring_handle )->destination_file_descriptor = -1;
+
+	return( 1 );
+}
+
+/* Frees an io_uring handle
+ * Returns 1 if successful or -1 on error
+ */
+int uring_handle_free(
+     uring_handle_t **uring_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "uring_handle_free";
+	int result            = 1;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uring_handle != NULL )
+	{
+		if( uring_handle_close(
+		     *uring_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close io_uring handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *uring_handle );
+
+		*uring_handle = NULL;
+	}
+	return( result );
+}
+
+/* Sets up the ring and its buffers
+ * Returns 1 if successful, 0 if io_uring is not available or -1 on error
+ */
+int uring_handle_setup_ring(
+     uring_handle_t *uring_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "uring_handle_setup_ring";
+	size_t buffers_size    = 0;
+	int number_of_requests = 0;
+	int request_index      = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->has_ring != 0 )
+	{
+		return( 1 );
+	}
+	number_of_requests = 2 * uring_handle->queue_depth;
+
+	if( uring_handle->buffer_size > ( (size_t) SSIZE_MAX / number_of_requests ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid io_uring handle - buffers size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	buffers_size = uring_handle->buffer_size * number_of_requests;
+
+	uring_handle->buffers_data = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * buffers_size );
+
+	if( uring_handle->buffers_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers data.",
+		 function );
+
+		goto on_error;
+	}
+	uring_handle->buffers_vectors = (struct iovec *) memory_allocate(
+	                                                  sizeof( struct iovec ) * number_of_requests );
+
+	if( uring_handle->buffers_vectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers vectors.",
+		 function );
+
+		goto on_error;
+	}
+	uring_handle->requests = (uring_handle_request_t *) memory_allocate(
+	                                                     sizeof( uring_handle_request_t ) * number_of_requests );
+
+	if( uring_handle->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     uring_handle->requests,
+	     0,
+	     sizeof( uring_handle_request_t ) * number_of_requests ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear requests.",
+		 function );
+
+		goto on_error;
+	}
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		uring_handle->requests[ request_index ].buffer          = &( uring_handle->buffers_data[ request_index * uring_handle->buffer_size ] );
+		uring_handle->requests[ request_index ].buffer_index    = request_index;
+		uring_handle->requests[ request_index ].file_descriptor = -1;
+
+		uring_handle->buffers_vectors[ request_index ].iov_base = uring_handle->requests[ request_index ].buffer;
+		uring_handle->buffers_vectors[ request_index ].iov_len  = uring_handle->buffer_size;
+	}
+	/* The kernel can lack io_uring support or deny its use in which case
+	 * the caller falls back to regular reads and writes
+	 */
+	if( io_uring_queue_init(
+	     (unsigned int) number_of_requests,
+	     &( uring_handle->ring ),
+	     0 ) != 0 )
+	{
+		memory_free(
+		 uring_handle->requests );
+
+		uring_handle->requests = NULL;
+
+		memory_free(
+		 uring_handle->buffers_vectors );
+
+		uring_handle->buffers_vectors = NULL;
+
+		memory_free(
+		 uring_handle->buffers_data );
+
+		uring_handle->buffers_data = NULL;
+
+		return( 0 );
+	}
+	uring_handle->has_ring = 1;
+
+	/* Registering the buffers can fail if they exceed the locked memory limit
+	 * in which case the buffers are passed with every request
+	 */
+	if( io_uring_register_buffers(
+	     &( uring_handle->ring ),
+	     uring_handle->buffers_vectors,
+	     (unsigned int) number_of_requests ) == 0 )
+	{
+		uring_handle->has_registered_buffers = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( uring_handle->requests != NULL )
+	{
+		memory_free(
+		 uring_handle->requests );
+
+		uring_handle->requests = NULL;
+	}
+	if( uring_handle->buffers_vectors != NULL )
+	{
+		memory_free(
+		 uring_handle->buffers_vectors );
+
+		uring_handle->buffers_vectors = NULL;
+	}
+	if( uring_handle->buffers_data != NULL )
+	{
+		memory_free(
+		 uring_handle->buffers_data );
+
+		uring_handle->buffers_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens the source
+ * Only regular files and block devices are read using io_uring since the reads
+ * are submitted ahead at increasing offsets
+ * Returns 1 if successful, 0 if the source cannot be read using io_uring or -1 on error
+ */
+int uring_handle_open_source(
+     uring_handle_t *uring_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	uring_handle_request_t *request = NULL;
+	static char *function           = "uring_handle_open_source";
+	int file_descriptor             = -1;
+	int request_index               = 0;
+	int result                      = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->source_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring handle - source file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	if( !S_ISREG( file_statistics.st_mode )
+	 && !S_ISBLK( file_statistics.st_mode ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	result = uring_handle_setup_ring(
+	          uring_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to set up ring.",
+			 function );
+		}
+		close(
+		 file_descriptor );
+
+		return( result );
+	}
+	uring_handle->source_file_descriptor      = file_descriptor;
+	uring_handle->read_offset                 = 0;
+	uring_handle->read_request_index          = 0;
+	uring_handle->returned_read_request_index = -1;
+	uring_handle->returned_read_data_offset   = 0;
+	uring_handle->end_of_source               = 0;
+
+	/* Prefetch the start of the source with a read for every read request
+	 */
+	for( request_index = 0;
+	     request_index < uring_handle->queue_depth;
+	     request_index++ )
+	{
+		request = &( uring_handle->requests[ request_index ] );
+
+		request->file_descriptor = file_descriptor;
+		request->offset          = uring_handle->read_offset;
+		request->size            = uring_handle->buffer_size;
+		request->processed_size  = 0;
+		request->error_number    = 0;
+
+		if( uring_handle_submit_request(
+		     uring_handle,
+		     request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to submit read request: %d.",
+			 function,
+			 request_index );
+
+			return( -1 );
+		}
+		uring_handle->read_offset += (uint64_t) uring_handle->buffer_size;
+	}
+	return( 1 );
+}
+
+/* Opens the destination
+ * The destination must already have been created, only regular files
+ * are written using io_uring since the writes are submitted at increasing offsets
+ * Returns 1 if successful, 0 if the destination cannot be written using io_uring or -1 on error
+ */
+int uring_handle_open_destination(
+     uring_handle_t *uring_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "uring_handle_open_destination";
+	int file_descriptor   = -1;
+	int request_index     = 0;
+	int result            = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->destination_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring handle - destination file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	file_descriptor = open(
+	                   filename,
+	                   O_WRONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	if( !S_ISREG( file_statistics.st_mode ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	result = uring_handle_setup_ring(
+	          uring_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to set up ring.",
+			 function );
+		}
+		close(
+		 file_descriptor );
+
+		return( result );
+	}
+	uring_handle->destination_file_descriptor = file_descriptor;
+	uring_handle->write_offset                = 0;
+	uring_handle->write_request_index         = 0;
+
+	for( request_index = uring_handle->queue_depth;
+	     request_index < ( 2 * uring_handle->queue_depth );
+	     request_index++ )
+	{
+		uring_handle->requests[ request_index ].file_descriptor = file_descriptor;
+	}
+	return( 1 );
+}
+
+/* Closes the io_uring handle
+ * Requests that are in flight are waited for but their results are ignored,
+ * use uring_handle_flush to determine if all writes succeeded
+ * Returns 0 if successful or -1 on error
+ */
+int uring_handle_close(
+     uring_handle_t *uring_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "uring_handle_close";
+	int request_index     = 0;
+	int result            = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->has_ring != 0 )
+	{
+		/* The kernel can still access the buffers of requests in flight
+		 */
+		for( request_index = 0;
+		     request_index < ( 2 * uring_handle->queue_depth );
+		     request_index++ )
+		{
+			if( uring_handle_wait_for_request(
+			     uring_handle,
+			     &( uring_handle->requests[ request_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to wait for request: %d.",
+				 function,
+				 request_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( uring_handle->has_registered_buffers != 0 )
+		{
+			io_uring_unregister_buffers(
+			 &( uring_handle->ring ) );
+
+			uring_handle->has_registered_buffers = 0;
+		}
+		io_uring_queue_exit(
+		 &( uring_handle->ring ) );
+
+		uring_handle->has_ring = 0;
+
+		memory_free(
+		 uring_handle->requests );
+
+		uring_handle->requests = NULL;
+
+		memory_free(
+		 uring_handle->buffers_vectors );
+
+		uring_handle->buffers_vectors = NULL;
+
+		memory_free(
+		 uring_handle->buffers_data );
+
+		uring_handle->buffers_data = NULL;
+	}
+	if( uring_handle->source_file_descriptor != -1 )
+	{
+		if( close(
+		     uring_handle->source_file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source file descriptor.",
+			 function );
+
+			result = -1;
+		}
+		uring_handle->source_file_descriptor = -1;
+	}
+	if( uring_handle->destination_file_descriptor != -1 )
+	{
+		if( close(
+		     uring_handle->destination_file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close destination file descriptor.",
+			 function );
+
+			result = -1;
+		}
+		uring_handle->destination_file_descriptor = -1;
+	}
+	return( result );
+}
+
+/* Submits the remainder of a request
+ * Returns 1 if successful or -1 on error
+ */
+int uring_handle_submit_request(
+     uring_handle_t *uring_handle,
+     uring_handle_request_t *request,
+     libcerror_error_t **error )
+{
+	struct io_uring_sqe *submission_queue_entry = NULL;
+	static char *function                       = "uring_handle_submit_request";
+	uint8_t *buffer                             = NULL;
+	uint64_t offset                             = 0;
+	size_t size                                 = 0;
+	int result                                  = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	if( request->processed_size >= request->size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid request - processed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	submission_queue_entry = io_uring_get_sqe(
+	                          &( uring_handle->ring ) );
+
+	if( submission_queue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve submission queue entry.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( request->buffer[ request->processed_size ] );
+	offset = request->offset + (uint64_t) request->processed_size;
+	size   = request->size - request->processed_size;
+
+	if( request->buffer_index < uring_handle->queue_depth )
+	{
+		if( uring_handle->has_registered_buffers != 0 )
+		{
+			io_uring_prep_read_fixed(
+			 submission_queue_entry,
+			 request->file_descriptor,
+			 buffer,
+			 (unsigned int) size,
+			 (uint64_t) offset,
+			 request->buffer_index );
+		}
+		else
+		{
+			io_uring_prep_read(
+			 submission_queue_entry,
+			 request->file_descriptor,
+			 buffer,
+			 (unsigned int) size,
+			 (uint64_t) offset );
+		}
+	}
+	else
+	{
+		if( uring_handle->has_registered_buffers != 0 )
+		{
+			io_uring_prep_write_fixed(
+			 submission_queue_entry,
+			 request->file_descriptor,
+			 buffer,
+			 (unsigned int) size,
+			 (uint64_t) offset,
+			 request->buffer_index );
+		}
+		else
+		{
+			io_uring_prep_write(
+			 submission_queue_entry,
+			 request->file_descriptor,
+			 buffer,
+			 (unsigned int) size,
+			 (uint64_t) offset );
+		}
+	}
+	io_uring_sqe_set_data(
+	 submission_queue_entry,
+	 (void *) request );
+
+	request->is_pending = 1;
+
+	result = io_uring_submit(
+	          &( uring_handle->ring ) );
+
+	if( result < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to submit request with error: %d.",
+		 function,
+		 -result );
+
+		request->is_pending = 0;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Completes a request with the result of a completion queue entry
+ * A request that was partially read or written is submitted again for the remainder
+ * Returns 1 if successful or -1 on error
+ */
+int uring_handle_complete_request(
+     uring_handle_t *uring_handle,
+     uring_handle_request_t *request,
+     int result,
+     libcerror_error_t **error )
+{
+	static char *function = "uring_handle_complete_request";
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	request->is_pending = 0;
+
+	if( result < 0 )
+	{
+		request->error_number = -result;
+
+		return( 1 );
+	}
+	if( result == 0 )
+	{
+		/* A read of 0 bytes indicates the end of the source
+		 * but a write of 0 bytes cannot make progress
+		 */
+		if( request->buffer_index >= uring_handle->queue_depth )
+		{
+			request->error_number = EIO;
+		}
+		return( 1 );
+	}
+	if( (size_t) result > ( request->size - request->processed_size ) )
+	{
+		request->error_number = EIO;
+
+		return( 1 );
+	}
+	request->processed_size += (size_t) result;
+
+	if( request->processed_size < request->size )
+	{
+		if( uring_handle_submit_request(
+		     uring_handle,
+		     request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to submit remainder of request.",
+			 function );
+
+			request->is_pending = 0;
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Waits for a request to complete
+ * Completions of other requests that arrive in the meantime are processed as well
+ * Returns 1 if successful or -1 on error
+ */
+int uring_handle_wait_for_request(
+     uring_handle_t *uring_handle,
+     uring_handle_request_t *request,
+     libcerror_error_t **error )
+{
+	struct io_uring_cqe *completion_queue_entry = NULL;
+	uring_handle_request_t *completed_request   = NULL;
+	static char *function                       = "uring_handle_wait_for_request";
+	int completion_result                       = 0;
+	int result                                  = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	while( request->is_pending != 0 )
+	{
+		result = io_uring_wait_cqe(
+		          &( uring_handle->ring ),
+		          &completion_queue_entry );
+
+		if( result == -EINTR )
+		{
+			continue;
+		}
+		if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to wait for completion queue entry with error: %d.",
+			 function,
+			 -result );
+
+			return( -1 );
+		}
+		completed_request = (uring_handle_request_t *) io_uring_cqe_get_data(
+		                                                completion_queue_entry );
+		completion_result = completion_queue_entry->res;
+
+		io_uring_cqe_seen(
+		 &( uring_handle->ring ),
+		 completion_queue_entry );
+
+		if( uring_handle_complete_request(
+		     uring_handle,
+		     completed_request,
+		     completion_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to complete request.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the next buffer from the source
+ * The data is set to the buffer of a read request, which remains valid until
+ * the next read, after the data of the read request has been returned the read
+ * request is submitted again to prefetch the source further ahead
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t uring_handle_read_buffer(
+         uring_handle_t *uring_handle,
+         size_t maximum_size,
+         const uint8_t **data,
+         libcerror_error_t **error )
+{
+	uring_handle_request_t *request = NULL;
+	static char *function           = "uring_handle_read_buffer";
+	size_t read_size                = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->source_file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid io_uring handle - missing source file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_size == 0 )
+	 || ( maximum_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->end_of_source != 0 )
+	{
+		return( 0 );
+	}
+	if( uring_handle->returned_read_request_index != -1 )
+	{
+		request = &( uring_handle->requests[ uring_handle->returned_read_request_index ] );
+
+		if( uring_handle->returned_read_data_offset < request->processed_size )
+		{
+			read_size = request->processed_size - uring_handle->returned_read_data_offset;
+
+			if( read_size > maximum_size )
+			{
+				read_size = maximum_size;
+			}
+			*data = &( request->buffer[ uring_handle->returned_read_data_offset ] );
+
+			uring_handle->returned_read_data_offset += read_size;
+
+			return( (ssize_t) read_size );
+		}
+		request->offset         = uring_handle->read_offset;
+		request->size           = uring_handle->buffer_size;
+		request->processed_size = 0;
+		request->error_number   = 0;
+
+		uring_handle->returned_read_request_index = -1;
+
+		if( uring_handle_submit_request(
+		     uring_handle,
+		     request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to submit read request.",
+			 function );
+
+			return( -1 );
+		}
+		uring_handle->read_offset += (uint64_t) uring_handle->buffer_size;
+	}
+	request = &( uring_handle->requests[ uring_handle->read_request_index ] );
+
+	if( uring_handle_wait_for_request(
+	     uring_handle,
+	     request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to wait for read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( request->error_number != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from source at offset: %" PRIu64 " with error: %d.",
+		 function,
+		 request->offset,
+		 request->error_number );
+
+		return( -1 );
+	}
+	/* The reads that were submitted beyond the end of the source
+	 * are not returned
+	 */
+	if( request->processed_size == 0 )
+	{
+		uring_handle->end_of_source = 1;
+
+		return( 0 );
+	}
+	read_size = request->processed_size;
+
+	if( read_size > maximum_size )
+	{
+		read_size = maximum_size;
+	}
+	*data = request->buffer;
+
+	uring_handle->returned_read_request_index = uring_handle->read_request_index;
+	uring_handle->returned_read_data_offset   = read_size;
+	uring_handle->read_request_index          = ( uring_handle->read_request_index + 1 ) % uring_handle->queue_depth;
+
+	return( (ssize_t) read_size );
+}
+
+/* Writes a buffer to the destination
+ * The buffer is copied into the buffers of write requests which are written
+ * in the background, a write request is waited for before it is reused
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t uring_handle_write_buffer(
+         uring_handle_t *uring_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	uring_handle_request_t *request = NULL;
+	static char *function           = "uring_handle_write_buffer";
+	size_t buffer_offset            = 0;
+	size_t write_size               = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->destination_file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid io_uring handle - missing destination file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		request = &( uring_handle->requests[ uring_handle->queue_depth + uring_handle->write_request_index ] );
+
+		if( uring_handle_wait_for_request(
+		     uring_handle,
+		     request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to wait for write request.",
+			 function );
+
+			return( -1 );
+		}
+		if( request->error_number != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination at offset: %" PRIu64 " with error: %d.",
+			 function,
+			 request->offset,
+			 request->error_number );
+
+			return( -1 );
+		}
+		write_size = buffer_size - buffer_offset;
+
+		if( write_size > uring_handle->buffer_size )
+		{
+			write_size = uring_handle->buffer_size;
+		}
+		if( memory_copy(
+		     request->buffer,
+		     &( buffer[ buffer_offset ] ),
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer.",
+			 function );
+
+			return( -1 );
+		}
+		request->offset         = uring_handle->write_offset;
+		request->size           = write_size;
+		request->processed_size = 0;
+
+		if( uring_handle_submit_request(
+		     uring_handle,
+		     request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to submit write request.",
+			 function );
+
+			return( -1 );
+		}
+		uring_handle->write_offset       += (uint64_t) write_size;
+		uring_handle->write_request_index = ( uring_handle->write_request_index + 1 ) % uring_handle->queue_depth;
+
+		buffer_offset += write_size;
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Waits for all write requests to complete
+ * Returns 1 if successful or -1 on error
+ */
+int uring_handle_flush(
+     uring_handle_t *uring_handle,
+     libcerror_error_t **error )
+{
+	uring_handle_request_t *request = NULL;
+	static char *function           = "uring_handle_flush";
+	int request_index               = 0;
+
+	if( uring_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uring_handle->destination_file_descriptor == -1 )
+	{
+		return( 1 );
+	}
+	for( request_index = uring_handle->queue_depth;
+	     request_index < ( 2 * uring_handle->queue_depth );
+	     request_index++ )
+	{
+		request = &( uring_handle->requests[ request_index ] );
+
+		if( uring_handle_wait_for_request(
+		     uring_handle,
+		     request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to wait for write request: %d.",
+			 function,
+			 request_index );
+
+			return( -1 );
+		}
+		if( request->error_number != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination at offset: %" PRIu64 " with error: %d.",
+			 function,
+			 request->offset,
+			 request->error_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( URING_HANDLE_HAVE_IO_URING ) */
+
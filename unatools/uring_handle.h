@@ -0,0 +1,225 @@
+/*
+ * io_uring handle
+ *
+ * Copyright (C) 2008-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _URING_HANDLE_H )
+#define _URING_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LIBURING_H )
+#include <liburing.h>
+#endif
+
+#include "unatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The source and destination are read and written using io_uring
+ */
+#if defined( HAVE_LIBURING ) && defined( HAVE_LIBURING_H )
+#define URING_HANDLE_HAVE_IO_URING		1
+#endif
+
+#if defined( URING_HANDLE_HAVE_IO_URING )
+
+typedef struct uring_handle_request uring_handle_request_t;
+
+struct uring_handle_request
+{
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The index of the buffer in the registered buffers
+	 */
+	int buffer_index;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The offset
+	 */
+	uint64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The number of bytes read or written
+	 */
+	size_t processed_size;
+
+	/* Value to indicate the request was submitted and is not completed
+	 */
+	int is_pending;
+
+	/* The error number of a failed request
+	 */
+	int error_number;
+};
+
+typedef struct uring_handle uring_handle_t;
+
+struct uring_handle
+{
+	/* The ring
+	 */
+	struct io_uring ring;
+
+	/* Value to indicate the ring was set up
+	 */
+	int has_ring;
+
+	/* Value to indicate the buffers were registered with the ring
+	 */
+	int has_registered_buffers;
+
+	/* The queue depth, which is the number of reads and the number of writes
+	 * that can be in flight
+	 */
+	int queue_depth;
+
+	/* The size of the buffer of a request
+	 */
+	size_t buffer_size;
+
+	/* The buffers data
+	 */
+	uint8_t *buffers_data;
+
+	/* The I/O vectors of the buffers
+	 */
+	struct iovec *buffers_vectors;
+
+	/* The requests, the read requests followed by the write requests
+	 */
+	uring_handle_request_t *requests;
+
+	/* The source file descriptor
+	 */
+	int source_file_descriptor;
+
+	/* The offset of the next read that is submitted
+	 */
+	uint64_t read_offset;
+
+	/* The index of the next read request that is returned
+	 */
+	int read_request_index;
+
+	/* The index of the last read request that was returned or -1
+	 */
+	int returned_read_request_index;
+
+	/* The offset of the data in the last read request that was returned
+	 * that has not been returned yet
+	 */
+	size_t returned_read_data_offset;
+
+	/* Value to indicate the end of the source was read
+	 */
+	int end_of_source;
+
+	/* The destination file descriptor
+	 */
+	int destination_file_descriptor;
+
+	/* The offset of the next write that is submitted
+	 */
+	uint64_t write_offset;
+
+	/* The index of the next write request
+	 */
+	int write_request_index;
+};
+
+int uring_handle_initialize(
+     uring_handle_t **uring_handle,
+     int queue_depth,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int uring_handle_free(
+     uring_handle_t **uring_handle,
+     libcerror_error_t **error );
+
+int uring_handle_setup_ring(
+     uring_handle_t *uring_handle,
+     libcerror_error_t **error );
+
+int uring_handle_open_source(
+     uring_handle_t *uring_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int uring_handle_open_destination(
+     uring_handle_t *uring_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int uring_handle_close(
+     uring_handle_t *uring_handle,
+     libcerror_error_t **error );
+
+int uring_handle_submit_request(
+     uring_handle_t *uring_handle,
+     uring_handle_request_t *request,
+     libcerror_error_t **error );
+
+int uring_handle_complete_request(
+     uring_handle_t *uring_handle,
+     uring_handle_request_t *request,
+     int result,
+     libcerror_error_t **error );
+
+int uring_handle_wait_for_request(
+     uring_handle_t *uring_handle,
+     uring_handle_request_t *request,
+     libcerror_error_t **error );
+
+ssize_t uring_handle_read_buffer(
+         uring_handle_t *uring_handle,
+         size_t maximum_size,
+         const uint8_t **data,
+         libcerror_error_t **error );
+
+ssize_t uring_handle_write_buffer(
+         uring_handle_t *uring_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int uring_handle_flush(
+     uring_handle_t *uring_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( URING_HANDLE_HAVE_IO_URING ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _URING_HANDLE_H ) */
+